@@ -38,6 +38,7 @@
 
 #include <rtems.h>
 #include <rtems/chain.h>
+#include <rtems/counter.h>
 #include <rtems/score/assert.h>
 
 #include <bsp/irq-generic.h>
@@ -89,6 +90,7 @@ static void bsp_interrupt_server_trigger(void *arg)
   rtems_interrupt_lock_acquire(&s->lock, &lock_context);
 
   if (rtems_chain_is_node_off_chain(&e->node)) {
+    e->submitted = rtems_counter_read();
     rtems_chain_append_unprotected(&s->entries, &e->node);
   } else {
     ++s->errors;
@@ -147,6 +149,7 @@ typedef struct {
   void *arg;
   rtems_id task;
   rtems_status_code sc;
+  bool balanced;
 } bsp_interrupt_server_helper_data;
 
 static void bsp_interrupt_server_install_helper(void *arg)
@@ -176,6 +179,7 @@ static void bsp_interrupt_server_install_helper(void *arg)
       e->server = hd->server;
       e->vector = hd->vector;
       e->actions = a;
+      e->balanced = hd->balanced;
 
       sc = rtems_interrupt_handler_install(
         hd->vector,
@@ -184,7 +188,9 @@ static void bsp_interrupt_server_install_helper(void *arg)
         bsp_interrupt_server_trigger,
         e
       );
-      if (sc != RTEMS_SUCCESSFUL) {
+      if (sc == RTEMS_SUCCESSFUL) {
+        ++hd->server->entry_count;
+      } else {
         free(e);
       }
     } else {
@@ -266,6 +272,7 @@ static void bsp_interrupt_server_remove_helper(void *arg)
       free(c);
 
       if (remove_last) {
+        --e->server->entry_count;
         free(e);
       }
 
@@ -283,6 +290,27 @@ static void bsp_interrupt_server_remove_helper(void *arg)
   rtems_event_transient_send(hd->task);
 }
 
+static rtems_status_code bsp_interrupt_server_call_helper_with_data(
+  bsp_interrupt_server_helper_data *hd,
+  void (*helper)(void *)
+)
+{
+  rtems_interrupt_server_action a = {
+    .handler = helper,
+    .arg = hd
+  };
+  rtems_interrupt_server_entry e = {
+    .server = hd->server,
+    .vector = BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR,
+    .actions = &a
+  };
+
+  bsp_interrupt_server_trigger(&e);
+  rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+
+  return hd->sc;
+}
+
 static rtems_status_code bsp_interrupt_server_call_helper(
   rtems_interrupt_server_control *s,
   rtems_vector_number vector,
@@ -300,20 +328,8 @@ static rtems_status_code bsp_interrupt_server_call_helper(
     .arg = arg,
     .task = rtems_task_self()
   };
-  rtems_interrupt_server_action a = {
-    .handler = helper,
-    .arg = &hd
-  };
-  rtems_interrupt_server_entry e = {
-    .server = s,
-    .vector = BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR,
-    .actions = &a
-  };
-
-  bsp_interrupt_server_trigger(&e);
-  rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
 
-  return hd.sc;
+  return bsp_interrupt_server_call_helper_with_data(&hd, helper);
 }
 
 static rtems_interrupt_server_entry *bsp_interrupt_server_get_entry(
@@ -338,6 +354,265 @@ static rtems_interrupt_server_entry *bsp_interrupt_server_get_entry(
   return e;
 }
 
+static void bsp_interrupt_server_account(
+  rtems_interrupt_server_control *s,
+  rtems_interrupt_server_entry *e,
+  rtems_counter_ticks submitted,
+  rtems_counter_ticks begin,
+  rtems_counter_ticks end
+)
+{
+  rtems_interrupt_lock_context lock_context;
+  rtems_counter_ticks latency;
+  rtems_counter_ticks service_time;
+
+  latency = rtems_counter_difference(begin, submitted);
+  service_time = rtems_counter_difference(end, begin);
+
+  /*
+   * An interrupt vector entry is only processed by the interrupt server
+   * referenced by the entry.  Moving the entry to another server is carried
+   * out in the context of the source server.  The lock is required since the
+   * 64-bit counters are read by other tasks.
+   */
+  rtems_interrupt_lock_acquire(&s->lock, &lock_context);
+
+  ++e->count;
+  e->total_latency += latency;
+  e->total_service_time += service_time;
+  s->service_time += service_time;
+
+  if (latency > e->max_latency) {
+    e->max_latency = latency;
+  }
+
+  if (service_time > e->max_service_time) {
+    e->max_service_time = service_time;
+  }
+
+  rtems_interrupt_lock_release(&s->lock, &lock_context);
+}
+
+static uint64_t bsp_interrupt_server_get_service_time(
+  rtems_interrupt_server_control *s
+)
+{
+  rtems_interrupt_lock_context lock_context;
+  uint64_t service_time;
+
+  rtems_interrupt_lock_acquire(&s->lock, &lock_context);
+  service_time = s->service_time;
+  rtems_interrupt_lock_release(&s->lock, &lock_context);
+
+  return service_time;
+}
+
+static uint64_t bsp_interrupt_server_get_entry_service_time(
+  rtems_interrupt_server_entry *e
+)
+{
+  rtems_interrupt_lock_context lock_context;
+  uint64_t service_time;
+
+  rtems_interrupt_lock_acquire(&e->server->lock, &lock_context);
+  service_time = e->total_service_time;
+  rtems_interrupt_lock_release(&e->server->lock, &lock_context);
+
+  return service_time;
+}
+
+static void bsp_interrupt_server_move_entry(
+  rtems_interrupt_server_entry *e,
+  rtems_interrupt_server_control *dst
+)
+{
+  rtems_interrupt_lock_context lock_context;
+  rtems_interrupt_server_control *src = e->server;
+  bool pending;
+
+  rtems_interrupt_lock_acquire(&src->lock, &lock_context);
+
+  pending = !rtems_chain_is_node_off_chain(&e->node);
+  if (pending) {
+    rtems_chain_extract_unprotected(&e->node);
+    rtems_chain_set_off_chain(&e->node);
+  }
+
+  rtems_interrupt_lock_release(&src->lock, &lock_context);
+
+  --src->entry_count;
+  ++dst->entry_count;
+  e->server = dst;
+
+  if (pending) {
+    bsp_interrupt_server_trigger(e);
+  }
+}
+
+#define BSP_INTERRUPT_SERVER_BALANCE_INTERVAL_DEFAULT UINT32_MAX
+
+static rtems_interval bsp_interrupt_server_balance_interval =
+  BSP_INTERRUPT_SERVER_BALANCE_INTERVAL_DEFAULT;
+
+void rtems_interrupt_server_set_balance_interval(rtems_interval interval)
+{
+  bsp_interrupt_server_balance_interval = interval;
+}
+
+static rtems_interval bsp_interrupt_server_get_balance_interval(void)
+{
+  rtems_interval interval;
+
+  interval = bsp_interrupt_server_balance_interval;
+
+  if (interval == BSP_INTERRUPT_SERVER_BALANCE_INTERVAL_DEFAULT) {
+    interval = rtems_clock_get_ticks_per_second();
+  }
+
+  return interval;
+}
+
+static bool bsp_interrupt_server_is_balanced(
+  const rtems_interrupt_server_control *s
+)
+{
+  return s->index < rtems_scheduler_get_processor_maximum();
+}
+
+static uint64_t bsp_interrupt_server_get_recent_load(
+  const rtems_interrupt_server_control *s,
+  rtems_interval now,
+  rtems_interval interval
+)
+{
+  /*
+   * A server checks its load only while it processes entries.  A server
+   * which did not check its load for some time was idle.
+   */
+  if (now - s->balance_ticks > 2 * interval) {
+    return 0;
+  }
+
+  return s->recent_load;
+}
+
+/*
+ * Carries out one step of the automatic load balancing.  This function is
+ * executed by the server in its own context, so it may move its own entries
+ * to other servers without a round trip through a helper.
+ */
+static void bsp_interrupt_server_balance_step(
+  rtems_interrupt_server_control *s,
+  rtems_interval now,
+  rtems_interval interval
+)
+{
+  rtems_interrupt_server_control *dst;
+  rtems_interrupt_server_entry *candidate;
+  rtems_chain_node *node;
+  rtems_vector_number vector;
+  uint64_t service_time;
+  uint64_t src_load;
+  uint64_t dst_load;
+  uint64_t best;
+
+  bsp_interrupt_lock();
+
+  service_time = bsp_interrupt_server_get_service_time(s);
+  src_load = service_time - s->balance_service_time;
+  s->balance_service_time = service_time;
+  s->recent_load = src_load;
+  s->balance_ticks = now;
+
+  dst = NULL;
+  dst_load = src_load;
+  node = rtems_chain_first(&bsp_interrupt_server_chain);
+
+  while (node != rtems_chain_tail(&bsp_interrupt_server_chain)) {
+    rtems_interrupt_server_control *other;
+
+    other = RTEMS_CONTAINER_OF(node, rtems_interrupt_server_control, node);
+
+    if (other != s && bsp_interrupt_server_is_balanced(other)) {
+      uint64_t load;
+
+      load = bsp_interrupt_server_get_recent_load(other, now, interval);
+
+      if (load < dst_load) {
+        dst = other;
+        dst_load = load;
+      }
+    }
+
+    node = rtems_chain_next(node);
+  }
+
+  candidate = NULL;
+  best = src_load;
+
+  for (vector = 0; vector < BSP_INTERRUPT_VECTOR_COUNT; ++vector) {
+    rtems_interrupt_server_entry *e;
+    rtems_option trigger_options;
+    uint64_t total;
+    uint64_t load;
+    uint64_t new_max;
+
+    e = bsp_interrupt_server_query_entry(vector, &trigger_options);
+
+    if (e == NULL || e->server != s) {
+      continue;
+    }
+
+    total = bsp_interrupt_server_get_entry_service_time(e);
+    load = total - e->balance_service_time;
+    e->balance_service_time = total;
+
+    if (dst == NULL || !e->balanced || load == 0) {
+      continue;
+    }
+
+    /* Select the entry which minimizes the greater load of both servers */
+    if (dst_load + load < src_load) {
+      new_max = src_load - load;
+
+      if (dst_load + load > new_max) {
+        new_max = dst_load + load;
+      }
+
+      if (new_max < best) {
+        best = new_max;
+        candidate = e;
+      }
+    }
+  }
+
+  if (candidate != NULL) {
+    bsp_interrupt_server_move_entry(candidate, dst);
+  }
+
+  bsp_interrupt_unlock();
+}
+
+static void bsp_interrupt_server_balance_check(
+  rtems_interrupt_server_control *s
+)
+{
+  rtems_interval interval;
+  rtems_interval now;
+
+  interval = bsp_interrupt_server_get_balance_interval();
+
+  if (interval == 0 || !bsp_interrupt_server_is_balanced(s)) {
+    return;
+  }
+
+  now = rtems_clock_get_ticks_since_boot();
+
+  if (now - s->balance_ticks >= interval) {
+    bsp_interrupt_server_balance_step(s, now, interval);
+  }
+}
+
 static void bsp_interrupt_server_task(rtems_task_argument arg)
 {
   rtems_interrupt_server_control *s = (rtems_interrupt_server_control *) arg;
@@ -356,6 +631,8 @@ static void bsp_interrupt_server_task(rtems_task_argument arg)
     while ((e = bsp_interrupt_server_get_entry(s)) != NULL) {
       rtems_interrupt_server_action *action = e->actions;
       rtems_vector_number vector = e->vector;
+      rtems_counter_ticks submitted = e->submitted;
+      rtems_counter_ticks begin = rtems_counter_read();
 
       do {
         rtems_interrupt_server_action *current = action;
@@ -363,13 +640,92 @@ static void bsp_interrupt_server_task(rtems_task_argument arg)
         (*current->handler)(current->arg);
       } while (action != NULL);
 
+      /*
+       * Management entries may be gone once their action returned, so only
+       * interrupt vector entries are accounted.
+       */
       if (bsp_interrupt_is_valid_vector(vector)) {
+        bsp_interrupt_server_account(
+          s,
+          e,
+          submitted,
+          begin,
+          rtems_counter_read()
+        );
         bsp_interrupt_vector_enable(vector);
+        bsp_interrupt_server_balance_check(s);
       }
     }
   }
 }
 
+static uint64_t bsp_interrupt_server_get_load(
+  rtems_interrupt_server_control *s
+)
+{
+  return bsp_interrupt_server_get_service_time(s) - s->balance_service_time;
+}
+
+static rtems_interrupt_server_control *bsp_interrupt_server_select(
+  rtems_vector_number vector,
+  rtems_status_code *sc
+)
+{
+  rtems_interrupt_server_control *selected;
+  rtems_interrupt_server_entry *e;
+  rtems_option trigger_options;
+  rtems_chain_node *node;
+
+  bsp_interrupt_lock();
+
+  /* Shared handlers use the server of the already installed handlers */
+  e = bsp_interrupt_server_query_entry(vector, &trigger_options);
+  if (e != NULL) {
+    selected = e->server;
+    bsp_interrupt_unlock();
+    return selected;
+  }
+
+  selected = NULL;
+  node = rtems_chain_first(&bsp_interrupt_server_chain);
+
+  while (node != rtems_chain_tail(&bsp_interrupt_server_chain)) {
+    rtems_interrupt_server_control *s;
+
+    s = RTEMS_CONTAINER_OF(node, rtems_interrupt_server_control, node);
+
+    if (bsp_interrupt_server_is_balanced(s)) {
+      if (selected == NULL) {
+        selected = s;
+      } else {
+        uint64_t load;
+        uint64_t selected_load;
+
+        load = bsp_interrupt_server_get_load(s);
+        selected_load = bsp_interrupt_server_get_load(selected);
+
+        if (
+          load < selected_load
+            || (load == selected_load
+              && s->entry_count < selected->entry_count)
+        ) {
+          selected = s;
+        }
+      }
+    }
+
+    node = rtems_chain_next(node);
+  }
+
+  bsp_interrupt_unlock();
+
+  if (selected == NULL) {
+    *sc = RTEMS_INVALID_ID;
+  }
+
+  return selected;
+}
+
 rtems_status_code rtems_interrupt_server_handler_install(
   uint32_t server_index,
   rtems_vector_number vector,
@@ -381,18 +737,28 @@ rtems_status_code rtems_interrupt_server_handler_install(
 {
   rtems_status_code sc;
   rtems_interrupt_server_control *s;
+  bsp_interrupt_server_helper_data hd;
+
+  hd.balanced = server_index == RTEMS_INTERRUPT_SERVER_BALANCED;
+
+  if (hd.balanced) {
+    s = bsp_interrupt_server_select(vector, &sc);
+  } else {
+    s = bsp_interrupt_server_get_context(server_index, &sc);
+  }
 
-  s = bsp_interrupt_server_get_context(server_index, &sc);
   if (s == NULL) {
     return sc;
   }
 
-  return bsp_interrupt_server_call_helper(
-    s,
-    vector,
-    options,
-    handler,
-    arg,
+  hd.server = s;
+  hd.vector = vector;
+  hd.options = options;
+  hd.handler = handler;
+  hd.arg = arg;
+  hd.task = rtems_task_self();
+  return bsp_interrupt_server_call_helper_with_data(
+    &hd,
     bsp_interrupt_server_install_helper
   );
 }
@@ -675,6 +1041,10 @@ rtems_status_code rtems_interrupt_server_create(
 
   rtems_interrupt_lock_initialize(&s->lock, "Interrupt Server");
   rtems_chain_initialize_empty(&s->entries);
+  s->errors = 0;
+  s->entry_count = 0;
+  s->service_time = 0;
+  s->balance_service_time = 0;
   s->destroy = config->destroy;
   s->index = rtems_object_id_get_index(s->server)
     + rtems_scheduler_get_processor_maximum();
@@ -884,29 +1254,7 @@ static void bsp_interrupt_server_handler_move_helper(void *arg)
 
   e = bsp_interrupt_server_query_entry(hd->vector, &trigger_options);
   if (e != NULL) {
-    rtems_interrupt_lock_context lock_context;
-    rtems_interrupt_server_control *src = e->server;
-    rtems_interrupt_server_control *dst = hihd->arg;
-    bool pending;
-
-    /* The source server is only used in SMP configurations for the lock */
-    (void) src;
-
-    rtems_interrupt_lock_acquire(&src->lock, &lock_context);
-
-    pending = !rtems_chain_is_node_off_chain(&e->node);
-    if (pending) {
-      rtems_chain_extract_unprotected(&e->node);
-      rtems_chain_set_off_chain(&e->node);
-    }
-
-    rtems_interrupt_lock_release(&src->lock, &lock_context);
-
-    e->server = dst;
-
-    if (pending) {
-      bsp_interrupt_server_trigger(e);
-    }
+    bsp_interrupt_server_move_entry(e, hihd->arg);
   }
 
   bsp_interrupt_unlock();
@@ -1040,3 +1388,225 @@ rtems_status_code rtems_interrupt_server_set_affinity(
 
   return rtems_task_set_affinity(s->server, affinity_size, affinity);
 }
+
+typedef struct {
+  rtems_vector_number vector;
+  uint32_t server_index;
+  uint64_t load;
+} bsp_interrupt_server_balance_item;
+
+static int bsp_interrupt_server_balance_compare(const void *a, const void *b)
+{
+  const bsp_interrupt_server_balance_item *ia = a;
+  const bsp_interrupt_server_balance_item *ib = b;
+
+  if (ia->load > ib->load) {
+    return -1;
+  }
+
+  if (ia->load < ib->load) {
+    return 1;
+  }
+
+  return 0;
+}
+
+static size_t bsp_interrupt_server_balance_collect(
+  bsp_interrupt_server_balance_item *items,
+  uint64_t *loads
+)
+{
+  rtems_chain_node *node;
+  rtems_vector_number vector;
+  size_t item_count;
+
+  item_count = 0;
+
+  bsp_interrupt_lock();
+
+  node = rtems_chain_first(&bsp_interrupt_server_chain);
+
+  while (node != rtems_chain_tail(&bsp_interrupt_server_chain)) {
+    rtems_interrupt_server_control *s;
+
+    s = RTEMS_CONTAINER_OF(node, rtems_interrupt_server_control, node);
+
+    if (bsp_interrupt_server_is_balanced(s)) {
+      loads[s->index] = 0;
+      s->balance_service_time = bsp_interrupt_server_get_service_time(s);
+    }
+
+    node = rtems_chain_next(node);
+  }
+
+  for (vector = 0; vector < BSP_INTERRUPT_VECTOR_COUNT; ++vector) {
+    rtems_interrupt_server_entry *e;
+    rtems_option trigger_options;
+
+    e = bsp_interrupt_server_query_entry(vector, &trigger_options);
+
+    if (e != NULL && bsp_interrupt_server_is_balanced(e->server)) {
+      uint64_t total;
+      uint64_t load;
+
+      total = bsp_interrupt_server_get_entry_service_time(e);
+      load = total - e->balance_service_time;
+      e->balance_service_time = total;
+
+      if (e->balanced) {
+        items[item_count].vector = vector;
+        items[item_count].server_index = e->server->index;
+        items[item_count].load = load;
+        ++item_count;
+      } else {
+        loads[e->server->index] += load;
+      }
+    }
+  }
+
+  bsp_interrupt_unlock();
+
+  return item_count;
+}
+
+rtems_status_code rtems_interrupt_server_balance(void)
+{
+  bsp_interrupt_server_balance_item *items;
+  uint64_t *loads;
+  uint32_t server_count;
+  uint32_t server_index;
+  size_t item_count;
+  size_t i;
+
+  server_count = rtems_scheduler_get_processor_maximum();
+  items = calloc(BSP_INTERRUPT_VECTOR_COUNT, sizeof(*items));
+  loads = malloc(server_count * sizeof(*loads));
+
+  if (items == NULL || loads == NULL) {
+    free(items);
+    free(loads);
+    return RTEMS_NO_MEMORY;
+  }
+
+  /* Servers which do not exist are never selected */
+  for (server_index = 0; server_index < server_count; ++server_index) {
+    loads[server_index] = UINT64_MAX;
+  }
+
+  item_count = bsp_interrupt_server_balance_collect(items, loads);
+
+  /*
+   * Place the entries with the highest load first, each on the server with
+   * the lowest load so far.  Prefer the current server to avoid needless
+   * moves.
+   */
+  qsort(
+    items,
+    item_count,
+    sizeof(*items),
+    bsp_interrupt_server_balance_compare
+  );
+
+  for (i = 0; i < item_count; ++i) {
+    bsp_interrupt_server_balance_item *item;
+    uint32_t destination;
+
+    item = &items[i];
+    destination = item->server_index;
+
+    for (server_index = 0; server_index < server_count; ++server_index) {
+      if (loads[server_index] < loads[destination]) {
+        destination = server_index;
+      }
+    }
+
+    loads[destination] += item->load;
+
+    if (destination != item->server_index) {
+      (void) rtems_interrupt_server_move(
+        item->server_index,
+        item->vector,
+        destination
+      );
+    }
+  }
+
+  free(items);
+  free(loads);
+  return RTEMS_SUCCESSFUL;
+}
+
+static uint64_t bsp_interrupt_server_ticks_to_nanoseconds(uint64_t ticks)
+{
+  uint64_t frequency;
+
+  frequency = rtems_counter_frequency();
+
+  if (frequency == 0) {
+    return 0;
+  }
+
+  return (ticks / frequency) * 1000000000
+    + ((ticks % frequency) * 1000000000) / frequency;
+}
+
+rtems_status_code rtems_interrupt_server_get_statistics(
+  rtems_vector_number vector,
+  rtems_interrupt_server_statistics *statistics
+)
+{
+  rtems_interrupt_server_entry *e;
+  rtems_option trigger_options;
+  rtems_interrupt_lock_context lock_context;
+  rtems_interrupt_server_control *s;
+  unsigned long count;
+  rtems_counter_ticks max_latency;
+  uint64_t total_latency;
+  rtems_counter_ticks max_service_time;
+  uint64_t total_service_time;
+
+  if (statistics == NULL) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if (!bsp_interrupt_is_valid_vector(vector)) {
+    return RTEMS_INVALID_ID;
+  }
+
+  bsp_interrupt_lock();
+
+  e = bsp_interrupt_server_query_entry(vector, &trigger_options);
+  if (e == NULL) {
+    bsp_interrupt_unlock();
+    return RTEMS_UNSATISFIED;
+  }
+
+  /*
+   * The server of the entry can only change while the interrupt support lock
+   * is owned.  The server lock protects the counters.
+   */
+  s = e->server;
+  statistics->server_index = s->index;
+  statistics->balanced = e->balanced;
+
+  rtems_interrupt_lock_acquire(&s->lock, &lock_context);
+  count = e->count;
+  max_latency = e->max_latency;
+  total_latency = e->total_latency;
+  max_service_time = e->max_service_time;
+  total_service_time = e->total_service_time;
+  rtems_interrupt_lock_release(&s->lock, &lock_context);
+
+  bsp_interrupt_unlock();
+
+  statistics->count = count;
+  statistics->max_latency = rtems_counter_ticks_to_nanoseconds(max_latency);
+  statistics->total_latency =
+    bsp_interrupt_server_ticks_to_nanoseconds(total_latency);
+  statistics->max_service_time =
+    rtems_counter_ticks_to_nanoseconds(max_service_time);
+  statistics->total_service_time =
+    bsp_interrupt_server_ticks_to_nanoseconds(total_service_time);
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -34,25 +34,101 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <rtems/printer.h>
 #include <rtems/shell.h>
 
+#include <bsp/irq-generic.h>
 #include <bsp/irq-info.h>
 
+static void bsp_interrupt_shell_report_server(const rtems_printer *printer)
+{
+  rtems_vector_number v;
+
+  rtems_printf(
+    printer,
+    "-------------------------------------------------------------------------------\n"
+    "                         INTERRUPT SERVER STATISTICS\n"
+    "--------+--------+-----+------------+------------+------------+------------\n"
+    " VECTOR | SERVER | BAL | COUNT      | AVG LAT/ns | MAX LAT/ns | AVG SVC/ns \n"
+    "--------+--------+-----+------------+------------+------------+------------\n"
+  );
+
+  for (v = 0; v < BSP_INTERRUPT_VECTOR_COUNT; ++v) {
+    rtems_interrupt_server_statistics stats;
+    rtems_status_code sc;
+    uint64_t avg_latency;
+    uint64_t avg_service_time;
+
+    sc = rtems_interrupt_server_get_statistics(v, &stats);
+    if (sc != RTEMS_SUCCESSFUL) {
+      continue;
+    }
+
+    if (stats.count > 0) {
+      avg_latency = stats.total_latency / stats.count;
+      avg_service_time = stats.total_service_time / stats.count;
+    } else {
+      avg_latency = 0;
+      avg_service_time = 0;
+    }
+
+    rtems_printf(
+      printer,
+      "%7" PRIu32 " | %6" PRIu32 " | %3s | %10lu | %10" PRIu64
+        " | %10" PRIu64 " | %10" PRIu64 "\n",
+      v,
+      stats.server_index,
+      stats.balanced ? "yes" : "no",
+      stats.count,
+      avg_latency,
+      stats.max_latency,
+      avg_service_time
+    );
+  }
+
+  rtems_printf(
+    printer,
+    "--------+--------+-----+------------+------------+------------+------------\n"
+  );
+}
+
 static int bsp_interrupt_shell_main(int argc, char **argv)
 {
   rtems_printer printer;
   rtems_print_printer_printf(&printer);
-  bsp_interrupt_report_with_plugin(&printer);
+
+  if (argc <= 1) {
+    bsp_interrupt_report_with_plugin(&printer);
+  } else if (strcmp(argv[1], "server") == 0) {
+    bsp_interrupt_shell_report_server(&printer);
+  } else if (strcmp(argv[1], "balance") == 0) {
+    rtems_status_code sc;
+
+    sc = rtems_interrupt_server_balance();
+    if (sc != RTEMS_SUCCESSFUL) {
+      printf("error: %s\n", rtems_status_text(sc));
+      return 1;
+    }
+
+    bsp_interrupt_shell_report_server(&printer);
+  } else {
+    printf("error: unknown command: %s\n", argv[1]);
+    return 1;
+  }
 
   return 0;
 }
 
 struct rtems_shell_cmd_tt bsp_interrupt_shell_command = {
   .name     = "irq",
-  .usage   = "Prints interrupt information",
+  .usage   = "irq [server|balance]\n"
+    "  Prints interrupt information\n"
+    "  server: prints interrupt server statistics\n"
+    "  balance: balances the interrupt server load and prints the statistics",
   .topic   = "rtems",
   .command = bsp_interrupt_shell_main,
   .alias   = NULL,
@@ -199,6 +199,7 @@
 #include <errno.h>
 #include <ctype.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <sched.h>
 
 #include <rtems.h>
@@ -267,6 +268,18 @@ typedef struct
   char                *user;       /* user name (0 if not supplied) */
   char                user_buf[256]; /* user name buffer */
   bool                auth;        /* true if user/pass was valid, false if not or not supplied */
+  char                *xfer_buf[2]; /* Cache aligned data transfer buffers */
+  rtems_id            xfer_tid;    /* Transfer helper task id */
+  rtems_binary_semaphore xfer_request; /* Helper has a request to process */
+  rtems_binary_semaphore xfer_done; /* Helper finished the request */
+  ssize_t             (*xfer_write)(int, void const*, size_t); /* NULL to read */
+  int                 xfer_fd;     /* File descriptor of helper request */
+  char                *xfer_data;  /* Buffer of helper request */
+  size_t              xfer_count;  /* Byte count of helper request */
+  ssize_t             xfer_result; /* Result of helper request */
+  uint64_t            bytes_sent;  /* Session file bytes sent */
+  uint64_t            bytes_received; /* Session file bytes received */
+  uint64_t            xfer_time;   /* Session file transfer time in ns */
 } FTPD_SessionInfo_t;
 
 
@@ -305,6 +318,11 @@ static int ftpd_timeout = 0;
  */
 static int ftpd_access = 0;
 
+/*
+ * Size of each data transfer buffer of a session.
+ */
+static size_t ftpd_xfer_size = FTPD_DATASIZE;
+
 static void
 yield(void)
 {
@@ -349,6 +367,209 @@ can_write(void)
   return (ftpd_access & FTPD_NO_WRITE) == 0;
 }
 
+/*
+ * Transfer helper routines
+ *
+ * Each session owns two cache aligned data transfer buffers and a helper
+ * task.  While the session task sends one buffer to the data connection the
+ * helper reads the next chunk of the file into the other buffer, and vice
+ * versa for uploads.
+ *
+ */
+
+/*
+ * xfer_task
+ *
+ * Body of the transfer helper task.  Performs the file read or write
+ * requested by the session task.
+ *
+ * Input parameters:
+ *   arg - pointer to corresponding SessionInfo.
+ *
+ * Output parameters:
+ *   NONE
+ */
+static void
+xfer_task(rtems_task_argument arg)
+{
+  FTPD_SessionInfo_t *const info = (FTPD_SessionInfo_t *)arg;
+
+  while (1)
+  {
+    rtems_binary_semaphore_wait(&info->xfer_request);
+    if (info->xfer_write != NULL)
+      info->xfer_result =
+        info->xfer_write(info->xfer_fd, info->xfer_data, info->xfer_count);
+    else
+      info->xfer_result = read(info->xfer_fd, info->xfer_data, info->xfer_count);
+    rtems_binary_semaphore_post(&info->xfer_done);
+  }
+}
+
+/*
+ * xfer_start
+ *
+ * Hand a file read or write over to the transfer helper task.  The request
+ * must be completed with xfer_wait() before the next one is started.
+ *
+ * Input parameters:
+ *   info  - corresponding SessionInfo structure
+ *   wrt   - write routine or NULL to read from the file
+ *   fd    - file descriptor
+ *   data  - buffer to read into or to write from
+ *   count - number of bytes to read or write
+ *
+ * Output parameters:
+ *   NONE
+ */
+static void
+xfer_start(FTPD_SessionInfo_t *info,
+  ssize_t (*wrt)(int, void const*, size_t), int fd, char *data, size_t count)
+{
+  info->xfer_write = wrt;
+  info->xfer_fd = fd;
+  info->xfer_data = data;
+  info->xfer_count = count;
+  rtems_binary_semaphore_post(&info->xfer_request);
+}
+
+/*
+ * xfer_wait
+ *
+ * Wait for the transfer helper task to complete the current request.
+ *
+ * Input parameters:
+ *   info - corresponding SessionInfo structure
+ *
+ * Output parameters:
+ *   returns the result of the read or write routine.
+ */
+static ssize_t
+xfer_wait(FTPD_SessionInfo_t *info)
+{
+  rtems_binary_semaphore_wait(&info->xfer_done);
+  return info->xfer_result;
+}
+
+/*
+ * xfer_init
+ *
+ * Allocate the data transfer buffers and start the transfer helper task of
+ * a session.
+ *
+ * Input parameters:
+ *   info     - corresponding SessionInfo structure
+ *   priority - priority the helper task is started with
+ *   id       - last character of the helper task name
+ *
+ * Output parameters:
+ *   returns 1 on success, 0 on failure.
+ */
+static int
+xfer_init(FTPD_SessionInfo_t *info, rtems_task_priority priority, char id)
+{
+  rtems_status_code sc;
+
+  rtems_binary_semaphore_init(&info->xfer_request, "FTPD");
+  rtems_binary_semaphore_init(&info->xfer_done, "FTPD");
+
+  info->xfer_buf[0] = rtems_cache_aligned_malloc(ftpd_xfer_size);
+  info->xfer_buf[1] = rtems_cache_aligned_malloc(ftpd_xfer_size);
+  if (NULL == info->xfer_buf[0] || NULL == info->xfer_buf[1])
+    return 0;
+
+  sc = rtems_task_create(rtems_build_name('F', 'T', 'X', id),
+    priority, FTPD_STACKSIZE,
+    RTEMS_PREEMPT | RTEMS_NO_TIMESLICE |
+    RTEMS_NO_ASR | RTEMS_INTERRUPT_LEVEL(0),
+    RTEMS_LOCAL,
+    &info->xfer_tid);
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    info->xfer_tid = 0;
+    return 0;
+  }
+
+  sc = rtems_task_start(info->xfer_tid, xfer_task, (rtems_task_argument)info);
+  return sc == RTEMS_SUCCESSFUL;
+}
+
+/*
+ * xfer_done
+ *
+ * Delete the transfer helper task and free the data transfer buffers of a
+ * session.  Works on partially initialized sessions.
+ *
+ * Input parameters:
+ *   info - corresponding SessionInfo structure
+ *
+ * Output parameters:
+ *   NONE
+ */
+static void
+xfer_done(FTPD_SessionInfo_t *info)
+{
+  if (info->xfer_tid != 0)
+    rtems_task_delete(info->xfer_tid);
+  free(info->xfer_buf[0]);
+  free(info->xfer_buf[1]);
+  rtems_binary_semaphore_destroy(&info->xfer_request);
+  rtems_binary_semaphore_destroy(&info->xfer_done);
+  info->xfer_tid = 0;
+  info->xfer_buf[0] = NULL;
+  info->xfer_buf[1] = NULL;
+}
+
+/*
+ * kib_per_second
+ *
+ * Compute a transfer rate in KiB/s without overflow for large transfers.
+ *
+ * Input parameters:
+ *   bytes - number of bytes transferred
+ *   ns    - transfer time in nanoseconds
+ *
+ * Output parameters:
+ *   returns the transfer rate or 0 if the time is too short to measure.
+ */
+static uint64_t
+kib_per_second(uint64_t bytes, uint64_t ns)
+{
+  uint64_t us = ns / 1000;
+
+  return us != 0 ? (bytes / 1024) * 1000000 / us : 0;
+}
+
+/*
+ * xfer_report
+ *
+ * Account a completed file transfer and log its throughput if the server is
+ * verbose.
+ *
+ * Input parameters:
+ *   info     - corresponding SessionInfo structure
+ *   cmd      - command name
+ *   filename - transferred file
+ *   bytes    - number of file bytes transferred
+ *   start    - uptime in nanoseconds at the start of the transfer
+ *
+ * Output parameters:
+ *   NONE
+ */
+static void
+xfer_report(FTPD_SessionInfo_t *info, char const *cmd, char const *filename,
+  uint64_t bytes, uint64_t start)
+{
+  uint64_t ns = rtems_clock_get_uptime_nanoseconds() - start;
+
+  info->xfer_time += ns;
+
+  if (ftpd_config->verbose)
+    syslog(LOG_INFO,
+      "ftpd: %s %s: %" PRIu64 " bytes in %" PRIu64 " ms (%" PRIu64 " KiB/s)",
+      cmd, filename, bytes, ns / 1000000, kib_per_second(bytes, ns));
+}
+
 /*
  * Task pool management routines
  *
@@ -372,7 +593,10 @@ task_pool_done(int count)
 {
   int i;
   for(i = 0; i < count; ++i)
+  {
     rtems_task_delete(task_pool.info[i].tid);
+    xfer_done(&task_pool.info[i]);
+  }
   free(task_pool.info);
   free(task_pool.queue);
   rtems_mutex_destroy(&task_pool.mutex);
@@ -411,7 +635,7 @@ task_pool_init(int count, rtems_task_priority priority)
   rtems_counting_semaphore_init(&task_pool.sem, "FTPD", (unsigned int) count);
 
   task_pool.info = (FTPD_SessionInfo_t*)
-    malloc(sizeof(FTPD_SessionInfo_t) * count);
+    calloc(count, sizeof(FTPD_SessionInfo_t));
   task_pool.queue = (FTPD_SessionInfo_t**)
     malloc(sizeof(FTPD_SessionInfo_t*) * count);
   if (NULL == task_pool.info || NULL == task_pool.queue)
@@ -424,6 +648,13 @@ task_pool_init(int count, rtems_task_priority priority)
   for(i = 0; i < count; ++i)
   {
     FTPD_SessionInfo_t *info = &task_pool.info[i];
+    if (!xfer_init(info, priority, id))
+    {
+      xfer_done(info);
+      task_pool_done(i);
+      syslog(LOG_ERR, "ftpd: Could not create FTPD transfer buffers");
+      return 0;
+    }
     sc = rtems_task_create(rtems_build_name('F', 'T', 'P', id),
       priority, FTPD_STACKSIZE,
       RTEMS_PREEMPT | RTEMS_NO_TIMESLICE |
@@ -435,10 +666,13 @@ task_pool_init(int count, rtems_task_priority priority)
       sc = rtems_task_start(
         info->tid, session, (rtems_task_argument)info);
       if (sc != RTEMS_SUCCESSFUL)
-        task_pool_done(i);
+        task_pool_done(i + 1);
     }
     else
-      task_pool_done(i + 1);
+    {
+      xfer_done(info);
+      task_pool_done(i);
+    }
     if (sc != RTEMS_SUCCESSFUL)
     {
       syslog(LOG_ERR, "ftpd: Could not create/start FTPD session: %s",
@@ -759,9 +993,11 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
 {
   int                 s = -1;
   int                 fd = -1;
-  char                buf[FTPD_DATASIZE];
+  char                *buf = info->xfer_buf[0];
   struct stat         stat_buf;
   int                 res = 0;
+  uint64_t            bytes = 0;
+  uint64_t            start = rtems_clock_get_uptime_nanoseconds();
 
   if(!can_read() || !info->auth)
   {
@@ -793,18 +1029,35 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
 
     if(info->xfer_mode == TYPE_I)
     {
-      while ((n = read(fd, buf, FTPD_DATASIZE)) > 0)
+      int cur = 0;
+
+      /*
+       * Double buffering: the helper task reads the next chunk of the file
+       * while this task sends the current one.
+       */
+      xfer_start(info, NULL, fd, info->xfer_buf[cur], ftpd_xfer_size);
+      while ((n = xfer_wait(info)) > 0)
       {
-        if(send(s, buf, n, 0) != n)
+        char *data = info->xfer_buf[cur];
+
+        cur ^= 1;
+        xfer_start(info, NULL, fd, info->xfer_buf[cur], ftpd_xfer_size);
+        if(send(s, data, n, 0) != n)
+        {
+          xfer_wait(info);
+          n = -1;
           break;
+        }
+        bytes += n;
         yield();
       }
     }
     else if (info->xfer_mode == TYPE_A)
     {
       int rest = 0;
-      while (rest == 0 && (n = read(fd, buf, FTPD_DATASIZE)) > 0)
+      while (rest == 0 && (n = read(fd, buf, ftpd_xfer_size)) > 0)
       {
+        bytes += n;
         char const* e = buf;
         char const* b;
         int i;
@@ -853,7 +1106,11 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
   if (0 == res)
     send_reply(info, 451, "File read error.");
   else
+  {
+    info->bytes_sent += bytes;
+    xfer_report(info, "RETR", filename, bytes, start);
     send_reply(info, 226, "Transfer complete.");
+  }
 
   close_data_socket(info);
 
@@ -902,8 +1159,10 @@ command_store(FTPD_SessionInfo_t *info, char const *filename)
   int                    n;
   unsigned long          size = 0;
   struct rtems_ftpd_hook *usehook = NULL;
-  char                   buf[FTPD_DATASIZE];
+  char                   *buf = info->xfer_buf[0];
   int                    res = 1;
+  uint64_t               bytes = 0;
+  uint64_t               start = rtems_clock_get_uptime_nanoseconds();
   int                    bare_lfs = 0;
   int                    null = 0;
   typedef ssize_t (*WriteProc)(int, void const*, size_t);
@@ -995,6 +1254,7 @@ command_store(FTPD_SessionInfo_t *info, char const *filename)
      */
     res = (usehook->hook_function)(bigBufr, size) == 0;
     free(bigBufr);
+    bytes = size;
     if(!res)
     {
       send_reply(info, 451, "File processing failed.");
@@ -1020,26 +1280,41 @@ command_store(FTPD_SessionInfo_t *info, char const *filename)
 
     if(info->xfer_mode == TYPE_I)
     {
-      while ((n = recv(s, buf, FTPD_DATASIZE, 0)) > 0)
+      int cur = 0;
+      int pending = 0;
+
+      /*
+       * Double buffering: the helper task writes the previous chunk to the
+       * file while this task receives the next one.
+       */
+      while ((n = recv(s, info->xfer_buf[cur], ftpd_xfer_size, 0)) > 0)
       {
-        if (wrt(fd, buf, n) != n)
+        if (pending > 0 && xfer_wait(info) != pending)
         {
+          pending = 0;
           res = 0;
           break;
         }
+        xfer_start(info, wrt, fd, info->xfer_buf[cur], n);
+        pending = n;
+        bytes += n;
+        cur ^= 1;
         yield();
       }
+      if (pending > 0 && xfer_wait(info) != pending)
+        res = 0;
     }
     else if(info->xfer_mode == TYPE_A)
     {
       int rest = 0;
       int pended_cr = 0;
-      while (res && rest == 0 && (n = recv(s, buf, FTPD_DATASIZE, 0)) > 0)
+      while (res && rest == 0 && (n = recv(s, buf, ftpd_xfer_size, 0)) > 0)
       {
         char const* e = buf;
         char const* b;
         int i;
 
+        bytes += n;
         rest = n;
         if(pended_cr && *e != '\n')
         {
@@ -1101,6 +1376,9 @@ command_store(FTPD_SessionInfo_t *info, char const *filename)
     }
   }
 
+  info->bytes_received += bytes;
+  xfer_report(info, "STOR", filename, bytes, start);
+
   if (bare_lfs > 0)
   {
     snprintf(buf, FTPD_BUFSIZE,
@@ -1950,6 +2228,13 @@ session(rtems_task_argument arg)
      */
     chdir("/");
 
+    if (ftpd_config->verbose)
+      syslog(LOG_INFO, "ftpd: Session closed: %" PRIu64 " bytes sent, %"
+        PRIu64 " bytes received (%" PRIu64 " KiB/s)",
+        info->bytes_sent, info->bytes_received,
+        kib_per_second(info->bytes_sent + info->bytes_received,
+          info->xfer_time));
+
     /* Close connection and put ourselves back into the task pool. */
     close_data_socket(info);
     close_stream(info);
@@ -2038,6 +2323,9 @@ ftpd_daemon(rtems_task_argument args RTEMS_UNUSED)
               htons(ntohs(info->ctrl_addr.sin_port) - 1);
             info->idle = ftpd_timeout;
             info->user = NULL;
+            info->bytes_sent = 0;
+            info->bytes_received = 0;
+            info->xfer_time = 0;
             if (ftpd_config->login)
               info->auth = false;
             else
@@ -2103,6 +2391,18 @@ rtems_ftpd_start(const struct rtems_ftpd_configuration* config)
 
   ftpd_access = ftpd_config->access;
 
+  /*
+   * The transfer buffers are also used to format replies, so they must not be
+   * smaller than FTPD_BUFSIZE.
+   */
+  if (ftpd_config->transfer_buffer_size == 0)
+    ftpd_config->transfer_buffer_size = FTPD_DATASIZE;
+  else if (ftpd_config->transfer_buffer_size < FTPD_BUFSIZE)
+    ftpd_config->transfer_buffer_size = FTPD_BUFSIZE;
+  else if (ftpd_config->transfer_buffer_size > INT_MAX)
+    ftpd_config->transfer_buffer_size = INT_MAX;
+  ftpd_xfer_size = ftpd_config->transfer_buffer_size;
+
   ftpd_root = "/";
   if (ftpd_config->root && ftpd_config->root[0] == '/' )
     ftpd_root = ftpd_config->root;
@@ -2142,8 +2442,9 @@ rtems_ftpd_start(const struct rtems_ftpd_configuration* config)
   }
 
   if (ftpd_config->verbose)
-    syslog(LOG_INFO, "ftpd: FTP daemon started (%d session%s max)",
-           count, ((count > 1) ? "s" : ""));
+    syslog(LOG_INFO, "ftpd: FTP daemon started (%d session%s max, "
+           "%zu byte transfer buffers)",
+           count, ((count > 1) ? "s" : ""), ftpd_xfer_size);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -162,6 +162,25 @@ struct mg_callbacks {
 // Refer to https://github.com/valenok/mongoose/blob/master/UserManual.md
 // for the list of valid option and their possible values.
 //
+// Static files can be kept in memory with these options:
+//   file_cache_size: total bytes of cached file content, the cache is
+//            disabled if this option is not set.
+//   file_cache_max_file_size: largest file to cache, 65536 by default.
+//   file_cache_gzip_pattern: files matching this pattern are also kept gzip
+//            encoded and sent encoded to clients accepting it. This needs
+//            the RTEMS_MGHTTPD_ZLIB build option and libz, otherwise the
+//            option is ignored.
+// A cached file is read again when its size or modification time changes.
+//
+// By default each worker thread (num_threads) serves one connection until
+// it is closed, so an idle keep-alive connection occupies a thread. With
+// enable_event_loop set to "yes" the master thread polls the idle
+// keep-alive connections and queues them for the workers once a new
+// request arrives, so a few workers can serve many connections:
+//   max_idle_connections: idle connections polled by the master, 64 by
+//            default. Further idle connections are kept by their worker.
+// Idle connections are closed after request_timeout_ms.
+//
 // Return:
 //   web server context, or NULL on error.
 struct mg_context *mg_start(const struct mg_callbacks *callbacks,
@@ -46,6 +46,17 @@ extern "C" {
 rtems_status_code
 rtems_capture_cli_init (rtems_capture_timestamp timestamp);
 
+/**
+ * rtems_capture_cli_export_file
+ *
+ * This function exports the trace records to a file in the record item
+ * format.  It is used by the cexport command.  It returns zero if the records
+ * were completely written and the file was closed successfully, otherwise
+ * non-zero.
+ */
+int
+rtems_capture_cli_export_file (const char* file);
+
 #ifdef __cplusplus
 }
 #endif
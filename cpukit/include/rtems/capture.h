@@ -579,6 +579,46 @@ rtems_status_code rtems_capture_read (uint32_t     cpu,
  */
 rtems_status_code rtems_capture_release (uint32_t cpu, uint32_t count);
 
+/**
+ * @brief Capture export chunk handler.
+ *
+ * This handler is called by rtems_capture_export_records to output a chunk
+ * of the exported data.
+ *
+ * @param[in] arg The argument passed to rtems_capture_export_records.
+ * @param[in] data The begin of the data chunk.
+ * @param[in] length The length in bytes of the data chunk.
+ */
+typedef void (*rtems_capture_export_chunk) (void*       arg,
+                                           const void* data,
+                                           size_t      length);
+
+/**
+ * @brief Capture export records.
+ *
+ * This function exports the capture records of all processors in the record
+ * item format of <rtems/recorddata.h>. The output starts with a record stream
+ * header followed by the items of each processor. Task records are exported
+ * as thread identifier and name items, the task events as thread create,
+ * start, restart, delete, terminate, begin, exitted, and switch items. The
+ * time stamps are converted under the assumption that the capture time is in
+ * nanoseconds which is the case for the default capture timestamp handler.
+ *
+ * The output can be processed by the host tools of the record subsystem, for
+ * example if it is written to a file or sent to a record client. Exported
+ * records are released from the capture buffer. The capture engine must be
+ * disabled, see rtems_capture_read.
+ *
+ * @param[in] chunk The handler to output a chunk of data.
+ * @param[in] arg The argument for the chunk handler.
+ *
+ * @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code rtems_capture_export_records (rtems_capture_export_chunk chunk,
+                                                void*                      arg);
+
 /**
  * @brief Capture filter
  *
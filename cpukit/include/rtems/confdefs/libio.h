@@ -135,6 +135,11 @@
   #include <rtems/imfs.h>
 #endif
 
+#ifdef CONFIGURE_IMFS_ENABLE_MKFIFO
+  #include <limits.h>
+  #include <rtems/pipe.h>
+#endif
+
 #ifdef CONFIGURE_FILESYSTEM_DOSFS
 #include <rtems/dosfs.h>
 #endif
@@ -181,6 +186,18 @@ extern "C" {
 
 const int imfs_memfile_bytes_per_block = CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK;
 
+#ifdef CONFIGURE_IMFS_ENABLE_MKFIFO
+  #ifndef CONFIGURE_PIPE_BUFFER_SIZE
+    #define CONFIGURE_PIPE_BUFFER_SIZE PIPE_BUF
+  #endif
+
+  #if CONFIGURE_PIPE_BUFFER_SIZE < PIPE_BUF
+    #error "CONFIGURE_PIPE_BUFFER_SIZE must be at least PIPE_BUF"
+  #endif
+
+  const size_t rtems_pipe_buffer_size = CONFIGURE_PIPE_BUFFER_SIZE;
+#endif
+
 static IMFS_fs_info_t IMFS_root_fs_info;
 
 static const rtems_filesystem_operations_table IMFS_root_ops = {
@@ -212,6 +212,30 @@ const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
   #error "CONFIGURE_TASK_STACK_ALLOCATOR and CONFIGURE_TASK_STACK_DEALLOCATOR must be both defined or both undefined"
 #endif
 
+#ifndef CONFIGURE_TASK_STACK_CACHE_MAXIMUM
+  #define CONFIGURE_TASK_STACK_CACHE_MAXIMUM 0
+#endif
+
+const uint32_t _Stack_Cache_maximum = CONFIGURE_TASK_STACK_CACHE_MAXIMUM;
+
+/*
+ * The stack cache keeps the stack areas of deleted tasks in the workspace.
+ * Account for them through CONFIGURE_EXTRA_TASK_STACKS.
+ */
+#if CONFIGURE_TASK_STACK_CACHE_MAXIMUM > 0
+  #if defined(CONFIGURE_TASK_STACK_ALLOCATOR) \
+    || defined(CONFIGURE_TASK_STACK_DEALLOCATOR)
+    #error "CONFIGURE_TASK_STACK_CACHE_MAXIMUM cannot be used with a custom task stack allocator"
+  #endif
+
+  const bool _Stack_Allocator_avoids_workspace = false;
+
+  const Stack_Allocator_allocate _Stack_Allocator_allocate =
+    _Stack_Cache_allocate;
+
+  const Stack_Allocator_free _Stack_Allocator_free = _Stack_Cache_free;
+#endif
+
 /*
  * Custom IDLE thread stacks allocator. If this is provided, it is assumed
  * that the allocator is providing its own memory for these stacks.
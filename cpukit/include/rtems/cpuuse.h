@@ -55,6 +55,10 @@
 #ifndef _RTEMS_CPUUSE_H
 #define _RTEMS_CPUUSE_H
 
+#include <stdint.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -70,6 +74,45 @@ extern "C" {
  *   the CPU usage of threads.
  */
 
+/**
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief This constant represents the load average of a task or processor
+ *   which was busy all the time.
+ */
+#define RTEMS_CPU_LOAD_AVERAGE_ONE 65536
+
+/**
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief This structure contains the load averages of a task or processor.
+ *
+ * The load averages are exponentially decayed averages of the fraction of
+ * time a task or processor was busy.  A processor is busy while it executes a
+ * task other than an idle task.  The load averages are fixed-point numbers,
+ * see #RTEMS_CPU_LOAD_AVERAGE_ONE.  They are maintained by the thread
+ * dispatcher and updated in periods of 1/16 second.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the load average with a time constant of one
+   *   second.
+   */
+  uint32_t one_second;
+
+  /**
+   * @brief This member contains the load average with a time constant of ten
+   *   seconds.
+   */
+  uint32_t ten_seconds;
+
+  /**
+   * @brief This member contains the load average with a time constant of one
+   *   minute.
+   */
+  uint32_t one_minute;
+} rtems_cpu_load_average;
+
 /* Generated from spec:/rtems/cpuuse/if/printer */
 
 /* Forward declaration */
@@ -97,6 +140,85 @@ struct rtems_printer;
  */
 int rtems_cpu_info_report( const struct rtems_printer *printer );
 
+/**
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief Gets the load averages of the processor.
+ *
+ * @param cpu_index is the index of the processor.
+ *
+ * @param[out] load_average is the pointer to an rtems_cpu_load_average
+ *   object.  When the directive call is successful, the load averages of the
+ *   processor will be stored in this object.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``load_average`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The processor index was invalid.
+ *
+ * @par Notes
+ * The time to get the load averages is independent of the count of tasks.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may be called from within device driver initialization
+ *   context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_cpu_load_average_get_by_processor(
+  uint32_t                cpu_index,
+  rtems_cpu_load_average *load_average
+);
+
+/**
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief Gets the load averages of the task.
+ *
+ * @param id is the task identifier.  The constant #RTEMS_SELF may be used to
+ *   specify the calling task.
+ *
+ * @param[out] load_average is the pointer to an rtems_cpu_load_average
+ *   object.  When the directive call is successful, the load averages of the
+ *   task will be stored in this object.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``load_average`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no task associated with the identifier
+ *   specified by ``id``.
+ *
+ * @par Notes
+ * The time to get the load averages is independent of the count of tasks.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within device driver initialization
+ *   context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_cpu_load_average_get_by_task(
+  rtems_id                id,
+  rtems_cpu_load_average *load_average
+);
+
 /* Generated from spec:/rtems/cpuuse/if/report */
 
 /**
@@ -17,7 +17,9 @@ extern "C" {
 enum {
   FTPD_BUFSIZE  = 256,       /* Size for temporary buffers */
   FTPD_DATASIZE = 4 * 1024,      /* Size for file transfer buffers */
-  FTPD_STACKSIZE = RTEMS_MINIMUM_STACK_SIZE + FTPD_DATASIZE /* Tasks stack size */
+  /* Session and transfer tasks stack size, the file transfer buffers are
+     allocated from the heap */
+  FTPD_STACKSIZE = RTEMS_MINIMUM_STACK_SIZE + 4 * FTPD_BUFSIZE
 };
 
 /* FTPD access control flags */
@@ -54,7 +56,12 @@ struct rtems_ftpd_configuration
                                                   3 - browse-only */
    rtems_shell_login_check_t login;            /* Login check or 0 to ignore
                                                   user/passwd. */
-   bool                    verbose;            /* Say hello! */
+   bool                    verbose;            /* Say hello and log
+                                                  transfer throughput */
+   size_t                  transfer_buffer_size; /* Size of each of the two
+                                                  data transfer buffers of
+                                                  a session or 0 for
+                                                  FTPD_DATASIZE */
 };
 
 rtems_status_code rtems_ftpd_start(
@@ -34,6 +34,48 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Gets the buffer size in bytes of a pipe or FIFO.
+ *
+ * The argument is a pointer to an int.
+ */
+#define RTEMS_PIPE_IOCTL_GET_SIZE _IOR('p', 1, int)
+
+/**
+ * @brief Sets the buffer size in bytes of a pipe or FIFO.
+ *
+ * The argument is a pointer to an int with the requested size.  Sizes less
+ * than PIPE_BUF are rounded up to PIPE_BUF.  The resulting size is returned
+ * through the argument.  The call fails with EBUSY if the pipe contains more
+ * data than fits into the requested size.
+ */
+#define RTEMS_PIPE_IOCTL_SET_SIZE _IOWR('p', 2, int)
+
+#ifndef F_SETPIPE_SZ
+/**
+ * @brief The fcntl() command to set the buffer size of a pipe or FIFO.
+ *
+ * The third argument is the requested size as an int.  On success, fcntl()
+ * returns the resulting size.
+ */
+#define F_SETPIPE_SZ 1031
+#endif
+
+#ifndef F_GETPIPE_SZ
+/**
+ * @brief The fcntl() command to get the buffer size of a pipe or FIFO.
+ */
+#define F_GETPIPE_SZ 1032
+#endif
+
+/**
+ * @brief The buffer size of new pipes and FIFOs.
+ *
+ * Defined by the application configuration option
+ * CONFIGURE_PIPE_BUFFER_SIZE.
+ */
+extern const size_t rtems_pipe_buffer_size;
+
 /* Control block to manage each pipe */
 typedef struct pipe_control {
   char *Buffer;
@@ -104,6 +146,35 @@ extern ssize_t pipe_write(
   rtems_libio_t  *iop
 );
 
+/**
+ * @brief Pipe readv.
+ *
+ * Reads into all buffers of the I/O vector with one pass over the pipe
+ * buffer.
+ */
+extern ssize_t pipe_readv(
+  pipe_control_t     *pipe,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total,
+  rtems_libio_t      *iop
+);
+
+/**
+ * @brief Pipe writev.
+ *
+ * Writes all buffers of the I/O vector with one pass over the pipe buffer if
+ * there is enough space.  Writes of at most the pipe buffer size are not
+ * interleaved with other writes.
+ */
+extern ssize_t pipe_writev(
+  pipe_control_t     *pipe,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total,
+  rtems_libio_t      *iop
+);
+
 /**
  * @brief File system Input/Output control.
  *
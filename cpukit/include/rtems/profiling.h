@@ -23,9 +23,12 @@
 #ifndef _RTEMS_PROFILING_H
 #define _RTEMS_PROFILING_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <rtems/print.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -77,7 +80,14 @@ typedef enum {
    *
    * @see rtems_profiling_smp_lock.
    */
-  RTEMS_PROFILING_SMP_LOCK
+  RTEMS_PROFILING_SMP_LOCK,
+
+  /**
+   * @brief Type of SMP lock call site profiling data.
+   *
+   * @see rtems_profiling_smp_lock_call_site.
+   */
+  RTEMS_PROFILING_SMP_LOCK_CALL_SITE
 } rtems_profiling_type;
 
 /**
@@ -265,6 +275,73 @@ typedef struct {
   uint64_t contention_counts[RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS];
 } rtems_profiling_smp_lock;
 
+/**
+ * @brief SMP lock call site profiling data.
+ *
+ * The lock uses are accounted for each pair of a call site which acquired the
+ * lock and a lock name on each processor.  For out of line lock acquire
+ * functions, for example _ISR_lock_Acquire(), the call site is the return
+ * address of the lock acquire function.  For inline lock acquire sequences,
+ * for example the thread queue locks, the call site is an address inside the
+ * function into which the lock acquire sequence was inlined.
+ *
+ * The times are defined as in rtems_profiling_smp_lock.
+ *
+ * @see rtems_profiling_smp_lock_call_sites_enable().
+ */
+typedef struct {
+  /**
+   * @brief The profiling data header.
+   */
+  rtems_profiling_header header;
+
+  /**
+   * @brief The lock name.
+   */
+  const char *name;
+
+  /**
+   * @brief The call site which acquired the lock.
+   */
+  uintptr_t call_site;
+
+  /**
+   * @brief The index of the processor which used the lock.
+   */
+  uint32_t processor_index;
+
+  /**
+   * @brief The maximum lock acquire time in nanoseconds.
+   */
+  uint32_t max_acquire_time;
+
+  /**
+   * @brief The maximum lock section time in nanoseconds.
+   */
+  uint32_t max_section_time;
+
+  /**
+   * @brief The count of lock uses.
+   *
+   * This value may overflow.
+   */
+  uint64_t usage_count;
+
+  /**
+   * @brief Total lock acquire time in nanoseconds.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_acquire_time;
+
+  /**
+   * @brief Total lock section time in nanoseconds.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_section_time;
+} rtems_profiling_smp_lock_call_site;
+
 /**
  * @brief Collection of profiling data.
  */
@@ -283,6 +360,11 @@ typedef union {
    * @brief SMP lock profiling data if indicated by the header.
    */
   rtems_profiling_smp_lock smp_lock;
+
+  /**
+   * @brief SMP lock call site profiling data if indicated by the header.
+   */
+  rtems_profiling_smp_lock_call_site smp_lock_call_site;
 } rtems_profiling_data;
 
 /**
@@ -309,6 +391,44 @@ void rtems_profiling_iterate(
   void *visitor_arg
 );
 
+/**
+ * @brief Enables the SMP lock call site profiling.
+ *
+ * Once enabled, each lock use is accounted to the call site which acquired
+ * the lock.  The call site profiling data is reported by
+ * rtems_profiling_iterate() with the RTEMS_PROFILING_SMP_LOCK_CALL_SITE type.
+ * The call site profiling adds overhead to each lock release.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_NO_MEMORY There was not enough memory to allocate the call
+ *   site tables.
+ * @retval RTEMS_NOT_IMPLEMENTED Profiling or SMP support is disabled.
+ */
+rtems_status_code rtems_profiling_smp_lock_call_sites_enable(void);
+
+/**
+ * @brief Disables the SMP lock call site profiling.
+ *
+ * The profiling data collected so far is kept.
+ */
+void rtems_profiling_smp_lock_call_sites_disable(void);
+
+/**
+ * @brief Resets the SMP lock call site profiling data.
+ *
+ * Lock uses accounted concurrently on other processors may be partially
+ * reset.
+ */
+void rtems_profiling_smp_lock_call_sites_reset(void);
+
+/**
+ * @brief Gets the count of lock uses which could not be accounted to a call
+ * site since the call site tables were full.
+ *
+ * @return The count of dropped lock uses summed up over all processors.
+ */
+uint32_t rtems_profiling_smp_lock_call_sites_get_dropped(void);
+
 /**
  * @brief Reports profiling data as XML.
  *
@@ -326,6 +446,514 @@ int rtems_profiling_report_xml(
   const char *indentation
 );
 
+/**
+ * @brief Count of wake-up latency histogram bins.
+ *
+ * @see rtems_profiling_latency_bin_limit().
+ */
+#define RTEMS_PROFILING_LATENCY_BIN_COUNT 32
+
+/**
+ * @brief Wake-up latency profiling data.
+ *
+ * The wake-up latency is the time elapsed between the unblock of a thread,
+ * for example by the release of a semaphore or the send of an event, and the
+ * dispatch of the thread on a processor.  It includes the time the thread
+ * waits for higher priority threads and the thread dispatch latency.
+ */
+typedef struct {
+  /**
+   * @brief The count of latency samples.
+   */
+  uint64_t count;
+
+  /**
+   * @brief The total latency in nanoseconds.
+   *
+   * The average latency is the total latency divided by the count of latency
+   * samples.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_latency;
+
+  /**
+   * @brief The maximum latency in nanoseconds.
+   */
+  uint64_t max_latency;
+
+  /**
+   * @brief The log2 histogram of latencies.
+   *
+   * The bin with index i counts latencies less than the limit returned by
+   * rtems_profiling_latency_bin_limit() for this index and at least the limit
+   * of the previous bin.  The last bin counts all greater latencies.
+   */
+  uint32_t bins[ RTEMS_PROFILING_LATENCY_BIN_COUNT ];
+} rtems_profiling_latency;
+
+/**
+ * @brief Gets the wake-up latency profiling data of a thread.
+ *
+ * The statistics of threads executing on other processors may be observed in
+ * an inconsistent state.
+ *
+ * @param id is the thread identifier.
+ *
+ * @param[out] latency is the wake-up latency profiling data of the thread.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The latency parameter was NULL.
+ * @retval RTEMS_INVALID_ID There was no thread with this identifier.
+ * @retval RTEMS_NOT_IMPLEMENTED Profiling is disabled.
+ */
+rtems_status_code rtems_profiling_get_thread_latency(
+  rtems_id id,
+  rtems_profiling_latency *latency
+);
+
+/**
+ * @brief Gets the wake-up latency profiling data of a processor.
+ *
+ * The data accounts for all threads dispatched on the processor.
+ *
+ * @param cpu_index is the processor index.
+ *
+ * @param[out] latency is the wake-up latency profiling data of the processor.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The latency parameter was NULL.
+ * @retval RTEMS_INVALID_NUMBER The processor index was invalid.
+ * @retval RTEMS_NOT_IMPLEMENTED Profiling is disabled.
+ */
+rtems_status_code rtems_profiling_get_processor_latency(
+  uint32_t cpu_index,
+  rtems_profiling_latency *latency
+);
+
+/**
+ * @brief Resets the wake-up latency profiling data of all threads and
+ * processors.
+ */
+void rtems_profiling_reset_latency(void);
+
+/**
+ * @brief Returns the exclusive upper limit in nanoseconds of a wake-up
+ * latency histogram bin.
+ *
+ * @param bin is the bin index.
+ *
+ * @return The limit in nanoseconds.  For the last bin, UINT64_MAX is returned.
+ */
+uint64_t rtems_profiling_latency_bin_limit(size_t bin);
+
+/**
+ * @brief Default count of histogram entries of the sampling profiler per
+ * processor.
+ */
+#define RTEMS_PROFILING_SAMPLER_DEFAULT_ENTRY_COUNT 1024
+
+/**
+ * @brief Magic number of the sampling profiler export format.
+ *
+ * @see rtems_profiling_sampler_export().
+ */
+#define RTEMS_PROFILING_SAMPLER_EXPORT_MAGIC 0x50524f46
+
+/**
+ * @brief Sampling profiler configuration.
+ */
+typedef struct {
+  /**
+   * @brief The sample period in clock ticks.
+   *
+   * If the period is zero, then no samples are taken by the clock tick.  In
+   * this case, samples may be provided by a high-rate timer interrupt through
+   * rtems_profiling_sampler_sample().  A non-zero period requires an
+   * implementation of rtems_profiling_sampler_get_interrupted_pc().
+   */
+  uint32_t period;
+
+  /**
+   * @brief The count of histogram entries per processor.
+   *
+   * It shall be a power of two.  If it is zero, then
+   * RTEMS_PROFILING_SAMPLER_DEFAULT_ENTRY_COUNT is used.
+   */
+  uint32_t entry_count;
+} rtems_profiling_sampler_config;
+
+/**
+ * @brief Sampling profiler histogram entry.
+ */
+typedef struct {
+  /**
+   * @brief The interrupted program counter.
+   *
+   * It is zero, if the program counter is not available.
+   */
+  uintptr_t pc;
+
+  /**
+   * @brief The identifier of the thread executing at sample time.
+   */
+  rtems_id thread;
+
+  /**
+   * @brief The index of the sampled processor.
+   */
+  uint32_t cpu_index;
+
+  /**
+   * @brief The count of samples with this program counter and thread.
+   */
+  uint32_t count;
+} rtems_profiling_sampler_entry;
+
+/**
+ * @brief Sampling profiler statistics.
+ */
+typedef struct {
+  /**
+   * @brief The count of samples accounted in the histograms.
+   */
+  uint64_t samples;
+
+  /**
+   * @brief The count of samples dropped since a histogram was full.
+   */
+  uint64_t dropped;
+} rtems_profiling_sampler_statistics;
+
+/**
+ * @brief Visitor function for sampling profiler histogram entries.
+ *
+ * @param[in, out] arg is the visitor argument.
+ *
+ * @param entry is the histogram entry.
+ */
+typedef void (*rtems_profiling_sampler_visitor)(
+  void *arg,
+  const rtems_profiling_sampler_entry *entry
+);
+
+/**
+ * @brief Resolves a program counter to the name of the enclosing function.
+ *
+ * @param pc is the program counter.
+ *
+ * @param[out] begin is the begin address of the function.
+ *
+ * @retval NULL No function was found.
+ * @return Returns the name of the function.
+ */
+typedef const char *(*rtems_profiling_sampler_resolver)(
+  uintptr_t pc,
+  uintptr_t *begin
+);
+
+/**
+ * @brief Starts the sampling profiler.
+ *
+ * The profiler records the interrupted program counter and the executing
+ * thread of each processor into per-processor hash histograms.  Histograms
+ * of a previous run are discarded.
+ *
+ * @param config is the profiler configuration.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The configuration was NULL.
+ * @retval RTEMS_INVALID_NUMBER The entry count was not a power of two.
+ * @retval RTEMS_RESOURCE_IN_USE The profiler was already started.
+ * @retval RTEMS_NOT_IMPLEMENTED The sample period was non-zero and there was
+ *   no implementation of rtems_profiling_sampler_get_interrupted_pc() to get
+ *   the interrupted program counter in the clock tick.
+ * @retval RTEMS_NO_MEMORY There was not enough memory for the histograms.
+ */
+rtems_status_code rtems_profiling_sampler_start(
+  const rtems_profiling_sampler_config *config
+);
+
+/**
+ * @brief Stops the sampling profiler.
+ *
+ * The histograms remain available until the profiler is started again.
+ */
+void rtems_profiling_sampler_stop(void);
+
+/**
+ * @brief Clears the histograms and statistics of the sampling profiler.
+ */
+void rtems_profiling_sampler_reset(void);
+
+/**
+ * @brief Takes a sample of the current processor.
+ *
+ * This function may be called by interrupt handlers of high-rate timers,
+ * which know the interrupted program counter.  If the profiler is not
+ * started, then nothing is done.
+ *
+ * @param pc is the interrupted program counter.
+ */
+void rtems_profiling_sampler_sample(uintptr_t pc);
+
+/**
+ * @brief Gets the interrupted program counter of the current processor.
+ *
+ * This function is called in the clock tick interrupt.  There is no default
+ * implementation since the interrupt frame layout depends on the architecture
+ * and the interrupt entry of the BSP.  A BSP or application which knows the
+ * interrupt frame layout may provide an implementation.  Without an
+ * implementation, rtems_profiling_sampler_start() rejects a non-zero sample
+ * period.
+ *
+ * @return Returns the interrupted program counter.
+ */
+uintptr_t rtems_profiling_sampler_get_interrupted_pc(void);
+
+/**
+ * @brief Gets the sampling profiler statistics.
+ *
+ * @param[out] statistics is the statistics.
+ */
+void rtems_profiling_sampler_get_statistics(
+  rtems_profiling_sampler_statistics *statistics
+);
+
+/**
+ * @brief Iterates through the sampling profiler histogram entries.
+ *
+ * The histograms are copied in small chunks, so sampling may continue
+ * concurrently.
+ *
+ * @param visitor is the visitor.
+ *
+ * @param[in, out] arg is the visitor argument.
+ */
+void rtems_profiling_sampler_iterate(
+  rtems_profiling_sampler_visitor visitor,
+  void *arg
+);
+
+/**
+ * @brief Sets the function name resolver used by
+ * rtems_profiling_sampler_report().
+ *
+ * The resolver maps a program counter to the name and start address of the
+ * enclosing function, for example through the application's symbol table.
+ *
+ * @param resolver is the resolver or NULL to print addresses only.
+ */
+void rtems_profiling_sampler_set_resolver(
+  rtems_profiling_sampler_resolver resolver
+);
+
+/**
+ * @brief Gets the function name resolver set by
+ * rtems_profiling_sampler_set_resolver().
+ *
+ * @return Returns the resolver or NULL.
+ */
+rtems_profiling_sampler_resolver rtems_profiling_sampler_get_resolver(void);
+
+/**
+ * @brief Reports the functions with the most samples.
+ *
+ * @param[in] printer is the RTEMS printer to send the output to.
+ *
+ * @param limit is the maximum count of reported functions.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_NO_MEMORY There was not enough memory for the report.
+ */
+rtems_status_code rtems_profiling_sampler_report(
+  const rtems_printer *printer,
+  size_t limit
+);
+
+/**
+ * @brief Exports the sampling profiler histograms in a binary format.
+ *
+ * The export starts with a header of four 32-bit words: the
+ * RTEMS_PROFILING_SAMPLER_EXPORT_MAGIC, the format version one, the size of
+ * an entry in bytes and the size of a program counter in bytes.  Each
+ * following entry consists of the program counter as 64-bit word, the thread
+ * identifier, the processor index and the sample count as 32-bit words.  All
+ * words are in the byte order of the target.  Host tools may resolve the
+ * program counters with the symbols of the executable and produce flame
+ * graphs.
+ *
+ * @param fd is the file descriptor to write to.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_IO_ERROR A write error occurred.
+ */
+rtems_status_code rtems_profiling_sampler_export(int fd);
+
+/**
+ * @brief Count of lifetime histogram bins of the heap allocation profiler.
+ *
+ * The bin with index zero counts blocks freed in the clock tick of their
+ * allocation.  The bin with index i > 0 counts lifetimes of at least
+ * 2**(i - 1) and less than 2**i clock ticks.  The last bin counts all longer
+ * lifetimes.
+ */
+#define RTEMS_PROFILING_HEAP_LIFETIME_BIN_COUNT 16
+
+/**
+ * @brief Default count of allocation sites of the heap allocation profiler
+ * per processor.
+ */
+#define RTEMS_PROFILING_HEAP_DEFAULT_SITE_COUNT 256
+
+/**
+ * @brief Heaps observed by the heap allocation profiler.
+ */
+typedef enum {
+  /**
+   * @brief The C Program Heap used by malloc(), realloc() and free().
+   */
+  RTEMS_PROFILING_HEAP_MALLOC,
+
+  /**
+   * @brief The RTEMS Workspace used by _Workspace_Allocate() and
+   * _Workspace_Free().
+   */
+  RTEMS_PROFILING_HEAP_WORKSPACE
+} rtems_profiling_heap_kind;
+
+/**
+ * @brief Heap allocation profiler statistics of an allocation site.
+ */
+typedef struct {
+  /**
+   * @brief The allocation site, this is the return address of the allocation
+   * call.
+   */
+  uintptr_t site;
+
+  /**
+   * @brief The heap of the allocation site.
+   */
+  rtems_profiling_heap_kind heap;
+
+  /**
+   * @brief The count of allocations.
+   */
+  uint64_t allocations;
+
+  /**
+   * @brief The count of frees of blocks allocated by this site.
+   */
+  uint64_t frees;
+
+  /**
+   * @brief The count of bytes currently allocated by this site.
+   */
+  uint64_t live_bytes;
+
+  /**
+   * @brief The total count of bytes allocated by this site.
+   */
+  uint64_t allocated_bytes;
+
+  /**
+   * @brief The lifetime histogram of freed blocks in clock ticks.
+   */
+  uint64_t lifetimes[RTEMS_PROFILING_HEAP_LIFETIME_BIN_COUNT];
+} rtems_profiling_heap_site;
+
+/**
+ * @brief Visitor function for allocation sites.
+ *
+ * @param[in, out] arg is the visitor argument.
+ *
+ * @param site is the allocation site statistics.
+ */
+typedef void (*rtems_profiling_heap_visitor)(
+  void *arg,
+  const rtems_profiling_heap_site *site
+);
+
+/**
+ * @brief Starts the heap allocation profiler.
+ *
+ * While the profiler is started, each allocation of malloc(), realloc() and
+ * _Workspace_Allocate() is extended by a small trailer which records the
+ * allocation site, the size and the allocation time.  Allocations, frees and
+ * lifetimes are accounted per allocation site in per-processor hash tables.
+ * The statistics of a previous run are discarded.  Blocks allocated by a
+ * previous run are not accounted when they are freed or resized.
+ *
+ * @param site_count is the count of allocation sites per processor.  It
+ *   shall be a power of two.  If it is zero, then
+ *   RTEMS_PROFILING_HEAP_DEFAULT_SITE_COUNT is used.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_NUMBER The site count was not a power of two.
+ * @retval RTEMS_RESOURCE_IN_USE The profiler was already started.
+ * @retval RTEMS_NO_MEMORY There was not enough memory for the tables.
+ */
+rtems_status_code rtems_profiling_heap_start(uint32_t site_count);
+
+/**
+ * @brief Stops the heap allocation profiler.
+ *
+ * The statistics remain available until the profiler is started again.
+ */
+void rtems_profiling_heap_stop(void);
+
+/**
+ * @brief Clears the statistics of the heap allocation profiler.
+ *
+ * Blocks allocated before the reset are not accounted when they are freed or
+ * resized, so the live bytes of an allocation site never become negative.
+ */
+void rtems_profiling_heap_reset(void);
+
+/**
+ * @brief Gets the count of operations not accounted since an allocation site
+ * table was full.
+ *
+ * @return Returns the count of dropped operations.
+ */
+uint32_t rtems_profiling_heap_get_dropped(void);
+
+/**
+ * @brief Iterates through the allocation sites.
+ *
+ * The per-processor statistics of each allocation site are summed up.
+ *
+ * @param visitor is the visitor.
+ *
+ * @param[in, out] arg is the visitor argument.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_NO_MEMORY There was not enough memory to merge the tables.
+ */
+rtems_status_code rtems_profiling_heap_iterate(
+  rtems_profiling_heap_visitor visitor,
+  void *arg
+);
+
+/**
+ * @brief Reports the allocation sites with the most live bytes.
+ *
+ * The allocation sites are resolved with the resolver set by
+ * rtems_profiling_sampler_set_resolver().
+ *
+ * @param[in] printer is the RTEMS printer to send the output to.
+ *
+ * @param limit is the maximum count of reported allocation sites.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_NO_MEMORY There was not enough memory for the report.
+ */
+rtems_status_code rtems_profiling_heap_report(
+  const rtems_printer *printer,
+  size_t limit
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -163,7 +163,22 @@ typedef struct RTEMS_PACKED {
   rtems_record_item Info[64];
 } Record_Stream_header;
 
-size_t _Record_Stream_header_initialize( Record_Stream_header *header );
+size_t _Record_Stream_header_prepare(
+  Record_Stream_header *header,
+  uint32_t              item_count,
+  uint32_t              frequency
+);
+
+RTEMS_INLINE_ROUTINE size_t _Record_Stream_header_initialize(
+  Record_Stream_header *header
+)
+{
+  return _Record_Stream_header_prepare(
+    header,
+    _Record_Configuration.item_count,
+    rtems_counter_frequency()
+  );
+}
 
 size_t _Record_String_to_items(
   rtems_record_event  event,
@@ -596,9 +611,210 @@ RTEMS_INLINE_ROUTINE void rtems_record_commit( rtems_record_context *context )
   _CPU_ISR_Enable( context->level );
 }
 
+/**
+ * @brief The record event classes.
+ *
+ * Each record event belongs to exactly one event class, see
+ * rtems_record_get_event_class().  The production of events can be enabled
+ * and disabled at runtime on a per event class basis, see
+ * rtems_record_set_event_classes().
+ */
+typedef enum {
+  /**
+   * @brief Events which belong to no other event class.
+   */
+  RTEMS_RECORD_CLASS_OTHER,
+
+  /**
+   * @brief Events which are required to decode the record stream, for example
+   *   the processor, per-processor head and tail, and uptime events.
+   *
+   * Events of this class are always produced.
+   */
+  RTEMS_RECORD_CLASS_CONTROL,
+
+  /**
+   * @brief Thread life-cycle and thread switch events.
+   */
+  RTEMS_RECORD_CLASS_THREAD,
+
+  /**
+   * @brief Scheduler events.
+   */
+  RTEMS_RECORD_CLASS_SCHEDULER,
+
+  /**
+   * @brief Interrupt entry, exit, and interrupt disable/enable events.
+   */
+  RTEMS_RECORD_CLASS_INTERRUPT,
+
+  /**
+   * @brief Interrupt lock, thread queue, and thread resource events.
+   */
+  RTEMS_RECORD_CLASS_LOCK,
+
+  /**
+   * @brief Watchdog and thread timer events.
+   */
+  RTEMS_RECORD_CLASS_WATCHDOG,
+
+  /**
+   * @brief Heap, workspace, and memory allocator events.
+   */
+  RTEMS_RECORD_CLASS_MEMORY,
+
+  /**
+   * @brief System call and directive events.
+   */
+  RTEMS_RECORD_CLASS_SYSTEM_CALL,
+
+  /**
+   * @brief Network stack events.
+   */
+  RTEMS_RECORD_CLASS_NETWORK,
+
+  /**
+   * @brief Function entry, exit, argument, return value, caller, and line
+   *   events.
+   */
+  RTEMS_RECORD_CLASS_FUNCTION,
+
+  /**
+   * @brief User defined events, see RTEMS_RECORD_USER().
+   */
+  RTEMS_RECORD_CLASS_USER,
+
+  /**
+   * @brief The count of record event classes.
+   */
+  RTEMS_RECORD_CLASS_COUNT
+} rtems_record_event_class;
+
+/**
+ * @brief Gets the bit of the record event class in a record event class set.
+ *
+ * @param event_class The record event class.
+ */
+#define RTEMS_RECORD_CLASS_BIT( event_class ) \
+  ( UINT32_C( 1 ) << ( event_class ) )
+
+/**
+ * @brief The record event class set which contains all record event classes.
+ */
+#define RTEMS_RECORD_CLASS_ALL \
+  ( RTEMS_RECORD_CLASS_BIT( RTEMS_RECORD_CLASS_COUNT ) - 1U )
+
+/**
+ * @brief The set of enabled record event classes.
+ *
+ * Use rtems_record_set_event_classes() to change it.
+ */
+extern uint32_t _Record_Event_classes;
+
+/**
+ * @brief The record event filter.
+ *
+ * There is one bit for each record event.  The bit is set, if the record
+ * event class of the event is enabled.  The filter is derived from
+ * _Record_Event_classes by rtems_record_set_event_classes() so that the
+ * event producers need only one load and branch to decide if an event is
+ * enabled.
+ */
+extern uint32_t _Record_Event_filter[ ( RTEMS_RECORD_LAST + 1 ) / 32 ];
+
+/**
+ * @brief Checks if the record event class is enabled.
+ *
+ * @param event_class The record event class.
+ *
+ * @retval true The record event class is enabled.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Record_Is_class_enabled(
+  rtems_record_event_class event_class
+)
+{
+  return ( _Record_Event_classes & RTEMS_RECORD_CLASS_BIT( event_class ) )
+    != 0;
+}
+
+/**
+ * @brief Checks if the production of the record event is enabled.
+ *
+ * @param event The record event without a time stamp.
+ *
+ * @retval true The record event class of the event is enabled.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool rtems_record_is_event_enabled(
+  rtems_record_event event
+)
+{
+  return ( _Record_Event_filter[ event / 32 ]
+    & ( UINT32_C( 1 ) << ( event % 32 ) ) ) != 0;
+}
+
+/**
+ * @brief Gets the record event class of the record event.
+ *
+ * @param event The record event without a time stamp.
+ *
+ * @return Returns the record event class of the event.
+ */
+rtems_record_event_class rtems_record_get_event_class(
+  rtems_record_event event
+);
+
+/**
+ * @brief Gets the set of enabled record event classes.
+ *
+ * @return Returns the set of enabled record event classes.
+ */
+uint32_t rtems_record_get_event_classes( void );
+
+/**
+ * @brief Sets the set of enabled record event classes.
+ *
+ * The events of disabled record event classes are discarded by
+ * rtems_record_produce(), rtems_record_produce_2(), rtems_record_produce_n(),
+ * and the record user extensions.  The RTEMS_RECORD_CLASS_CONTROL class is
+ * always enabled.  By default, all record event classes are enabled.
+ *
+ * This function shall be called from thread context.
+ *
+ * @param classes The set of record event classes to enable.  Use
+ *   RTEMS_RECORD_CLASS_BIT() to build the set.
+ *
+ * @return Returns the previous set of enabled record event classes.
+ */
+uint32_t rtems_record_set_event_classes( uint32_t classes );
+
+/**
+ * @brief Gets the name of the record event class.
+ *
+ * @param event_class The record event class.
+ *
+ * @return Returns the name of the record event class or NULL, if the class
+ *   is invalid.
+ */
+const char *rtems_record_event_class_text(
+  rtems_record_event_class event_class
+);
+
+/**
+ * @brief Produces n record items regardless of the enabled record event
+ *   classes.
+ *
+ * @param item The record items without a time stamps.
+ * @param n The count of record items.
+ */
+void _Record_Produce_n( const rtems_record_item *items, size_t n );
+
 /**
  * @brief Produces a record item.
  *
+ * The item is discarded, if the record event class of the event is disabled.
+ *
  * @param event The record event without a time stamp for the item.
  * @param data The record data for the item.
  */
@@ -607,6 +823,9 @@ void rtems_record_produce( rtems_record_event event, rtems_record_data data );
 /**
  * @brief Produces two record items.
  *
+ * The items are discarded, if the record event class of the first event is
+ * disabled.
+ *
  * @param event_0 The record event without a time stamp for the first item.
  * @param data_0 The record data for the first item.
  * @param event_1 The record event without a time stamp for the second item.
@@ -622,6 +841,9 @@ void rtems_record_produce_2(
 /**
  * @brief Produces n record items.
  *
+ * The items are discarded, if the record event class of the first event is
+ * disabled.
+ *
  * @param item The record items without a time stamps.
  * @param n The count of record items.
  */
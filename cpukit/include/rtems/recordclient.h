@@ -61,7 +61,8 @@ typedef enum {
   RTEMS_RECORD_CLIENT_ERROR_DOUBLE_PER_CPU_COUNT,
   RTEMS_RECORD_CLIENT_ERROR_NO_CPU_MAX,
   RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY,
-  RTEMS_RECORD_CLIENT_ERROR_PER_CPU_ITEMS_OVERFLOW
+  RTEMS_RECORD_CLIENT_ERROR_PER_CPU_ITEMS_OVERFLOW,
+  RTEMS_RECORD_CLIENT_ERROR_OUTPUT
 } rtems_record_client_status;
 
 typedef rtems_record_client_status ( *rtems_record_client_handler )(
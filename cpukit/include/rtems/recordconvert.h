@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file must be compatible to general purpose POSIX system, e.g. Linux,
+ * FreeBSD.  It may be used for utility programs.
+ */
+
+#ifndef _RTEMS_RECORDCONVERT_H
+#define _RTEMS_RECORDCONVERT_H
+
+#include "recordclient.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSRecord
+ *
+ * @{
+ */
+
+/**
+ * @brief Decodes a complete record stream in parallel and calls the handler
+ *   for each record item in timestamp order.
+ *
+ * The record stream is split into per-processor streams.  Each per-processor
+ * stream is decoded chunk by chunk by its own record client.  The worker
+ * threads and the caller decode the chunks while the caller merges the decoded
+ * per-processor items by timestamp.  Items with equal timestamps are ordered
+ * by the processor index.  At most two decoded chunks are buffered for each
+ * processor, so the memory demand does not depend on the stream size.  The
+ * handler is invoked in the context of the caller.
+ *
+ * @param stream The record stream produced by the record server or the record
+ *   file server.
+ * @param size The size of the record stream in bytes.
+ * @param worker_count The count of decoding threads including the caller.  A
+ *   value of zero selects one decoding thread for each processor in the
+ *   stream.
+ * @param handler The handler is invoked for each decoded record item.
+ * @param arg The handler argument.
+ *
+ * @return Returns the status of the decode operation.
+ */
+rtems_record_client_status rtems_record_decode_parallel(
+  const void                  *stream,
+  size_t                       size,
+  uint32_t                     worker_count,
+  rtems_record_client_handler  handler,
+  void                        *arg
+);
+
+/**
+ * @brief The record stream conversion output formats.
+ */
+typedef enum {
+  /**
+   * @brief The Chrome trace event JSON format.
+   *
+   * This format can be viewed by the Perfetto UI and chrome://tracing.
+   */
+  RTEMS_RECORD_CONVERT_CHROME_JSON,
+
+  /**
+   * @brief The Common Trace Format (CTF) 1.8.
+   *
+   * The output is a directory with a metadata file and one stream file per
+   * processor.
+   */
+  RTEMS_RECORD_CONVERT_CTF
+} rtems_record_convert_format;
+
+/**
+ * @brief The record stream conversion statistics.
+ */
+typedef struct {
+  /**
+   * @brief The count of decoded record items.
+   */
+  uint64_t items;
+
+  /**
+   * @brief The count of processors in the record stream.
+   */
+  uint32_t processors;
+} rtems_record_convert_statistics;
+
+/**
+ * @brief Converts a complete record stream.
+ *
+ * @param stream The record stream.
+ * @param size The size of the record stream in bytes.
+ * @param worker_count The count of decode worker threads, see
+ *   rtems_record_decode_parallel().
+ * @param format The output format.
+ * @param output The output file path for the Chrome trace event JSON format
+ *   and the output directory path for the Common Trace Format.
+ * @param[out] stats The conversion statistics.  It may be NULL.
+ *
+ * @retval RTEMS_RECORD_CLIENT_ERROR_OUTPUT The output could not be written.
+ *
+ * @return Returns the status of the conversion.
+ */
+rtems_record_client_status rtems_record_convert(
+  const void                      *stream,
+  size_t                           size,
+  uint32_t                         worker_count,
+  rtems_record_convert_format      format,
+  const char                      *output,
+  rtems_record_convert_statistics *stats
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_RECORDCONVERT_H */
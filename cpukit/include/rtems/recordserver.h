@@ -32,6 +32,7 @@
 
 #include <sys/types.h>
 #include <rtems.h>
+#include <rtems/thread.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,6 +50,26 @@ extern "C" {
  */
 ssize_t rtems_record_writev( int fd, bool *written );
 
+/**
+ * @brief Writes a record stream header to the file descriptor.
+ *
+ * @param fd The file descriptor.
+ *
+ * @return Returns the return value of write().
+ */
+ssize_t _Record_Write_header( int fd );
+
+/**
+ * @brief Writes the identifiers and names of all threads to the file
+ *   descriptor.
+ *
+ * @param fd The file descriptor.
+ *
+ * @retval -1 A write error occurred.
+ * @retval other The bytes written to the file descriptor.
+ */
+ssize_t _Record_Write_thread_names( int fd );
+
 /**
  * @brief Runs a record TCP server loop.
  *
@@ -70,6 +91,152 @@ rtems_status_code rtems_record_start_server(
   rtems_interval      period
 );
 
+/**
+ * @brief The record file server configuration.
+ */
+typedef struct {
+  /**
+   * @brief The path of the files or the raw device.
+   *
+   * In case file_count is positive, the files are named "<path>.0",
+   * "<path>.1", up to "<path>.<file_count - 1>".  Otherwise, the path is
+   * opened once and the record stream is written to it as a ring buffer of
+   * file_size bytes, for example to a raw disk partition.
+   *
+   * In the ring buffer mode, the valid data ends with an end marker of two
+   * record items.  Both items have the RTEMS_RECORD_EMPTY event and a time
+   * of zero.  The data of the first item is RTEMS_RECORD_MAGIC, the data of
+   * the second item is the count of wrap-arounds.  The data after the end
+   * marker is stale and shall be ignored.
+   */
+  const char *path;
+
+  /**
+   * @brief The count of files to rotate through, or zero to write to a
+   *   single file or device in a circular manner.
+   */
+  uint32_t file_count;
+
+  /**
+   * @brief The maximum size in bytes of a file or the raw device area.
+   *
+   * Each file starts with a record stream header and the thread names, so
+   * that it can be decoded on its own.
+   */
+  off_t file_size;
+
+  /**
+   * @brief The drain period in clock ticks.
+   */
+  rtems_interval period;
+
+  /**
+   * @brief The priority of the drain task.
+   */
+  rtems_task_priority priority;
+} rtems_record_file_server_config;
+
+/**
+ * @brief The record file server statistics.
+ */
+typedef struct {
+  /**
+   * @brief The count of bytes written.
+   */
+  uint64_t bytes_written;
+
+  /**
+   * @brief The count of record items overwritten in the per-processor ring
+   *   buffers before they could be drained.
+   */
+  uint64_t items_lost;
+
+  /**
+   * @brief The count of bytes which could not be written due to write
+   *   errors.
+   */
+  uint64_t bytes_dropped;
+
+  /**
+   * @brief The count of write errors.
+   */
+  uint32_t write_errors;
+
+  /**
+   * @brief The count of file rotations or device wrap-arounds.
+   */
+  uint32_t rotations;
+
+  /**
+   * @brief The index of the current file.
+   */
+  uint32_t file_index;
+} rtems_record_file_server_statistics;
+
+/**
+ * @brief The record file server control.
+ *
+ * The members of this structure are private and shall not be accessed
+ * directly by the application.
+ */
+typedef struct {
+  rtems_record_file_server_config     config;
+  rtems_record_file_server_statistics stats;
+  rtems_mutex                         mutex;
+  rtems_id                            task;
+  rtems_id                            timer;
+  rtems_id                            caller;
+  int                                 fd;
+  off_t                               offset;
+  char                                file_name[ 128 ];
+} rtems_record_file_server;
+
+/**
+ * @brief Starts a record file server task.
+ *
+ * The task periodically drains the record items on all processors and writes
+ * them to a rotating set of files or to a raw device.  It uses no buffers, the
+ * items are written directly from the per-processor ring buffers.
+ *
+ * @param server The record file server control.  It shall be valid until the
+ *   server is stopped by rtems_record_stop_file_server().
+ * @param config The record file server configuration.  It is copied to the
+ *   server control.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The server, configuration, or path was NULL.
+ * @retval RTEMS_INVALID_NAME The path was too long.
+ * @retval RTEMS_INVALID_SIZE The file size was less than the size of the
+ *   record stream header and the end marker plus four times the size of a
+ *   per-processor ring buffer.
+ * @retval RTEMS_IO_ERROR The first file could not be opened.
+ * @retval other The task or timer creation failed.
+ */
+rtems_status_code rtems_record_start_file_server(
+  rtems_record_file_server              *server,
+  const rtems_record_file_server_config *config
+);
+
+/**
+ * @brief Stops a record file server task.
+ *
+ * The record items are drained one last time and the current file is closed.
+ *
+ * @param server The record file server control.
+ */
+void rtems_record_stop_file_server( rtems_record_file_server *server );
+
+/**
+ * @brief Gets the statistics of a record file server.
+ *
+ * @param server The record file server control.
+ * @param[out] stats The statistics.
+ */
+void rtems_record_get_file_server_statistics(
+  rtems_record_file_server            *server,
+  rtems_record_file_server_statistics *stats
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -2055,6 +2055,19 @@ rtems_status_code rtems_interrupt_handler_iterate(
  */
 #define RTEMS_INTERRUPT_SERVER_DEFAULT 0
 
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief The constant represents the set of interrupt servers created by
+ *   rtems_interrupt_server_initialize() with load balanced placement.
+ *
+ * Interrupt handlers installed by rtems_interrupt_server_handler_install()
+ * with this server index are placed on the least loaded interrupt server of
+ * the set.  They may be moved to another interrupt server of the set by
+ * rtems_interrupt_server_balance().
+ */
+#define RTEMS_INTERRUPT_SERVER_BALANCED 0xffffffff
+
 /* Generated from spec:/rtems/intr/if/server-control */
 
 /**
@@ -2096,6 +2109,36 @@ typedef struct rtems_interrupt_server_control {
    */
   uint32_t index;
 
+  /**
+   * @brief This member is the count of interrupt vector entries processed by
+   *   the server.
+   */
+  uint32_t entry_count;
+
+  /**
+   * @brief This member is the total time in CPU counter ticks spent in
+   *   interrupt handlers of interrupt vector entries by the server.
+   */
+  uint64_t service_time;
+
+  /**
+   * @brief This member is the value of the service time member at the last
+   *   load balancing.
+   */
+  uint64_t balance_service_time;
+
+  /**
+   * @brief This member is the service time in CPU counter ticks of the last
+   *   automatic load balancing interval of the server.
+   */
+  uint64_t recent_load;
+
+  /**
+   * @brief This member is the clock tick count at the end of the last
+   *   automatic load balancing interval of the server.
+   */
+  uint32_t balance_ticks;
+
   /**
    * @brief This member is the node for the interrupt server registry.
    */
@@ -2291,7 +2334,9 @@ rtems_status_code rtems_interrupt_server_create(
  *
  * @param server_index is the interrupt server index.  The constant
  *   #RTEMS_INTERRUPT_SERVER_DEFAULT may be used to specify the default
- *   interrupt server.
+ *   interrupt server.  The constant #RTEMS_INTERRUPT_SERVER_BALANCED may be
+ *   used to place the handler on the least loaded interrupt server created by
+ *   rtems_interrupt_server_initialize().
  *
  * @param vector is the interrupt vector number.
  *
@@ -2638,6 +2683,169 @@ rtems_status_code rtems_interrupt_server_move(
   uint32_t            destination_server_index
 );
 
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief Balances the load of the interrupt servers created by
+ *   rtems_interrupt_server_initialize().
+ *
+ * The interrupt handlers installed with the #RTEMS_INTERRUPT_SERVER_BALANCED
+ * server index are distributed to the interrupt servers so that the time spent
+ * in interrupt handlers since the last load balancing is evenly distributed.
+ * Interrupt handlers installed with an explicit server index are not moved,
+ * however, their service time contributes to the load of their server.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_NO_MEMORY There was not enough memory to carry out the load
+ *   balancing.
+ *
+ * @par Notes
+ * The directive may be called periodically by an application task to adapt
+ * the interrupt handler placement to the actual interrupt load.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive shall not be called from within the context of an interrupt
+ *   server.  Calling the directive from within the context of an interrupt
+ *   server is undefined behaviour.
+ *
+ * * The directive sends a request to another task and waits for a response.
+ *   This may cause the calling task to be blocked and unblocked.
+ * @endparblock
+ */
+rtems_status_code rtems_interrupt_server_balance( void );
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief Sets the automatic load balancing interval of the interrupt servers
+ *   created by rtems_interrupt_server_initialize().
+ *
+ * @param interval is the automatic load balancing interval in clock ticks.
+ *   The value zero disables the automatic load balancing.
+ *
+ * When an interrupt server created by rtems_interrupt_server_initialize()
+ * processed interrupt vector entries and the interval elapsed since its last
+ * check, then the server compares the time it spent in interrupt handlers
+ * during the interval with the time spent by the other servers of the set.
+ * If the server is more loaded than the least loaded server, then it moves
+ * one interrupt handler installed with the #RTEMS_INTERRUPT_SERVER_BALANCED
+ * server index to the least loaded server, if this reduces the load
+ * imbalance.  The interrupt servers carry out the moves in their own context,
+ * so the automatic load balancing does not block the servers.  The default
+ * interval is one second.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within any runtime context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+void rtems_interrupt_server_set_balance_interval( rtems_interval interval );
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief This structure provides the statistics of the interrupt server entry
+ *   of an interrupt vector.
+ *
+ * @par Notes
+ * See also rtems_interrupt_server_get_statistics().
+ */
+typedef struct {
+  /**
+   * @brief This member is the index of the interrupt server processing the
+   *   interrupt vector.
+   */
+  uint32_t server_index;
+
+  /**
+   * @brief This member is true, if the interrupt vector is subject to load
+   *   balancing, otherwise it is false.
+   */
+  bool balanced;
+
+  /**
+   * @brief This member is the count of services of the interrupt vector.
+   */
+  unsigned long count;
+
+  /**
+   * @brief This member is the maximum time in nanoseconds from the interrupt
+   *   to the start of the service in the interrupt server.
+   */
+  uint64_t max_latency;
+
+  /**
+   * @brief This member is the total time in nanoseconds from the interrupt to
+   *   the start of the service in the interrupt server.
+   */
+  uint64_t total_latency;
+
+  /**
+   * @brief This member is the maximum time in nanoseconds spent in the
+   *   interrupt handlers.
+   */
+  uint64_t max_service_time;
+
+  /**
+   * @brief This member is the total time in nanoseconds spent in the interrupt
+   *   handlers.
+   */
+  uint64_t total_service_time;
+} rtems_interrupt_server_statistics;
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief Gets the statistics of the interrupt server entry of the interrupt
+ *   vector.
+ *
+ * @param vector is the interrupt vector number.
+ *
+ * @param[out] statistics is the pointer to an
+ *   ::rtems_interrupt_server_statistics object.  When the directive call is
+ *   successful, the statistics will be stored in this object.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``statistics`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no interrupt vector associated with the
+ *   number specified by ``vector``.
+ *
+ * @retval ::RTEMS_UNSATISFIED There was no interrupt server handler installed
+ *   at the interrupt vector.
+ *
+ * @par Notes
+ * The directive is intended for system information and diagnostics.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may obtain and release the interrupt support mutex.  This may
+ *   cause the calling task to be preempted.
+ *
+ * * The directive acquires and releases the lock of the interrupt server
+ *   which services the vector to read the counters.
+ * @endparblock
+ */
+rtems_status_code rtems_interrupt_server_get_statistics(
+  rtems_vector_number                vector,
+  rtems_interrupt_server_statistics *statistics
+);
+
 /* Generated from spec:/rtems/intr/if/server-handler-iterate */
 
 /**
@@ -2759,6 +2967,52 @@ typedef struct {
    * @brief This member is the interrupt server actions list head.
    */
   rtems_interrupt_server_action *actions;
+
+  /**
+   * @brief This member is the CPU counter value of the last submission.
+   */
+  CPU_Counter_ticks submitted;
+
+  /**
+   * @brief This member is true, if the entry is subject to load balancing,
+   *   otherwise it is false.
+   */
+  bool balanced;
+
+  /**
+   * @brief This member is the count of services of the entry.
+   */
+  unsigned long count;
+
+  /**
+   * @brief This member is the maximum time in CPU counter ticks from a
+   *   submission to the start of the service.
+   */
+  CPU_Counter_ticks max_latency;
+
+  /**
+   * @brief This member is the total time in CPU counter ticks from a
+   *   submission to the start of the service.
+   */
+  uint64_t total_latency;
+
+  /**
+   * @brief This member is the maximum time in CPU counter ticks spent in the
+   *   interrupt handlers of the entry.
+   */
+  CPU_Counter_ticks max_service_time;
+
+  /**
+   * @brief This member is the total time in CPU counter ticks spent in the
+   *   interrupt handlers of the entry.
+   */
+  uint64_t total_service_time;
+
+  /**
+   * @brief This member is the value of the total service time member at the
+   *   last load balancing.
+   */
+  uint64_t balance_service_time;
 } rtems_interrupt_server_entry;
 
 /* Generated from spec:/rtems/intr/if/server-entry-initialize */
@@ -613,6 +613,223 @@ rtems_status_code rtems_timer_initiate_server(
   rtems_attribute     attribute_set
 );
 
+/**
+ * @ingroup RTEMSAPIClassicTimer
+ *
+ * @brief This constant indicates that a timer server created by
+ *   rtems_timer_server_create() has no processor affinity.
+ */
+#define RTEMS_TIMER_SERVER_ANY_PROCESSOR 0xffffffff
+
+/**
+ * @ingroup RTEMSAPIClassicTimer
+ *
+ * @brief This constant represents the identifier of the default Timer Server
+ *   initiated by rtems_timer_initiate_server().
+ */
+#define RTEMS_TIMER_SERVER_DEFAULT 0
+
+/**
+ * @ingroup RTEMSAPIClassicTimer
+ *
+ * @brief This constant defines the count of bins of the Timer Server lateness
+ *   histogram.
+ *
+ * The bin with index zero counts timer service routines with a lateness of
+ * less than one microsecond.  The bin with index ``i`` greater than zero and
+ * less than the last index counts timer service routines with a lateness of
+ * at least 2 to the power of ``i - 1`` microseconds and less than 2 to the
+ * power of ``i`` microseconds.  The last bin counts all timer service routines
+ * with a greater lateness.
+ */
+#define RTEMS_TIMER_SERVER_LATENESS_BIN_COUNT 16
+
+/**
+ * @ingroup RTEMSAPIClassicTimer
+ *
+ * @brief This structure provides the statistics of a Timer Server.
+ *
+ * The lateness of a timer service routine is the time between the expiration
+ * of the timer and the start of the timer service routine in the context of
+ * the Timer Server task.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the identifier of the Timer Server task.
+   */
+  rtems_id server_id;
+
+  /**
+   * @brief This member contains the count of timer service routines invoked
+   *   by the Timer Server.
+   */
+  uint32_t routines;
+
+  /**
+   * @brief This member contains the maximum lateness in nanoseconds.
+   */
+  uint32_t max_lateness;
+
+  /**
+   * @brief This member contains the lateness histogram, see
+   *   #RTEMS_TIMER_SERVER_LATENESS_BIN_COUNT.
+   */
+  uint32_t lateness[ RTEMS_TIMER_SERVER_LATENESS_BIN_COUNT ];
+} rtems_timer_server_statistics;
+
+/**
+ * @ingroup RTEMSAPIClassicTimer
+ *
+ * @brief Creates an additional Timer Server.
+ *
+ * @param name is the name of the Timer Server task.
+ *
+ * @param priority is the task priority.
+ *
+ * @param stack_size is the task stack size in bytes.
+ *
+ * @param attribute_set is the task attribute set.
+ *
+ * @param cpu_index is the index of the processor to which the Timer Server
+ *   task shall be bound, or #RTEMS_TIMER_SERVER_ANY_PROCESSOR.
+ *
+ * @param[out] id is the pointer to an object identifier variable.  When the
+ *   directive call is successful, the identifier of the Timer Server task will
+ *   be stored in this variable.
+ *
+ * This directive creates and starts a Timer Server task.  In contrast to the
+ * default Timer Server initiated by rtems_timer_initiate_server(), any number
+ * of these Timer Servers may be created.  Timers are bound to a Timer Server
+ * by rtems_timer_set_server().  This allows to execute long running timer
+ * service routines in a different Timer Server than latency sensitive timer
+ * service routines.
+ *
+ * If ``cpu_index`` is not #RTEMS_TIMER_SERVER_ANY_PROCESSOR, then the Timer
+ * Server task is moved to the scheduler owning the processor and its
+ * processor affinity is set to this processor.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``id`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NAME The ``cpu_index`` parameter was invalid or the
+ *   processor was not owned by a scheduler.
+ *
+ * @retval ::RTEMS_NO_MEMORY There was not enough memory in the RTEMS
+ *   Workspace to allocate the Timer Server control block.
+ *
+ * @retval ::RTEMS_INVALID_PRIORITY The task priority was invalid.
+ *
+ * @retval ::RTEMS_TOO_MANY There was no inactive task object available to
+ *   create the Timer Server task.
+ *
+ * @retval ::RTEMS_UNSATISFIED There was not enough memory to allocate the task
+ *   storage area.
+ *
+ * @par Notes
+ * The Timer Server task is created using the rtems_task_create() directive and
+ * must be accounted for when configuring the system.  Timer Servers cannot be
+ * deleted.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may allocate memory from the RTEMS Workspace.
+ * @endparblock
+ */
+rtems_status_code rtems_timer_server_create(
+  rtems_name          name,
+  rtems_task_priority priority,
+  size_t              stack_size,
+  rtems_attribute     attribute_set,
+  uint32_t            cpu_index,
+  rtems_id           *id
+);
+
+/* Generated from spec:/rtems/timer/if/set-server */
+
+/**
+ * @ingroup RTEMSAPIClassicTimer
+ *
+ * @brief Binds the timer to a Timer Server.
+ *
+ * @param id is the timer identifier.
+ *
+ * @param server_id is the identifier of the Timer Server task returned by
+ *   rtems_timer_server_create(), or #RTEMS_TIMER_SERVER_DEFAULT.
+ *
+ * This directive cancels the timer specified by ``id`` and binds it to the
+ * Timer Server specified by ``server_id``.  The timer service routines of
+ * subsequent rtems_timer_server_fire_after() and
+ * rtems_timer_server_fire_when() calls for this timer are invoked in the
+ * context of this Timer Server.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no Timer Server associated with the
+ *   identifier specified by ``server_id``.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no timer associated with the identifier
+ *   specified by ``id``.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ *
+ * * The directive may be called from within task context.
+ * @endparblock
+ */
+rtems_status_code rtems_timer_set_server( rtems_id id, rtems_id server_id );
+
+/* Generated from spec:/rtems/timer/if/server-get-statistics */
+
+/**
+ * @ingroup RTEMSAPIClassicTimer
+ *
+ * @brief Gets the statistics of a Timer Server.
+ *
+ * @param server_id is the identifier of the Timer Server task, or
+ *   #RTEMS_TIMER_SERVER_DEFAULT.
+ *
+ * @param[out] statistics is the pointer to a statistics variable.  When the
+ *   directive call is successful, the statistics of the Timer Server will be
+ *   stored in this variable.
+ *
+ * @param reset is true, if the statistics of the Timer Server shall be reset
+ *   after they were obtained, otherwise it is false.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``statistics`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no Timer Server associated with the
+ *   identifier specified by ``server_id``.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ *
+ * * The directive may be called from within task context.
+ * @endparblock
+ */
+rtems_status_code rtems_timer_server_get_statistics(
+  rtems_id                       server_id,
+  rtems_timer_server_statistics *statistics,
+  bool                           reset
+);
+
 /* Generated from spec:/rtems/timer/if/server-fire-after */
 
 /**
@@ -639,6 +856,9 @@ rtems_status_code rtems_timer_initiate_server(
  *
  * @retval ::RTEMS_INCORRECT_STATE The Timer Server was not initiated.
  *
+ * @retval ::RTEMS_INCORRECT_STATE The timer was not bound to a Timer Server
+ *   and the default Timer Server was not initiated.
+ *
  * @retval ::RTEMS_INVALID_NUMBER The ``ticks`` parameter was 0.
  *
  * @retval ::RTEMS_INVALID_ADDRESS The ``routine`` parameter was NULL.
@@ -692,6 +912,9 @@ rtems_status_code rtems_timer_server_fire_after(
  *
  * @retval ::RTEMS_INCORRECT_STATE The Timer Server was not initiated.
  *
+ * @retval ::RTEMS_INCORRECT_STATE The timer was not bound to a Timer Server
+ *   and the default Timer Server was not initiated.
+ *
  * @retval ::RTEMS_NOT_DEFINED The system date and time was not set.
  *
  * @retval ::RTEMS_INVALID_ADDRESS The ``routine`` parameter was NULL.
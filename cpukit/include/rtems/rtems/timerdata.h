@@ -56,6 +56,16 @@ typedef struct {
   Watchdog_Interval start_time;
   /** This field is the timer stop time point in ticks. */
   Watchdog_Interval stop_time;
+  /**
+   * This field is the timer server bound to the timer.  It is NULL for timers
+   * using the default timer server.
+   */
+  struct Timer_server_Control *server;
+  /**
+   * This field is the CPU counter value when the timer was submitted to the
+   * timer server.
+   */
+  CPU_Counter_ticks submit_time;
 }   Timer_Control;
 
 /**
@@ -46,6 +46,33 @@ typedef struct Timer_server_Control {
   Chain_Control Pending;
 
   Objects_Id server_id;
+
+  /**
+   * @brief This member is the node for the chain of all timer servers.
+   */
+  Chain_Node Node;
+
+  /**
+   * @brief This member is the count of timer service routines invoked by the
+   *   timer server.
+   *
+   * It is protected by the timer server lock.
+   */
+  uint32_t routines;
+
+  /**
+   * @brief This member is the maximum lateness in nanoseconds.
+   *
+   * It is protected by the timer server lock.
+   */
+  uint32_t max_lateness;
+
+  /**
+   * @brief This member is the lateness histogram.
+   *
+   * It is protected by the timer server lock.
+   */
+  uint32_t lateness[ RTEMS_TIMER_SERVER_LATENESS_BIN_COUNT ];
 } Timer_server_Control;
 
 /**
@@ -55,6 +82,17 @@ typedef struct Timer_server_Control {
  */
 extern Timer_server_Control *volatile _Timer_server;
 
+/**
+ * @brief The chain of all timer servers.
+ *
+ * This chain contains the default timer server and all timer servers created
+ * by rtems_timer_server_create().  Timer servers are never removed from the
+ * chain.  Timer servers are appended to the chain under the object allocator
+ * lock and an ISR lock, so the emptiness of the chain may be checked without
+ * the object allocator lock.
+ */
+extern Chain_Control _Timer_server_Chain;
+
 /**
  *  @brief Timer_Allocate
  *
@@ -180,6 +218,44 @@ void _Timer_Routine_adaptor( Watchdog_Control *the_watchdog );
 
 void _Timer_server_Routine_adaptor( Watchdog_Control *the_watchdog );
 
+/**
+ * @brief Gets the timer server of the timer.
+ *
+ * @param the_timer is the timer.
+ *
+ * @retval NULL The timer is not bound to a timer server and the default timer
+ *   server was not initiated.
+ *
+ * @return Returns the timer server bound to the timer, otherwise the default
+ *   timer server.
+ */
+RTEMS_INLINE_ROUTINE Timer_server_Control *_Timer_server_Get(
+  const Timer_Control *the_timer
+)
+{
+  Timer_server_Control *timer_server;
+
+  timer_server = the_timer->server;
+
+  if ( timer_server == NULL ) {
+    timer_server = _Timer_server;
+  }
+
+  return timer_server;
+}
+
+/**
+ * @brief Checks if at least one timer server is available.
+ *
+ * @retval true At least one timer server is available.
+ *
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Timer_server_Is_any_available( void )
+{
+  return !_Chain_Is_empty( &_Timer_server_Chain );
+}
+
 RTEMS_INLINE_ROUTINE void _Timer_server_Acquire_critical(
   Timer_server_Control *timer_server,
   ISR_lock_Context     *lock_context
@@ -0,0 +1,134 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rtl
+ *
+ * @brief RTEMS Run-Time Linker Relocated Image Cache.
+ *
+ * The relocated image cache stores the sections of an object file after the
+ * object file has been relocated. The next time the same object file is
+ * loaded the relocated sections are read from the cache and the relocation
+ * records are not processed.
+ *
+ * A relocated image depends on the base image's symbols, the contents of the
+ * object file, the addresses the object file's sections and trampolines are
+ * allocated at and the contents and addresses of the object files it
+ * depends on. The image is keyed by a hash of the base image's symbol tables
+ * and the contents of the object file. The addresses and the dependents are
+ * held in the image and checked when it is loaded. A system that loads the
+ * same object files in the same order on each boot allocates the same
+ * addresses.
+ *
+ * An object file with unresolved externals, bound lazily or using
+ * architecture specific sections is not cached.
+ *
+ * The cache is disabled by default. Set the path of a directory to hold the
+ * images to enable it.
+ */
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#if !defined (_RTEMS_RTL_IMAGE_CACHE_H_)
+#define _RTEMS_RTL_IMAGE_CACHE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <sha256.h>
+
+#include <rtems/rtl/rtl-obj-fwd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * The relocated image cache.
+ */
+typedef struct rtems_rtl_image_cache
+{
+  char*      path; /**< The directory holding the images. NULL if the cache
+                    *   is disabled. */
+  SHA256_CTX base; /**< The hash of the base image's symbol tables. */
+} rtems_rtl_image_cache;
+
+/**
+ * Set the directory the relocated images are held in. The directory must
+ * exist. Setting the path to NULL disables the cache.
+ *
+ * @param path The path of the directory.
+ * @retval true The path has been set.
+ * @retval false The path could not be set. The RTL error has the error.
+ */
+bool rtems_rtl_image_cache_path (const char* path);
+
+/**
+ * Open the image cache. The cache is disabled.
+ *
+ * @param cache The image cache to open.
+ */
+void rtems_rtl_image_cache_open (rtems_rtl_image_cache* cache);
+
+/**
+ * Add a base image symbol table to the hash of the base image.
+ *
+ * @param cache The image cache.
+ * @param esyms The symbol table.
+ * @param size The size of the symbol table.
+ */
+void rtems_rtl_image_cache_base_add (rtems_rtl_image_cache* cache,
+                                     const unsigned char*   esyms,
+                                     unsigned int           size);
+
+/**
+ * Load an object file's relocated image from the cache. The sections and
+ * the trampolines must be allocated and the symbols located. If the cache is
+ * enabled the object file's identifier is set.
+ *
+ * @param obj The object file to load the image of.
+ * @param fd The object file's file descriptor.
+ * @retval true The relocated image has been loaded.
+ * @retval false There is no valid image in the cache. The object file needs
+ *               to be loaded and relocated.
+ */
+bool rtems_rtl_image_cache_load (rtems_rtl_obj* obj, int fd);
+
+/**
+ * Store an object file's relocated image in the cache. Errors are ignored.
+ *
+ * @param obj The object file to store the image of.
+ * @param link_time The time in nanoseconds loading and relocating the
+ *                  sections took.
+ */
+void rtems_rtl_image_cache_store (rtems_rtl_obj* obj, uint64_t link_time);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif
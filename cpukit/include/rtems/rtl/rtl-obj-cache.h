@@ -33,6 +33,11 @@
  *
  * You can have more than one cache for a single file all looking at different
  * parts of the file.
+ *
+ * A file that is resident in memory, for example an IMFS linear file created
+ * by rtems_tarfs_load(), is mapped using the file's mmap handler. Reads by
+ * reference return a pointer into the file's image and nothing is copied. The
+ * size of a reference is not limited by the cache's size.
  */
 
 #if !defined (_RTEMS_RTL_OBJ_CACHE_H_)
@@ -59,6 +64,10 @@ typedef struct rtems_rtl_obj_cache
   size_t   level;     /**< The amount of data in the cache. A file can be
                        * smaller than the cache file. */
   uint8_t* buffer;    /**< The buffer */
+  uint8_t* image;     /**< The file's image if resident in memory else
+                       * NULL. */
+  size_t   reads;     /**< The number of times the buffer has been filled
+                       * from a file. */
 } rtems_rtl_obj_cache;
 
 /**
@@ -86,12 +95,23 @@ void rtems_rtl_obj_cache_close (rtems_rtl_obj_cache* cache);
  */
 void rtems_rtl_obj_cache_flush (rtems_rtl_obj_cache* cache);
 
+/**
+ * Is the file resident in memory and referenced in place by the cache?
+ *
+ * @param cache The cache to check.
+ * @param fd The file descriptor. Must be an open file.
+ * @retval true The cache references the file's data in place.
+ * @retval false The file's data is read into the cache buffer.
+ */
+bool rtems_rtl_obj_cache_in_place (rtems_rtl_obj_cache* cache, int fd);
+
 /**
  * Read data by reference. The length contains the amount of data that should
  * be available in the cache and referenced by the buffer handle. It must be
  * less than or equal to the size of the cache. This call will return the
  * amount of data that is available. It can be less than you ask if the offset
- * and size is past the end of the file.
+ * and size is past the end of the file. If the file is referenced in place
+ * the length can be larger than the size of the cache.
  *
  * @param cache The cache to reference data from.
  * @param fd The file descriptor. Must be an open file.
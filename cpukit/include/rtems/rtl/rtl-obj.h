@@ -172,6 +172,17 @@ typedef bool (*rtems_rtl_obj_depends_iterator) (rtems_rtl_obj* obj,
                                              *   parsing. */
 #define RTEMS_RTL_OBJ_DEP_VISITED  (1 << 4) /**< Dependency loop detection. */
 #define RTEMS_RTL_OBJ_CTOR_RUN     (1 << 5) /**< Constructors have been called. */
+#define RTEMS_RTL_OBJ_LAZY         (1 << 6) /**< Bind function calls to external
+                                             *   symbols on the first call. */
+#define RTEMS_RTL_OBJ_IMAGE_ID     (1 << 7) /**< The image identifier is
+                                             *   valid. */
+#define RTEMS_RTL_OBJ_IMAGE        (1 << 8) /**< Loaded from the relocated image
+                                             *   cache. */
+
+/**
+ * The size of an object file's image identifier.
+ */
+#define RTEMS_RTL_OBJ_IMAGE_ID_SIZE (32)
 
 /**
  * RTL Object. There is one for each object module loaded plus one for the base
@@ -235,6 +246,15 @@ struct rtems_rtl_obj
   size_t              tramp_relocs; /**< Number of slots reserved for
                                      *   relocs. The remainder are for
                                      *   unresolved symbols. */
+  void*               lazy;         /**< Lazy binding table. */
+  size_t              lazy_syms;    /**< Number of symbols bound lazily. */
+  size_t              lazy_resolved; /**< Number of lazily bound symbols
+                                      *   resolved by a call. */
+  uint8_t             image_id[RTEMS_RTL_OBJ_IMAGE_ID_SIZE];
+                                    /**< The hash of the object file's
+                                     *   contents. */
+  uint64_t            image_saved;  /**< Nanoseconds saved loading the
+                                     *   relocated image from the cache. */
   struct link_map*    linkmap;      /**< For GDB. */
   void*               loader;       /**< The file details specific to a
                                      *   loader. */
@@ -32,22 +32,37 @@ typedef struct rtems_rtl_obj_sym
   const char*      name;    /**< The symbol's name. */
   void*            value;   /**< The value of the symbol. */
   uint32_t         data;    /**< Format specific data. */
+  uint32_t         hash;    /**< The name's hash in the global table. */
 } rtems_rtl_obj_sym;
 
 /**
- * Table of symbols stored in a hash table.
+ * Table of symbols stored in a hash table. The number of buckets is a power
+ * of two and doubles when the average chain length exceeds
+ * RTEMS_RTL_SYMS_GLOBAL_LOAD. A bloom filter with one word per bucket rejects
+ * most lookups of symbols not in the table without visiting a chain.
  */
 typedef struct rtems_rtl_symbols
 {
-  rtems_chain_control* buckets;
-  size_t               nbuckets;
+  rtems_chain_control* buckets;  /**< The hash table's chains. */
+  size_t               nbuckets; /**< The number of buckets. */
+  size_t               nsyms;    /**< The number of symbols in the table. */
+  uintptr_t*           bloom;    /**< The bloom filter, nbuckets words. */
 } rtems_rtl_symbols;
 
+/**
+ * Hash a symbol name. The global symbol table uses this hash.
+ *
+ * @param name The name as an ASCIIZ string.
+ * @return uint32_t The name's hash.
+ */
+uint32_t rtems_rtl_symbol_hash (const char* name);
+
 /**
  * Open a symbol table with the specified number of buckets.
  *
  * @param symbols The symbol table to open.
- * @param buckets The number of buckets in the hash table.
+ * @param buckets The initial number of buckets in the hash table. It is
+ *                rounded up to a power of two.
  * @retval true The symbol is open.
  * @retval false The symbol table could not created. The RTL
  *               error has the error.
@@ -55,6 +55,7 @@ typedef uint32_t rtems_rtl_trace_mask;
 #define RTEMS_RTL_TRACE_DEPENDENCY             (1UL << 14)
 #define RTEMS_RTL_TRACE_BIT_ALLOC              (1UL << 15)
 #define RTEMS_RTL_TRACE_COMP                   (1UL << 16)
+#define RTEMS_RTL_TRACE_IMAGE                  (1UL << 17)
 #define RTEMS_RTL_TRACE_ALL                    (0xffffffffUL & ~(RTEMS_RTL_TRACE_CACHE | \
                                                                  RTEMS_RTL_TRACE_COMP | \
                                                                  RTEMS_RTL_TRACE_GLOBAL_SYM | \
@@ -24,10 +24,13 @@
  * relocations are resolved and removed the table is compacted. The only
  * pointer in the table is the object file poniter. This is used to identify
  * which object the relocation belongs to. There are no linking or back
- * pointers in the unresolved relocations table. The table is scanned for each
- * object file's relocations. This is not fast but the table should be small
- * and if it happens to grow large you have other more pressing issues to
- * resolve in your application.
+ * pointers in the unresolved relocations table.
+ *
+ * The symbol names are indexed by a name table hashed by the name. Adding a
+ * relocation finds the symbol's name without scanning the blocks. Resolving
+ * looks up each unresolved name once in the global symbol table and then
+ * relocates the records waiting for the names found in a single pass over
+ * the blocks.
  *
  * The table holds two (2) types of records:
  *
@@ -39,7 +42,8 @@
  * counts the number of references and the string is removed from the table
  * when the reference count reaches 0. There can be many relocations
  * referencing the symbol. The strings are referenced by a single 16bit
- * unsigned integer which is the count of the string in the table.
+ * unsigned integer which is the string's index in the name table. The index
+ * does not change while the string is in the table.
  *
  * The section the relocation is for in the object is the section number. The
  * relocation data is series of machine word sized fields:
@@ -55,6 +59,7 @@
 #include <rtems.h>
 #include <rtems/chain.h>
 #include "rtl-obj-fwd.h"
+#include "rtl-sym.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -97,6 +102,7 @@ typedef struct rtems_rtl_unresolv_symbol
   uint16_t   refs;     /**< The number of references to this name. */
   uint16_t   flags;    /**< Flags to manage the symbol. */
   uint16_t   length;   /**< The length of this name. */
+  uint16_t   index;    /**< The name's index in the name table. */
   const char name[];   /**< The symbol name. */
 } rtems_rtl_unresolv_symbol;
 
@@ -108,7 +114,7 @@ typedef struct rtems_rtl_unresolv_reloc
 {
   rtems_rtl_obj* obj;     /**< The relocation's object file. */
   uint16_t       flags;   /**< Format specific flags. */
-  uint16_t       name;    /**< The symbol's name. */
+  uint16_t       name;    /**< The symbol's name index. */
   uint16_t       sect;    /**< The target section. */
   rtems_rtl_word rel[3];  /**< Relocation record. */
 } rtems_rtl_unresolv_reloc;
@@ -149,14 +155,33 @@ typedef struct rtems_rtl_unresolv_block
   rtems_rtl_unresolv_rec rec[]; /**< The records. More follow. */
 } rtems_rtl_unresolv_block;
 
+/**
+ * Unresolved name table entry. The entries are chained into hash buckets by
+ * their index. An index of 0 ends a chain.
+ */
+typedef struct rtems_rtl_unresolv_name
+{
+  rtems_rtl_unresolv_rec* rec;  /**< The name's record. NULL if free. */
+  rtems_rtl_obj_sym*      sym;  /**< The symbol found when resolving. */
+  uint32_t                hash; /**< The name's hash. */
+  uint16_t                next; /**< The next index in the chain. */
+} rtems_rtl_unresolv_name;
+
 /**
  * Unresolved table holds the names and relocations.
  */
 typedef struct rtems_rtl_unresolved
 {
-  uint32_t            marker;     /**< Block marker. */
-  size_t              block_recs; /**< The records per blocks allocated. */
-  rtems_chain_control blocks;     /**< List of blocks. */
+  uint32_t                 marker;     /**< Block marker. */
+  size_t                   block_recs; /**< The records per blocks allocated. */
+  rtems_chain_control      blocks;     /**< List of blocks. */
+  rtems_rtl_unresolv_name* names;      /**< The name table. Index 0 is not
+                                        *   used. */
+  uint16_t*                buckets;    /**< The name table's hash buckets. */
+  size_t                   nnames;     /**< The size of the name table and
+                                        *   the number of buckets. A power
+                                        *   of two. */
+  uint16_t                 free;       /**< The first free name index. */
 } rtems_rtl_unresolved;
 
 /**
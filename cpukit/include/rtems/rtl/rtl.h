@@ -26,6 +26,7 @@
 #include <rtems/rtl/rtl-allocator.h>
 #include <rtems/rtl/rtl-archive.h>
 #include <rtems/rtl/rtl-fwd.h>
+#include <rtems/rtl/rtl-image-cache.h>
 #include <rtems/rtl/rtl-obj.h>
 #include <rtems/rtl/rtl-obj-cache.h>
 #include <rtems/rtl/rtl-obj-comp.h>
@@ -65,10 +66,16 @@ extern "C" {
 #define RTL_GLUE(a,b) RTL_XGLUE(a,b)
 
 /**
- * The number of buckets in the global symbol table.
+ * The initial number of buckets in the global symbol table.
  */
 #define RTEMS_RTL_SYMS_GLOBAL_BUCKETS (32)
 
+/**
+ * The average number of symbols per bucket in the global symbol table
+ * before the table grows.
+ */
+#define RTEMS_RTL_SYMS_GLOBAL_LOAD (2)
+
 /**
  * The number of relocation record per block in the unresolved table.
  */
@@ -79,6 +86,16 @@ extern "C" {
  */
 #define RTEMS_RTL_DEPENDENCY_BLOCK_SIZE (16)
 
+/**
+ * An RTEMS specific dlopen mode flag to bind the function calls of the object
+ * file to external symbols on the first call. The RTLD_LAZY mode alone binds
+ * all external symbols when the object file is loaded. An external symbol
+ * that cannot be found on the first call is the
+ * INTERNAL_ERROR_RTL_LAZY_BINDING_FAILED fatal error. Architectures without
+ * lazy binding support ignore the flag.
+ */
+#define RTEMS_RTL_LAZY_BIND (1 << 16)
+
 /**
  * The global debugger interface variable.
  */
@@ -118,6 +135,7 @@ struct rtems_rtl_data
   rtems_rtl_obj_cache   strings;        /**< Strings object file cache. */
   rtems_rtl_obj_cache   relocs;         /**< Relocations object file cache. */
   rtems_rtl_obj_comp    decomp;         /**< The decompression compressor. */
+  rtems_rtl_image_cache image_cache;    /**< The relocated image cache. */
   int                   last_errno;     /**< Last error number. */
   char                  last_error[64]; /**< Last error string. */
 };
@@ -0,0 +1,329 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief This header file provides the interfaces of the heap allocation
+ *   profiler.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_HEAPPROFILER_H
+#define _RTEMS_SCORE_HEAPPROFILER_H
+
+#include <rtems/score/heap.h>
+#include <rtems/score/isrlock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreHeap
+ *
+ * @{
+ */
+
+/**
+ * @brief The count of lifetime histogram bins of an allocation site.
+ *
+ * The bin with index zero counts blocks freed in the clock tick of their
+ * allocation.  The bin with index i > 0 counts lifetimes of at least
+ * 2**(i - 1) and less than 2**i clock ticks.  The last bin counts all longer
+ * lifetimes.
+ */
+#define HEAP_PROFILER_LIFETIME_BIN_COUNT 16
+
+/**
+ * @brief The heaps observed by the heap allocation profiler.
+ */
+typedef enum {
+  HEAP_PROFILER_MALLOC,
+  HEAP_PROFILER_WORKSPACE
+} Heap_Profiler_Kind;
+
+/**
+ * @brief The trailer placed at the end of each profiled block.
+ *
+ * Profiled allocations are extended by the size of the trailer.  The trailer
+ * is located at the end of the allocated area, so that it can be found with
+ * _Heap_Size_of_alloc_area().
+ */
+typedef struct {
+  /**
+   * @brief The allocation site.
+   */
+  uintptr_t site;
+
+  /**
+   * @brief The requested allocation size in bytes.
+   */
+  uintptr_t size;
+
+  /**
+   * @brief The clock tick of the allocation.
+   */
+  uint32_t ticks;
+
+  /**
+   * @brief The profiler generation of the allocation.
+   *
+   * Frees and resizes are only accounted if this is the current generation.
+   */
+  uint32_t generation;
+
+  /**
+   * @brief The index of the processor which accounted the allocation.
+   */
+  uint32_t cpu_index;
+
+  /**
+   * @brief The check value to tell profiled blocks from other blocks.
+   */
+  uint32_t check;
+} Heap_Profiler_Trailer;
+
+/**
+ * @brief The statistics of an allocation site.
+ */
+typedef struct {
+  /**
+   * @brief The allocation site.
+   */
+  uintptr_t site;
+
+  /**
+   * @brief The heap of the allocation site, see Heap_Profiler_Kind.
+   */
+  uint32_t kind;
+
+  /**
+   * @brief The count of allocations.
+   */
+  uint32_t allocations;
+
+  /**
+   * @brief The count of frees.
+   */
+  uint32_t frees;
+
+  /**
+   * @brief The total count of allocated bytes.
+   */
+  uint64_t allocated_bytes;
+
+  /**
+   * @brief The total count of freed bytes.
+   */
+  uint64_t freed_bytes;
+
+  /**
+   * @brief The lifetime histogram of freed blocks.
+   */
+  uint32_t lifetimes[ HEAP_PROFILER_LIFETIME_BIN_COUNT ];
+} Heap_Profiler_Site;
+
+/**
+ * @brief The per-processor allocation site hash table.
+ *
+ * Frees and resizes are accounted in the table of the processor which
+ * accounted the allocation.  So, the freed bytes of an entry never exceed its
+ * allocated bytes.  The statistics of an allocation site are the sum of the
+ * entries of all processors.
+ */
+typedef struct {
+  /**
+   * @brief The lock protecting the table.
+   */
+  ISR_LOCK_MEMBER( Lock )
+
+  /**
+   * @brief The table of allocation sites.
+   */
+  Heap_Profiler_Site *sites;
+
+  /**
+   * @brief The mask to get the table index of a hash value.
+   */
+  uint32_t mask;
+
+  /**
+   * @brief The count of operations not accounted since the table was full.
+   */
+  uint32_t dropped;
+} Heap_Profiler_Per_CPU;
+
+/**
+ * @brief The heap allocation profiler control.
+ */
+typedef struct {
+  /**
+   * @brief The per-processor tables.
+   *
+   * This pointer is NULL until the profiler is started for the first time.
+   * The per-processor controls are never freed.
+   */
+  Heap_Profiler_Per_CPU *per_cpu;
+
+  /**
+   * @brief Indicates if new allocations are profiled.
+   */
+  bool enabled;
+
+  /**
+   * @brief The current generation.
+   *
+   * It is incremented each time the tables are cleared or replaced.  Blocks
+   * allocated in a previous generation are no longer accounted.
+   */
+  uint32_t generation;
+} Heap_Profiler_Control;
+
+/**
+ * @brief The heap allocation profiler.
+ */
+extern Heap_Profiler_Control _Heap_Profiler;
+
+/**
+ * @brief Extends the allocation size for the profiler trailer.
+ *
+ * @param size is the requested allocation size.
+ *
+ * @return Returns the size to allocate.  If it differs from the requested
+ *   size, then _Heap_Profiler_Allocate() shall be called after a successful
+ *   allocation.
+ */
+RTEMS_INLINE_ROUTINE uintptr_t _Heap_Profiler_Extend_size( uintptr_t size )
+{
+  if (
+    RTEMS_PREDICT_TRUE( !_Heap_Profiler.enabled )
+      || size > UINTPTR_MAX - sizeof( Heap_Profiler_Trailer )
+  ) {
+    return size;
+  }
+
+  return size + sizeof( Heap_Profiler_Trailer );
+}
+
+/**
+ * @brief Accounts an allocation and places the trailer.
+ *
+ * The caller shall own the allocated block.
+ *
+ * @param heap is the heap of the block.
+ * @param alloc_begin is the begin of the allocated area.
+ * @param size is the requested allocation size.
+ * @param site is the allocation site.
+ * @param kind is the heap kind.
+ */
+void _Heap_Profiler_Allocate(
+  Heap_Control       *heap,
+  void               *alloc_begin,
+  uintptr_t           size,
+  void               *site,
+  Heap_Profiler_Kind  kind
+);
+
+/**
+ * @brief Gets the trailer of a profiled block.
+ *
+ * The caller shall own the allocated block.
+ *
+ * @param heap is the heap of the block.
+ * @param alloc_begin is the begin of the allocated area.
+ * @param[out] trailer is the trailer of the block.
+ *
+ * @retval true The block is profiled.
+ * @retval false Otherwise.
+ */
+bool _Heap_Profiler_Get_trailer(
+  Heap_Control          *heap,
+  void                  *alloc_begin,
+  Heap_Profiler_Trailer *trailer
+);
+
+/**
+ * @brief Accounts an in-place resize of a profiled block and moves the
+ *   trailer to the new end of the allocated area.
+ *
+ * @param heap is the heap of the block.
+ * @param alloc_begin is the begin of the allocated area.
+ * @param trailer is the trailer obtained before the resize.
+ * @param size is the new requested allocation size.
+ * @param kind is the heap kind.
+ */
+void _Heap_Profiler_Resize(
+  Heap_Control                *heap,
+  void                        *alloc_begin,
+  const Heap_Profiler_Trailer *trailer,
+  uintptr_t                    size,
+  Heap_Profiler_Kind           kind
+);
+
+/**
+ * @brief Accounts the free of a profiled block.
+ *
+ * @param heap is the heap of the block.
+ * @param alloc_begin is the begin of the allocated area.
+ * @param kind is the heap kind.
+ */
+void _Heap_Profiler_Do_free(
+  Heap_Control       *heap,
+  void               *alloc_begin,
+  Heap_Profiler_Kind  kind
+);
+
+/**
+ * @brief Accounts the free of a block, if it is profiled.
+ *
+ * This function shall be called before the block is freed.
+ *
+ * @param heap is the heap of the block.
+ * @param alloc_begin is the begin of the allocated area.
+ * @param kind is the heap kind.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Profiler_Free(
+  Heap_Control       *heap,
+  void               *alloc_begin,
+  Heap_Profiler_Kind  kind
+)
+{
+  /* Blocks profiled by a previous run may still be allocated */
+  if ( RTEMS_PREDICT_FALSE( _Heap_Profiler.per_cpu != NULL ) ) {
+    _Heap_Profiler_Do_free( heap, alloc_begin, kind );
+  }
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_SCORE_HEAPPROFILER_H */
@@ -210,6 +210,7 @@ typedef enum {
   INTERNAL_ERROR_NO_MEMORY_FOR_PER_CPU_DATA = 40,
   INTERNAL_ERROR_TOO_LARGE_TLS_SIZE = 41,
   INTERNAL_ERROR_RTEMS_INIT_TASK_CONSTRUCT_FAILED = 42,
+  INTERNAL_ERROR_RTL_LAZY_BINDING_FAILED = 43,
 } Internal_errors_Core_list;
 
 typedef CPU_Uint32ptr Internal_errors_t;
@@ -0,0 +1,139 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreProfiling
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreProfiling related to latency statistics.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_LATENCYSTATS_H
+#define _RTEMS_SCORE_LATENCYSTATS_H
+
+#include <rtems/score/cpu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSScoreProfiling
+ *
+ * @{
+ */
+
+#if defined(RTEMS_PROFILING)
+
+/**
+ * @brief Count of latency histogram bins.
+ *
+ * The bin with index zero counts latencies of zero CPU counter ticks.  The bin
+ * with index i greater than zero counts latencies of at least 2^(i - 1) and
+ * less than 2^i CPU counter ticks.  The last bin counts all greater latencies.
+ */
+#define LATENCY_STATS_BIN_COUNT 32
+
+/**
+ * @brief Latency statistics.
+ *
+ * The latency is the time elapsed between an event, for example the unblock
+ * of a thread, and the reaction to this event, for example the dispatch of
+ * the thread.
+ */
+typedef struct {
+  /**
+   * @brief The count of latency samples.
+   */
+  uint64_t count;
+
+  /**
+   * @brief The total latency in CPU counter ticks.
+   *
+   * The average latency is the total latency divided by the count of latency
+   * samples.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_latency;
+
+  /**
+   * @brief The maximum latency in CPU counter ticks.
+   */
+  uint64_t max_latency;
+
+  /**
+   * @brief The log2 histogram of latencies.
+   */
+  uint32_t bins[ LATENCY_STATS_BIN_COUNT ];
+} Latency_Stats;
+
+/**
+ * @brief Adds a latency sample to the latency statistics.
+ *
+ * @param[in, out] stats are the latency statistics.
+ *
+ * @param latency is the latency in CPU counter ticks.
+ */
+static inline void _Latency_Stats_add(
+  Latency_Stats     *stats,
+  CPU_Counter_ticks  latency
+)
+{
+  unsigned int bin;
+
+  if ( latency != 0 ) {
+    bin = 64U - (unsigned int) __builtin_clzll( (unsigned long long) latency );
+
+    if ( bin >= LATENCY_STATS_BIN_COUNT ) {
+      bin = LATENCY_STATS_BIN_COUNT - 1;
+    }
+  } else {
+    bin = 0;
+  }
+
+  ++stats->count;
+  stats->total_latency += latency;
+
+  if ( stats->max_latency < latency ) {
+    stats->max_latency = latency;
+  }
+
+  ++stats->bins[ bin ];
+}
+
+#endif /* RTEMS_PROFILING */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_LATENCYSTATS_H */
@@ -0,0 +1,180 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreLoadAverage
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreLoadAverage.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_LOADAVERAGE_H
+#define _RTEMS_SCORE_LOADAVERAGE_H
+
+#include <rtems/score/timestamp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSScoreLoadAverage Load Average Handler
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the Load Average Handler implementation.
+ *
+ * The load averages are exponentially decayed averages of the fraction of
+ * time a thread or processor was busy.  The time is divided into periods of
+ * 1/16 second.  At the end of each period, the averages are updated with the
+ * busy fraction of the period.  Periods without an update are accounted
+ * lazily, so the cost of an update or query does not depend on the time
+ * elapsed since the last update.
+ *
+ * @{
+ */
+
+/**
+ * @brief The count of load averages.
+ *
+ * The load averages have time constants of one second, ten seconds, and one
+ * minute.
+ */
+#define LOAD_AVERAGE_COUNT 3
+
+/**
+ * @brief The count of fraction bits of the load average fixed-point values.
+ */
+#define LOAD_AVERAGE_SHIFT 16
+
+/**
+ * @brief The load average fixed-point value representing a fully busy thread
+ *   or processor.
+ */
+#define LOAD_AVERAGE_ONE ( (uint32_t) 1 << LOAD_AVERAGE_SHIFT )
+
+/**
+ * @brief The binary logarithm of the period length in timestamp units.
+ *
+ * The timestamps are in the sbintime_t format, so the period length is
+ * 1/16 second.
+ */
+#define LOAD_AVERAGE_PERIOD_SHIFT 28
+
+/**
+ * @brief The load average control.
+ */
+typedef struct {
+  /**
+   * @brief The load averages at the begin of the current period.
+   *
+   * The values are fixed-point numbers, see #LOAD_AVERAGE_ONE.
+   */
+  uint32_t average[ LOAD_AVERAGE_COUNT ];
+
+  /**
+   * @brief The busy time of the current period.
+   */
+  Timestamp_Control busy;
+
+  /**
+   * @brief The index of the current period.
+   */
+  int64_t period;
+} Load_average_Control;
+
+/**
+ * @brief Adds a busy interval to the load average if the interval ends in a
+ *   later period than the current period.
+ *
+ * Use _Load_average_Add_busy() instead of this function.
+ *
+ * @param[in, out] load is the load average control.
+ *
+ * @param begin is the begin of the busy interval.
+ *
+ * @param end is the end of the busy interval.
+ */
+void _Load_average_Do_add_busy(
+  Load_average_Control *load,
+  Timestamp_Control     begin,
+  Timestamp_Control     end
+);
+
+/**
+ * @brief Adds a busy interval to the load average.
+ *
+ * The caller shall ensure mutual exclusion on the load average control.  The
+ * busy intervals shall be added in chronological order.
+ *
+ * @param[in, out] load is the load average control.
+ *
+ * @param begin is the begin of the busy interval.
+ *
+ * @param end is the end of the busy interval.
+ */
+static inline void _Load_average_Add_busy(
+  Load_average_Control *load,
+  Timestamp_Control     begin,
+  Timestamp_Control     end
+)
+{
+  if ( ( end >> LOAD_AVERAGE_PERIOD_SHIFT ) == load->period ) {
+    load->busy += end - begin;
+  } else {
+    _Load_average_Do_add_busy( load, begin, end );
+  }
+}
+
+/**
+ * @brief Gets the load averages.
+ *
+ * The load averages are decayed up to the begin of the period of the time
+ * point.  The busy time of this period is not accounted.  The load average
+ * control is not modified.
+ *
+ * @param load is the load average control.
+ *
+ * @param now is the current time point.
+ *
+ * @param[out] average is the array which is set to the load averages.
+ */
+void _Load_average_Get(
+  const Load_average_Control *load,
+  Timestamp_Control           now,
+  uint32_t                    average[ LOAD_AVERAGE_COUNT ]
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_SCORE_LOADAVERAGE_H */
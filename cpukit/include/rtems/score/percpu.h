@@ -29,6 +29,8 @@
   #include <rtems/score/assert.h>
   #include <rtems/score/chain.h>
   #include <rtems/score/isrlock.h>
+  #include <rtems/score/latencystats.h>
+  #include <rtems/score/loadaverage.h>
   #include <rtems/score/smp.h>
   #include <rtems/score/timestamp.h>
   #include <rtems/score/watchdog.h>
@@ -40,7 +42,7 @@ extern "C" {
 
 #if defined( RTEMS_SMP )
   #if defined( RTEMS_PROFILING )
-    #define PER_CPU_CONTROL_SIZE_PROFILING 332
+    #define PER_CPU_CONTROL_SIZE_PROFILING 484
   #else
     #define PER_CPU_CONTROL_SIZE_PROFILING 0
   #endif
@@ -57,7 +59,7 @@ extern "C" {
     #define PER_CPU_CONTROL_SIZE_BIG_POINTER 0
   #endif
 
-  #define PER_CPU_CONTROL_SIZE_BASE 180
+  #define PER_CPU_CONTROL_SIZE_BASE 212
   #define PER_CPU_CONTROL_SIZE_APPROX \
     ( PER_CPU_CONTROL_SIZE_BASE + CPU_PER_CPU_CONTROL_SIZE + \
     CPU_INTERRUPT_FRAME_SIZE + PER_CPU_CONTROL_SIZE_PROFILING + \
@@ -309,6 +311,15 @@ typedef struct {
    * This value may overflow.
    */
   uint64_t total_interrupt_time;
+
+  /**
+   * @brief The wake-up latency statistics of threads dispatched on this
+   *   processor.
+   *
+   * The wake-up latency is the time elapsed between the unblock of a thread
+   * and its dispatch on this processor.
+   */
+  Latency_Stats wake_up_latency;
 #endif /* defined( RTEMS_PROFILING ) */
 } Per_CPU_Stats;
 
@@ -461,6 +472,18 @@ typedef struct Per_CPU_Control {
    */
   Timestamp_Control cpu_usage_timestamp;
 
+  /**
+   * @brief The load averages of this processor.
+   *
+   * The processor is busy while it executes a thread other than an idle
+   * thread.
+   *
+   * Protected by the scheduler lock.
+   *
+   * @see _Thread_Update_CPU_time_used().
+   */
+  Load_average_Control Load_average;
+
   /**
    * @brief Watchdog state for this processor.
    */
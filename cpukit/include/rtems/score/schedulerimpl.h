@@ -321,6 +321,7 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Unblock( Thread_Control *the_thread )
   scheduler = _Thread_Scheduler_get_home( the_thread );
 #endif
 
+  _Thread_Wake_up_latency_unblock( the_thread );
   _Scheduler_Acquire_critical( scheduler, &lock_context );
   ( *scheduler->Operations.unblock )( scheduler, the_thread, scheduler_node );
   _Scheduler_Release_critical( scheduler, &lock_context );
@@ -20,6 +20,7 @@
 #define _RTEMS_SCORE_SMPIMPL_H
 
 #include <rtems/score/smp.h>
+#include <rtems/score/atomic.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/processormask.h>
 #include <rtems/fatal.h>
@@ -250,6 +251,186 @@ void _SMP_Multicast_action(
   void                 *arg
 );
 
+/**
+ * @brief Handler invoked when all jobs of an asynchronous SMP multicast
+ *   request were performed.
+ */
+typedef void ( *SMP_Multicast_done_handler )( void *arg );
+
+/**
+ * @brief An asynchronous SMP multicast request.
+ *
+ * The storage of the request is provided by the caller.  It shall be valid
+ * until _SMP_Multicast_request_is_done() returned true or
+ * _SMP_Multicast_request_wait() returned.
+ */
+typedef struct {
+  /**
+   * @brief The job context shared by all jobs of the request.
+   */
+  Per_CPU_Job_context Context;
+
+  /**
+   * @brief The set of target processors of the request.
+   */
+  Processor_mask targets;
+
+  /**
+   * @brief The action handler.
+   */
+  SMP_Action_handler handler;
+
+  /**
+   * @brief The action argument.
+   */
+  void *arg;
+
+  /**
+   * @brief The optional done handler.
+   */
+  SMP_Multicast_done_handler done;
+
+  /**
+   * @brief The done handler argument.
+   */
+  void *done_arg;
+
+  /**
+   * @brief The count of jobs which were not performed yet.
+   */
+  Atomic_Uint pending;
+
+  /**
+   * @brief The per-processor jobs of the request.
+   */
+  Per_CPU_Job Jobs[ CPU_MAXIMUM_PROCESSORS ];
+} SMP_Multicast_request;
+
+/**
+ * @brief A batch of asynchronous SMP multicast requests.
+ *
+ * All requests added to a batch are issued to the target processors by
+ * _SMP_Multicast_batch_flush() with at most one inter-processor interrupt per
+ * target processor.
+ */
+typedef struct {
+  /**
+   * @brief The union of the target processor sets of all requests added to
+   *   the batch since the last flush.
+   */
+  Processor_mask targets;
+} SMP_Multicast_batch;
+
+/**
+ * @brief Initializes the SMP multicast batch.
+ *
+ * @param[out] batch is the batch to initialize.
+ */
+static inline void _SMP_Multicast_batch_initialize(
+  SMP_Multicast_batch *batch
+)
+{
+  _Processor_mask_Zero( &batch->targets );
+}
+
+/**
+ * @brief Adds an asynchronous SMP multicast request to the batch.
+ *
+ * The jobs of the request are queued on the target processors, however, no
+ * inter-processor interrupt is sent.  Target processors may perform the jobs
+ * earlier, if they process their job queue for some other reason.
+ *
+ * @param[in, out] batch is the batch.
+ *
+ * @param[out] request is the request.  The storage shall be valid until the
+ *   request is done.
+ *
+ * @param targets is the set of target processors of the request.
+ *
+ * @param handler is the action handler.
+ *
+ * @param arg is the action argument.
+ *
+ * @param done is the optional handler invoked on the processor which performed
+ *   the last job of the request.  It may be NULL.  The done handler shall not
+ *   release the storage of the request.
+ *
+ * @param done_arg is the done handler argument.
+ */
+void _SMP_Multicast_batch_add(
+  SMP_Multicast_batch        *batch,
+  SMP_Multicast_request      *request,
+  const Processor_mask       *targets,
+  SMP_Action_handler          handler,
+  void                       *arg,
+  SMP_Multicast_done_handler  done,
+  void                       *done_arg
+);
+
+/**
+ * @brief Sends one inter-processor interrupt to each target processor of the
+ *   requests added to the batch.
+ *
+ * The batch is empty afterwards and may be used for new requests.
+ *
+ * @param[in, out] batch is the batch.
+ */
+void _SMP_Multicast_batch_flush( SMP_Multicast_batch *batch );
+
+/**
+ * @brief Initiates an asynchronous SMP multicast action to the set of target
+ *   processors.
+ *
+ * In contrast to _SMP_Multicast_action(), this function does not wait for the
+ * completion of the action.  The caller may be preempted while the request is
+ * in progress.  Use _SMP_Multicast_request_is_done() or
+ * _SMP_Multicast_request_wait() to synchronize with the completion.
+ *
+ * @param[out] request is the request.  The storage shall be valid until the
+ *   request is done.
+ *
+ * @param targets is the set of target processors of the request.
+ *
+ * @param handler is the action handler.
+ *
+ * @param arg is the action argument.
+ *
+ * @param done is the optional done handler, see _SMP_Multicast_batch_add().
+ *
+ * @param done_arg is the done handler argument.
+ */
+void _SMP_Multicast_action_async(
+  SMP_Multicast_request      *request,
+  const Processor_mask       *targets,
+  SMP_Action_handler          handler,
+  void                       *arg,
+  SMP_Multicast_done_handler  done,
+  void                       *done_arg
+);
+
+/**
+ * @brief Checks if all jobs of the asynchronous SMP multicast request were
+ *   performed.
+ *
+ * @param request is the request.
+ *
+ * @retval true The request is done and its storage may be reused.
+ *
+ * @retval false Otherwise.
+ */
+bool _SMP_Multicast_request_is_done( const SMP_Multicast_request *request );
+
+/**
+ * @brief Waits until all jobs of the asynchronous SMP multicast request were
+ *   performed.
+ *
+ * The caller must ensure that no thread dispatch can happen during the call
+ * of this function, see _SMP_Multicast_action().
+ *
+ * @param request is the request.
+ */
+void _SMP_Multicast_request_wait( const SMP_Multicast_request *request );
+
 /**
  * @brief Initiates an SMP multicast action to the set of all online
  * processors.
@@ -136,8 +136,122 @@ typedef struct {
    * @brief The lock stats used for the last lock acquire.
    */
   SMP_lock_Stats *stats;
+
+  /**
+   * @brief The lock acquire time of the last lock acquire in CPU counter
+   *   ticks.
+   */
+  CPU_Counter_ticks acquire_time;
+
+  /**
+   * @brief The call site of the last lock acquire.
+   *
+   * A value of zero indicates an unknown call site.
+   */
+  uintptr_t call_site;
 } SMP_lock_Stats_context;
 
+/**
+ * @brief Count of call site statistics per processor.
+ *
+ * This value shall be a power of two.
+ */
+#define SMP_LOCK_STATS_CALL_SITE_COUNT 256
+
+/**
+ * @brief SMP lock statistics of a call site.
+ *
+ * The call site statistics are accounted for each pair of a call site and
+ * a lock name.
+ */
+typedef struct {
+  /**
+   * @brief The call site which acquired the lock.
+   *
+   * A value of zero indicates an unused entry.
+   */
+  uintptr_t call_site;
+
+  /**
+   * @brief The lock name.
+   */
+  const char *name;
+
+  /**
+   * @brief The maximum lock acquire time in CPU counter ticks.
+   */
+  CPU_Counter_ticks max_acquire_time;
+
+  /**
+   * @brief The maximum lock section time in CPU counter ticks.
+   */
+  CPU_Counter_ticks max_section_time;
+
+  /**
+   * @brief The count of lock uses.
+   */
+  uint64_t usage_count;
+
+  /**
+   * @brief Total lock acquire time in CPU counter ticks.
+   */
+  uint64_t total_acquire_time;
+
+  /**
+   * @brief Total lock section time in CPU counter ticks.
+   */
+  uint64_t total_section_time;
+} SMP_lock_Stats_call_site;
+
+/**
+ * @brief The SMP lock call site statistics of a processor.
+ */
+typedef struct {
+  /**
+   * @brief The count of lock uses which could not be accounted since the
+   *   table was full.
+   */
+  uint32_t dropped;
+
+  /**
+   * @brief The call site statistics hash table.
+   */
+  SMP_lock_Stats_call_site sites[ SMP_LOCK_STATS_CALL_SITE_COUNT ];
+} SMP_lock_Stats_call_site_table;
+
+/**
+ * @brief The SMP lock call site statistics control.
+ */
+typedef struct {
+  /**
+   * @brief The call site statistics tables indexed by processor.
+   *
+   * The tables are allocated on demand and never freed, since lock releases
+   * on other processors may still access them.
+   */
+  SMP_lock_Stats_call_site_table *tables;
+
+  /**
+   * @brief Indicates if the call site statistics are enabled.
+   */
+  bool enabled;
+} SMP_lock_Stats_call_site_control;
+
+/**
+ * @brief The SMP lock call site statistics.
+ */
+extern SMP_lock_Stats_call_site_control _SMP_lock_Stats_call_sites;
+
+/**
+ * @brief Gets an address inside the function using this macro.
+ *
+ * This is used as the call site of inline lock acquire sequences, since they
+ * have no return address of their own.  For inline functions, the address is
+ * inside the function into which they are inlined.
+ */
+#define _SMP_lock_Stats_here() \
+  ( { __label__ _here; _here: (uintptr_t) &&_here; } )
+
 /**
  * @brief SMP lock statistics initializer for static initialization.
  */
@@ -232,8 +346,24 @@ static inline void _SMP_lock_Stats_acquire_end(
   ++stats->contention_counts[ queue_length ];
 
   stats_context->stats = stats;
+  stats_context->acquire_time = delta;
+  stats_context->call_site = _SMP_lock_Stats_here();
 }
 
+/**
+ * @brief Accounts a lock use to the call site of the lock acquire.
+ *
+ * The call site statistics shall be enabled.
+ *
+ * @param stats_context is the SMP lock statistics context.
+ *
+ * @param section_time is the lock section time in CPU counter ticks.
+ */
+void _SMP_lock_Stats_call_site_update(
+  const SMP_lock_Stats_context *stats_context,
+  CPU_Counter_ticks             section_time
+);
+
 /**
  * @brief Updates an SMP lock statistics block during a lock release.
  *
@@ -258,6 +388,10 @@ static inline void _SMP_lock_Stats_release_update(
   if ( stats->max_section_time < delta ) {
     _SMP_lock_Stats_register_or_max_section_time( stats, delta );
   }
+
+  if ( RTEMS_PREDICT_FALSE( _SMP_lock_Stats_call_sites.enabled ) ) {
+    _SMP_lock_Stats_call_site_update( stats_context, delta );
+  }
 }
 
 typedef struct {
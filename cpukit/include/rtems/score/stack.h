@@ -146,6 +146,47 @@ extern const Stack_Allocator_free _Stack_Allocator_free;
  */
 void _Stack_Allocator_do_initialize( void );
 
+/**
+ * @brief The maximum count of stack areas held by the stack cache.
+ *
+ * Application provided via <rtems/confdefs.h>.
+ */
+extern const uint32_t _Stack_Cache_maximum;
+
+/**
+ * @brief Allocates a stack area from the stack cache or the workspace.
+ *
+ * This is a stack allocator allocate handler.  It is used by
+ * <rtems/confdefs.h> if the stack cache is configured.  Stack areas which
+ * were freed by _Stack_Cache_free() and which have a size similar to the
+ * requested stack size are reused, otherwise the stack area is allocated from
+ * the RTEMS Workspace.  If the RTEMS Workspace has not enough memory, then
+ * the cached stack areas are freed to the RTEMS Workspace and the allocation
+ * is retried.
+ *
+ * The caller shall own the object allocator lock.
+ *
+ * @param stack_size is the size of the stack area to allocate in bytes.
+ *
+ * @retval NULL Not enough memory.
+ *
+ * @retval other Pointer to begin of stack area.
+ */
+void *_Stack_Cache_allocate( size_t stack_size );
+
+/**
+ * @brief Puts a stack area into the stack cache or frees it to the workspace.
+ *
+ * This is a stack allocator free handler.  It is used by <rtems/confdefs.h> if
+ * the stack cache is configured.  If the stack cache is full, then the stack
+ * area is freed to the RTEMS Workspace.
+ *
+ * The caller shall own the object allocator lock.
+ *
+ * @param addr is the stack area allocated by _Stack_Cache_allocate() or NULL.
+ */
+void _Stack_Cache_free( void *addr );
+
 /** @} */
 /**
  * @brief The stack allocator allocate stack for idle thread handler.
@@ -194,6 +194,119 @@ void *_Stack_Allocate( size_t stack_size );
  */
 void _Stack_Free( void *stack_area );
 
+/**
+ * @brief The count of stack cache bins.
+ *
+ * Each bin holds stack areas of a size range which is twice as large as the
+ * range of the previous bin.  The last bin holds all large stack areas.
+ */
+#define STACK_CACHE_BIN_COUNT 16
+
+/**
+ * @brief The binary logarithm of the upper size bound of the first stack
+ *   cache bin.
+ */
+#define STACK_CACHE_BIN_SHIFT 10
+
+/**
+ * @brief A stack area in the stack cache.
+ *
+ * The cache entry is placed at the begin of the cached stack area.
+ */
+typedef struct Stack_Cache_Entry {
+  /**
+   * @brief The next cache entry of the bin.
+   */
+  struct Stack_Cache_Entry *next;
+
+  /**
+   * @brief The usable size of the stack area in bytes.
+   */
+  size_t size;
+} Stack_Cache_Entry;
+
+/**
+ * @brief The stack cache control.
+ */
+typedef struct {
+  /**
+   * @brief The bins of cached stack areas.
+   *
+   * Each bin is a LIFO list, so the most recently used stack area of a bin is
+   * reused first.
+   */
+  Stack_Cache_Entry *bins[ STACK_CACHE_BIN_COUNT ];
+
+  /**
+   * @brief The count of stack areas currently held by the cache.
+   */
+  uint32_t count;
+
+  /**
+   * @brief The total size in bytes of stack areas currently held by the cache.
+   */
+  size_t size;
+
+  /**
+   * @brief The count of allocations satisfied by the cache.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief The count of allocations satisfied by the workspace.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief The count of stack areas freed to the workspace because the cache
+   *   was full.
+   */
+  uint32_t overflows;
+} Stack_Cache_Control;
+
+/**
+ * @brief The stack cache.
+ *
+ * The stack cache is protected by the object allocator lock.
+ */
+extern Stack_Cache_Control _Stack_Cache;
+
+/**
+ * @brief Gets the stack cache bin index for the stack size.
+ *
+ * @param size is the stack size in bytes.
+ *
+ * @return Returns the bin index.
+ */
+RTEMS_INLINE_ROUTINE size_t _Stack_Cache_Get_bin( size_t size )
+{
+  size_t bin;
+
+  bin = 0;
+  size >>= STACK_CACHE_BIN_SHIFT;
+
+  while ( size != 0 && bin < STACK_CACHE_BIN_COUNT - 1 ) {
+    size >>= 1;
+    ++bin;
+  }
+
+  return bin;
+}
+
+/**
+ * @brief Puts the stack area into the stack cache.
+ *
+ * The caller shall own the object allocator lock.
+ *
+ * @param stack_area is the stack area to cache.  It shall be allocated from
+ *   the RTEMS Workspace.
+ *
+ * @retval true The stack area was put into the cache.
+ *
+ * @retval false The cache is full.
+ */
+bool _Stack_Cache_Put( void *stack_area );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -29,6 +29,8 @@
 #endif
 #include <rtems/score/freechain.h>
 #include <rtems/score/isrlock.h>
+#include <rtems/score/latencystats.h>
+#include <rtems/score/loadaverage.h>
 #include <rtems/score/objectdata.h>
 #include <rtems/score/priority.h>
 #include <rtems/score/schedulernode.h>
@@ -851,6 +853,33 @@ struct _Thread_Control {
   SMP_lock_Stats Potpourri_stats;
 #endif
 
+#if defined(RTEMS_PROFILING)
+  /**
+   * @brief The wake-up latency control.
+   */
+  struct {
+    /**
+     * @brief The instant of the last unblock of this thread in CPU counter
+     *   ticks.
+     */
+    CPU_Counter_ticks unblock_instant;
+
+    /**
+     * @brief Indicates if the thread was unblocked and was not dispatched
+     *   since then.
+     */
+    bool pending;
+
+    /**
+     * @brief The wake-up latency statistics of this thread.
+     *
+     * The wake-up latency is the time elapsed between the unblock of the
+     * thread and its dispatch.
+     */
+    Latency_Stats Stats;
+  } Wake_up_latency;
+#endif
+
   /** This field is true if the thread is an idle thread. */
   bool                                  is_idle;
 #if defined(RTEMS_MULTIPROCESSING)
@@ -887,6 +916,13 @@ struct _Thread_Control {
    */
   Timestamp_Control cpu_time_used_at_last_reset;
 
+  /**
+   * @brief This member contains the processor load averages of this thread.
+   *
+   * It is updated together with the CPU time used.
+   */
+  Load_average_Control Load_average;
+
   /** This field contains information about the starting state of
    *  this thread.
    */
@@ -1203,6 +1203,8 @@ RTEMS_INLINE_ROUTINE Thread_Control *_Thread_Get_heir_and_make_it_executing(
 /**
  * @brief Updates the cpu time used of the thread.
  *
+ * The load averages of the thread and the processor are updated as well.
+ *
  * @param[in, out] the_thread The thread to add additional cpu time that is
  *      used.
  * @param cpu The cpu.
@@ -1219,6 +1221,20 @@ RTEMS_INLINE_ROUTINE void _Thread_Update_CPU_time_used(
   _TOD_Get_uptime( &cpu->cpu_usage_timestamp );
   _Timestamp_Subtract( &last, &cpu->cpu_usage_timestamp, &ran );
   _Timestamp_Add_to( &the_thread->cpu_time_used, &ran );
+
+  _Load_average_Add_busy(
+    &the_thread->Load_average,
+    last,
+    cpu->cpu_usage_timestamp
+  );
+
+  if ( !the_thread->is_idle ) {
+    _Load_average_Add_busy(
+      &cpu->Load_average,
+      last,
+      cpu->cpu_usage_timestamp
+    );
+  }
 }
 
 /**
@@ -1281,6 +1297,32 @@ Timestamp_Control _Thread_Get_CPU_time_used_after_last_reset(
   Thread_Control *the_thread
 );
 
+/**
+ * @brief Gets the processor load averages of the thread.
+ *
+ * @param[in, out] the_thread is the thread.
+ *
+ * @param[out] average is the array which is set to the load averages of the
+ *   thread, see #LOAD_AVERAGE_ONE.
+ */
+void _Thread_Get_load_average(
+  Thread_Control *the_thread,
+  uint32_t        average[ LOAD_AVERAGE_COUNT ]
+);
+
+/**
+ * @brief Gets the load averages of the processor.
+ *
+ * @param[in, out] cpu is the processor.
+ *
+ * @param[out] average is the array which is set to the load averages of the
+ *   processor, see #LOAD_AVERAGE_ONE.
+ */
+void _Thread_Get_processor_load_average(
+  Per_CPU_Control *cpu,
+  uint32_t         average[ LOAD_AVERAGE_COUNT ]
+);
+
 /**
  * @brief Initializes the control chain of the action control.
  *
@@ -2677,6 +2719,61 @@ RTEMS_INLINE_ROUTINE void _Thread_Unpin(
 #endif
 }
 
+/**
+ * @brief Records the unblock instant of the thread for the wake-up latency
+ *   statistics.
+ *
+ * The caller shall own the thread state lock.
+ *
+ * @param[in, out] the_thread is the thread which is unblocked.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_Wake_up_latency_unblock(
+  Thread_Control *the_thread
+)
+{
+#if defined(RTEMS_PROFILING)
+  if ( !the_thread->Wake_up_latency.pending ) {
+    the_thread->Wake_up_latency.unblock_instant = _CPU_Counter_read();
+    the_thread->Wake_up_latency.pending = true;
+  }
+#else
+  (void) the_thread;
+#endif
+}
+
+/**
+ * @brief Updates the wake-up latency statistics of the heir thread and the
+ *   processor if the heir was unblocked and was not dispatched since then.
+ *
+ * Interrupts shall be disabled on the processor.
+ *
+ * @param[in, out] cpu_self is the processor of the caller.
+ *
+ * @param[in, out] heir is the thread which is dispatched on the processor.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_Wake_up_latency_dispatch(
+  Per_CPU_Control *cpu_self,
+  Thread_Control  *heir
+)
+{
+#if defined(RTEMS_PROFILING)
+  if ( heir->Wake_up_latency.pending ) {
+    CPU_Counter_ticks latency;
+
+    heir->Wake_up_latency.pending = false;
+    latency = _CPU_Counter_difference(
+      _CPU_Counter_read(),
+      heir->Wake_up_latency.unblock_instant
+    );
+    _Latency_Stats_add( &heir->Wake_up_latency.Stats, latency );
+    _Latency_Stats_add( &cpu_self->Stats.wake_up_latency, latency );
+  }
+#else
+  (void) cpu_self;
+  (void) heir;
+#endif
+}
+
 /** @}*/
 
 #ifdef __cplusplus
@@ -90,8 +90,11 @@ extern rtems_shell_cmd_t rtems_shell_TOP_Command;
 extern rtems_shell_cmd_t rtems_shell_STACKUSE_Command;
 extern rtems_shell_cmd_t rtems_shell_PERIODUSE_Command;
 extern rtems_shell_cmd_t rtems_shell_PROFREPORT_Command;
+extern rtems_shell_cmd_t rtems_shell_PROFILE_Command;
+extern rtems_shell_cmd_t rtems_shell_LATENCY_Command;
 extern rtems_shell_cmd_t rtems_shell_WKSPACE_INFO_Command;
 extern rtems_shell_cmd_t rtems_shell_MALLOC_INFO_Command;
+extern rtems_shell_cmd_t rtems_shell_HEAPPROF_Command;
 extern rtems_shell_cmd_t rtems_shell_RTRACE_Command;
 #if RTEMS_NETWORKING
   extern rtems_shell_cmd_t rtems_shell_IFCONFIG_Command;
@@ -465,6 +468,16 @@ extern rtems_shell_alias_t * const rtems_shell_Initial_aliases[];
         defined(CONFIGURE_SHELL_COMMAND_PROFREPORT)
       &rtems_shell_PROFREPORT_Command,
     #endif
+    #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
+         !defined(CONFIGURE_SHELL_NO_COMMAND_PROFILE)) || \
+        defined(CONFIGURE_SHELL_COMMAND_PROFILE)
+      &rtems_shell_PROFILE_Command,
+    #endif
+    #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
+         !defined(CONFIGURE_SHELL_NO_COMMAND_LATENCY)) || \
+        defined(CONFIGURE_SHELL_COMMAND_LATENCY)
+      &rtems_shell_LATENCY_Command,
+    #endif
     #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
          !defined(CONFIGURE_SHELL_NO_COMMAND_WKSPACE_INFO)) || \
         defined(CONFIGURE_SHELL_COMMAND_WKSPACE_INFO)
@@ -479,6 +492,11 @@ extern rtems_shell_alias_t * const rtems_shell_Initial_aliases[];
         defined(CONFIGURE_SHELL_COMMAND_MALLOC_INFO)
       &rtems_shell_MALLOC_INFO_Command,
     #endif
+    #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
+         !defined(CONFIGURE_SHELL_NO_COMMAND_HEAPPROF)) || \
+        defined(CONFIGURE_SHELL_COMMAND_HEAPPROF)
+      &rtems_shell_HEAPPROF_Command,
+    #endif
 
     /*
      *  Tracing family commands
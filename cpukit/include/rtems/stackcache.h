@@ -0,0 +1,157 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIStackCache
+ *
+ * @brief This header file provides the Stack Cache API.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_STACKCACHE_H
+#define _RTEMS_STACKCACHE_H
+
+#include <rtems/rtems/status.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSAPIStackCache Stack Cache
+ *
+ * @ingroup RTEMSAPI
+ *
+ * @brief The stack cache keeps recently freed task stacks for reuse.
+ *
+ * Applications which create and delete tasks at a high rate spend a
+ * considerable time in the allocation and deallocation of task stacks.  The
+ * stack cache holds up to CONFIGURE_TASK_STACK_CACHE_MAXIMUM stack areas of
+ * deleted tasks and threads binned by size.  A new task or thread reuses a
+ * cached stack area of a suitable size, otherwise the stack area is allocated
+ * from the RTEMS Workspace.  The thread-local storage (TLS) area and the
+ * floating-point context are located in the stack area, so they are reused
+ * together with the stack.
+ *
+ * The stack cache is only available if the default stack allocator is used,
+ * see CONFIGURE_TASK_STACK_ALLOCATOR.
+ *
+ * @{
+ */
+
+/**
+ * @brief Stack cache information.
+ */
+typedef struct {
+  /**
+   * @brief The maximum count of stack areas held by the cache.
+   */
+  uint32_t maximum;
+
+  /**
+   * @brief The count of stack areas currently held by the cache.
+   */
+  uint32_t count;
+
+  /**
+   * @brief The total size in bytes of stack areas currently held by the cache.
+   */
+  size_t size;
+
+  /**
+   * @brief The count of stack allocations satisfied by the cache.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief The count of stack allocations satisfied by the RTEMS Workspace.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief The count of stack areas freed to the RTEMS Workspace because the
+   *   cache was full.
+   */
+  uint32_t overflows;
+} rtems_stack_cache_information;
+
+/**
+ * @brief Gets the stack cache information.
+ *
+ * @param[out] info is the stack cache information.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ *
+ * @retval RTEMS_INVALID_ADDRESS The information pointer was NULL.
+ */
+rtems_status_code rtems_stack_cache_get_information(
+  rtems_stack_cache_information *info
+);
+
+/**
+ * @brief Prefills the stack cache with stack areas for tasks of the stack
+ *   size.
+ *
+ * Use this directive during system initialization to make the first creation
+ * of short-lived tasks as cheap as the subsequent ones.
+ *
+ * @param stack_size is the task stack size as used for rtems_task_create() or
+ *   pthread_attr_setstacksize().
+ *
+ * @param is_fp shall be true, if the stack areas are used for floating-point
+ *   tasks, otherwise false.
+ *
+ * @param count is the count of stack areas to put into the cache.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ *
+ * @retval RTEMS_NOT_CONFIGURED The stack cache is not configured.
+ *
+ * @retval RTEMS_TOO_MANY The stack cache was full before all stack areas could
+ *   be put into the cache.
+ *
+ * @retval RTEMS_UNSATISFIED There was not enough memory in the RTEMS Workspace
+ *   to allocate all stack areas.
+ */
+rtems_status_code rtems_stack_cache_prefill(
+  size_t   stack_size,
+  bool     is_fp,
+  uint32_t count
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_STACKCACHE_H */
@@ -18,6 +18,21 @@
  *
  * The 'TFTP' is the mount path and the `hostname' must be four dot-separated
  * decimal values.
+ *
+ * The mount data is a string of space separated options:
+ *
+ *   verbose        print the name of each file opened
+ *   blocksize=N    request a block size of N bytes (RFC 2348), the default
+ *                  is 1456 and 512 sends no option
+ *   windowsize=N   request a window of N blocks for reads (RFC 7440), the
+ *                  default is 8 and 1 sends no option
+ *
+ * For example:
+ *         mount ("", "/TFTP", "tftpfs", RTEMS_FILESYSTEM_READ_WRITE,
+ *                "blocksize=8192 windowsize=16");
+ *
+ * The server can lower the requested values. A server without option
+ * support is used with the RFC 1350 block size of 512 bytes and no window.
  */
 
 #ifndef _RTEMS_TFTP_H
@@ -26,6 +26,8 @@
 
 #include <rtems/score/basedefs.h>
 
+#include "malloc_p.h"
+
 void *calloc(
   size_t nelem,
   size_t elsize
@@ -44,7 +46,7 @@ void *calloc(
   }
 
   length = nelem * elsize;
-  cptr = malloc( length );
+  cptr = _Malloc_Allocate( length, RTEMS_RETURN_ADDRESS() );
   RTEMS_OBFUSCATE_VARIABLE( cptr );
   if ( RTEMS_PREDICT_FALSE( cptr == NULL ) ) {
     return cptr;
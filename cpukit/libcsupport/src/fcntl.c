@@ -24,6 +24,7 @@
 #include <fcntl.h>
 
 #include <rtems/libio_.h>
+#include <rtems/pipe.h>
 
 static int duplicate_iop( rtems_libio_t *iop )
 {
@@ -114,6 +115,7 @@ static int vfcntl(
   int            fd2;
   int            flags;
   int            mask;
+  int            size;
   int            ret = 0;
 
   LIBIO_GET_IOP( fd, iop );
@@ -196,6 +198,27 @@ static int vfcntl(
       ret = -1;
       break;
 
+    case F_GETPIPE_SZ:   /*  for pipes and FIFOs. */
+    case F_SETPIPE_SZ:
+      if ( cmd == F_SETPIPE_SZ ) {
+        size = va_arg( ap, int );
+        ret = ( *iop->pathinfo.handlers->ioctl_h )(
+          iop,
+          RTEMS_PIPE_IOCTL_SET_SIZE,
+          &size
+        );
+      } else {
+        ret = ( *iop->pathinfo.handlers->ioctl_h )(
+          iop,
+          RTEMS_PIPE_IOCTL_GET_SIZE,
+          &size
+        );
+      }
+
+      if ( ret == 0 )
+        ret = size;
+      break;
+
     default:
       errno = EINVAL;
       ret = -1;
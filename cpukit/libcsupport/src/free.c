@@ -24,6 +24,7 @@
 #include <stdlib.h>
 
 #include <rtems/chain.h>
+#include <rtems/score/heapprofiler.h>
 
 static RTEMS_CHAIN_DEFINE_EMPTY( _Malloc_GC_list );
 
@@ -81,6 +82,8 @@ void free(
       return;
   }
 
+  _Heap_Profiler_Free( RTEMS_Malloc_Heap, ptr, HEAP_PROFILER_MALLOC );
+
   if ( !_Protected_heap_Free( RTEMS_Malloc_Heap, ptr ) ) {
     rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
   }
@@ -24,23 +24,42 @@
 
 #include "malloc_p.h"
 
-void *malloc(
-  size_t  size
-)
+#include <rtems/score/heapprofiler.h>
+
+void *_Malloc_Allocate( size_t size, void *site )
 {
   void        *return_this;
+  uintptr_t    alloc_size;
 
   if ( size == 0 ) {
     return NULL;
   }
 
-  return_this = rtems_heap_allocate_aligned_with_boundary( size, 0, 0 );
+  alloc_size = _Heap_Profiler_Extend_size( size );
+  return_this = rtems_heap_allocate_aligned_with_boundary( alloc_size, 0, 0 );
   if ( !return_this ) {
     errno = ENOMEM;
     return (void *) 0;
   }
 
+  if ( RTEMS_PREDICT_FALSE( alloc_size != size ) ) {
+    _Heap_Profiler_Allocate(
+      RTEMS_Malloc_Heap,
+      return_this,
+      size,
+      site,
+      HEAP_PROFILER_MALLOC
+    );
+  }
+
   return return_this;
 }
 
+void *malloc(
+  size_t  size
+)
+{
+  return _Malloc_Allocate( size, RTEMS_RETURN_ADDRESS() );
+}
+
 #endif
@@ -27,6 +27,19 @@ Malloc_System_state _Malloc_System_state( void );
 
 void _Malloc_Process_deferred_frees( void );
 
+/**
+ * @brief Allocates a memory area of the size from the C Program Heap and
+ *   accounts it to the allocation site if the heap profiler is enabled.
+ *
+ * @param size is the size in bytes of the memory area to allocate.
+ * @param site is the allocation site.
+ *
+ * @retval NULL There was not enough memory available.
+ *
+ * @return Returns the begin address of the allocated memory area.
+ */
+void *_Malloc_Allocate( size_t size, void *site );
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -25,7 +25,49 @@
 
 #include "malloc_p.h"
 
-static void *new_alloc( void *old_ptr, size_t new_size, size_t old_size )
+#include <rtems/score/heapprofiler.h>
+
+static Heap_Resize_status resize_block(
+  Heap_Control *heap,
+  void         *ptr,
+  size_t        size,
+  uintptr_t    *old_size,
+  uintptr_t    *avail_size
+)
+{
+  Heap_Profiler_Trailer trailer;
+  Heap_Resize_status    status;
+
+  if ( !_Heap_Profiler_Get_trailer( heap, ptr, &trailer ) ) {
+    return _Heap_Resize_block( heap, ptr, size, old_size, avail_size );
+  }
+
+  /* Keep room for the trailer of the profiled block */
+  if ( size > UINTPTR_MAX - sizeof( trailer ) ) {
+    return HEAP_RESIZE_UNSATISFIED;
+  }
+
+  status = _Heap_Resize_block(
+    heap,
+    ptr,
+    size + sizeof( trailer ),
+    old_size,
+    avail_size
+  );
+
+  if ( status == HEAP_RESIZE_SUCCESSFUL ) {
+    _Heap_Profiler_Resize( heap, ptr, &trailer, size, HEAP_PROFILER_MALLOC );
+  }
+
+  return status;
+}
+
+static void *new_alloc(
+  void   *old_ptr,
+  size_t  new_size,
+  size_t  old_size,
+  void   *site
+)
 {
   void *new_ptr;
 
@@ -35,7 +77,7 @@ static void *new_alloc( void *old_ptr, size_t new_size, size_t old_size )
    *  and the C Standard.
    */
 
-  new_ptr = malloc( new_size );
+  new_ptr = _Malloc_Allocate( new_size, site );
   if ( new_ptr == NULL ) {
     return NULL;
   }
@@ -54,7 +96,7 @@ void *realloc( void *ptr, size_t size )
   uintptr_t           avail_size;
 
   if ( ptr == NULL ) {
-    return malloc( size );
+    return _Malloc_Allocate( size, RTEMS_RETURN_ADDRESS() );
   }
 
   if ( size == 0 ) {
@@ -68,11 +110,11 @@ void *realloc( void *ptr, size_t size )
     case MALLOC_SYSTEM_STATE_NORMAL:
       _RTEMS_Lock_allocator();
       _Malloc_Process_deferred_frees();
-      status = _Heap_Resize_block( heap, ptr, size, &old_size, &avail_size );
+      status = resize_block( heap, ptr, size, &old_size, &avail_size );
       _RTEMS_Unlock_allocator();
       break;
     case MALLOC_SYSTEM_STATE_NO_PROTECTION:
-      status = _Heap_Resize_block( heap, ptr, size, &old_size, &avail_size );
+      status = resize_block( heap, ptr, size, &old_size, &avail_size );
       break;
     default:
       return NULL;
@@ -82,7 +124,7 @@ void *realloc( void *ptr, size_t size )
     case HEAP_RESIZE_SUCCESSFUL:
       return ptr;
     case HEAP_RESIZE_UNSATISFIED:
-      return new_alloc( ptr, size, old_size );
+      return new_alloc( ptr, size, old_size, RTEMS_RETURN_ADDRESS() );
     default:
       errno = EINVAL;
       return NULL;
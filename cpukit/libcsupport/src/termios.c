@@ -974,6 +974,7 @@ doTransmit (const char *buf, size_t len, rtems_termios_tty *tty,
   while (todo > 0) {
     size_t nToCopy;
     size_t nAvail;
+    size_t nFirst;
 
     /* Check space for at least one char */
     newHead = tty->rawOutBuf.Head + 1;
@@ -995,26 +996,21 @@ doTransmit (const char *buf, size_t len, rtems_termios_tty *tty,
       }
     }
 
-    /* Determine free space up to current tail or end of ring buffer */
+    /* Determine free space up to current tail, it may wrap at buffer end */
     nToCopy = todo;
-    if (tty->rawOutBuf.Tail > tty->rawOutBuf.Head) {
-      /* Available space is contiguous from Head to Tail */
-      nAvail = tty->rawOutBuf.Tail - tty->rawOutBuf.Head - 1;
-    } else {
-      /* Available space wraps at buffer end. To keep it simple, utilize
-         only the free space from Head to end during this iteration */
-      nAvail = tty->rawOutBuf.Size - tty->rawOutBuf.Head;
-      /* Head may not touch Tail after wraparound */
-      if (tty->rawOutBuf.Tail == 0)
-        nAvail--;
-    }
+    nAvail = (tty->rawOutBuf.Tail + tty->rawOutBuf.Size
+      - tty->rawOutBuf.Head - 1) % tty->rawOutBuf.Size;
     if (nToCopy > nAvail)
       nToCopy = nAvail;
 
     /* To minimize latency, the memcpy could be done
      * with interrupts enabled or with limit on nToCopy (TBD)
      */
-    memcpy(&tty->rawOutBuf.theBuf[tty->rawOutBuf.Head], buf, nToCopy);
+    nFirst = tty->rawOutBuf.Size - tty->rawOutBuf.Head;
+    if (nFirst > nToCopy)
+      nFirst = nToCopy;
+    memcpy(&tty->rawOutBuf.theBuf[tty->rawOutBuf.Head], buf, nFirst);
+    memcpy(&tty->rawOutBuf.theBuf[0], buf + nFirst, nToCopy - nFirst);
 
     newHead = tty->rawOutBuf.Head + nToCopy;
     if (newHead >= tty->rawOutBuf.Size)
@@ -1492,6 +1488,51 @@ fillBufferPoll (struct rtems_termios_tty *tty)
   return RTEMS_TERMIOS_IPROC_CONTINUE;
 }
 
+/*
+ * Check if characters of the raw input queue may be moved to the input
+ * buffer without per character processing.  This is the case for raw mode
+ * without echo, signals, and flow control to restart.
+ */
+static bool
+isRawRead (const rtems_termios_tty *tty)
+{
+  return (tty->termios.c_lflag & (ICANON | ISIG | ECHO)) == 0
+    && (tty->flow_ctrl & (FL_MDXON | FL_MDRTS)) == 0;
+}
+
+/*
+ * Move as many characters as possible from the raw input queue to the input
+ * buffer with at most two copies.  Must be called with the device lock
+ * acquired.  Returns the number of characters moved.
+ */
+static unsigned int
+moveRawInput (rtems_termios_tty *tty)
+{
+  unsigned int size = tty->rawInBuf.Size;
+  unsigned int head = tty->rawInBuf.Head;
+  unsigned int start = (head + 1) % size;
+  unsigned int n = (tty->rawInBuf.Tail + size - head) % size;
+  unsigned int first;
+
+  if (n > CBUFSIZE - 1 - tty->ccount)
+    n = CBUFSIZE - 1 - tty->ccount;
+
+  first = size - start;
+  if (first > n)
+    first = n;
+
+  memcpy(&tty->cbuf[tty->ccount], &tty->rawInBuf.theBuf[start], first);
+  memcpy(&tty->cbuf[tty->ccount + first], &tty->rawInBuf.theBuf[0], n - first);
+  tty->ccount += n;
+  head = (head + n) % size;
+  tty->rawInBuf.Head = head;
+
+  if (((tty->rawInBuf.Tail + size - head) % size) < tty->lowwater)
+    tty->flow_ctrl &= ~FL_IREQXOF;
+
+  return n;
+}
+
 /*
  * Fill the input buffer from the raw input queue
  */
@@ -1511,6 +1552,12 @@ fillBufferQueue (struct rtems_termios_tty *tty)
 
     rtems_termios_device_lock_acquire (ctx, &lock_context);
 
+    if (isRawRead (tty) && moveRawInput (tty) > 0) {
+      if (tty->ccount >= tty->termios.c_cc[VMIN])
+        wait = false;
+      timeout = tty->rawInBufSemaphoreTimeout;
+    }
+
     while ((tty->rawInBuf.Head != tty->rawInBuf.Tail) &&
                        (tty->ccount < (CBUFSIZE-1))) {
       unsigned char                    c;
@@ -1605,8 +1652,6 @@ rtems_termios_read_tty (
   uint32_t                         count;
   rtems_termios_iproc_status_code  rc;
 
-  count = initial_count;
-
   if (tty->cindex == tty->ccount) {
     tty->cindex = tty->ccount = 0;
     tty->read_start_column = tty->column;
@@ -1621,12 +1666,13 @@ rtems_termios_read_tty (
   /*
    * If there are characters in the buffer, then copy them to the caller.
    */
-  while (count && (tty->cindex < tty->ccount)) {
-    *buffer++ = tty->cbuf[tty->cindex++];
-    count--;
-   }
+  count = (uint32_t) (tty->ccount - tty->cindex);
+  if (count > initial_count)
+    count = initial_count;
+  memcpy (buffer, &tty->cbuf[tty->cindex], count);
+  tty->cindex += (int) count;
   tty->tty_rcvwakeup = false;
-  *count_read = initial_count - count;
+  *count_read = count;
 
   /*
    * fillBufferPoll and fillBufferQueue can indicate that the operation
@@ -1694,6 +1740,82 @@ mustCallReceiveCallback (const rtems_termios_tty *tty, unsigned char c,
   }
 }
 
+/*
+ * Check if received characters may be placed on the raw queue without per
+ * character processing.  This is the case for raw mode without flow control
+ * and early input processing.  A receive callback in canonical mode needs to
+ * inspect each character.
+ */
+static bool
+isRawInput (const rtems_termios_tty *tty)
+{
+  return (tty->flow_ctrl & (FL_MDXON | FL_MDXOF | FL_MDRTS)) == 0
+    && (tty->termios.c_iflag & (IGNCR | ISTRIP | IUCLC | ICRNL | INLCR)) == 0
+    && (tty->tty_rcv.sw_pfn == NULL
+      || (tty->termios.c_lflag & ICANON) == 0);
+}
+
+/*
+ * Place characters on raw queue with at most two copies.
+ * NOTE: This routine runs in the context of the
+ *       device receive interrupt handler.
+ * Returns the number of characters dropped because of overflow.
+ */
+static int
+enqueueRawBulk (rtems_termios_tty *tty, const char *buf, int len)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context lock_context;
+  unsigned int size;
+  unsigned int head;
+  unsigned int tail;
+  unsigned int start;
+  unsigned int n;
+  unsigned int first;
+  bool callReciveCallback;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+
+  size = tty->rawInBuf.Size;
+  head = tty->rawInBuf.Head;
+  tail = tty->rawInBuf.Tail;
+  start = (tail + 1) % size;
+
+  /* The raw queue holds at most Size - 1 characters */
+  n = size - 1 - (tail + size - head) % size;
+  if (n > (unsigned int) len)
+    n = (unsigned int) len;
+
+  first = size - start;
+  if (first > n)
+    first = n;
+
+  memcpy(&tty->rawInBuf.theBuf[start], buf, first);
+  memcpy(&tty->rawInBuf.theBuf[0], buf + first, n - first);
+  tail = (tail + n) % size;
+  tty->rawInBuf.Tail = tail;
+
+  /*
+   * check to see if rcv wakeup callback was set
+   */
+  callReciveCallback = false;
+  if (tty->tty_rcv.sw_pfn != NULL && !tty->tty_rcvwakeup) {
+    if (n < (unsigned int) len ||
+        (n > 0 && mustCallReceiveCallback (tty, 0, tail, head))) {
+      tty->tty_rcvwakeup = true;
+      callReciveCallback = true;
+    }
+  }
+
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  if (callReciveCallback) {
+    (*tty->tty_rcv.sw_pfn)(&tty->termios, tty->tty_rcv.sw_arg);
+  }
+
+  return len - (int) n;
+}
+
 /*
  * Place characters on raw queue.
  * NOTE: This routine runs in the context of the
@@ -1726,6 +1848,11 @@ rtems_termios_enqueue_raw_characters (void *ttyp, const char *buf, int len)
     return 0;
   }
 
+  if (isRawInput (tty)) {
+    dropped = enqueueRawBulk (tty, buf, len);
+    len = 0;
+  }
+
   while (len--) {
     c = *buf++;
     /* FIXME: implement IXANY: any character restarts output */
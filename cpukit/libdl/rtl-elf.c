@@ -27,9 +27,12 @@
 #include <stdio.h>
 #include <unistd.h>
 
+#include <rtems/rtems/clock.h>
+
 #include <rtems/rtl/rtl.h>
 #include "rtl-elf.h"
 #include "rtl-error.h"
+#include <rtems/rtl/rtl-image-cache.h>
 #include <rtems/rtl/rtl-trace.h>
 #include "rtl-trampoline.h"
 #include "rtl-unwind.h"
@@ -187,6 +190,31 @@ rtems_rtl_elf_find_symbol (rtems_rtl_obj*      obj,
   return true;
 }
 
+/**
+ * Check if a relocation record is a call to an external function that is
+ * bound lazily. The symbol is only looked up on the first call.
+ */
+static bool
+rtems_rtl_elf_reloc_lazy (const rtems_rtl_obj* obj,
+                          bool                 is_rela,
+                          const void*          relbuf,
+                          const Elf_Sym*       sym,
+                          const char*          symname)
+{
+  Elf_Word rel_type;
+
+  if ((obj->flags & RTEMS_RTL_OBJ_LAZY) == 0 || symname == NULL ||
+      sym->st_shndx != SHN_UNDEF || ELF_ST_BIND (sym->st_info) != STB_GLOBAL)
+    return false;
+
+  if (is_rela)
+    rel_type = ELF_R_TYPE (((const Elf_Rela*) relbuf)->r_info);
+  else
+    rel_type = ELF_R_TYPE (((const Elf_Rel*) relbuf)->r_info);
+
+  return rtems_rtl_elf_rel_lazy (rel_type);
+}
+
 /**
  * Relocation worker routine.
  */
@@ -206,8 +234,10 @@ typedef bool (*rtems_rtl_elf_reloc_handler)(rtems_rtl_obj*      obj,
  */
 typedef struct
 {
-  size_t dependents; /**< The number of dependent object files. */
-  size_t unresolved; /**< The number of unresolved symbols. */
+  size_t dependents;   /**< The number of dependent object files. */
+  size_t unresolved;   /**< The number of unresolved symbols. */
+  size_t lazy;         /**< The number of lazily bound relocations. */
+  size_t lazy_strings; /**< The size of the lazily bound symbol names. */
 } rtems_rtl_elf_reloc_data;
 
 static bool
@@ -226,6 +256,17 @@ rtems_rtl_elf_reloc_parser (rtems_rtl_obj*      obj,
   rtems_rtl_word            rel_words[3];
   rtems_rtl_elf_rel_status  rs;
 
+  /*
+   * A lazily bound call is relocated to a stub close to the text. Count the
+   * stubs and the names the lazy binding table needs.
+   */
+  if (rtems_rtl_elf_reloc_lazy (obj, is_rela, relbuf, sym, symname))
+  {
+    ++rd->lazy;
+    rd->lazy_strings += strlen (symname) + 1;
+    return true;
+  }
+
   /*
    * Check the reloc record to see if a trampoline is needed.
    */
@@ -315,6 +356,39 @@ rtems_rtl_elf_reloc_relocator (rtems_rtl_obj*      obj,
 {
   const Elf_Rela* rela = (const Elf_Rela*) relbuf;
   const Elf_Rel*  rel = (const Elf_Rel*) relbuf;
+  bool            lazy;
+
+  /*
+   * Relocate a lazily bound call to the symbol's stub. The dependency on the
+   * symbol's object file is added when the call is resolved.
+   */
+  lazy = rtems_rtl_elf_reloc_lazy (obj, is_rela, relbuf, sym, symname);
+  if (lazy)
+  {
+    rtems_rtl_lazy_slot* slot;
+    size_t               stub_size = rtems_rtl_elf_lazy_stub_size ();
+
+    slot = rtems_rtl_lazy_slot_find (obj, symname);
+    if (slot == NULL)
+    {
+      rtems_rtl_set_error (EINVAL, "lazy binding table full: %s", symname);
+      return false;
+    }
+
+    if (slot->stub == 0)
+    {
+      if (!rtems_rtl_obj_has_tramp_space (obj, stub_size))
+      {
+        rtems_rtl_set_error (EINVAL, "no lazy binding stub memory: %s",
+                             symname);
+        return false;
+      }
+      slot->stub = rtems_rtl_elf_lazy_stub (obj->tramp_brk, slot);
+      obj->tramp_brk = ((uint8_t*) obj->tramp_brk) + stub_size;
+    }
+
+    symvalue = slot->stub;
+  }
 
   if (!resolved)
   {
@@ -374,18 +448,21 @@ rtems_rtl_elf_reloc_relocator (rtems_rtl_obj*      obj,
         return false;
     }
 
-    sobj = rtems_rtl_find_obj_with_symbol (symbol);
+    if (!lazy)
+    {
+      sobj = rtems_rtl_find_obj_with_symbol (symbol);
 
-    if (rtems_rtl_trace (RTEMS_RTL_TRACE_DEPENDENCY))
-      printf ("rtl: depend: %s -> %s:%s\n",
-              obj->oname,
-              sobj == NULL ? "not-found" : sobj->oname,
-              symname);
+      if (rtems_rtl_trace (RTEMS_RTL_TRACE_DEPENDENCY))
+        printf ("rtl: depend: %s -> %s:%s\n",
+                obj->oname,
+                sobj == NULL ? "not-found" : sobj->oname,
+                symname);
 
-    if (sobj != NULL)
-    {
-      if (rtems_rtl_obj_add_dependent (obj, sobj))
-        rtems_rtl_obj_inc_reference (sobj);
+      if (sobj != NULL)
+      {
+        if (rtems_rtl_obj_add_dependent (obj, sobj))
+          rtems_rtl_obj_inc_reference (sobj);
+      }
     }
   }
 
@@ -519,7 +596,8 @@ rtems_rtl_elf_relocate_worker (rtems_rtl_obj*              obj,
 
     resolved = true;
 
-    if (rtems_rtl_elf_rel_resolve_sym (rel_type))
+    if (rtems_rtl_elf_rel_resolve_sym (rel_type) &&
+        !rtems_rtl_elf_reloc_lazy (obj, is_rela, relbuf, &sym, symname))
       resolved = rtems_rtl_elf_find_symbol (obj,
                                             &sym, symname,
                                             &symbol, &symvalue);
@@ -784,7 +862,8 @@ rtems_rtl_elf_tramp_resolve_reloc (rtems_rtl_unresolv_rec* rec,
 }
 
 static bool
-rtems_rtl_elf_alloc_trampoline (rtems_rtl_obj* obj, size_t unresolved)
+rtems_rtl_elf_alloc_trampoline (rtems_rtl_obj*            obj,
+                                rtems_rtl_elf_reloc_data* reloc)
 {
   rtems_rtl_tramp_data td =  { 0 };
   td.obj = obj;
@@ -804,7 +883,12 @@ rtems_rtl_elf_alloc_trampoline (rtems_rtl_obj* obj, size_t unresolved)
    * resolved at some point in time. They could all require fixups and
    * trampolines.
    */
-  obj->tramps_size += obj->tramp_size * unresolved;
+  obj->tramps_size += obj->tramp_size * reloc->unresolved;
+  /*
+   * Add the lazy binding stubs. There is a stub for each symbol bound lazily
+   * and the symbols are not known yet so reserve one for each relocation.
+   */
+  obj->tramps_size += rtems_rtl_elf_lazy_stub_size () * reloc->lazy;
   if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
     printf ("rtl: tramp:elf: slots: %zu (%zu)\n",
             obj->tramp_size == 0 ? 0 : obj->tramps_size / obj->tramp_size,
@@ -1249,8 +1333,34 @@ rtems_rtl_elf_loader (rtems_rtl_obj*      obj,
                       rtems_rtl_obj_sect* sect,
                       void*               data)
 {
-  uint8_t* base_offset;
-  size_t   len;
+  rtems_rtl_obj_cache* sects;
+  uint8_t*             base_offset;
+  size_t               len;
+
+  /*
+   * A file resident in memory is copied directly from its image.
+   */
+  rtems_rtl_obj_caches (&sects, NULL, NULL);
+
+  if (rtems_rtl_obj_cache_in_place (sects, fd))
+  {
+    void* image;
+
+    len = sect->size;
+
+    if (!rtems_rtl_obj_cache_read (sects, fd, obj->ooffset + sect->offset,
+                                   &image, &len))
+      return false;
+
+    if (len != sect->size)
+    {
+      rtems_rtl_set_error (EINVAL, "section load past end of file");
+      return false;
+    }
+
+    memcpy (sect->base, image, len);
+    return true;
+  }
 
   if (lseek (fd, obj->ooffset + sect->offset, SEEK_SET) < 0)
   {
@@ -1698,6 +1808,12 @@ rtems_rtl_elf_file_load (rtems_rtl_obj* obj, int fd)
    */
   obj->tramp_size = rtems_rtl_elf_relocate_tramp_max_size ();
 
+  /*
+   * Bind calls eagerly if the architecture cannot bind them lazily.
+   */
+  if (rtems_rtl_elf_lazy_stub_size () == 0)
+    obj->flags &= ~RTEMS_RTL_OBJ_LAZY;
+
   /*
    * Parse the section information first so we have the memory map of the object
    * file and the memory allocated. Any further allocations we make to complete
@@ -1751,7 +1867,7 @@ rtems_rtl_elf_file_load (rtems_rtl_obj* obj, int fd)
   if (!rtems_rtl_elf_dependents (obj, &relocs))
     return false;
 
-  if (!rtems_rtl_elf_alloc_trampoline (obj, relocs.unresolved))
+  if (!rtems_rtl_elf_alloc_trampoline (obj, &relocs))
     return false;
 
   /*
@@ -1759,17 +1875,30 @@ rtems_rtl_elf_file_load (rtems_rtl_obj* obj, int fd)
    */
   rtems_rtl_alloc_unlock ();
 
-  /*
-   * Load the sections and symbols and then relocation to the base address.
-   */
-  if (!rtems_rtl_obj_load_sections (obj, fd, rtems_rtl_elf_loader, &ehdr))
+  if (!rtems_rtl_lazy_alloc (obj, relocs.lazy, relocs.lazy_strings))
     return false;
 
   /*
-   * Fix up the relocations.
+   * Load the relocated image if the image cache has a valid image else load
+   * the sections and symbols and then relocation to the base address.
    */
-  if (!rtems_rtl_obj_relocate (obj, fd, rtems_rtl_elf_relocs_locator, &ehdr))
-    return false;
+  if (!rtems_rtl_image_cache_load (obj, fd))
+  {
+    uint64_t link_time = rtems_clock_get_uptime_nanoseconds ();
+
+    if (!rtems_rtl_obj_load_sections (obj, fd, rtems_rtl_elf_loader, &ehdr))
+      return false;
+
+    /*
+     * Fix up the relocations.
+     */
+    if (!rtems_rtl_obj_relocate (obj, fd, rtems_rtl_elf_relocs_locator, &ehdr))
+      return false;
+
+    link_time = rtems_clock_get_uptime_nanoseconds () - link_time;
+
+    rtems_rtl_image_cache_store (obj, link_time);
+  }
 
   rtems_rtl_symbol_obj_erase_local (obj);
 
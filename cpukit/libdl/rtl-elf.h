@@ -19,6 +19,7 @@
 #include <rtems/rtl/rtl-fwd.h>
 #include <rtems/rtl/rtl-obj-fwd.h>
 #include <rtems/rtl/rtl-sym.h>
+#include "rtl-lazy.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -140,6 +141,38 @@ bool rtems_rtl_elf_arch_section_free (const rtems_rtl_obj* obj,
  */
 bool rtems_rtl_elf_rel_resolve_sym (Elf_Word type);
 
+/**
+ * Architecture specific lazy binding stub size. A stub of this size is
+ * allocated in the trampoline memory for each symbol called lazily.
+ *
+ * @retval 0 The architecture does not support lazy binding.
+ * @return size_t The size of a lazy binding stub.
+ */
+size_t rtems_rtl_elf_lazy_stub_size (void);
+
+/**
+ * Architecture specific handler to check if a relocation record's type is a
+ * function call that can be bound lazily.
+ *
+ * @param type The type field in the relocation record.
+ * @retval true The call can be bound lazily.
+ * @retval false The relocation record has to be resolved when loading.
+ */
+bool rtems_rtl_elf_rel_lazy (Elf_Word type);
+
+/**
+ * Architecture specific handler to write a lazy binding stub. The stub loads
+ * the slot's address into a scratch register and jumps to the slot's
+ * target. The handler sets the slot's target to the architecture's resolver
+ * entry. The entry passes the slot to rtems_rtl_lazy_resolve() and jumps to
+ * the address returned with the call's arguments preserved.
+ *
+ * @param stub The stub memory.
+ * @param slot The lazy binding slot.
+ * @return Elf_Word The value to relocate the calls to the stub with.
+ */
+Elf_Word rtems_rtl_elf_lazy_stub (void* stub, rtems_rtl_lazy_slot* slot);
+
 /**
  * Architecture specific relocation maximum trampoline size. A trampoline entry
  * of this size is allocated for each unresolved external.
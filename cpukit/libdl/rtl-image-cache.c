@@ -0,0 +1,659 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rtl
+ *
+ * @brief RTEMS Run-Time Linker Relocated Image Cache
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <rtems/rtems/clock.h>
+
+#include <rtems/rtl/rtl.h>
+#include <rtems/rtl/rtl-allocator.h>
+#include <rtems/rtl/rtl-image-cache.h>
+#include <rtems/rtl/rtl-obj.h>
+#include <rtems/rtl/rtl-trace.h>
+#include "rtl-error.h"
+#include "rtl-string.h"
+
+/**
+ * The image file's magic number and version.
+ */
+#define RTEMS_RTL_IMAGE_MAGIC   (0x52544c49)
+#define RTEMS_RTL_IMAGE_VERSION (1)
+
+/**
+ * The memory blocks of an object file in the order they are held in an image
+ * file. The bss is zeroed and not held in the image file.
+ */
+#define RTEMS_RTL_IMAGE_TEXT   (0)
+#define RTEMS_RTL_IMAGE_CONST  (1)
+#define RTEMS_RTL_IMAGE_EH     (2)
+#define RTEMS_RTL_IMAGE_DATA   (3)
+#define RTEMS_RTL_IMAGE_BSS    (4)
+#define RTEMS_RTL_IMAGE_TRAMP  (5)
+#define RTEMS_RTL_IMAGE_BLOCKS (6)
+
+/**
+ * The number of hexadecimal characters of the key used as the image file
+ * name. It fits the IMFS name length.
+ */
+#define RTEMS_RTL_IMAGE_NAME_SIZE (16)
+
+/**
+ * A memory block of an object file.
+ */
+typedef struct
+{
+  uintptr_t base; /**< The address of the block. */
+  size_t    size; /**< The size of the block. */
+} rtems_rtl_image_block;
+
+/**
+ * The header of an image file. The dependents follow the header then the
+ * blocks.
+ */
+typedef struct
+{
+  uint32_t              magic;       /**< The magic number. */
+  uint32_t              version;     /**< The version of the format. */
+  uint8_t               key[RTEMS_RTL_OBJ_IMAGE_ID_SIZE];
+                                     /**< The base image and object file
+                                      *   key. */
+  rtems_rtl_image_block blocks[RTEMS_RTL_IMAGE_BLOCKS];
+                                     /**< The object file's memory. */
+  size_t                tramps_used; /**< The trampoline memory used. */
+  uint64_t              link_time;   /**< Nanoseconds taken to load and
+                                      *   relocate the sections. */
+  size_t                dependents;  /**< The number of dependents. */
+} rtems_rtl_image_header;
+
+/**
+ * An object file the image depends on.
+ */
+typedef struct
+{
+  uint8_t               id[RTEMS_RTL_OBJ_IMAGE_ID_SIZE];
+                                     /**< The dependent's image identifier. */
+  rtems_rtl_image_block blocks[RTEMS_RTL_IMAGE_BLOCKS];
+                                     /**< The dependent's memory. */
+} rtems_rtl_image_depend;
+
+/**
+ * Dependent iterator data for storing an image.
+ */
+typedef struct
+{
+  int    fd;         /**< The image file. */
+  size_t dependents; /**< The number of dependents. */
+  bool   ok;         /**< All the dependents can be held. */
+} rtems_rtl_image_depend_data;
+
+static void
+rtems_rtl_image_blocks (const rtems_rtl_obj* obj, rtems_rtl_image_block* blocks)
+{
+  blocks[RTEMS_RTL_IMAGE_TEXT].base  = (uintptr_t) obj->text_base;
+  blocks[RTEMS_RTL_IMAGE_TEXT].size  = obj->text_size;
+  blocks[RTEMS_RTL_IMAGE_CONST].base = (uintptr_t) obj->const_base;
+  blocks[RTEMS_RTL_IMAGE_CONST].size = obj->const_size;
+  blocks[RTEMS_RTL_IMAGE_EH].base    = (uintptr_t) obj->eh_base;
+  blocks[RTEMS_RTL_IMAGE_EH].size    = obj->eh_size;
+  blocks[RTEMS_RTL_IMAGE_DATA].base  = (uintptr_t) obj->data_base;
+  blocks[RTEMS_RTL_IMAGE_DATA].size  = obj->data_size;
+  blocks[RTEMS_RTL_IMAGE_BSS].base   = (uintptr_t) obj->bss_base;
+  blocks[RTEMS_RTL_IMAGE_BSS].size   = obj->bss_size;
+  blocks[RTEMS_RTL_IMAGE_TRAMP].base = (uintptr_t) obj->trampoline;
+  blocks[RTEMS_RTL_IMAGE_TRAMP].size = obj->tramps_size;
+}
+
+static rtems_rtl_alloc_tag
+rtems_rtl_image_block_tag (int block)
+{
+  switch (block)
+  {
+    case RTEMS_RTL_IMAGE_TEXT:
+      return rtems_rtl_alloc_text_tag ();
+    case RTEMS_RTL_IMAGE_CONST:
+      return rtems_rtl_alloc_const_tag ();
+    case RTEMS_RTL_IMAGE_EH:
+      return rtems_rtl_alloc_eh_tag ();
+    case RTEMS_RTL_IMAGE_DATA:
+      return rtems_rtl_alloc_data_tag ();
+    case RTEMS_RTL_IMAGE_BSS:
+      return rtems_rtl_alloc_bss_tag ();
+    default:
+      break;
+  }
+  return RTEMS_RTL_ALLOC_OBJECT;
+}
+
+static bool
+rtems_rtl_image_cacheable (const rtems_rtl_obj* obj)
+{
+  const rtems_chain_control* sections = &obj->sections;
+  const rtems_chain_node*    node;
+
+  if ((obj->flags & (RTEMS_RTL_OBJ_LAZY | RTEMS_RTL_OBJ_UNRESOLVED)) != 0)
+    return false;
+
+  node = rtems_chain_immutable_first (sections);
+  while (!rtems_chain_is_tail (sections, node))
+  {
+    const rtems_rtl_obj_sect* sect = (const rtems_rtl_obj_sect*) node;
+    if ((sect->flags & RTEMS_RTL_OBJ_SECT_ARCH_ALLOC) != 0)
+      return false;
+    node = rtems_chain_immutable_next (node);
+  }
+
+  return true;
+}
+
+static bool
+rtems_rtl_image_id (rtems_rtl_obj* obj, int fd)
+{
+  rtems_rtl_obj_cache* cache;
+  SHA256_CTX           ctx;
+  off_t                offset = 0;
+
+  rtems_rtl_obj_caches (&cache, NULL, NULL);
+
+  SHA256_Init (&ctx);
+
+  /*
+   * A file resident in memory is referenced in place so the whole object
+   * file is hashed in one update.
+   */
+  while ((size_t) offset < obj->fsize)
+  {
+    void*  data;
+    size_t length = obj->fsize - offset;
+
+    if (!rtems_rtl_obj_cache_in_place (cache, fd) && (length > cache->size))
+      length = cache->size;
+
+    if (!rtems_rtl_obj_cache_read (cache, fd, obj->ooffset + offset,
+                                   &data, &length))
+      return false;
+
+    if (length == 0)
+    {
+      rtems_rtl_set_error (EINVAL, "image id read past end of file");
+      return false;
+    }
+
+    SHA256_Update (&ctx, data, length);
+    offset += length;
+  }
+
+  SHA256_Final (obj->image_id, &ctx);
+  obj->flags |= RTEMS_RTL_OBJ_IMAGE_ID;
+
+  return true;
+}
+
+static void
+rtems_rtl_image_key (rtems_rtl_obj* obj, uint8_t* key)
+{
+  rtems_rtl_data* rtl = rtems_rtl_data_unprotected ();
+  SHA256_CTX      ctx = rtl->image_cache.base;
+  uint8_t         base[RTEMS_RTL_OBJ_IMAGE_ID_SIZE];
+
+  SHA256_Final (base, &ctx);
+  SHA256_Init (&ctx);
+  SHA256_Update (&ctx, base, sizeof (base));
+  SHA256_Update (&ctx, obj->image_id, sizeof (obj->image_id));
+  SHA256_Final (key, &ctx);
+}
+
+static char*
+rtems_rtl_image_file (const uint8_t* key)
+{
+  rtems_rtl_data* rtl = rtems_rtl_data_unprotected ();
+  size_t          len = strlen (rtl->image_cache.path);
+  char*           name;
+  size_t          i;
+
+  name = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                              len + RTEMS_RTL_IMAGE_NAME_SIZE + sizeof ("/.rtl"),
+                              false);
+  if (name == NULL)
+    return NULL;
+
+  memcpy (name, rtl->image_cache.path, len);
+  name[len++] = '/';
+  for (i = 0; i < (RTEMS_RTL_IMAGE_NAME_SIZE / 2); ++i)
+    len += sprintf (name + len, "%02x", key[i]);
+  strcpy (name + len, ".rtl");
+
+  return name;
+}
+
+static bool
+rtems_rtl_image_read (int fd, void* buffer, size_t length)
+{
+  uint8_t* p = buffer;
+  while (length != 0)
+  {
+    ssize_t r = read (fd, p, length);
+    if (r <= 0)
+      return false;
+    p += r;
+    length -= r;
+  }
+  return true;
+}
+
+static bool
+rtems_rtl_image_write (int fd, const void* buffer, size_t length)
+{
+  const uint8_t* p = buffer;
+  while (length != 0)
+  {
+    ssize_t r = write (fd, p, length);
+    if (r <= 0)
+      return false;
+    p += r;
+    length -= r;
+  }
+  return true;
+}
+
+static rtems_rtl_obj*
+rtems_rtl_image_find_dependent (const rtems_rtl_image_depend* depend)
+{
+  rtems_chain_control* lists[2] = {
+    rtems_rtl_objects_unprotected (),
+    rtems_rtl_pending_unprotected ()
+  };
+  size_t               l;
+
+  for (l = 0; l < RTEMS_ARRAY_SIZE (lists); ++l)
+  {
+    rtems_chain_node* node = rtems_chain_first (lists[l]);
+    while (!rtems_chain_is_tail (lists[l], node))
+    {
+      rtems_rtl_obj*        obj = (rtems_rtl_obj*) node;
+      rtems_rtl_image_block blocks[RTEMS_RTL_IMAGE_BLOCKS];
+
+      if ((obj->flags & RTEMS_RTL_OBJ_IMAGE_ID) != 0 &&
+          memcmp (obj->image_id, depend->id, sizeof (depend->id)) == 0)
+      {
+        rtems_rtl_image_blocks (obj, blocks);
+        if (memcmp (blocks, depend->blocks, sizeof (blocks)) == 0)
+          return obj;
+      }
+
+      node = rtems_chain_next (node);
+    }
+  }
+
+  return NULL;
+}
+
+static bool
+rtems_rtl_image_load_blocks (int                           fd,
+                             rtems_rtl_obj*                obj,
+                             const rtems_rtl_image_header* header)
+{
+  int b;
+
+  for (b = 0; b < RTEMS_RTL_IMAGE_BLOCKS; ++b)
+  {
+    const rtems_rtl_image_block* block = &header->blocks[b];
+    rtems_rtl_alloc_tag          tag = rtems_rtl_image_block_tag (b);
+    void*                        base = (void*) block->base;
+    size_t                       size = block->size;
+    bool                         ok = true;
+
+    if (b == RTEMS_RTL_IMAGE_TRAMP)
+      size = header->tramps_used;
+
+    if (base == NULL || size == 0)
+      continue;
+
+    rtems_rtl_alloc_wr_enable (tag, base);
+
+    if (b == RTEMS_RTL_IMAGE_BSS)
+      memset (base, 0, size);
+    else
+      ok = rtems_rtl_image_read (fd, base, size);
+
+    rtems_rtl_alloc_wr_disable (tag, base);
+
+    if (!ok)
+      return false;
+  }
+
+  return true;
+}
+
+void
+rtems_rtl_image_cache_open (rtems_rtl_image_cache* cache)
+{
+  cache->path = NULL;
+  SHA256_Init (&cache->base);
+}
+
+void
+rtems_rtl_image_cache_base_add (rtems_rtl_image_cache* cache,
+                                const unsigned char*   esyms,
+                                unsigned int           size)
+{
+  SHA256_Update (&cache->base, esyms, size);
+}
+
+bool
+rtems_rtl_image_cache_path (const char* path)
+{
+  rtems_rtl_data* rtl;
+  char*           copy = NULL;
+
+  rtl = rtems_rtl_lock ();
+  if (rtl == NULL)
+  {
+    rtems_rtl_set_error (EINVAL, "cannot lock rtl");
+    return false;
+  }
+
+  if (path != NULL)
+  {
+    copy = rtems_rtl_strdup (path);
+    if (copy == NULL)
+    {
+      rtems_rtl_set_error (ENOMEM, "no memory for image cache path");
+      rtems_rtl_unlock ();
+      return false;
+    }
+  }
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, rtl->image_cache.path);
+  rtl->image_cache.path = copy;
+
+  rtems_rtl_unlock ();
+
+  return true;
+}
+
+bool
+rtems_rtl_image_cache_load (rtems_rtl_obj* obj, int fd)
+{
+  rtems_rtl_data*        rtl = rtems_rtl_data_unprotected ();
+  rtems_rtl_image_header header;
+  rtems_rtl_image_block  blocks[RTEMS_RTL_IMAGE_BLOCKS];
+  rtems_rtl_image_depend depend;
+  uint8_t                key[RTEMS_RTL_OBJ_IMAGE_ID_SIZE];
+  uint64_t               start;
+  uint64_t               load_time;
+  char*                  name;
+  int                    ifd;
+  size_t                 d;
+
+  if (rtl->image_cache.path == NULL)
+    return false;
+
+  start = rtems_clock_get_uptime_nanoseconds ();
+
+  /*
+   * The identifier is needed to store the image and when an object file that
+   * depends on this object file is loaded from the cache.
+   */
+  if (!rtems_rtl_image_id (obj, fd))
+    return false;
+
+  if (!rtems_rtl_image_cacheable (obj))
+    return false;
+
+  rtems_rtl_image_key (obj, key);
+
+  name = rtems_rtl_image_file (key);
+  if (name == NULL)
+    return false;
+
+  ifd = open (name, O_RDONLY);
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_IMAGE))
+    printf ("rtl: image: %s: %s: %s\n",
+            rtems_rtl_obj_oname (obj), name, ifd < 0 ? "miss" : "found");
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, name);
+
+  if (ifd < 0)
+    return false;
+
+  /*
+   * The image is only valid if the memory is at the same addresses.
+   */
+  rtems_rtl_image_blocks (obj, blocks);
+
+  if (!rtems_rtl_image_read (ifd, &header, sizeof (header)) ||
+      header.magic != RTEMS_RTL_IMAGE_MAGIC ||
+      header.version != RTEMS_RTL_IMAGE_VERSION ||
+      memcmp (header.key, key, sizeof (key)) != 0 ||
+      memcmp (header.blocks, blocks, sizeof (blocks)) != 0 ||
+      header.tramps_used > obj->tramps_size)
+  {
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_IMAGE))
+      printf ("rtl: image: %s: mismatch\n", rtems_rtl_obj_oname (obj));
+    close (ifd);
+    return false;
+  }
+
+  /*
+   * Check the dependents are loaded at the same addresses. The dependents are
+   * added once the image has loaded.
+   */
+  for (d = 0; d < header.dependents; ++d)
+  {
+    if (!rtems_rtl_image_read (ifd, &depend, sizeof (depend)) ||
+        rtems_rtl_image_find_dependent (&depend) == NULL)
+    {
+      if (rtems_rtl_trace (RTEMS_RTL_TRACE_IMAGE))
+        printf ("rtl: image: %s: dependent mismatch\n",
+                rtems_rtl_obj_oname (obj));
+      close (ifd);
+      return false;
+    }
+  }
+
+  if (!rtems_rtl_image_load_blocks (ifd, obj, &header))
+  {
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_IMAGE))
+      printf ("rtl: image: %s: read failed\n", rtems_rtl_obj_oname (obj));
+    close (ifd);
+    return false;
+  }
+
+  if (lseek (ifd, sizeof (header), SEEK_SET) < 0)
+  {
+    close (ifd);
+    return false;
+  }
+
+  for (d = 0; d < header.dependents; ++d)
+  {
+    rtems_rtl_obj* dobj;
+    if (!rtems_rtl_image_read (ifd, &depend, sizeof (depend)))
+    {
+      close (ifd);
+      return false;
+    }
+    dobj = rtems_rtl_image_find_dependent (&depend);
+    if (rtems_rtl_obj_add_dependent (obj, dobj))
+      rtems_rtl_obj_inc_reference (dobj);
+  }
+
+  close (ifd);
+
+  if (obj->trampoline != NULL)
+    obj->tramp_brk = ((uint8_t*) obj->trampoline) + header.tramps_used;
+
+  load_time = rtems_clock_get_uptime_nanoseconds () - start;
+
+  obj->flags |= RTEMS_RTL_OBJ_IMAGE;
+  obj->image_saved =
+    header.link_time > load_time ? header.link_time - load_time : 0;
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_IMAGE))
+    printf ("rtl: image: %s: loaded, saved %" PRIu64 " ns\n",
+            rtems_rtl_obj_oname (obj), obj->image_saved);
+
+  return true;
+}
+
+static bool
+rtems_rtl_image_store_dependent (rtems_rtl_obj* obj,
+                                 rtems_rtl_obj* dependent,
+                                 void*          data)
+{
+  rtems_rtl_image_depend_data* dd = (rtems_rtl_image_depend_data*) data;
+  rtems_rtl_image_depend       depend;
+
+  (void) obj;
+
+  if ((dependent->flags & RTEMS_RTL_OBJ_IMAGE_ID) == 0)
+  {
+    dd->ok = false;
+    return true;
+  }
+
+  if (dd->fd >= 0)
+  {
+    memcpy (depend.id, dependent->image_id, sizeof (depend.id));
+    rtems_rtl_image_blocks (dependent, depend.blocks);
+    if (!rtems_rtl_image_write (dd->fd, &depend, sizeof (depend)))
+    {
+      dd->ok = false;
+      return true;
+    }
+  }
+
+  ++dd->dependents;
+
+  return false;
+}
+
+void
+rtems_rtl_image_cache_store (rtems_rtl_obj* obj, uint64_t link_time)
+{
+  rtems_rtl_data*             rtl = rtems_rtl_data_unprotected ();
+  rtems_rtl_image_header      header;
+  rtems_rtl_image_depend_data dd = { .fd = -1, .dependents = 0, .ok = true };
+  char*                       name;
+  int                         ifd;
+  int                         b;
+  bool                        ok;
+
+  if (rtl->image_cache.path == NULL ||
+      (obj->flags & RTEMS_RTL_OBJ_IMAGE_ID) == 0 ||
+      !rtems_rtl_image_cacheable (obj))
+    return;
+
+  /*
+   * Count the dependents. All dependents need an identifier.
+   */
+  rtems_rtl_obj_iterate_dependents (obj, rtems_rtl_image_store_dependent, &dd);
+  if (!dd.ok)
+    return;
+
+  memset (&header, 0, sizeof (header));
+  header.magic = RTEMS_RTL_IMAGE_MAGIC;
+  header.version = RTEMS_RTL_IMAGE_VERSION;
+  rtems_rtl_image_key (obj, header.key);
+  rtems_rtl_image_blocks (obj, header.blocks);
+  if (obj->trampoline != NULL)
+    header.tramps_used = (uint8_t*) obj->tramp_brk - (uint8_t*) obj->trampoline;
+  header.link_time = link_time;
+  header.dependents = dd.dependents;
+
+  name = rtems_rtl_image_file (header.key);
+  if (name == NULL)
+    return;
+
+  ifd = open (name, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (ifd < 0)
+  {
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_IMAGE))
+      printf ("rtl: image: %s: %s: create failed: %s\n",
+              rtems_rtl_obj_oname (obj), name, strerror (errno));
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, name);
+    return;
+  }
+
+  ok = rtems_rtl_image_write (ifd, &header, sizeof (header));
+
+  if (ok)
+  {
+    dd.fd = ifd;
+    dd.dependents = 0;
+    rtems_rtl_obj_iterate_dependents (obj, rtems_rtl_image_store_dependent, &dd);
+    ok = dd.ok;
+  }
+
+  for (b = 0; ok && b < RTEMS_RTL_IMAGE_BLOCKS; ++b)
+  {
+    const rtems_rtl_image_block* block = &header.blocks[b];
+    size_t                       size = block->size;
+
+    if (b == RTEMS_RTL_IMAGE_BSS)
+      continue;
+
+    if (b == RTEMS_RTL_IMAGE_TRAMP)
+      size = header.tramps_used;
+
+    if (block->base != 0 && size != 0)
+      ok = rtems_rtl_image_write (ifd, (const void*) block->base, size);
+  }
+
+  close (ifd);
+
+  /*
+   * Do not leave a partial image.
+   */
+  if (!ok)
+    unlink (name);
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_IMAGE))
+    printf ("rtl: image: %s: %s: %s\n",
+            rtems_rtl_obj_oname (obj), name, ok ? "stored" : "store failed");
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, name);
+}
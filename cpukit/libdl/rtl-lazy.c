@@ -0,0 +1,199 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rtl
+ *
+ * @brief RTEMS Run-Time Linker Lazy Binding.
+ */
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems/score/interr.h>
+
+#include <rtems/rtl/rtl.h>
+#include "rtl-error.h"
+#include "rtl-lazy.h"
+#include <rtems/rtl/rtl-sym.h>
+#include <rtems/rtl/rtl-trace.h>
+
+/**
+ * The lazy binding table. The slots are an open addressed hash table keyed by
+ * the symbol name. The names are copied into the string space after the
+ * slots.
+ */
+typedef struct
+{
+  size_t              size;    /**< The number of slots, a power of two. */
+  char*               strings; /**< The next free string space. */
+  rtems_rtl_lazy_slot slots[]; /**< The slots. */
+} rtems_rtl_lazy_table;
+
+bool
+rtems_rtl_lazy_alloc (rtems_rtl_obj* obj, size_t relocs, size_t strings)
+{
+  rtems_rtl_lazy_table* table;
+  size_t                size;
+
+  if (relocs == 0)
+    return true;
+
+  /*
+   * Keep the table at most half full so probe sequences are short.
+   */
+  size = 2;
+  while (size < (relocs * 2))
+    size <<= 1;
+
+  table = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                               sizeof (rtems_rtl_lazy_table) +
+                               (size * sizeof (rtems_rtl_lazy_slot)) + strings,
+                               true);
+  if (table == NULL)
+  {
+    rtems_rtl_set_error (ENOMEM, "no memory for lazy binding table");
+    return false;
+  }
+
+  table->size = size;
+  table->strings = (char*) &table->slots[size];
+
+  obj->lazy = table;
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
+    printf ("rtl: lazy: %s: slots:%zu strings:%zu\n",
+            rtems_rtl_obj_oname (obj), size, strings);
+
+  return true;
+}
+
+void
+rtems_rtl_lazy_free (rtems_rtl_obj* obj)
+{
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, obj->lazy);
+  obj->lazy = NULL;
+}
+
+rtems_rtl_lazy_slot*
+rtems_rtl_lazy_slot_find (rtems_rtl_obj* obj, const char* name)
+{
+  rtems_rtl_lazy_table* table = obj->lazy;
+  size_t                mask;
+  size_t                index;
+  size_t                probes;
+
+  if (table == NULL)
+    return NULL;
+
+  mask = table->size - 1;
+  index = rtems_rtl_symbol_hash (name) & mask;
+
+  for (probes = 0; probes < table->size; ++probes)
+  {
+    rtems_rtl_lazy_slot* slot = &table->slots[index];
+
+    if (slot->name == NULL)
+    {
+      size_t len = strlen (name) + 1;
+      memcpy (table->strings, name, len);
+      slot->name = table->strings;
+      slot->obj = obj;
+      table->strings += len;
+      ++obj->lazy_syms;
+      return slot;
+    }
+
+    if (strcmp (slot->name, name) == 0)
+      return slot;
+
+    index = (index + 1) & mask;
+  }
+
+  return NULL;
+}
+
+void*
+rtems_rtl_lazy_resolve (rtems_rtl_lazy_slot* slot)
+{
+  rtems_rtl_obj* obj = slot->obj;
+
+  if (rtems_rtl_lock () == NULL)
+    _Internal_error (INTERNAL_ERROR_RTL_LAZY_BINDING_FAILED);
+
+  /*
+   * Another thread may have resolved the slot while this thread waited for
+   * the lock.
+   */
+  if (!slot->resolved)
+  {
+    rtems_rtl_obj_sym* symbol;
+    rtems_rtl_obj*     sobj;
+
+    symbol = rtems_rtl_symbol_global_find (slot->name);
+    if (symbol == NULL)
+    {
+      /*
+       * There is no caller to return the error to. Record it as the last
+       * error for fatal error handlers.
+       */
+      rtems_rtl_set_error (ENOENT, "lazy: %s: unresolved symbol: %s",
+                           rtems_rtl_obj_oname (obj), slot->name);
+      rtems_rtl_unlock ();
+      _Internal_error (INTERNAL_ERROR_RTL_LAZY_BINDING_FAILED);
+    }
+
+    sobj = rtems_rtl_find_obj_with_symbol (symbol);
+
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_DEPENDENCY))
+      printf ("rtl: lazy: depend: %s -> %s:%s\n",
+              rtems_rtl_obj_oname (obj),
+              sobj == NULL ? "not-found" : sobj->oname,
+              slot->name);
+
+    if (sobj != NULL)
+    {
+      if (rtems_rtl_obj_add_dependent (obj, sobj))
+        rtems_rtl_obj_inc_reference (sobj);
+    }
+
+    slot->target = symbol->value;
+    slot->resolved = true;
+    ++obj->lazy_resolved;
+  }
+
+  rtems_rtl_unlock ();
+
+  return slot->target;
+}
@@ -0,0 +1,119 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rtl
+ *
+ * @brief RTEMS Run-Time Linker Lazy Binding.
+ *
+ * An object file loaded with RTEMS_RTL_LAZY_BIND does not resolve the calls
+ * to external functions when it is loaded. Each call is relocated to a small
+ * architecture specific stub held in the object file's trampoline memory.
+ * The stub jumps through a slot. The slot initially holds the architecture's
+ * resolver entry. The first call through a stub looks up the symbol in the
+ * global symbol table and patches the slot so later calls go directly to the
+ * symbol.
+ *
+ * There is one slot and one stub for each symbol called lazily. The slots of
+ * an object file are held in a table allocated when the object file is
+ * loaded.
+ */
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#if !defined (_RTEMS_RTL_LAZY_H_)
+#define _RTEMS_RTL_LAZY_H_
+
+#include <rtems/rtl/rtl-obj.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * A lazy binding slot. The target is the first field as the architecture
+ * stubs load it using the slot's address.
+ */
+typedef struct rtems_rtl_lazy_slot
+{
+  void*          target;   /**< The call target. */
+  rtems_rtl_obj* obj;      /**< The object file the calls are in. */
+  const char*    name;     /**< The symbol's name. NULL if the slot is
+                            *   free. */
+  uintptr_t      stub;     /**< The address calls are relocated to. Zero
+                            *   if the slot has no stub. */
+  bool           resolved; /**< The target is the symbol's value. */
+} rtems_rtl_lazy_slot;
+
+/**
+ * Allocate the lazy binding table for an object file.
+ *
+ * @param obj The object file to allocate the table for.
+ * @param relocs The number of relocation records to bind lazily.
+ * @param strings The size of the symbol names including the nul characters.
+ * @retval true The table has been allocated or no table is needed.
+ * @retval false The table could not be allocated. The RTL error has the
+ *               error.
+ */
+bool rtems_rtl_lazy_alloc (rtems_rtl_obj* obj, size_t relocs, size_t strings);
+
+/**
+ * Free the lazy binding table of an object file.
+ *
+ * @param obj The object file to free the table of.
+ */
+void rtems_rtl_lazy_free (rtems_rtl_obj* obj);
+
+/**
+ * Find the slot for a symbol. A free slot is taken and the name copied into
+ * the table if the symbol does not have a slot. A new slot does not have a
+ * stub.
+ *
+ * @param obj The object file calling the symbol.
+ * @param name The symbol's name.
+ * @retval NULL There is no table or the table is full.
+ * @return rtems_rtl_lazy_slot* The symbol's slot.
+ */
+rtems_rtl_lazy_slot* rtems_rtl_lazy_slot_find (rtems_rtl_obj* obj,
+                                               const char*    name);
+
+/**
+ * Resolve a lazy binding slot. Called by the architecture's resolver entry
+ * on the first call through a slot's stub. The slot's target is set to the
+ * symbol's value. An unresolved symbol terminates the system with the
+ * INTERNAL_ERROR_RTL_LAZY_BINDING_FAILED fatal error. Lazy binding is
+ * only used for object files loaded with the RTEMS_RTL_LAZY_BIND mode flag.
+ *
+ * @param slot The slot to resolve.
+ * @return void* The address to call.
+ */
+void* rtems_rtl_lazy_resolve (rtems_rtl_lazy_slot* slot);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif
@@ -164,6 +164,94 @@ rtems_rtl_elf_rel_resolve_sym (Elf_Word type)
   return true;
 }
 
+/*
+ * The lazy binding resolver entry. A stub enters with the slot in ip. Save the
+ * argument registers, resolve the slot and jump to the symbol with the
+ * arguments restored. The entry is assembled in the same instruction set as
+ * the stubs.
+ */
+void rtems_rtl_elf_lazy_entry (void);
+
+__asm__ (
+  "  .pushsection .text\n"
+  "  .align 2\n"
+  "  .syntax unified\n"
+#if defined(__thumb__)
+  "  .thumb\n"
+  "  .thumb_func\n"
+#else
+  "  .arm\n"
+#endif
+  "  .type rtems_rtl_elf_lazy_entry, %function\n"
+  "rtems_rtl_elf_lazy_entry:\n"
+  "  push {r0-r3, ip, lr}\n"
+#if defined(__ARM_PCS_VFP)
+  "  vpush {d0-d7}\n"
+#endif
+  "  mov r0, ip\n"
+  "  bl rtems_rtl_lazy_resolve\n"
+#if defined(__ARM_PCS_VFP)
+  "  vpop {d0-d7}\n"
+#endif
+  "  str r0, [sp, #16]\n"
+  "  pop {r0-r3, ip, lr}\n"
+  "  bx ip\n"
+  "  .size rtems_rtl_elf_lazy_entry, . - rtems_rtl_elf_lazy_entry\n"
+  "  .popsection\n"
+);
+
+size_t
+rtems_rtl_elf_lazy_stub_size (void)
+{
+  return 12;
+}
+
+bool
+rtems_rtl_elf_rel_lazy (Elf_Word type)
+{
+  /*
+   * Only BL calls are bound lazily, THM_PC22 is THM_CALL. A JUMP24 branch
+   * cannot switch to Thumb.
+   */
+  return type == R_TYPE(CALL) || type == R_TYPE(THM_PC22);
+}
+
+Elf_Word
+rtems_rtl_elf_lazy_stub (void* stub, rtems_rtl_lazy_slot* slot)
+{
+  /*
+   *  Thumb mode:
+   *    ldr.w ip, [pc, #4]
+   *    ldr.w pc, [ip]
+   *    .word slot
+   *
+   *  ARM mode:
+   *    ldr ip, [pc]
+   *    ldr pc, [ip]
+   *    .word slot
+   */
+  uint32_t* tramp = (uint32_t*) stub;
+#if defined(__thumb__)
+ #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  *tramp++ = 0xc004f8df;
+  *tramp++ = 0xf000f8dc;
+ #else
+  *tramp++ = 0xf8dfc004; /* not tested */
+  *tramp++ = 0xf8dcf000; /* not tested */
+ #endif
+#else
+  *tramp++ = 0xe59fc000;
+  *tramp++ = 0xe59cf000;
+#endif
+  *tramp = (uint32_t) slot;
+  slot->target = (void*) rtems_rtl_elf_lazy_entry;
+#if defined(__thumb__)
+  return ((Elf_Word) stub) | 1;
+#else
+  return (Elf_Word) stub;
+#endif
+}
+
 rtems_rtl_elf_rel_status
 rtems_rtl_elf_relocate_rela_tramp (rtems_rtl_obj*            obj,
                                    const Elf_Rela*           rela,
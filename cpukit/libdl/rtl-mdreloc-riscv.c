@@ -89,6 +89,24 @@ rtems_rtl_elf_rel_resolve_sym (Elf_Word type) {
   return true;
 }
 
+size_t
+rtems_rtl_elf_lazy_stub_size (void) {
+  return 0;
+}
+
+bool
+rtems_rtl_elf_rel_lazy (Elf_Word type) {
+  (void) type;
+  return false;
+}
+
+Elf_Word
+rtems_rtl_elf_lazy_stub (void* stub, rtems_rtl_lazy_slot* slot) {
+  (void) stub;
+  (void) slot;
+  return 0;
+}
+
 size_t
 rtems_rtl_elf_relocate_tramp_max_size (void) {
   /*
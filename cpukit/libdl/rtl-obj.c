@@ -30,6 +30,7 @@
 #include <rtems/rtl/rtl-obj.h>
 #include "rtl-error.h"
 #include "rtl-find-file.h"
+#include "rtl-lazy.h"
 #include "rtl-string.h"
 #include <rtems/rtl/rtl-trace.h>
 
@@ -118,6 +119,7 @@ rtems_rtl_obj_free (rtems_rtl_obj* obj)
   rtems_rtl_obj_erase_dependents (obj);
   rtems_rtl_symbol_obj_erase (obj);
   rtems_rtl_obj_erase_trampoline (obj);
+  rtems_rtl_lazy_free (obj);
   rtems_rtl_obj_free_names (obj);
   if (obj->sec_num != NULL)
     free (obj->sec_num);
@@ -123,6 +123,7 @@ rtems_rtl_shell_status (const rtems_printer* printer,
   rtems_printf (printer, "  exec memory: %zi\n", summary.exec);
   rtems_printf (printer, "   sym memory: %zi\n", summary.symbols);
   rtems_printf (printer, "      symbols: %d\n", rtems_rtl_count_symbols (rtl));
+  rtems_printf (printer, "  sym buckets: %zu\n", rtl->globals.nbuckets);
 
   rtems_rtl_unlock ();
 
@@ -482,11 +483,13 @@ rtems_rtl_obj_printer (rtems_rtl_obj_print* print, rtems_rtl_obj* obj)
     rtems_printf (print->printer,
                   "%-*carchive name  : %s\n",
                   indent, ' ', rtems_rtl_obj_aname (obj));
-    strcpy (flags_str, "--");
+    strcpy (flags_str, "---");
     if (obj->flags & RTEMS_RTL_OBJ_LOCKED)
       flags_str[0] = 'L';
     if (obj->flags & RTEMS_RTL_OBJ_UNRESOLVED)
       flags_str[1] = 'U';
+    if (obj->flags & RTEMS_RTL_OBJ_IMAGE)
+      flags_str[2] = 'I';
     rtems_printf (print->printer,
                   "%-*cflags         : %s\n", indent, ' ', flags_str);
     rtems_printf (print->printer,
@@ -518,6 +521,12 @@ rtems_rtl_obj_printer (rtems_rtl_obj_print* print, rtems_rtl_obj* obj)
     rtems_printf (print->printer, "%-*creferences    : %zu\n", indent, ' ', obj->refs);
     rtems_printf (print->printer, "%-*ctrampolines   : %zu\n", indent, ' ',
                   rtems_rtl_obj_trampolines (obj));
+    if ((obj->flags & RTEMS_RTL_OBJ_LAZY) != 0)
+      rtems_printf (print->printer, "%-*clazy symbols  : %zu (resolved: %zu)\n",
+                    indent, ' ', obj->lazy_syms, obj->lazy_resolved);
+    if ((obj->flags & RTEMS_RTL_OBJ_IMAGE) != 0)
+      rtems_printf (print->printer, "%-*cimage cache   : saved %" PRIu64 " usec\n",
+                    indent, ' ', obj->image_saved / 1000);
     rtems_printf (print->printer, "%-*csymbols       : %zi\n", indent, ' ', obj->global_syms);
     rtems_printf (print->printer, "%-*csymbol memory : %zi\n", indent, ' ', obj->global_size);
   }
@@ -19,6 +19,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -38,40 +39,171 @@ static rtems_rtl_obj_sym global_sym_add =
   .value = (void*) rtems_rtl_base_sym_global_add
 };
 
-static uint_fast32_t
+uint32_t
 rtems_rtl_symbol_hash (const char *s)
 {
-  uint_fast32_t h = 5381;
+  uint32_t      h = 5381;
   unsigned char c;
   for (c = *s; c != '\0'; c = *++s)
     h = h * 33 + c;
-  return h & 0xffffffff;
+  return h;
+}
+
+/*
+ * The bloom filter sets two bits per symbol in the word selected by the hash.
+ * The second bit is taken from the upper bits of the hash.
+ */
+#define RTEMS_RTL_SYMBOL_BLOOM_BITS  (sizeof (uintptr_t) * CHAR_BIT)
+#define RTEMS_RTL_SYMBOL_BLOOM_SHIFT (26)
+
+static inline uintptr_t*
+rtems_rtl_symbol_bloom_word (rtems_rtl_symbols* symbols, uint32_t hash)
+{
+  return &symbols->bloom[(hash / RTEMS_RTL_SYMBOL_BLOOM_BITS) &
+                         (symbols->nbuckets - 1)];
+}
+
+static inline uintptr_t
+rtems_rtl_symbol_bloom_mask (uint32_t hash)
+{
+  return ((uintptr_t) 1 << (hash % RTEMS_RTL_SYMBOL_BLOOM_BITS)) |
+    ((uintptr_t) 1 << ((hash >> RTEMS_RTL_SYMBOL_BLOOM_SHIFT) %
+                       RTEMS_RTL_SYMBOL_BLOOM_BITS));
+}
+
+static inline rtems_chain_control*
+rtems_rtl_symbol_bucket (rtems_rtl_symbols* symbols, uint32_t hash)
+{
+  return &symbols->buckets[hash & (symbols->nbuckets - 1)];
+}
+
+static void
+rtems_rtl_symbol_global_link (rtems_rtl_symbols* symbols,
+                              rtems_rtl_obj_sym* symbol)
+{
+  *rtems_rtl_symbol_bloom_word (symbols, symbol->hash) |=
+    rtems_rtl_symbol_bloom_mask (symbol->hash);
+  rtems_chain_append_unprotected (rtems_rtl_symbol_bucket (symbols,
+                                                           symbol->hash),
+                                  &symbol->node);
+}
+
+static bool
+rtems_rtl_symbol_table_alloc (rtems_rtl_symbols* symbols, size_t buckets)
+{
+  size_t b;
+
+  symbols->buckets = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_SYMBOL,
+                                          buckets * sizeof (rtems_chain_control),
+                                          true);
+  if (!symbols->buckets)
+    return false;
+
+  symbols->bloom = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_SYMBOL,
+                                        buckets * sizeof (uintptr_t),
+                                        true);
+  if (!symbols->bloom)
+  {
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, symbols->buckets);
+    symbols->buckets = NULL;
+    return false;
+  }
+
+  symbols->nbuckets = buckets;
+  for (b = 0; b < symbols->nbuckets; ++b)
+    rtems_chain_initialize_empty (&symbols->buckets[b]);
+
+  return true;
+}
+
+/*
+ * Double the number of buckets and move the symbols over using the stored
+ * hashes. The bloom filter is rebuilt so bits of erased symbols are dropped.
+ * If there is no memory the table stays as it is and only the chains get
+ * longer.
+ */
+static void
+rtems_rtl_symbol_table_grow (rtems_rtl_symbols* symbols)
+{
+  rtems_rtl_symbols    grown;
+  rtems_chain_control* buckets;
+  size_t               b;
+
+  if (!rtems_rtl_symbol_table_alloc (&grown, symbols->nbuckets * 2))
+    return;
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_GLOBAL_SYM))
+    printf ("rtl: global symbol table grow: %zu buckets, %zu symbols\n",
+            grown.nbuckets, symbols->nsyms);
+
+  buckets = symbols->buckets;
+
+  for (b = 0; b < symbols->nbuckets; ++b)
+  {
+    rtems_chain_node* node;
+    while ((node = rtems_chain_get_unprotected (&buckets[b])) != NULL)
+      rtems_rtl_symbol_global_link (&grown, (rtems_rtl_obj_sym*) node);
+  }
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, buckets);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, symbols->bloom);
+
+  symbols->buckets = grown.buckets;
+  symbols->nbuckets = grown.nbuckets;
+  symbols->bloom = grown.bloom;
 }
 
 static void
 rtems_rtl_symbol_global_insert (rtems_rtl_symbols* symbols,
                                 rtems_rtl_obj_sym* symbol)
 {
-  uint_fast32_t hash = rtems_rtl_symbol_hash (symbol->name);
-  rtems_chain_append (&symbols->buckets[hash % symbols->nbuckets],
-                      &symbol->node);
+  if (symbols->nsyms >= symbols->nbuckets * RTEMS_RTL_SYMS_GLOBAL_LOAD)
+    rtems_rtl_symbol_table_grow (symbols);
+  symbol->hash = rtems_rtl_symbol_hash (symbol->name);
+  rtems_rtl_symbol_global_link (symbols, symbol);
+  ++symbols->nsyms;
+}
+
+static rtems_rtl_obj_sym*
+rtems_rtl_symbol_global_lookup (rtems_rtl_symbols* symbols,
+                                const char*        name,
+                                uint32_t           hash)
+{
+  uintptr_t            mask;
+  rtems_chain_control* bucket;
+  rtems_chain_node*    node;
+
+  mask = rtems_rtl_symbol_bloom_mask (hash);
+  if ((*rtems_rtl_symbol_bloom_word (symbols, hash) & mask) != mask)
+    return NULL;
+
+  bucket = rtems_rtl_symbol_bucket (symbols, hash);
+  node = rtems_chain_first (bucket);
+
+  while (!rtems_chain_is_tail (bucket, node))
+  {
+    rtems_rtl_obj_sym* sym = (rtems_rtl_obj_sym*) node;
+    if (sym->hash == hash && strcmp (name, sym->name) == 0)
+      return sym;
+    node = rtems_chain_next (node);
+  }
+
+  return NULL;
 }
 
 bool
 rtems_rtl_symbol_table_open (rtems_rtl_symbols* symbols,
                              size_t             buckets)
 {
-  symbols->buckets = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_SYMBOL,
-                                          buckets * sizeof (rtems_chain_control),
-                                          true);
-  if (!symbols->buckets)
+  size_t size = 1;
+  while (size < buckets)
+    size <<= 1;
+  if (!rtems_rtl_symbol_table_alloc (symbols, size))
   {
     rtems_rtl_set_error (ENOMEM, "no memory for global symbol table");
     return false;
   }
-  symbols->nbuckets = buckets;
-  for (buckets = 0; buckets < symbols->nbuckets; ++buckets)
-    rtems_chain_initialize_empty (&symbols->buckets[buckets]);
+  symbols->nsyms = 0;
   rtems_rtl_symbol_global_insert (symbols, &global_sym_add);
   return true;
 }
@@ -80,6 +212,7 @@ void
 rtems_rtl_symbol_table_close (rtems_rtl_symbols* symbols)
 {
   rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, symbols->buckets);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, symbols->bloom);
 }
 
 bool
@@ -162,7 +295,9 @@ rtems_rtl_symbol_global_add (rtems_rtl_obj*       obj,
     sym->value = copy_voidp.value;
     if (rtems_rtl_trace (RTEMS_RTL_TRACE_GLOBAL_SYM))
       printf ("rtl: esyms: %s -> %8p\n", sym->name, sym->value);
-    if (rtems_rtl_symbol_global_find (sym->name) == NULL)
+    if (rtems_rtl_symbol_global_lookup (symbols,
+                                        sym->name,
+                                        rtems_rtl_symbol_hash (sym->name)) == NULL)
       rtems_rtl_symbol_global_insert (symbols, sym);
     ++sym;
   }
@@ -175,29 +310,9 @@ rtems_rtl_symbol_global_add (rtems_rtl_obj*       obj,
 rtems_rtl_obj_sym*
 rtems_rtl_symbol_global_find (const char* name)
 {
-  rtems_rtl_symbols*   symbols;
-  uint_fast32_t        hash;
-  rtems_chain_control* bucket;
-  rtems_chain_node*    node;
-
-  symbols = rtems_rtl_global_symbols ();
-
-  hash = rtems_rtl_symbol_hash (name);
-  bucket = &symbols->buckets[hash % symbols->nbuckets];
-  node = rtems_chain_first (bucket);
-
-  while (!rtems_chain_is_tail (bucket, node))
-  {
-    rtems_rtl_obj_sym* sym = (rtems_rtl_obj_sym*) node;
-    /*
-     * Use the hash. I could add this to the symbol but it uses more memory.
-     */
-    if (strcmp (name, sym->name) == 0)
-      return sym;
-    node = rtems_chain_next (node);
-  }
-
-  return NULL;
+  return rtems_rtl_symbol_global_lookup (rtems_rtl_global_symbols (),
+                                         name,
+                                         rtems_rtl_symbol_hash (name));
 }
 
 static int
@@ -288,11 +403,16 @@ rtems_rtl_symbol_obj_erase (rtems_rtl_obj* obj)
   rtems_rtl_symbol_obj_erase_local (obj);
   if (obj->global_table)
   {
+    rtems_rtl_symbols* symbols;
     rtems_rtl_obj_sym* sym;
     size_t             s;
+    symbols = rtems_rtl_global_symbols ();
     for (s = 0, sym = obj->global_table; s < obj->global_syms; ++s, ++sym)
-        if (!rtems_chain_is_node_off_chain (&sym->node))
-          rtems_chain_extract (&sym->node);
+      if (!rtems_chain_is_node_off_chain (&sym->node))
+      {
+        rtems_chain_extract (&sym->node);
+        --symbols->nsyms;
+      }
     rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, obj->global_table);
     obj->global_table = NULL;
     obj->global_size = 0;
@@ -75,7 +75,9 @@ rtems_rtl_trace_shell_command (const rtems_printer* printer,
     "archives",
     "archive-syms",
     "dependency",
-    "bit-alloc"
+    "bit-alloc",
+    "comp",
+    "image"
   };
 
   rtems_rtl_trace_mask set_value = 0;
@@ -127,138 +127,182 @@ rtems_rtl_unresolved_rec_first_free (rtems_rtl_unresolv_block* block)
   return &block->rec[0] + block->recs;
 }
 
-/**
- * Name management iterator data.
+/*
+ * The initial size of the name table. The table doubles when full. A name
+ * index is 16 bits and index 0 is not used.
  */
-typedef struct
-{
-  const char*             name;   /**< The name being searched for. */
-  size_t                  length; /**< The length of the name. */
-  rtems_rtl_unresolv_rec* rec;    /**< The record being searched for. */
-  int                     index;  /**< The name's index. */
-  int                     offset; /**< The offset to move the index. */
-} rtl_unresolved_name_data;
+#define RTEMS_RTL_UNRESOLVED_NAMES     (64)
+#define RTEMS_RTL_UNRESOLVED_NAMES_MAX (UINT16_MAX + 1)
 
 static bool
-rtems_rtl_unresolved_find_name_iterator (rtems_rtl_unresolv_rec* rec,
-                                         void*                   data)
-{
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  if (rec->type == rtems_rtl_unresolved_symbol)
+rtems_rtl_unresolved_names_alloc (rtems_rtl_unresolved* unresolved,
+                                  size_t                nnames)
+{
+  rtems_rtl_unresolv_name* names;
+  uint16_t*                buckets;
+  size_t                   index;
+
+  names = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_EXTERNAL,
+                               nnames * sizeof (rtems_rtl_unresolv_name),
+                               true);
+  buckets = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_EXTERNAL,
+                                 nnames * sizeof (uint16_t),
+                                 true);
+  if (names == NULL || buckets == NULL)
   {
-    if ((rec->rec.name.length == nd->length)
-        && (strcmp (rec->rec.name.name, nd->name) == 0))
-    {
-      ++rec->rec.name.refs;
-      return true;
-    }
-    ++nd->index;
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, names);
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, buckets);
+    rtems_rtl_set_error (ENOMEM, "no memory for unresolved names");
+    return false;
   }
-  return false;
-}
 
-static int
-rtems_rtl_unresolved_find_name (const char* name)
-{
-  rtl_unresolved_name_data nd = {
-    .name = name,
-    .length = strlen (name) + 1,
-    .rec = NULL,
-    .index = 1,
-    .offset = 0
-  };
-  if (rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_find_name_iterator,
-                                    &nd))
-    return nd.index;
-  return -1;
-}
+  /*
+   * Copy the names keeping their indexes and rehash them. The new entries are
+   * added to the free list. The names are only resized when full so there
+   * are no free entries in the old table.
+   */
+  if (unresolved->names != NULL)
+    memcpy (names, unresolved->names,
+            unresolved->nnames * sizeof (rtems_rtl_unresolv_name));
 
-static bool
-rtems_rtl_unresolved_find_index_iterator (rtems_rtl_unresolv_rec* rec,
-                                          void*                   data)
-{
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  if (rec == nd->rec)
-    return true;
-  if (rec->type == rtems_rtl_unresolved_symbol)
-    ++nd->index;
-  return false;
+  for (index = 1; index < unresolved->nnames; ++index)
+  {
+    rtems_rtl_unresolv_name* name = &names[index];
+    uint16_t*                bucket = &buckets[name->hash & (nnames - 1)];
+    name->next = *bucket;
+    *bucket = index;
+  }
+
+  unresolved->free = 0;
+  for (index = nnames - 1; index >= unresolved->nnames && index > 0; --index)
+  {
+    names[index].next = unresolved->free;
+    unresolved->free = index;
+  }
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->names);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->buckets);
+
+  unresolved->names = names;
+  unresolved->buckets = buckets;
+  unresolved->nnames = nnames;
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
+    printf ("rtl: unresolv: names: %zu\n", nnames);
+
+  return true;
 }
 
 static int
-rtems_rtl_unresolved_find_index (rtems_rtl_unresolv_rec* rec)
-{
-  rtl_unresolved_name_data nd = {
-    .name = NULL,
-    .length = 0,
-    .rec = rec,
-    .index = 1,
-    .offset = 0
-  };
-  if (rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_find_index_iterator,
-                                    &nd))
-    return nd.index;
+rtems_rtl_unresolved_find_name (rtems_rtl_unresolved* unresolved,
+                                const char*           name,
+                                uint32_t              hash)
+{
+  uint16_t index = unresolved->buckets[hash & (unresolved->nnames - 1)];
+  while (index != 0)
+  {
+    rtems_rtl_unresolv_name* entry = &unresolved->names[index];
+    if (entry->hash == hash && strcmp (entry->rec->rec.name.name, name) == 0)
+      return index;
+    index = entry->next;
+  }
   return -1;
 }
 
-static bool
-rtems_rtl_unresolved_reindex_iterator (rtems_rtl_unresolv_rec* rec,
-                                       void*                   data)
+static int
+rtems_rtl_unresolved_add_name (rtems_rtl_unresolved*   unresolved,
+                               rtems_rtl_unresolv_rec* rec,
+                               uint32_t                hash)
 {
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  /*
-   * Reindexing only effects the reloc records.
-   */
-  if (rec->type == rtems_rtl_unresolved_reloc)
+  rtems_rtl_unresolv_name* entry;
+  uint16_t*                bucket;
+  uint16_t                 index;
+
+  if (unresolved->free == 0)
   {
-    if (rec->rec.reloc.name >= nd->index)
-      rec->rec.reloc.name += nd->offset;
+    if (unresolved->nnames >= RTEMS_RTL_UNRESOLVED_NAMES_MAX)
+    {
+      rtems_rtl_set_error (ENOMEM, "too many unresolved names");
+      return -1;
+    }
+    if (!rtems_rtl_unresolved_names_alloc (unresolved, unresolved->nnames * 2))
+      return -1;
   }
-  return false;
+
+  index = unresolved->free;
+  entry = &unresolved->names[index];
+  unresolved->free = entry->next;
+
+  bucket = &unresolved->buckets[hash & (unresolved->nnames - 1)];
+  entry->rec = rec;
+  entry->sym = NULL;
+  entry->hash = hash;
+  entry->next = *bucket;
+  *bucket = index;
+
+  rec->rec.name.index = index;
+
+  return index;
 }
 
 static void
-rtems_rtl_unresolved_reindex_names (uint16_t index, int offset)
+rtems_rtl_unresolved_remove_name (rtems_rtl_unresolved* unresolved,
+                                  uint16_t              index)
 {
-  rtl_unresolved_name_data nd = {
-    .name = NULL,
-    .length = 0,
-    .rec = NULL,
-    .index = index,
-    .offset = offset
-  };
-  rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_reindex_iterator,
-                                &nd);
+  rtems_rtl_unresolv_name* entry = &unresolved->names[index];
+  uint16_t*                link;
+
+  link = &unresolved->buckets[entry->hash & (unresolved->nnames - 1)];
+  while (*link != index)
+    link = &unresolved->names[*link].next;
+  *link = entry->next;
+
+  entry->rec = NULL;
+  entry->sym = NULL;
+  entry->next = unresolved->free;
+  unresolved->free = index;
 }
 
-/**
- * Struct to pass relocation data in the iterator.
+static bool
+rtems_rtl_unresolved_relink_iterator (rtems_rtl_unresolv_rec* rec,
+                                      void*                   data)
+{
+  rtems_rtl_unresolved* unresolved = (rtems_rtl_unresolved*) data;
+  if (rec->type == rtems_rtl_unresolved_symbol)
+    unresolved->names[rec->rec.name.index].rec = rec;
+  return false;
+}
+
+/*
+ * Update the name table after records have been moved in the blocks.
  */
-typedef struct rtems_rtl_unresolved_reloc_data
+static void
+rtems_rtl_unresolved_relink_names (rtems_rtl_unresolved* unresolved)
 {
-  uint16_t                name;     /**< Name index. */
-  rtems_rtl_unresolv_rec* name_rec; /**< Name record. */
-  rtems_rtl_obj_sym*      sym;      /**< The symbol record. */
-} rtems_rtl_unresolved_reloc_data;
+  rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_relink_iterator,
+                                unresolved);
+}
 
 static bool
 rtems_rtl_unresolved_resolve_reloc (rtems_rtl_unresolv_rec* rec,
                                     void*                   data)
 {
-  if (rec->type == rtems_rtl_unresolved_reloc)
+  if (rec->type == rtems_rtl_unresolved_reloc && rec->rec.reloc.obj != NULL)
   {
-    rtems_chain_control*             pending;
-    rtems_rtl_unresolved_reloc_data* rd;
+    rtems_rtl_unresolved*    unresolved;
+    rtems_rtl_unresolv_name* name;
+    rtems_chain_control*     pending;
 
-    rd = (rtems_rtl_unresolved_reloc_data*) data;
+    unresolved = (rtems_rtl_unresolved*) data;
+    name = &unresolved->names[rec->rec.reloc.name];
 
-    if (rec->rec.reloc.name == rd->name && rec->rec.reloc.obj != NULL)
+    if (name->sym != NULL)
     {
       if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
         printf ("rtl: unresolv: resolve reloc: %s\n",
-                rd->name_rec->rec.name.name);
+                name->rec->rec.name.name);
 
-      if (rtems_rtl_obj_relocate_unresolved (&rec->rec.reloc, rd->sym))
+      if (rtems_rtl_obj_relocate_unresolved (&rec->rec.reloc, name->sym))
       {
         /*
          * If all unresolved externals are resolved add the obj module
@@ -280,45 +324,46 @@ rtems_rtl_unresolved_resolve_reloc (rtems_rtl_unresolv_rec* rec,
          * NULL and names with a reference count of 0.
          */
         rec->rec.reloc.obj = NULL;
-        if (rd->name_rec != NULL && rd->name_rec->rec.name.refs > 0)
-          --rd->name_rec->rec.name.refs;
+        if (name->rec->rec.name.refs > 0)
+          --name->rec->rec.name.refs;
       }
     }
   }
   return false;
 }
 
-static bool
-rtems_rtl_unresolved_resolve_iterator (rtems_rtl_unresolv_rec* rec,
-                                       void*                   data)
+/*
+ * Look up the unresolved names in the global symbol table. Returns the number
+ * of names found.
+ */
+static size_t
+rtems_rtl_unresolved_lookup_names (rtems_rtl_unresolved* unresolved)
 {
-  if (rec->type == rtems_rtl_unresolved_symbol)
+  size_t found = 0;
+  size_t index;
+
+  for (index = 1; index < unresolved->nnames; ++index)
   {
-    rtems_rtl_unresolved_reloc_data* rd;
-    rd = (rtems_rtl_unresolved_reloc_data*) data;
+    rtems_rtl_unresolv_name* name = &unresolved->names[index];
 
-    ++rd->name;
+    if (name->rec == NULL)
+      continue;
 
     if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-      printf ("rtl: unresolv: lookup: %d: %s\n", rd->name, rec->rec.name.name);
+      printf ("rtl: unresolv: lookup: %zu: %s\n",
+              index, name->rec->rec.name.name);
 
-    rd->sym = rtems_rtl_symbol_global_find (rec->rec.name.name);
+    name->sym = rtems_rtl_symbol_global_find (name->rec->rec.name.name);
 
-    if (rd->sym)
+    if (name->sym != NULL)
     {
       if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-        printf ("rtl: unresolv: found: %s\n", rec->rec.name.name);
-
-      rd->name_rec = rec;
-
-      rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_resolve_reloc, rd);
-
-      rd->name_rec = NULL;
-      rd->sym = NULL;
+        printf ("rtl: unresolv: found: %s\n", name->rec->rec.name.name);
+      ++found;
     }
   }
 
-  return false;
+  return found;
 }
 
 /**
@@ -431,11 +476,10 @@ rtems_rtl_unresolved_compact (void)
   if (unresolved)
   {
     /*
-     * Iterate over the blocks removing any empty strings. If a string is
-     * removed update the indexes of all strings above this level.
+     * Iterate over the blocks removing any empty strings and resolved
+     * relocation records. The name indexes do not change.
      */
     rtems_chain_node* node = rtems_chain_first (&unresolved->blocks);
-    uint16_t          index = 0;
     while (!rtems_chain_is_tail (&unresolved->blocks, node))
     {
       rtems_rtl_unresolv_block* block = (rtems_rtl_unresolv_block*) node;
@@ -446,20 +490,19 @@ rtems_rtl_unresolved_compact (void)
 
         if (rec->type == rtems_rtl_unresolved_symbol)
         {
-          ++index;
           if (rec->rec.name.refs == 0)
           {
             size_t name_recs;
             if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
               printf ("rtl: unresolv: remove name: %s\n", rec->rec.name.name);
-            rtems_rtl_unresolved_reindex_names (index, -1);
+            rtems_rtl_unresolved_remove_name (unresolved,
+                                              rec->rec.name.index);
             /*
              * Compact the block removing the name record.
              */
             name_recs = rtems_rtl_unresolved_symbol_recs (rec->rec.name.name);
             rtems_rtl_unresolved_clean_block (block, rec, name_recs,
                                               unresolved->block_recs);
-            --index;
             next_rec = false;
           }
         }
@@ -480,6 +523,8 @@ rtems_rtl_unresolved_compact (void)
       node = rtems_rtl_unresolved_delete_block_if_empty (&unresolved->blocks,
                                                          block);
     }
+
+    rtems_rtl_unresolved_relink_names (unresolved);
   }
 }
 
@@ -490,7 +535,19 @@ rtems_rtl_unresolved_table_open (rtems_rtl_unresolved* unresolved,
   unresolved->marker = 0xdeadf00d;
   unresolved->block_recs = block_recs;
   rtems_chain_initialize_empty (&unresolved->blocks);
-  return rtems_rtl_unresolved_block_alloc (unresolved);
+  unresolved->names = NULL;
+  unresolved->buckets = NULL;
+  unresolved->nnames = 0;
+  if (!rtems_rtl_unresolved_names_alloc (unresolved,
+                                         RTEMS_RTL_UNRESOLVED_NAMES))
+    return false;
+  if (rtems_rtl_unresolved_block_alloc (unresolved) == NULL)
+  {
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->names);
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->buckets);
+    return false;
+  }
+  return true;
 }
 
 void
@@ -503,6 +560,8 @@ rtems_rtl_unresolved_table_close (rtems_rtl_unresolved* unresolved)
     rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, node);
     node = next;
   }
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->names);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->buckets);
 }
 
 bool
@@ -541,6 +600,7 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
   rtems_rtl_unresolved*     unresolved;
   rtems_rtl_unresolv_block* block;
   rtems_rtl_unresolv_rec*   rec;
+  uint32_t                  hash;
   int                       name_index;
 
   if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
@@ -554,12 +614,17 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
   /*
    * Is the name present?
    */
-  name_index = rtems_rtl_unresolved_find_name (name);
+  hash = rtems_rtl_symbol_hash (name);
+  name_index = rtems_rtl_unresolved_find_name (unresolved, name, hash);
 
   /*
    * An index less than 0 means the name was not found.
    */
-  if (name_index < 0)
+  if (name_index >= 0)
+  {
+    ++unresolved->names[name_index].rec->rec.name.refs;
+  }
+  else
   {
     size_t name_recs;
 
@@ -582,8 +647,7 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
     rec = rtems_rtl_unresolved_rec_first_free (block);
 
     /*
-     * Enter the new record before reindexing so the iterator can see
-     * it and the iterator is called.
+     * Enter the new record and add it to the name table.
      */
     rec->type = rtems_rtl_unresolved_symbol;
     rec->rec.name.refs = 1;
@@ -592,18 +656,13 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
     memcpy ((void*) &rec->rec.name.name[0], name, rec->rec.name.length);
     block->recs += name_recs;
 
-    /*
-     * Find the name index for the name and then reindex the names which
-     * are moved up because of the insertion.
-     */
-    name_index = rtems_rtl_unresolved_find_index (rec);
+    name_index = rtems_rtl_unresolved_add_name (unresolved, rec, hash);
     if (name_index < 0)
     {
-      rtems_rtl_set_error (ENOMEM, "internal unresolved block error");
+      rtems_rtl_unresolved_clean_block (block, rec, name_recs,
+                                        unresolved->block_recs);
       return false;
     }
-
-    rtems_rtl_unresolved_reindex_names (name_index, 1);
   }
 
   /*
@@ -635,16 +694,21 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
 void
 rtems_rtl_unresolved_resolve (void)
 {
-  bool resolving = true;
+  rtems_rtl_unresolved* unresolved;
+  bool                  resolving = true;
 
   if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
     printf ("rtl: unresolv: global resolve\n");
 
+  unresolved = rtems_rtl_unresolved_unprotected ();
+  if (unresolved == NULL)
+    return;
+
   /*
    * The resolving process is two separate stages, The first stage is to
-   * iterate over the unresolved symbols searching the global symbol table. If
-   * a symbol is found iterate over the unresolved relocation records for the
-   * symbol fixing up the relocations. The second stage is to search the
+   * look up the unresolved symbols in the global symbol table. If any symbols
+   * are found iterate once over the unresolved relocation records fixing up
+   * the relocations of the symbols found. The second stage is to search the
    * archives for symbols we have not searched before and if a symbol is found
    * in an archve load the object file. Loading an object file stops the
    * search of the archives for symbols and stage one is performed again. The
@@ -652,19 +716,18 @@ rtems_rtl_unresolved_resolve (void)
    */
   while (resolving)
   {
-    rtems_rtl_unresolved_reloc_data rd = {
-      .name = 0,
-      .name_rec = NULL,
-      .sym = NULL
-    };
     rtems_rtl_unresolved_archive_reloc_data ard = {
       .name = 0,
       .result = rtems_rtl_archive_search_not_found,
       .archives = rtems_rtl_archives_unprotected ()
     };
 
-    rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_resolve_iterator, &rd);
-    rtems_rtl_unresolved_compact ();
+    if (rtems_rtl_unresolved_lookup_names (unresolved) != 0)
+    {
+      rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_resolve_reloc,
+                                    unresolved);
+      rtems_rtl_unresolved_compact ();
+    }
     rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_archive_iterator, &ard);
 
     resolving = ard.result == rtems_rtl_archive_search_loaded;
@@ -753,6 +816,8 @@ rtems_rtl_trampoline_remove (rtems_rtl_obj* obj)
       node = rtems_rtl_unresolved_delete_block_if_empty (&unresolved->blocks,
                                                          block);
     }
+
+    rtems_rtl_unresolved_relink_names (unresolved);
   }
 }
 
@@ -779,8 +844,8 @@ rtems_rtl_unresolved_dump_iterator (rtems_rtl_unresolv_rec* rec,
     break;
   case rtems_rtl_unresolved_symbol:
     ++dd->names;
-    printf (" %3zu: 1:  name: %3zu refs:%4d: flags:%04x %s (%d)\n",
-            dd->rec, dd->names,
+    printf (" %3zu: 1:  name: %3d refs:%4d: flags:%04x %s (%d)\n",
+            dd->rec, rec->rec.name.index,
             rec->rec.name.refs,
             rec->rec.name.flags,
             rec->rec.name.name,
@@ -209,6 +209,8 @@ rtems_rtl_data_init (void)
         return false;
       }
 
+      rtems_rtl_image_cache_open (&rtl->image_cache);
+
       rtl->base = rtems_rtl_obj_alloc ();
       if (!rtl->base)
       {
@@ -525,6 +527,15 @@ rtems_rtl_load_object (const char* name, int mode)
 
     rtems_chain_append (&rtl->pending, &obj->link);
 
+    /*
+     * Function calls are bound on the first call if explicitly requested.
+     * Callers passing RTLD_LAZY expect a failed load for missing symbols and
+     * not a fatal error on a call. The format loader clears the flag if it
+     * cannot bind lazily.
+     */
+    if ((mode & RTEMS_RTL_LAZY_BIND) != 0)
+      obj->flags |= RTEMS_RTL_OBJ_LAZY;
+
     /*
      * Find the file in the file system using the search path. The fname field
      * will point to a valid file name if found.
@@ -850,6 +861,7 @@ rtems_rtl_base_sym_global_add (const unsigned char* esyms,
   }
 
   rtems_rtl_symbol_global_add (rtl->base, esyms, size);
+  rtems_rtl_image_cache_base_add (&rtl->image_cache, esyms, size);
 
   rtems_rtl_unlock ();
 }
@@ -1,6 +1,9 @@
 /*
  * Trivial File Transfer Protocol (RFC 1350)
  *
+ * Option extension (RFC 2347), block size option (RFC 2348) and window size
+ * option (RFC 7440)
+ *
  * Transfer file to/from remote host
  *
  * W. Eric Norum
@@ -23,6 +26,7 @@
 #include <errno.h>
 #include <malloc.h>
 #include <string.h>
+#include <strings.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <rtems.h>
@@ -65,12 +69,43 @@ int rtems_tftp_driver_debug = 1;
 #define TFTP_OPCODE_DATA    3
 #define TFTP_OPCODE_ACK     4
 #define TFTP_OPCODE_ERROR   5
+#define TFTP_OPCODE_OACK    6
+
+/*
+ * TFTP error codes
+ */
+#define TFTP_ERROR_OPTION   8
 
 /*
- * Largest data transfer
+ * Largest request and error message
  */
 #define TFTP_BUFSIZE        512
 
+/*
+ * Space for the options in a request
+ */
+#define TFTP_OPTIONS_SIZE   64
+
+/*
+ * Block sizes (RFC 1350 and RFC 2348)
+ */
+#define TFTP_DEFAULT_BLOCKSIZE  512
+#define TFTP_MIN_BLOCKSIZE      8
+#define TFTP_MAX_BLOCKSIZE      65464
+
+/*
+ * Window sizes (RFC 7440)
+ */
+#define TFTP_DEFAULT_WINDOWSIZE 1
+#define TFTP_MAX_WINDOWSIZE     65535
+
+/*
+ * Options requested if the mount does not set them. The block size fills an
+ * Ethernet frame.
+ */
+#define TFTP_CONFIG_BLOCKSIZE   1456
+#define TFTP_CONFIG_WINDOWSIZE  8
+
 /*
  * Packets transferred between machines
  */
@@ -80,18 +115,25 @@ union tftpPacket {
      */
     struct tftpRWRQ {
         uint16_t      opcode;
-        char                filename_mode[TFTP_BUFSIZE];
+        char                filename_mode[TFTP_BUFSIZE + TFTP_OPTIONS_SIZE];
     } tftpRWRQ;
 
     /*
-     * DATA packet
+     * DATA packet, the data follows the block number
      */
     struct tftpDATA {
         uint16_t      opcode;
         uint16_t      blocknum;
-        uint8_t       data[TFTP_BUFSIZE];
     } tftpDATA;
 
+    /*
+     * OACK packet
+     */
+    struct tftpOACK {
+        uint16_t      opcode;
+        char                options[TFTP_BUFSIZE];
+    } tftpOACK;
+
     /*
      * ACK packet
      */
@@ -117,13 +159,25 @@ struct tftpStream {
     /*
      * Buffer for storing most recently-received packet
      */
-    union tftpPacket    pkbuf;
+    union tftpPacket    *pkbuf;
+    int                 pksize;
 
     /*
      * Last block number transferred
      */
     uint16_t      blocknum;
 
+    /*
+     * Negotiated block size and window size
+     */
+    int           blocksize;
+    uint16_t      windowsize;
+
+    /*
+     * Blocks received in the current window
+     */
+    uint16_t      windowpos;
+
     /*
      * Data transfer socket
      */
@@ -143,8 +197,14 @@ struct tftpStream {
     int     firstReply;
     int     eof;
     int     writing;
+    int     reacked;
 };
 
+/*
+ * The data of a DATA packet
+ */
+#define tftpData(_tp) ((uint8_t *) (_tp)->pkbuf + 2 * sizeof (uint16_t))
+
 /*
  * Flags for filesystem info.
  */
@@ -155,6 +215,8 @@ struct tftpStream {
  */
 typedef struct tftpfs_info_s {
   uint32_t flags;
+  int blocksize;
+  int windowsize;
   rtems_mutex tftp_mutex;
   int nStreams;
   struct tftpStream ** volatile tftpStreams;
@@ -188,6 +250,8 @@ int rtems_tftpfs_initialize(
   size_t devicelen = strlen (device);
   tftpfs_info_t *fs = NULL;
   char *root_path;
+  char *config_copy = NULL;
+  int eno = ENOMEM;
 
   if (devicelen == 0) {
     root_path = malloc (1);
@@ -209,9 +273,42 @@ int rtems_tftpfs_initialize(
   if (fs == NULL)
     goto error;
   fs->flags = 0;
+  fs->blocksize = TFTP_CONFIG_BLOCKSIZE;
+  fs->windowsize = TFTP_CONFIG_WINDOWSIZE;
   fs->nStreams = 0;
   fs->tftpStreams = 0;
-  
+
+  if (data) {
+      char* config = config_copy = strdup (data);
+      char* token;
+      char* saveptr;
+      if (config == NULL)
+          goto error;
+      token = strtok_r (config, " ", &saveptr);
+      while (token) {
+          if (strcmp (token, "verbose") == 0)
+              fs->flags |= TFTPFS_VERBOSE;
+          else if (strncmp (token, "blocksize=", 10) == 0) {
+              fs->blocksize = (int) strtol (token + 10, NULL, 10);
+              if ((fs->blocksize < TFTP_MIN_BLOCKSIZE)
+               || (fs->blocksize > TFTP_MAX_BLOCKSIZE)) {
+                  eno = EINVAL;
+                  goto error;
+              }
+          }
+          else if (strncmp (token, "windowsize=", 11) == 0) {
+              fs->windowsize = (int) strtol (token + 11, NULL, 10);
+              if ((fs->windowsize < TFTP_DEFAULT_WINDOWSIZE)
+               || (fs->windowsize > TFTP_MAX_WINDOWSIZE)) {
+                  eno = EINVAL;
+                  goto error;
+              }
+          }
+          token = strtok_r (NULL, " ", &saveptr);
+      }
+      free (config_copy);
+  }
+
   mt_entry->fs_info = fs;
   mt_entry->mt_fs_root->location.node_access = root_path;
   mt_entry->mt_fs_root->location.handlers = &rtems_tftp_handlers;
@@ -225,26 +322,15 @@ int rtems_tftpfs_initialize(
 
   rtems_mutex_init (&fs->tftp_mutex, "TFTPFS");
 
-  if (data) {
-      char* config = (char*) data;
-      char* token;
-      char* saveptr;
-      token = strtok_r (config, " ", &saveptr);
-      while (token) {
-          if (strcmp (token, "verbose") == 0)
-              fs->flags |= TFTPFS_VERBOSE;
-          token = strtok_r (NULL, " ", &saveptr);
-      }
-  }
-  
   return 0;
 
 error:
 
+  free (config_copy);
   free (fs);
   free (root_path);
 
-  rtems_set_errno_and_return_minus_one (ENOMEM);
+  rtems_set_errno_and_return_minus_one (eno);
 }
 
 /*
@@ -291,7 +377,7 @@ tftpErrno (struct tftpStream *tp)
         ESRCH,
     };
 
-    tftpError = ntohs (tp->pkbuf.tftpERROR.errorCode);
+    tftpError = ntohs (tp->pkbuf->tftpERROR.errorCode);
     if (tftpError < (sizeof errorMap / sizeof errorMap[0]))
         return errorMap[tftpError];
     else
@@ -299,25 +385,27 @@ tftpErrno (struct tftpStream *tp)
 }
 
 /*
- * Send a message to make the other end shut up
+ * Send an error message
  */
 static void
-sendStifle (struct tftpStream *tp, struct sockaddr_in *to)
+sendError (struct tftpStream *tp, struct sockaddr_in *to, int errorCode,
+           const char *errorMessage)
 {
     int len;
     struct {
         uint16_t      opcode;
         uint16_t      errorCode;
-        char                errorMessage[12];
+        char                errorMessage[24];
     } msg;
 
     /*
-     * Create the error packet (Unknown transfer ID).
+     * Create the error packet
      */
     msg.opcode = htons (TFTP_OPCODE_ERROR);
-    msg.errorCode = htons (5);
+    msg.errorCode = htons (errorCode);
     len = sizeof msg.opcode + sizeof msg.errorCode + 1;
-    len += sprintf (msg.errorMessage, "GO AWAY");
+    len += snprintf (msg.errorMessage, sizeof msg.errorMessage, "%s",
+                     errorMessage);
 
     /*
      * Send it
@@ -325,6 +413,18 @@ sendStifle (struct tftpStream *tp, struct sockaddr_in *to)
     sendto (tp->socket, (char *)&msg, len, 0, (struct sockaddr *)to, sizeof *to);
 }
 
+/*
+ * Send a message to make the other end shut up
+ */
+static void
+sendStifle (struct tftpStream *tp, struct sockaddr_in *to)
+{
+    /*
+     * Unknown transfer ID
+     */
+    sendError (tp, to, 5, "GO AWAY");
+}
+
 /*
  * Wait for a data packet
  */
@@ -349,8 +449,8 @@ getPacket (struct tftpStream *tp, int retryCount)
             struct sockaddr_in i;
         } from;
         socklen_t fromlen = sizeof from;
-        len = recvfrom (tp->socket, &tp->pkbuf,
-                        sizeof tp->pkbuf, 0,
+        len = recvfrom (tp->socket, tp->pkbuf,
+                        tp->pksize, 0,
                         &from.s, &fromlen);
         if (len < 0)
             break;
@@ -374,19 +474,19 @@ getPacket (struct tftpStream *tp, int retryCount)
     setsockopt (tp->socket, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv);
 #ifdef RTEMS_TFTP_DRIVER_DEBUG
     if (rtems_tftp_driver_debug) {
-        if (len >= (int) sizeof tp->pkbuf.tftpACK) {
-            int opcode = ntohs (tp->pkbuf.tftpDATA.opcode);
+        if (len >= (int) sizeof tp->pkbuf->tftpACK) {
+            int opcode = ntohs (tp->pkbuf->tftpDATA.opcode);
             switch (opcode) {
             default:
                 printf ("TFTP: OPCODE %d\n", opcode);
                 break;
 
             case TFTP_OPCODE_DATA:
-                printf ("TFTP: RECV %d\n", ntohs (tp->pkbuf.tftpDATA.blocknum));
+                printf ("TFTP: RECV %d\n", ntohs (tp->pkbuf->tftpDATA.blocknum));
                 break;
 
             case TFTP_OPCODE_ACK:
-                printf ("TFTP: GOT ACK %d\n", ntohs (tp->pkbuf.tftpACK.blocknum));
+                printf ("TFTP: GOT ACK %d\n", ntohs (tp->pkbuf->tftpACK.blocknum));
                 break;
             }
         }
@@ -404,27 +504,118 @@ getPacket (struct tftpStream *tp, int retryCount)
 static int
 sendAck (struct tftpStream *tp)
 {
+    struct tftpACK ack;
+
 #ifdef RTEMS_TFTP_DRIVER_DEBUG
     if (rtems_tftp_driver_debug)
         printf ("TFTP: ACK %d\n", tp->blocknum);
 #endif
 
     /*
-     * Create the acknowledgement
+     * Create the acknowledgement. The packet buffer can hold data not yet
+     * read.
      */
-    tp->pkbuf.tftpACK.opcode = htons (TFTP_OPCODE_ACK);
-    tp->pkbuf.tftpACK.blocknum = htons (tp->blocknum);
+    ack.opcode = htons (TFTP_OPCODE_ACK);
+    ack.blocknum = htons (tp->blocknum);
 
     /*
      * Send it
      */
-    if (sendto (tp->socket, (char *)&tp->pkbuf, sizeof tp->pkbuf.tftpACK, 0,
+    if (sendto (tp->socket, (char *)&ack, sizeof ack, 0,
                                     (struct sockaddr *)&tp->farAddress,
                                     sizeof tp->farAddress) < 0)
         return errno;
     return 0;
 }
 
+/*
+ * Make room in the socket for a window of blocks so the next window can
+ * be received while the current one is read
+ */
+static void
+setReceiveBuffer (struct tftpStream *tp)
+{
+    int size;
+
+    if (tp->windowsize == TFTP_DEFAULT_WINDOWSIZE)
+        return;
+    size = 2 * tp->windowsize * (tp->blocksize + 2 * sizeof (uint16_t));
+    setsockopt (tp->socket, SOL_SOCKET, SO_RCVBUF, &size, sizeof size);
+}
+
+/*
+ * Create a read or write request. The options are only added if they differ
+ * from the RFC 1350 defaults.
+ */
+static int
+makeRequest (struct tftpStream *tp, const char *remoteFilename, int options,
+             int blocksize, int windowsize)
+{
+    char *cp;
+
+    if (tp->writing)
+        tp->pkbuf->tftpRWRQ.opcode = htons (TFTP_OPCODE_WRQ);
+    else
+        tp->pkbuf->tftpRWRQ.opcode = htons (TFTP_OPCODE_RRQ);
+    cp = tp->pkbuf->tftpRWRQ.filename_mode;
+    cp += sprintf (cp, "%s", remoteFilename) + 1;
+    cp += sprintf (cp, "octet") + 1;
+    if (options) {
+        if (blocksize != TFTP_DEFAULT_BLOCKSIZE) {
+            cp += sprintf (cp, "blksize") + 1;
+            cp += sprintf (cp, "%d", blocksize) + 1;
+        }
+        if (windowsize != TFTP_DEFAULT_WINDOWSIZE) {
+            cp += sprintf (cp, "windowsize") + 1;
+            cp += sprintf (cp, "%d", windowsize) + 1;
+        }
+    }
+    return cp - (char *)&tp->pkbuf->tftpRWRQ;
+}
+
+/*
+ * Parse an option acknowledgement. The server can only accept an option we
+ * requested and can only lower its value.
+ */
+static int
+parseOack (struct tftpStream *tp, int len, int blocksize, int windowsize)
+{
+    const char *cp = tp->pkbuf->tftpOACK.options;
+    const char *end = (const char *)tp->pkbuf + len;
+
+    tp->blocksize = TFTP_DEFAULT_BLOCKSIZE;
+    tp->windowsize = TFTP_DEFAULT_WINDOWSIZE;
+    while (cp < end) {
+        const char *name = cp;
+        const char *value;
+        long        v;
+
+        value = memchr (name, '\0', end - name);
+        if (value == NULL)
+            return EPROTO;
+        ++value;
+        cp = memchr (value, '\0', end - value);
+        if (cp == NULL)
+            return EPROTO;
+        ++cp;
+        v = strtol (value, NULL, 10);
+        if ((strcasecmp (name, "blksize") == 0)
+         && (blocksize != TFTP_DEFAULT_BLOCKSIZE)
+         && (v >= TFTP_MIN_BLOCKSIZE) && (v <= blocksize)) {
+            tp->blocksize = v;
+        }
+        else if ((strcasecmp (name, "windowsize") == 0)
+         && (windowsize != TFTP_DEFAULT_WINDOWSIZE)
+         && (v >= TFTP_DEFAULT_WINDOWSIZE) && (v <= windowsize)) {
+            tp->windowsize = v;
+        }
+        else {
+            return EPROTO;
+        }
+    }
+    return 0;
+}
+
 /*
  * Convert a path to canonical form
  */
@@ -532,10 +723,12 @@ static int rtems_tftp_open_worker(
     int                  s;
     int                  len;
     char                 *cp1;
-    char                 *cp2;
     char                 *remoteFilename;
     rtems_interval       now;
     char                 *hostname;
+    int                  pksize;
+    int                  options;
+    int                  windowsize;
 
     /*
      * Get the file system info.
@@ -610,10 +803,19 @@ static int rtems_tftp_open_worker(
         }
         fs->tftpStreams = np;
     }
-    tp = fs->tftpStreams[s] = malloc (sizeof (struct tftpStream));
+    /*
+     * The packet buffer follows the stream and holds the largest block
+     * we request
+     */
+    pksize = 2 * sizeof (uint16_t) + fs->blocksize;
+    if (pksize < (int) sizeof (union tftpPacket))
+        pksize = sizeof (union tftpPacket);
+    tp = fs->tftpStreams[s] = malloc (sizeof (struct tftpStream) + pksize);
     rtems_mutex_unlock (&fs->tftp_mutex);
     if (tp == NULL)
         return ENOMEM;
+    tp->pkbuf = (union tftpPacket *) (tp + 1);
+    tp->pksize = pksize;
     iop->data0 = s;
     iop->data1 = tp;
 
@@ -653,35 +855,30 @@ static int rtems_tftp_open_worker(
     tp->farAddress.sin_port = htons (69);
 
     /*
-     * Start the transfer
+     * Start the transfer. Writes are kept in lock-step, a window only
+     * pays off for reads.
      */
+    tp->writing = ((oflag & O_ACCMODE) != O_RDONLY);
+    tp->blocksize = TFTP_DEFAULT_BLOCKSIZE;
+    tp->windowsize = TFTP_DEFAULT_WINDOWSIZE;
+    tp->windowpos = 0;
+    tp->reacked = 0;
+    windowsize = tp->writing ? TFTP_DEFAULT_WINDOWSIZE : fs->windowsize;
+    options = (fs->blocksize != TFTP_DEFAULT_BLOCKSIZE)
+        || (windowsize != TFTP_DEFAULT_WINDOWSIZE);
     tp->firstReply = 1;
     retryCount = 0;
     for (;;) {
         /*
          * Create the request
          */
-        if ((oflag & O_ACCMODE) == O_RDONLY) {
-            tp->writing = 0;
-            tp->pkbuf.tftpRWRQ.opcode = htons (TFTP_OPCODE_RRQ);
-        }
-        else {
-            tp->writing = 1;
-            tp->pkbuf.tftpRWRQ.opcode = htons (TFTP_OPCODE_WRQ);
-        }
-        cp1 = (char *) tp->pkbuf.tftpRWRQ.filename_mode;
-        cp2 = (char *) remoteFilename;
-        while ((*cp1++ = *cp2++) != '\0')
-            continue;
-        cp2 = "octet";
-        while ((*cp1++ = *cp2++) != '\0')
-            continue;
-        len = cp1 - (char *)&tp->pkbuf.tftpRWRQ;
+        len = makeRequest (tp, remoteFilename, options,
+                           fs->blocksize, windowsize);
 
         /*
          * Send the request
          */
-        if (sendto (tp->socket, (char *)&tp->pkbuf, len, 0,
+        if (sendto (tp->socket, (char *)tp->pkbuf, len, 0,
                     (struct sockaddr *)&tp->farAddress,
                     sizeof tp->farAddress) < 0) {
             releaseStream (fs, s);
@@ -692,15 +889,38 @@ static int rtems_tftp_open_worker(
          * Get reply
          */
         len = getPacket (tp, retryCount);
-        if (len >= (int) sizeof tp->pkbuf.tftpACK) {
-            int opcode = ntohs (tp->pkbuf.tftpDATA.opcode);
+        if (len >= (int) sizeof tp->pkbuf->tftpACK) {
+            int opcode = ntohs (tp->pkbuf->tftpDATA.opcode);
+            if (options && (opcode == TFTP_OPCODE_OACK)) {
+                int e = parseOack (tp, len, fs->blocksize, windowsize);
+                if (e != 0) {
+                    sendError (tp, &tp->farAddress, TFTP_ERROR_OPTION,
+                               "BAD OPTION");
+                    releaseStream (fs, s);
+                    return e;
+                }
+                tp->nused = 0;
+                tp->nleft = 0;
+                tp->eof = 0;
+                if (tp->writing) {
+                    tp->blocknum = 1;
+                    break;
+                }
+                setReceiveBuffer (tp);
+                tp->blocknum = 0;
+                if (sendAck (tp) != 0) {
+                    releaseStream (fs, s);
+                    return EIO;
+                }
+                break;
+            }
             if (!tp->writing
              && (opcode == TFTP_OPCODE_DATA)
-             && (ntohs (tp->pkbuf.tftpDATA.blocknum) == 1)) {
+             && (ntohs (tp->pkbuf->tftpDATA.blocknum) == 1)) {
                 tp->nused = 0;
                 tp->blocknum = 1;
                 tp->nleft = len - 2 * sizeof (uint16_t  );
-                tp->eof = (tp->nleft < TFTP_BUFSIZE);
+                tp->eof = (tp->nleft < tp->blocksize);
                 if (sendAck (tp) != 0) {
                     releaseStream (fs, s);
                     return EIO;
@@ -709,13 +929,24 @@ static int rtems_tftp_open_worker(
             }
             if (tp->writing
              && (opcode == TFTP_OPCODE_ACK)
-             && (ntohs (tp->pkbuf.tftpACK.blocknum) == 0)) {
+             && (ntohs (tp->pkbuf->tftpACK.blocknum) == 0)) {
                 tp->nused = 0;
                 tp->blocknum = 1;
                 break;
             }
             if (opcode == TFTP_OPCODE_ERROR) {
-                int e = tftpErrno (tp);
+                int e = ntohs (tp->pkbuf->tftpERROR.errorCode);
+                if (options && (e == TFTP_ERROR_OPTION)) {
+                    /*
+                     * The server refuses the options, ask again without
+                     * them.
+                     */
+                    options = 0;
+                    tp->firstReply = 1;
+                    tp->farAddress.sin_port = htons (69);
+                    continue;
+                }
+                e = tftpErrno (tp);
                 releaseStream (fs, s);
                 return e;
             }
@@ -794,7 +1025,7 @@ static ssize_t rtems_tftp_read(
                 ncopy = nwant;
             else
                 ncopy = tp->nleft;
-            memcpy (bp, &tp->pkbuf.tftpDATA.data[tp->nused], ncopy);
+            memcpy (bp, &tftpData (tp)[tp->nused], ncopy);
             tp->nused += ncopy;
             tp->nleft -= ncopy;
             bp += ncopy;
@@ -811,21 +1042,40 @@ static ssize_t rtems_tftp_read(
         retryCount = 0;
         for (;;) {
             int len = getPacket (tp, retryCount);
-            if (len >= (int)sizeof tp->pkbuf.tftpACK) {
-                int opcode = ntohs (tp->pkbuf.tftpDATA.opcode);
+            if (len >= (int)sizeof tp->pkbuf->tftpACK) {
+                int opcode = ntohs (tp->pkbuf->tftpDATA.opcode);
                 uint16_t   nextBlock = tp->blocknum + 1;
                 if ((opcode == TFTP_OPCODE_DATA)
-                 && (ntohs (tp->pkbuf.tftpDATA.blocknum) == nextBlock)) {
+                 && (ntohs (tp->pkbuf->tftpDATA.blocknum) == nextBlock)) {
                     tp->nused = 0;
                     tp->nleft = len - 2 * sizeof (uint16_t);
-                    tp->eof = (tp->nleft < TFTP_BUFSIZE);
+                    tp->eof = (tp->nleft < tp->blocksize);
                     tp->blocknum++;
-                    if (sendAck (tp) != 0)
-                        rtems_set_errno_and_return_minus_one (EIO);
+                    tp->reacked = 0;
+                    /*
+                     * Acknowledge the end of a window as soon as it is
+                     * received. The server sends the next window into the
+                     * socket buffer while the caller reads this one.
+                     */
+                    if ((++tp->windowpos >= tp->windowsize) || tp->eof) {
+                        tp->windowpos = 0;
+                        if (sendAck (tp) != 0)
+                            rtems_set_errno_and_return_minus_one (EIO);
+                    }
                     break;
                 }
                 if (opcode == TFTP_OPCODE_ERROR)
                     rtems_set_errno_and_return_minus_one (tftpErrno (tp));
+
+                /*
+                 * Only the first block out of order in a window is
+                 * acknowledged, the server restarts the window after the
+                 * acknowledged block and the rest of the broken window
+                 * is dropped.
+                 */
+                if ((opcode == TFTP_OPCODE_DATA)
+                 && (tp->windowsize > 1) && tp->reacked)
+                    continue;
             }
 
             /*
@@ -833,6 +1083,8 @@ static ssize_t rtems_tftp_read(
              */
             if (++retryCount == IO_RETRY_LIMIT)
                 rtems_set_errno_and_return_minus_one (EIO);
+            tp->windowpos = 0;
+            tp->reacked = 1;
             if (sendAck (tp) != 0)
                 rtems_set_errno_and_return_minus_one (EIO);
         }
@@ -850,13 +1102,13 @@ static int rtems_tftp_flush (struct tftpStream *tp)
 
     wlen = tp->nused + 2 * sizeof (uint16_t  );
     for (;;) {
-        tp->pkbuf.tftpDATA.opcode = htons (TFTP_OPCODE_DATA);
-        tp->pkbuf.tftpDATA.blocknum = htons (tp->blocknum);
+        tp->pkbuf->tftpDATA.opcode = htons (TFTP_OPCODE_DATA);
+        tp->pkbuf->tftpDATA.blocknum = htons (tp->blocknum);
 #ifdef RTEMS_TFTP_DRIVER_DEBUG
         if (rtems_tftp_driver_debug)
             printf ("TFTP: SEND %d (%d)\n", tp->blocknum, tp->nused);
 #endif
-        if (sendto (tp->socket, (char *)&tp->pkbuf, wlen, 0,
+        if (sendto (tp->socket, (char *)tp->pkbuf, wlen, 0,
                                         (struct sockaddr *)&tp->farAddress,
                                         sizeof tp->farAddress) < 0)
             return EIO;
@@ -864,12 +1116,12 @@ static int rtems_tftp_flush (struct tftpStream *tp)
         /*
          * Our last packet won't necessarily be acknowledged!
          */
-        if ((rlen < 0) && (tp->nused < sizeof tp->pkbuf.tftpDATA.data))
+        if ((rlen < 0) && (tp->nused < tp->blocksize))
                 return 0;
-        if (rlen >= (int)sizeof tp->pkbuf.tftpACK) {
-            int opcode = ntohs (tp->pkbuf.tftpACK.opcode);
+        if (rlen >= (int)sizeof tp->pkbuf->tftpACK) {
+            int opcode = ntohs (tp->pkbuf->tftpACK.opcode);
             if ((opcode == TFTP_OPCODE_ACK)
-             && (ntohs (tp->pkbuf.tftpACK.blocknum) == tp->blocknum)) {
+             && (ntohs (tp->pkbuf->tftpACK.blocknum) == tp->blocknum)) {
                 tp->nused = 0;
                 tp->blocknum++;
                 return 0;
@@ -948,16 +1200,16 @@ static ssize_t rtems_tftp_write(
     bp = buffer;
     nleft = count;
     while (nleft) {
-        nfree = sizeof tp->pkbuf.tftpDATA.data - tp->nused;
+        nfree = tp->blocksize - tp->nused;
         if (nleft < nfree)
             ncopy = nleft;
         else
             ncopy = nfree;
-        memcpy (&tp->pkbuf.tftpDATA.data[tp->nused], bp, ncopy);
+        memcpy (&tftpData (tp)[tp->nused], bp, ncopy);
         tp->nused += ncopy;
         nleft -= ncopy;
         bp += ncopy;
-        if (tp->nused == sizeof tp->pkbuf.tftpDATA.data) {
+        if (tp->nused == tp->blocksize) {
             int e = rtems_tftp_flush (tp);
             if (e) {
                 tp->writing = 0;
@@ -90,6 +90,39 @@ static ssize_t IMFS_fifo_write(
   IMFS_FIFO_RETURN(err);
 }
 
+static ssize_t IMFS_fifo_readv(
+  rtems_libio_t      *iop,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total
+)
+{
+  IMFS_jnode_t *jnode = iop->pathinfo.node_access;
+
+  ssize_t err = pipe_readv(JNODE2PIPE(jnode), iov, iovcnt, total, iop);
+  if (err > 0)
+    IMFS_update_atime(jnode);
+
+  IMFS_FIFO_RETURN(err);
+}
+
+static ssize_t IMFS_fifo_writev(
+  rtems_libio_t      *iop,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total
+)
+{
+  IMFS_jnode_t *jnode = iop->pathinfo.node_access;
+
+  ssize_t err = pipe_writev(JNODE2PIPE(jnode), iov, iovcnt, total, iop);
+  if (err > 0) {
+    IMFS_mtime_ctime_update(jnode);
+  }
+
+  IMFS_FIFO_RETURN(err);
+}
+
 static int IMFS_fifo_ioctl(
   rtems_libio_t   *iop,
   ioctl_command_t  command,
@@ -130,8 +163,8 @@ static const rtems_filesystem_file_handlers_r IMFS_fifo_handlers = {
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
-  .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .readv_h = IMFS_fifo_readv,
+  .writev_h = IMFS_fifo_writev
 };
 
 const IMFS_mknod_control IMFS_mknod_control_fifo = {
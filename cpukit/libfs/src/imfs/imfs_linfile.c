@@ -18,6 +18,7 @@
 #endif
 
 #include <string.h>
+#include <sys/mman.h>
 
 #include <rtems/imfs.h>
 
@@ -42,6 +43,34 @@ static ssize_t IMFS_linfile_read(
   return (ssize_t) count;
 }
 
+static int IMFS_linfile_mmap(
+  rtems_libio_t  *iop,
+  void          **addr,
+  size_t          len,
+  int             prot,
+  off_t           off
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  size_t size = file->File.size;
+  unsigned char *data = file->Linearfile.direct;
+
+  /*
+   * The data of a linear file is usually in read-only memory.  A linear file
+   * opened for writing becomes a memfile, see IMFS_linfile_open().
+   */
+  if ((prot & PROT_WRITE) != 0)
+    rtems_set_errno_and_return_minus_one( EACCES );
+
+  if (off < 0 || (size_t) off > size || len > size - (size_t) off)
+    rtems_set_errno_and_return_minus_one( ENXIO );
+
+  IMFS_update_atime( &file->Node );
+  *addr = &data[off];
+
+  return 0;
+}
+
 static int IMFS_linfile_open(
   rtems_libio_t *iop,
   const char    *pathname,
@@ -89,7 +118,7 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = IMFS_linfile_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
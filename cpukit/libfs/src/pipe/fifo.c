@@ -73,7 +73,7 @@ static int pipe_alloc(
     return err;
   memset(pipe, 0, sizeof(pipe_control_t));
 
-  pipe->Size = PIPE_BUF;
+  pipe->Size = rtems_pipe_buffer_size;
   pipe->Buffer = malloc(pipe->Size);
   if (pipe->Buffer == NULL) {
     free(pipe);
@@ -266,14 +266,96 @@ out_error:
   return err;
 }
 
-ssize_t pipe_read(
-  pipe_control_t *pipe,
-  void           *buffer,
-  size_t          count,
-  rtems_libio_t  *iop
+/*
+ * Copy count bytes from the pipe buffer to the I/O vector at the cursor
+ * position given by *iovp and *offsetp.  Called with the pipe locked and at
+ * least count bytes in the pipe buffer.
+ */
+static void pipe_copy_out(
+  pipe_control_t      *pipe,
+  const struct iovec **iovp,
+  size_t              *offsetp,
+  size_t               count
+)
+{
+  const struct iovec *iov = *iovp;
+  size_t offset = *offsetp;
+
+  while (count > 0) {
+    size_t chunk = MIN(iov->iov_len - offset, count);
+
+    if (chunk == 0) {
+      ++iov;
+      offset = 0;
+      continue;
+    }
+
+    chunk = MIN(chunk, pipe->Size - pipe->Start);
+    memcpy((char *) iov->iov_base + offset, pipe->Buffer + pipe->Start, chunk);
+
+    pipe->Start += chunk;
+    pipe->Start %= pipe->Size;
+    pipe->Length -= chunk;
+    offset += chunk;
+    count -= chunk;
+  }
+
+  *iovp = iov;
+  *offsetp = offset;
+}
+
+/*
+ * Copy count bytes from the I/O vector at the cursor position given by *iovp
+ * and *offsetp to the pipe buffer.  Called with the pipe locked and at least
+ * count bytes space in the pipe buffer.
+ */
+static void pipe_copy_in(
+  pipe_control_t      *pipe,
+  const struct iovec **iovp,
+  size_t              *offsetp,
+  size_t               count
+)
+{
+  const struct iovec *iov = *iovp;
+  size_t offset = *offsetp;
+
+  while (count > 0) {
+    size_t chunk = MIN(iov->iov_len - offset, count);
+
+    if (chunk == 0) {
+      ++iov;
+      offset = 0;
+      continue;
+    }
+
+    chunk = MIN(chunk, pipe->Size - PIPE_WSTART(pipe));
+    memcpy(
+      pipe->Buffer + PIPE_WSTART(pipe),
+      (const char *) iov->iov_base + offset,
+      chunk
+    );
+
+    pipe->Length += chunk;
+    offset += chunk;
+    count -= chunk;
+  }
+
+  *iovp = iov;
+  *offsetp = offset;
+}
+
+ssize_t pipe_readv(
+  pipe_control_t     *pipe,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total,
+  rtems_libio_t      *iop
 )
 {
-  int chunk, chunk1, read = 0, ret = 0;
+  size_t chunk, offset = 0;
+  ssize_t read = 0, ret = 0;
+
+  (void) iovcnt;
 
   PIPE_LOCK(pipe);
 
@@ -294,18 +376,9 @@ ssize_t pipe_read(
   }
 
   /* Read chunk bytes */
-  chunk = MIN(count - read,  pipe->Length);
-  chunk1 = pipe->Size - pipe->Start;
-  if (chunk > chunk1) {
-    memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk1);
-    memcpy(buffer + read + chunk1, pipe->Buffer, chunk - chunk1);
-  }
-  else
-    memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk);
+  chunk = MIN((size_t) total, pipe->Length);
+  pipe_copy_out(pipe, &iov, &offset, chunk);
 
-  pipe->Start += chunk;
-  pipe->Start %= pipe->Size;
-  pipe->Length -= chunk;
   /* For buffering optimization */
   if (PIPE_EMPTY(pipe))
     pipe->Start = 0;
@@ -322,14 +395,30 @@ out_locked:
   return ret;
 }
 
-ssize_t pipe_write(
+ssize_t pipe_read(
   pipe_control_t *pipe,
-  const void     *buffer,
+  void           *buffer,
   size_t          count,
   rtems_libio_t  *iop
 )
 {
-  int chunk, chunk1, written = 0, ret = 0;
+  struct iovec iov = { .iov_base = buffer, .iov_len = count };
+
+  return pipe_readv(pipe, &iov, 1, (ssize_t) count, iop);
+}
+
+ssize_t pipe_writev(
+  pipe_control_t     *pipe,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total,
+  rtems_libio_t      *iop
+)
+{
+  size_t chunk, count = (size_t) total, offset = 0;
+  ssize_t written = 0, ret = 0;
+
+  (void) iovcnt;
 
   /* Write nothing */
   if (count == 0)
@@ -345,7 +434,7 @@ ssize_t pipe_write(
   /* Write of PIPE_BUF bytes or less shall not be interleaved */
   chunk = count <= pipe->Size ? count : 1;
 
-  while (written < count) {
+  while ((size_t) written < count) {
     while (PIPE_SPACE(pipe) < chunk) {
       if (LIBIO_NODELAY(iop)) {
         ret = -EAGAIN;
@@ -361,18 +450,15 @@ ssize_t pipe_write(
         ret = -EPIPE;
         goto out_locked;
       }
+
+      /* The pipe buffer may have been shrunk in the meantime */
+      if (chunk > pipe->Size)
+        chunk = 1;
     }
 
     chunk = MIN(count - written, PIPE_SPACE(pipe));
-    chunk1 = pipe->Size - PIPE_WSTART(pipe);
-    if (chunk > chunk1) {
-      memcpy(pipe->Buffer + PIPE_WSTART(pipe), buffer + written, chunk1);
-      memcpy(pipe->Buffer, buffer + written + chunk1, chunk - chunk1);
-    }
-    else
-      memcpy(pipe->Buffer + PIPE_WSTART(pipe), buffer + written, chunk);
+    pipe_copy_in(pipe, &iov, &offset, chunk);
 
-    pipe->Length += chunk;
     if (pipe->waitingReaders > 0)
       PIPE_WAKEUPREADERS(pipe);
     written += chunk;
@@ -394,6 +480,60 @@ out_locked:
   return ret;
 }
 
+ssize_t pipe_write(
+  pipe_control_t *pipe,
+  const void     *buffer,
+  size_t          count,
+  rtems_libio_t  *iop
+)
+{
+  struct iovec iov = { .iov_base = (void *) buffer, .iov_len = count };
+
+  return pipe_writev(pipe, &iov, 1, (ssize_t) count, iop);
+}
+
+/*
+ * Replace the pipe buffer by one of the requested size.  The content is moved
+ * to the start of the new buffer.  Called with the pipe locked.
+ */
+static int pipe_resize(
+  pipe_control_t *pipe,
+  int            *size
+)
+{
+  char *buffer;
+  unsigned int new_size;
+  unsigned int chunk1;
+
+  if (*size < 0)
+    return -EINVAL;
+
+  new_size = MAX((unsigned int) *size, PIPE_BUF);
+  if (new_size < pipe->Length)
+    return -EBUSY;
+
+  if (new_size != pipe->Size) {
+    buffer = malloc(new_size);
+    if (buffer == NULL)
+      return -ENOMEM;
+
+    chunk1 = MIN(pipe->Length, pipe->Size - pipe->Start);
+    memcpy(buffer, pipe->Buffer + pipe->Start, chunk1);
+    memcpy(buffer + chunk1, pipe->Buffer, pipe->Length - chunk1);
+
+    free(pipe->Buffer);
+    pipe->Buffer = buffer;
+    pipe->Size = new_size;
+    pipe->Start = 0;
+
+    if (pipe->waitingWriters > 0)
+      PIPE_WAKEUPWRITERS(pipe);
+  }
+
+  *size = (int) new_size;
+  return 0;
+}
+
 int pipe_ioctl(
   pipe_control_t  *pipe,
   ioctl_command_t  cmd,
@@ -413,5 +553,27 @@ int pipe_ioctl(
     return 0;
   }
 
+  if (cmd == RTEMS_PIPE_IOCTL_GET_SIZE) {
+    if (buffer == NULL)
+      return -EFAULT;
+
+    PIPE_LOCK(pipe);
+    *(int *)buffer = (int) pipe->Size;
+    PIPE_UNLOCK(pipe);
+    return 0;
+  }
+
+  if (cmd == RTEMS_PIPE_IOCTL_SET_SIZE) {
+    int err;
+
+    if (buffer == NULL)
+      return -EFAULT;
+
+    PIPE_LOCK(pipe);
+    err = pipe_resize(pipe, buffer);
+    PIPE_UNLOCK(pipe);
+    return err;
+  }
+
   return -EINVAL;
 }
@@ -26,10 +26,12 @@
 #endif
 
 #include <ctype.h>
+#include <fcntl.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <inttypes.h>
+#include <unistd.h>
 
 #include <rtems.h>
 #include <rtems/capture-cli.h>
@@ -1002,6 +1004,96 @@ rtems_capture_cli_trace_records (int                                argc,
   rtems_capture_print_trace_records( dump_total, csv );
 }
 
+typedef struct
+{
+  int  fd;
+  bool failed;
+} rtems_capture_cli_export_context;
+
+/*
+ * rtems_capture_cli_export_chunk
+ *
+ * This function writes a chunk of the exported records to the file.
+ */
+
+static void
+rtems_capture_cli_export_chunk (void* arg, const void* data, size_t length)
+{
+  rtems_capture_cli_export_context* ctx = arg;
+
+  while (!ctx->failed && (length > 0))
+  {
+    ssize_t n = write (ctx->fd, data, length);
+
+    if (n <= 0)
+    {
+      ctx->failed = true;
+      return;
+    }
+
+    data = (const char*) data + n;
+    length -= (size_t) n;
+  }
+}
+
+int
+rtems_capture_cli_export_file (const char* file)
+{
+  rtems_capture_cli_export_context ctx;
+  rtems_status_code                sc;
+
+  ctx.fd = open (file, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  ctx.failed = false;
+
+  if (ctx.fd < 0)
+  {
+    fprintf (stdout, "error: cannot open %s\n", file);
+    return 1;
+  }
+
+  sc = rtems_capture_export_records (rtems_capture_cli_export_chunk, &ctx);
+
+  if (close (ctx.fd) != 0)
+    ctx.failed = true;
+
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    fprintf (stdout, "error: export failed: %s\n", rtems_status_text (sc));
+    return 1;
+  }
+
+  if (ctx.failed)
+  {
+    fprintf (stdout, "error: cannot write %s\n", file);
+    return 1;
+  }
+
+  fprintf (stdout, "trace records exported to %s.\n", file);
+  return 0;
+}
+
+/*
+ * rtems_capture_cli_export
+ *
+ * This function is a monitor command that exports the trace records to a
+ * file in the record item format.
+ */
+
+static void
+rtems_capture_cli_export (int                                argc,
+                          char**                             argv,
+                          const rtems_monitor_command_arg_t* command_arg RC_UNUSED,
+                          bool                               verbose RC_UNUSED)
+{
+  if (argc != 2)
+  {
+    fprintf (stdout, "usage: cexport file\n");
+    return;
+  }
+
+  (void) rtems_capture_cli_export_file (argv[1]);
+}
+
 /*
  * rtems_capture_cli_flush
  *
@@ -1148,6 +1240,14 @@ static rtems_monitor_command_entry_t rtems_capture_cli_cmds[] =
     { 0 },
     0
   },
+  {
+    "cexport",
+    "usage: cexport file",
+    0,
+    rtems_capture_cli_export,
+    { 0 },
+    0
+  },
   {
     "ctset",
     "usage: ctset -h",
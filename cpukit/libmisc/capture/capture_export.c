@@ -0,0 +1,294 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @brief Capture Engine Record Item Export
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/captureimpl.h>
+#include <rtems/record.h>
+
+/*
+ * The capture engine time stamps are in nanoseconds.  The stream header
+ * announces a nanosecond clock, so the record item time field contains the
+ * lower bits of the capture time stamp.
+ */
+#define CAPTURE_EXPORT_FREQUENCY UINT32_C (1000000000)
+
+#define CAPTURE_EXPORT_TIME_MASK ((UINT32_C (1) << RTEMS_RECORD_TIME_BITS) - 1)
+
+#define CAPTURE_EXPORT_ITEMS 64
+
+/*
+ * The maximum number of items a single capture record may produce: the two
+ * uptime items and one item for each event bit.
+ */
+#define CAPTURE_EXPORT_RECORD_ITEMS \
+  (2 + RTEMS_CAPTURE_EVENT_END - RTEMS_CAPTURE_EVENT_START)
+
+typedef struct
+{
+  rtems_capture_export_chunk chunk;
+  void*                      arg;
+  size_t                     count;
+  bool                       synchronized;
+  rtems_capture_time         last_time;
+  rtems_record_item          items[CAPTURE_EXPORT_ITEMS];
+} capture_export_context;
+
+typedef struct
+{
+  uint32_t           capture_event;
+  rtems_record_event record_event;
+} capture_export_event;
+
+/*
+ * The events caused by another task (created by, started by, etc.) are not
+ * exported.  The record format identifies the subject task in the item data
+ * and the causing task is the task executing on the processor.
+ */
+static const capture_export_event capture_export_events[] =
+{
+  { RTEMS_CAPTURE_CREATED_EVENT,      RTEMS_RECORD_THREAD_CREATE },
+  { RTEMS_CAPTURE_STARTED_EVENT,      RTEMS_RECORD_THREAD_START },
+  { RTEMS_CAPTURE_RESTARTED_EVENT,    RTEMS_RECORD_THREAD_RESTART },
+  { RTEMS_CAPTURE_DELETED_EVENT,      RTEMS_RECORD_THREAD_DELETE },
+  { RTEMS_CAPTURE_TERMINATED_EVENT,   RTEMS_RECORD_THREAD_TERMINATE },
+  { RTEMS_CAPTURE_BEGIN_EVENT,        RTEMS_RECORD_THREAD_BEGIN },
+  { RTEMS_CAPTURE_EXITTED_EVENT,      RTEMS_RECORD_THREAD_EXITTED },
+  { RTEMS_CAPTURE_SWITCHED_OUT_EVENT, RTEMS_RECORD_THREAD_SWITCH_OUT },
+  { RTEMS_CAPTURE_SWITCHED_IN_EVENT,  RTEMS_RECORD_THREAD_SWITCH_IN }
+};
+
+static void
+capture_export_flush (capture_export_context* ctx)
+{
+  if (ctx->count > 0)
+  {
+    (*ctx->chunk) (ctx->arg, ctx->items, ctx->count * sizeof (ctx->items[0]));
+    ctx->count = 0;
+  }
+}
+
+static void
+capture_export_add (capture_export_context* ctx,
+                    uint32_t                time,
+                    rtems_record_event      event,
+                    rtems_record_data       data)
+{
+  rtems_record_item* item;
+
+  item = &ctx->items[ctx->count];
+  item->event = RTEMS_RECORD_TIME_EVENT (time, event);
+  item->data = data;
+  ++ctx->count;
+}
+
+/*
+ * The record clients accumulate the differences of the item time fields.
+ * If the difference to the previous item exceeds the time field range, then
+ * the absolute time is provided through an uptime item pair.
+ */
+static uint32_t
+capture_export_time (capture_export_context* ctx, rtems_capture_time time)
+{
+  uint32_t time_field;
+
+  time_field = (uint32_t) time & CAPTURE_EXPORT_TIME_MASK;
+
+  if (!ctx->synchronized || time < ctx->last_time ||
+      time - ctx->last_time > CAPTURE_EXPORT_TIME_MASK)
+  {
+    uint64_t seconds;
+    uint64_t nanoseconds;
+    uint64_t bt;
+
+    seconds = time / CAPTURE_EXPORT_FREQUENCY;
+    nanoseconds = time % CAPTURE_EXPORT_FREQUENCY;
+    bt = (seconds << 32) | ((nanoseconds << 32) / CAPTURE_EXPORT_FREQUENCY);
+
+    capture_export_add (ctx, time_field, RTEMS_RECORD_UPTIME_LOW,
+                        (uint32_t) bt);
+    capture_export_add (ctx, time_field, RTEMS_RECORD_UPTIME_HIGH,
+                        (uint32_t) (bt >> 32));
+    ctx->synchronized = true;
+  }
+
+  ctx->last_time = time;
+  return time_field;
+}
+
+static void
+capture_export_task (capture_export_context*          ctx,
+                     const rtems_capture_record*      rec,
+                     const rtems_capture_task_record* task_rec)
+{
+  char              name[4];
+  rtems_record_data data;
+  size_t            i;
+
+  if (ctx->count + 2 > CAPTURE_EXPORT_ITEMS)
+    capture_export_flush (ctx);
+
+  rtems_name_to_characters (task_rec->name,
+                            &name[0], &name[1], &name[2], &name[3]);
+
+  data = 0;
+
+  for (i = 0; i < sizeof (name) && name[i] != '\0'; ++i)
+    data |= (rtems_record_data) (unsigned char) name[i] << (i * 8);
+
+  capture_export_add (ctx, 0, RTEMS_RECORD_THREAD_ID, rec->task_id);
+  capture_export_add (ctx, 0, RTEMS_RECORD_THREAD_NAME, data);
+}
+
+static void
+capture_export_events_of_record (capture_export_context*     ctx,
+                                 const rtems_capture_record* rec)
+{
+  uint32_t time;
+  size_t   i;
+
+  if (ctx->count + CAPTURE_EXPORT_RECORD_ITEMS > CAPTURE_EXPORT_ITEMS)
+    capture_export_flush (ctx);
+
+  time = capture_export_time (ctx, rec->time);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE (capture_export_events); ++i)
+  {
+    const capture_export_event* event;
+
+    event = &capture_export_events[i];
+
+    if ((rec->events & event->capture_event) != 0)
+      capture_export_add (ctx, time, event->record_event, rec->task_id);
+  }
+}
+
+static rtems_status_code
+capture_export_processor (capture_export_context* ctx, uint32_t cpu)
+{
+  bool first;
+
+  first = true;
+  ctx->synchronized = false;
+
+  while (true)
+  {
+    rtems_status_code sc;
+    size_t            read;
+    const void*       recs;
+    size_t            i;
+
+    sc = rtems_capture_read (cpu, &read, &recs);
+    if (sc != RTEMS_SUCCESSFUL)
+      return sc;
+
+    if (read == 0)
+    {
+      rtems_capture_release (cpu, 0);
+      return RTEMS_SUCCESSFUL;
+    }
+
+    if (first)
+    {
+      first = false;
+      capture_export_add (ctx, 0, RTEMS_RECORD_PROCESSOR, cpu);
+    }
+
+    for (i = 0; i < read; ++i)
+    {
+      rtems_capture_record rec;
+
+      recs = rtems_capture_record_extract (recs, &rec, sizeof (rec));
+
+      if ((rec.events >> RTEMS_CAPTURE_EVENT_START) == 0)
+      {
+        rtems_capture_task_record task_rec;
+
+        recs = rtems_capture_record_extract (recs,
+                                             &task_rec,
+                                             sizeof (task_rec));
+        capture_export_task (ctx, &rec, &task_rec);
+      }
+      else
+      {
+        capture_export_events_of_record (ctx, &rec);
+      }
+    }
+
+    capture_export_flush (ctx);
+
+    sc = rtems_capture_release (cpu, read);
+    if (sc != RTEMS_SUCCESSFUL)
+      return sc;
+  }
+}
+
+rtems_status_code
+rtems_capture_export_records (rtems_capture_export_chunk chunk, void* arg)
+{
+  capture_export_context ctx;
+  Record_Stream_header   header;
+  size_t                 size;
+  uint32_t               cpus;
+  uint32_t               cpu;
+
+  ctx.chunk = chunk;
+  ctx.arg = arg;
+  ctx.count = 0;
+
+  /*
+   * The stream contains no ring buffer head and tail items, so the per
+   * processor item count is irrelevant for the record clients.
+   */
+  size = _Record_Stream_header_prepare (&header, 1, CAPTURE_EXPORT_FREQUENCY);
+  (*chunk) (arg, &header, size);
+
+  cpus = rtems_scheduler_get_processor_maximum ();
+
+  for (cpu = 0; cpu < cpus; ++cpu)
+  {
+    rtems_status_code sc;
+
+    sc = capture_export_processor (&ctx, cpu);
+    if (sc != RTEMS_SUCCESSFUL)
+    {
+      capture_export_flush (&ctx);
+      return sc;
+    }
+  }
+
+  capture_export_flush (&ctx);
+  return RTEMS_SUCCESSFUL;
+}
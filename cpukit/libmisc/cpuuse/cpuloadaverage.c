@@ -0,0 +1,116 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_cpu_load_average_get_by_processor() and
+ *   rtems_cpu_load_average_get_by_task().
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/cpuuse.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threadimpl.h>
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_CPU_LOAD_AVERAGE_ONE == LOAD_AVERAGE_ONE,
+  RTEMS_CPU_LOAD_AVERAGE_ONE
+);
+
+RTEMS_STATIC_ASSERT( LOAD_AVERAGE_COUNT == 3, LOAD_AVERAGE_COUNT );
+
+static void CPU_load_average_Set(
+  rtems_cpu_load_average *load_average,
+  const uint32_t          average[ LOAD_AVERAGE_COUNT ]
+)
+{
+  load_average->one_second = average[ 0 ];
+  load_average->ten_seconds = average[ 1 ];
+  load_average->one_minute = average[ 2 ];
+}
+
+rtems_status_code rtems_cpu_load_average_get_by_processor(
+  uint32_t                cpu_index,
+  rtems_cpu_load_average *load_average
+)
+{
+  uint32_t average[ LOAD_AVERAGE_COUNT ];
+
+  if ( load_average == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( cpu_index >= _SMP_Get_processor_maximum() ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  _Thread_Get_processor_load_average(
+    _Per_CPU_Get_by_index( cpu_index ),
+    average
+  );
+  CPU_load_average_Set( load_average, average );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_cpu_load_average_get_by_task(
+  rtems_id                id,
+  rtems_cpu_load_average *load_average
+)
+{
+  Thread_Control   *the_thread;
+  ISR_lock_Context  lock_context;
+  uint32_t          average[ LOAD_AVERAGE_COUNT ];
+
+  if ( load_average == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  /* The object allocator lock prevents a deletion of the thread */
+  _Objects_Allocator_lock();
+  the_thread = _Thread_Get( id, &lock_context );
+
+  if ( the_thread == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  _ISR_lock_ISR_enable( &lock_context );
+  _Thread_Get_load_average( the_thread, average );
+  _Objects_Allocator_unlock();
+
+  CPU_load_average_Set( load_average, average );
+  return RTEMS_SUCCESSFUL;
+}
@@ -38,6 +38,7 @@
 #include <rtems/score/objectimpl.h>
 #include <rtems/score/protectedheap.h>
 #include <rtems/score/schedulerimpl.h>
+#include <rtems/score/smpimpl.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/todimpl.h>
 #include <rtems/score/watchdogimpl.h>
@@ -71,6 +72,7 @@ typedef struct
   Timestamp_Control*     usage;             /* Usage of task's in this sample. */
   Timestamp_Control*     last_usage;        /* Usage of task's in the last sample. */
   Timestamp_Control*     current_usage;     /* Current usage for this sample. */
+  uint32_t*              load;              /* One second load average of task's. */
   Timestamp_Control      total;             /* Total run run, should equal the uptime. */
   Timestamp_Control      idle;              /* Time spent in idle. */
   Timestamp_Control      current;           /* Current time run in this period. */
@@ -86,7 +88,8 @@ typedef struct
 #define RTEMS_TOP_SORT_CURRENT_PRI   (2)
 #define RTEMS_TOP_SORT_TOTAL         (3)
 #define RTEMS_TOP_SORT_CURRENT       (4)
-#define RTEMS_TOP_SORT_MAX           (4)
+#define RTEMS_TOP_SORT_LOAD          (5)
+#define RTEMS_TOP_SORT_MAX           (5)
 
 static inline bool equal_to_uint32_t( uint32_t * lhs, uint32_t * rhs )
 {
@@ -119,6 +122,17 @@ print_memsize(rtems_cpu_usage_data* data, const uintptr_t size, const char* labe
     rtems_printf(data->printer, "%4" PRIuPTR " %s", size, label);
 }
 
+static void
+print_load(rtems_cpu_usage_data* data, uint32_t load)
+{
+  uint64_t load_per_100k = ((uint64_t) load * 100000) >> LOAD_AVERAGE_SHIFT;
+
+  rtems_printf(data->printer,
+               "%4" PRIu32 ".%03" PRIu32,
+               (uint32_t) (load_per_100k / 1000),
+               (uint32_t) (load_per_100k % 1000));
+}
+
 static int
 print_time(rtems_cpu_usage_data*    data,
            const Timestamp_Control* time,
@@ -174,12 +188,17 @@ task_usage(Thread_Control* thread, void* arg)
   rtems_cpu_usage_data* data = (rtems_cpu_usage_data*) arg;
   Timestamp_Control     usage;
   Timestamp_Control     current = data->zero;
+  uint32_t              average[LOAD_AVERAGE_COUNT];
+  uint32_t              load;
   int                   j;
 
   data->stack_size += thread->Start.Initial_stack.size;
 
   usage = _Thread_Get_CPU_time_used_after_last_reset(thread);
 
+  _Thread_Get_load_average(thread, average);
+  load = average[0];
+
   for (j = 0; j < data->last_task_count; j++)
   {
     if (thread == data->last_tasks[j])
@@ -217,6 +236,14 @@ task_usage(Thread_Control* thread, void* arg)
        */
       switch (data->sort_order)
       {
+        case RTEMS_TOP_SORT_LOAD:
+          /*
+           * The load average is maintained by the kernel, so no previous
+           * sample is required.
+           */
+          if (load <= data->load[j])
+            continue;
+          break;
         default:
           data->sort_order = RTEMS_TOP_SORT_CURRENT;
           /* drop through */
@@ -251,11 +278,13 @@ task_usage(Thread_Control* thread, void* arg)
         data->tasks[k + 1] = data->tasks[k];
         data->usage[k + 1]  = data->usage[k];
         data->current_usage[k + 1]  = data->current_usage[k];
+        data->load[k + 1]  = data->load[k];
       }
     }
     data->tasks[j] = thread;
     data->usage[j] = usage;
     data->current_usage[j] = current;
+    data->load[j] = load;
     break;
   }
 
@@ -292,20 +321,27 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
     Timestamp_Control uptime_at_last_reset = CPU_usage_Uptime_at_last_reset;
     size_t            tasks_size;
     size_t            usage_size;
+    size_t            load_size;
     Timestamp_Control load;
+    uint32_t          processor_count;
+    uint32_t          processor_load[LOAD_AVERAGE_COUNT];
+    uint32_t          cpu_index;
 
     data->task_count = 0;
     _Thread_Iterate(task_counter, data);
 
     tasks_size = sizeof(Thread_Control*) * (data->task_count + 1);
     usage_size = sizeof(Timestamp_Control) * (data->task_count + 1);
+    load_size = sizeof(uint32_t) * (data->task_count + 1);
 
     if (data->task_count > data->task_size)
     {
       data->tasks = realloc(data->tasks, tasks_size);
       data->usage = realloc(data->usage, usage_size);
       data->current_usage = realloc(data->current_usage, usage_size);
-      if ((data->tasks == NULL) || (data->usage == NULL) || (data->current_usage == NULL))
+      data->load = realloc(data->load, load_size);
+      if ((data->tasks == NULL) || (data->usage == NULL) ||
+          (data->current_usage == NULL) || (data->load == NULL))
       {
         rtems_printf(data->printer, "top worker: error: no memory\n");
         data->thread_run = false;
@@ -316,6 +352,7 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
     memset(data->tasks, 0, tasks_size);
     memset(data->usage, 0, usage_size);
     memset(data->current_usage, 0, usage_size);
+    memset(data->load, 0, load_size);
 
     _Timestamp_Set_to_zero(&data->total);
     _Timestamp_Set_to_zero(&data->current);
@@ -393,6 +430,45 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
     rtems_printf(data->printer,
                  "  Idle: %4" PRIu32 ".%03" PRIu32 "%%", ival, fval);
 
+    /*
+     * Load averages of the online processors.
+     */
+    processor_count = 0;
+    memset(processor_load, 0, sizeof(processor_load));
+
+    for (cpu_index = 0; cpu_index < _SMP_Get_processor_maximum(); ++cpu_index)
+    {
+      Per_CPU_Control* cpu = _Per_CPU_Get_by_index(cpu_index);
+      uint32_t         average[LOAD_AVERAGE_COUNT];
+      int              k;
+
+      if (!_Per_CPU_Is_processor_online(cpu))
+        continue;
+
+      _Thread_Get_processor_load_average(cpu, average);
+
+      for (k = 0; k < LOAD_AVERAGE_COUNT; ++k)
+        processor_load[k] += average[k];
+
+      ++processor_count;
+    }
+
+    if (processor_count > 0)
+    {
+      int k;
+
+      rtems_printf(data->printer, "\nProcessor Load Averages:");
+
+      for (k = 0; k < LOAD_AVERAGE_COUNT; ++k)
+      {
+        static const char* const labels[LOAD_AVERAGE_COUNT] = { "1s", "10s", "60s" };
+
+        rtems_printf(data->printer, "  %s: ", labels[k]);
+        print_load(data, processor_load[k] / processor_count);
+        rtems_printf(data->printer, "%%");
+      }
+    }
+
     /*
      * Memory usage.
      */
@@ -417,13 +493,14 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
 
     rtems_printf(data->printer,
        "\n"
-        " ID         | NAME                | RPRI | CPRI   | TIME                | TOTAL   | CURRENT\n"
-        "-%s---------+---------------------+-%s-----%s-----+---------------------+-%s------+--%s----\n",
+        " ID         | NAME                | RPRI | CPRI   | TIME                | TOTAL   | CURRENT | LOAD 1S\n"
+        "-%s---------+---------------------+-%s-----%s-----+---------------------+-%s------+--%s-----+--%s----\n",
        data->sort_order == RTEMS_TOP_SORT_ID ? "^^" : "--",
        data->sort_order == RTEMS_TOP_SORT_REAL_PRI ? "^^" : "--",
        data->sort_order == RTEMS_TOP_SORT_CURRENT_PRI ? "^^" : "--",
                           data->sort_order == RTEMS_TOP_SORT_TOTAL ? "^^" : "--",
-       data->sort_order == RTEMS_TOP_SORT_CURRENT ? "^^" : "--"
+       data->sort_order == RTEMS_TOP_SORT_CURRENT ? "^^" : "--",
+       data->sort_order == RTEMS_TOP_SORT_LOAD ? "^^" : "--"
     );
 
     task_count = 0;
@@ -483,7 +560,10 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
                    " |%4" PRIu32 ".%03" PRIu32, ival, fval);
       _Timestamp_Divide(&current_usage, &data->period, &ival, &fval);
       rtems_printf(data->printer,
-                   " |%4" PRIu32 ".%03" PRIu32 "\n", ival, fval);
+                   " |%4" PRIu32 ".%03" PRIu32, ival, fval);
+      rtems_printf(data->printer, " |");
+      print_load(data, data->load[i]);
+      rtems_printf(data->printer, "\n");
     }
 
     if (data->single_page && (data->show != 0) && (task_count < data->show))
@@ -512,6 +592,7 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
   free(data->last_tasks);
   free(data->last_usage);
   free(data->current_usage);
+  free(data->load);
 
   data->thread_active = false;
 
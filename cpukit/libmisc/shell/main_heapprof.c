@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/profiling.h>
+#include <rtems/printer.h>
+#include <rtems/shell.h>
+#include <rtems/shellconfig.h>
+
+#define HEAPPROF_DEFAULT_LIMIT 20
+
+static int rtems_shell_heapprof_usage(const char *cmd)
+{
+  fprintf(stderr, "usage: %s [start [SITES]|stop|reset|report [COUNT]]\n", cmd);
+  return 1;
+}
+
+static int rtems_shell_heapprof_error(rtems_status_code sc)
+{
+  fprintf(stderr, "heapprof: %s\n", rtems_status_text(sc));
+  return 1;
+}
+
+static int rtems_shell_main_heapprof(int argc, char **argv)
+{
+  rtems_printer printer;
+  rtems_status_code sc;
+  uint32_t site_count;
+  size_t limit;
+
+  if (argc == 1) {
+    printf("%" PRIu32 " dropped\n", rtems_profiling_heap_get_dropped());
+    return 0;
+  }
+
+  if (strcmp(argv[1], "start") == 0 && argc <= 3) {
+    site_count = 0;
+
+    if (argc == 3) {
+      site_count = (uint32_t) strtoul(argv[2], NULL, 0);
+    }
+
+    sc = rtems_profiling_heap_start(site_count);
+    if (sc != RTEMS_SUCCESSFUL) {
+      return rtems_shell_heapprof_error(sc);
+    }
+
+    return 0;
+  }
+
+  if (strcmp(argv[1], "stop") == 0 && argc == 2) {
+    rtems_profiling_heap_stop();
+    return 0;
+  }
+
+  if (strcmp(argv[1], "reset") == 0 && argc == 2) {
+    rtems_profiling_heap_reset();
+    return 0;
+  }
+
+  if (strcmp(argv[1], "report") == 0 && argc <= 3) {
+    limit = HEAPPROF_DEFAULT_LIMIT;
+
+    if (argc == 3) {
+      limit = (size_t) strtoul(argv[2], NULL, 0);
+    }
+
+    rtems_print_printer_fprintf(&printer, stdout);
+    sc = rtems_profiling_heap_report(&printer, limit);
+    if (sc != RTEMS_SUCCESSFUL) {
+      return rtems_shell_heapprof_error(sc);
+    }
+
+    return 0;
+  }
+
+  return rtems_shell_heapprof_usage(argv[0]);
+}
+
+rtems_shell_cmd_t rtems_shell_HEAPPROF_Command = {
+  .name = "heapprof",
+  .usage = "heapprof [start [SITES]|stop|reset|report [COUNT]]",
+  .topic = "rtems",
+  .command = rtems_shell_main_heapprof
+};
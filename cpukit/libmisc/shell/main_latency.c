@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/profiling.h>
+#include <rtems/shell.h>
+#include <rtems/shellconfig.h>
+#include <rtems/score/thread.h>
+
+typedef struct {
+  bool histogram;
+} rtems_shell_latency_context;
+
+static void rtems_shell_latency_print_histogram(
+  const rtems_profiling_latency *latency
+)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_PROFILING_LATENCY_BIN_COUNT; ++i) {
+    uint64_t limit;
+
+    if (latency->bins[i] == 0) {
+      continue;
+    }
+
+    limit = rtems_profiling_latency_bin_limit(i);
+
+    if (limit == UINT64_MAX) {
+      printf("           rest : %" PRIu32 "\n", latency->bins[i]);
+    } else {
+      printf(
+        "  < %10" PRIu64 "ns : %" PRIu32 "\n",
+        limit,
+        latency->bins[i]
+      );
+    }
+  }
+}
+
+static void rtems_shell_latency_print(
+  const rtems_shell_latency_context *ctx,
+  const char *label,
+  const rtems_profiling_latency *latency
+)
+{
+  uint64_t avg;
+
+  if (latency->count != 0) {
+    avg = latency->total_latency / latency->count;
+  } else {
+    avg = 0;
+  }
+
+  printf(
+    "%-22s %12" PRIu64 " %12" PRIu64 " %12" PRIu64 "\n",
+    label,
+    latency->count,
+    avg,
+    latency->max_latency
+  );
+
+  if (ctx->histogram) {
+    rtems_shell_latency_print_histogram(latency);
+  }
+}
+
+static bool rtems_shell_latency_visit_thread(
+  Thread_Control *the_thread,
+  void *arg
+)
+{
+  const rtems_shell_latency_context *ctx;
+  rtems_profiling_latency latency;
+  rtems_status_code sc;
+  rtems_id id;
+  char name[10];
+  char label[24];
+
+  ctx = arg;
+  id = the_thread->Object.id;
+  sc = rtems_profiling_get_thread_latency(id, &latency);
+
+  if (sc == RTEMS_SUCCESSFUL && latency.count != 0) {
+    rtems_object_get_name(id, sizeof(name), name);
+    snprintf(label, sizeof(label), "0x%08" PRIx32 " %s", id, name);
+    rtems_shell_latency_print(ctx, label, &latency);
+  }
+
+  return false;
+}
+
+static int rtems_shell_main_latency(int argc, char **argv)
+{
+  rtems_shell_latency_context ctx;
+  rtems_profiling_latency latency;
+  rtems_status_code sc;
+  uint32_t cpu_index;
+  uint32_t cpu_max;
+  int i;
+
+  memset(&ctx, 0, sizeof(ctx));
+
+  for (i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-r") == 0) {
+      rtems_profiling_reset_latency();
+      printf("Resetting wake-up latency information\n");
+      return 0;
+    } else if (strcmp(argv[i], "-H") == 0) {
+      ctx.histogram = true;
+    } else {
+      fprintf(stderr, "%s: [-H] [-r]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  printf(
+    "%-22s %12s %12s %12s\n",
+    "PROCESSOR/THREAD",
+    "COUNT",
+    "AVG [ns]",
+    "MAX [ns]"
+  );
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    char label[24];
+
+    sc = rtems_profiling_get_processor_latency(cpu_index, &latency);
+
+    if (sc == RTEMS_NOT_IMPLEMENTED) {
+      fprintf(stderr, "%s: profiling is disabled\n", argv[0]);
+      return 1;
+    }
+
+    if (sc == RTEMS_SUCCESSFUL) {
+      snprintf(label, sizeof(label), "CPU %" PRIu32, cpu_index);
+      rtems_shell_latency_print(&ctx, label, &latency);
+    }
+  }
+
+  rtems_task_iterate(rtems_shell_latency_visit_thread, &ctx);
+  return 0;
+}
+
+rtems_shell_cmd_t rtems_shell_LATENCY_Command = {
+  .name = "latency",
+  .usage = "latency [-H] [-r]\n"
+    "  print wake-up latencies of processors and threads\n"
+    "  -H  print the log2 latency histograms\n"
+    "  -r  reset the latency statistics",
+  .topic = "rtems",
+  .command = rtems_shell_main_latency
+};
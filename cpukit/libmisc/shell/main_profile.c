@@ -0,0 +1,180 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/profiling.h>
+#include <rtems/printer.h>
+#include <rtems/shell.h>
+#include <rtems/shellconfig.h>
+
+#define PROFILE_DEFAULT_LIMIT 20
+
+static int rtems_shell_profile_usage(const char *cmd)
+{
+  fprintf(
+    stderr,
+    "usage: %s [start [PERIOD [ENTRIES]]|stop|reset|report [COUNT]|"
+      "export FILE]\n",
+    cmd
+  );
+  return 1;
+}
+
+static int rtems_shell_profile_error(rtems_status_code sc)
+{
+  fprintf(stderr, "profile: %s\n", rtems_status_text(sc));
+  return 1;
+}
+
+static int rtems_shell_profile_start(int argc, char **argv)
+{
+  rtems_profiling_sampler_config config;
+  rtems_status_code sc;
+
+  if (argc > 4) {
+    return rtems_shell_profile_usage(argv[0]);
+  }
+
+  memset(&config, 0, sizeof(config));
+  config.period = 1;
+
+  if (argc > 2) {
+    config.period = (uint32_t) strtoul(argv[2], NULL, 0);
+  }
+
+  if (argc > 3) {
+    config.entry_count = (uint32_t) strtoul(argv[3], NULL, 0);
+  }
+
+  sc = rtems_profiling_sampler_start(&config);
+  if (sc == RTEMS_NOT_IMPLEMENTED) {
+    fprintf(
+      stderr,
+      "profile: clock tick sampling is not supported, use a period of 0\n"
+    );
+    return 1;
+  }
+
+  if (sc != RTEMS_SUCCESSFUL) {
+    return rtems_shell_profile_error(sc);
+  }
+
+  return 0;
+}
+
+static int rtems_shell_profile_export(const char *file)
+{
+  rtems_status_code sc;
+  int fd;
+
+  fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0) {
+    perror("profile");
+    return 1;
+  }
+
+  sc = rtems_profiling_sampler_export(fd);
+  close(fd);
+
+  if (sc != RTEMS_SUCCESSFUL) {
+    return rtems_shell_profile_error(sc);
+  }
+
+  return 0;
+}
+
+static int rtems_shell_main_profile(int argc, char **argv)
+{
+  rtems_profiling_sampler_statistics stats;
+  rtems_printer printer;
+  rtems_status_code sc;
+  size_t limit;
+
+  if (argc == 1) {
+    rtems_profiling_sampler_get_statistics(&stats);
+    printf(
+      "%" PRIu64 " samples, %" PRIu64 " dropped\n",
+      stats.samples,
+      stats.dropped
+    );
+    return 0;
+  }
+
+  if (strcmp(argv[1], "start") == 0) {
+    return rtems_shell_profile_start(argc, argv);
+  }
+
+  if (strcmp(argv[1], "stop") == 0 && argc == 2) {
+    rtems_profiling_sampler_stop();
+    return 0;
+  }
+
+  if (strcmp(argv[1], "reset") == 0 && argc == 2) {
+    rtems_profiling_sampler_reset();
+    return 0;
+  }
+
+  if (strcmp(argv[1], "report") == 0 && argc <= 3) {
+    limit = PROFILE_DEFAULT_LIMIT;
+
+    if (argc == 3) {
+      limit = (size_t) strtoul(argv[2], NULL, 0);
+    }
+
+    rtems_print_printer_fprintf(&printer, stdout);
+    sc = rtems_profiling_sampler_report(&printer, limit);
+    if (sc != RTEMS_SUCCESSFUL) {
+      return rtems_shell_profile_error(sc);
+    }
+
+    return 0;
+  }
+
+  if (strcmp(argv[1], "export") == 0 && argc == 3) {
+    return rtems_shell_profile_export(argv[2]);
+  }
+
+  return rtems_shell_profile_usage(argv[0]);
+}
+
+rtems_shell_cmd_t rtems_shell_PROFILE_Command = {
+  .name = "profile",
+  .usage = "profile [start [PERIOD [ENTRIES]]|stop|reset|report [COUNT]|"
+    "export FILE]",
+  .topic = "rtems",
+  .command = rtems_shell_main_profile
+};
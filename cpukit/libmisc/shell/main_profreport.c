@@ -17,15 +17,48 @@
 #endif
 
 #include <stdio.h>
+#include <string.h>
 
 #include <rtems/profiling.h>
 #include <rtems/printer.h>
 #include <rtems/shell.h>
 #include <rtems/shellconfig.h>
 
+static int rtems_shell_profreport_call_sites(const char *action)
+{
+  rtems_status_code sc;
+
+  if (strcmp(action, "on") == 0) {
+    sc = rtems_profiling_smp_lock_call_sites_enable();
+    if (sc != RTEMS_SUCCESSFUL) {
+      fprintf(stderr, "profreport: %s\n", rtems_status_text(sc));
+      return 1;
+    }
+  } else if (strcmp(action, "off") == 0) {
+    rtems_profiling_smp_lock_call_sites_disable();
+  } else if (strcmp(action, "reset") == 0) {
+    rtems_profiling_smp_lock_call_sites_reset();
+  } else {
+    fprintf(stderr, "usage: profreport [callsites on|off|reset]\n");
+    return 1;
+  }
+
+  return 0;
+}
+
 static int rtems_shell_main_profreport(int argc, char **argv)
 {
   rtems_printer printer;
+
+  if (argc == 3 && strcmp(argv[1], "callsites") == 0) {
+    return rtems_shell_profreport_call_sites(argv[2]);
+  }
+
+  if (argc != 1) {
+    fprintf(stderr, "usage: profreport [callsites on|off|reset]\n");
+    return 1;
+  }
+
   rtems_print_printer_printf(&printer);
   rtems_profiling_report_xml(
     "Shell",
@@ -39,7 +72,7 @@ static int rtems_shell_main_profreport(int argc, char **argv)
 
 rtems_shell_cmd_t rtems_shell_PROFREPORT_Command = {
   .name = "profreport",
-  .usage = "profreport",
+  .usage = "profreport [callsites on|off|reset]",
   .topic = "rtems",
   .command = rtems_shell_main_profreport
 };
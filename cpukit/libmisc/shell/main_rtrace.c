@@ -17,6 +17,7 @@
 #include <time.h>
 #include <unistd.h>
 
+#include <rtems/record.h>
 #include <rtems/shell.h>
 #include <rtems/trace/rtems-trace-buffer-vars.h>
 
@@ -592,6 +593,91 @@ rtems_trace_buffering_shell_save (int argc, char *argv[])
   return 0;
 }
 
+static bool
+rtems_trace_buffering_record_class (const char* name, uint32_t* classes)
+{
+  int c;
+
+  if (strcmp (name, "all") == 0)
+  {
+    *classes = RTEMS_RECORD_CLASS_ALL;
+    return true;
+  }
+
+  for (c = 0; c < RTEMS_RECORD_CLASS_COUNT; ++c)
+  {
+    if (strcmp (name, rtems_record_event_class_text (c)) == 0)
+    {
+      *classes = RTEMS_RECORD_CLASS_BIT (c);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static int
+rtems_trace_buffering_shell_classes (int argc, char *argv[])
+{
+  uint32_t classes;
+  int      arg;
+  int      c;
+
+  classes = rtems_record_get_event_classes ();
+
+  for (arg = 1; arg < argc; ++arg)
+  {
+    const char* name = argv[arg];
+    uint32_t    change;
+
+    if (strcmp (name, "none") == 0)
+    {
+      classes = 0;
+      continue;
+    }
+
+    if (name[0] == '+' || name[0] == '-')
+    {
+      if (!rtems_trace_buffering_record_class (name + 1, &change))
+      {
+        printf ("error: unknown event class: %s\n", name + 1);
+        return 1;
+      }
+
+      if (name[0] == '+')
+        classes |= change;
+      else
+        classes &= ~change;
+    }
+    else
+    {
+      if (!rtems_trace_buffering_record_class (name, &change))
+      {
+        printf ("error: unknown event class: %s\n", name);
+        return 1;
+      }
+
+      classes = change;
+    }
+  }
+
+  if (argc > 1)
+    rtems_record_set_event_classes (classes);
+
+  classes = rtems_record_get_event_classes ();
+
+  rtems_trace_buffering_banner ("record event classes");
+
+  for (c = 0; c < RTEMS_RECORD_CLASS_COUNT; ++c)
+  {
+    printf (" %-10s : %s\n",
+            rtems_record_event_class_text (c),
+            (classes & RTEMS_RECORD_CLASS_BIT (c)) != 0 ? "enabled" : "disabled");
+  }
+
+  return 0;
+}
+
 static void
 rtems_trace_buffering_shell_usage (const char* arg)
 {
@@ -640,6 +726,11 @@ static const rtems_trace_buffering_shell_cmd_t table[] =
     rtems_trace_buffering_shell_save,
     " file                  : Save the trace buffer to a file"
   },
+  {
+    "classes",
+    rtems_trace_buffering_shell_classes,
+    " [[+|-]class|all|none] : Show or set the record event classes"
+  },
 };
 
 #define RTEMS_TRACE_BUFFERING_COMMANDS \
@@ -0,0 +1,478 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/thread.h>
+
+/*
+ * The record event class of each system event.  Events which are not listed
+ * belong to the RTEMS_RECORD_CLASS_OTHER class.
+ */
+static const uint8_t event_classes[ RTEMS_RECORD_USER_0 ] = {
+  [ RTEMS_RECORD_EMPTY ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_VERSION ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_ACCEPT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_ACCEPT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_ALIGNED_ALLOC_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_ALIGNED_ALLOC_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_ARCH ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_ARG_0 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_1 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_2 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_3 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_4 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_5 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_6 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_7 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_8 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_ARG_9 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_BIND_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_BIND_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_BSP ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_CALLER ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_CALLOC_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_CALLOC_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_CHOWN_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_CHOWN_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_CLOSE_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_CLOSE_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_CONNECT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_CONNECT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_ETHER_INPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_ETHER_OUTPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_FATAL_CODE ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_FATAL_SOURCE ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_FCHMOD_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FCHMOD_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FCNTL_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FCNTL_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FDATASYNC_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FDATASYNC_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FREE_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_FREE_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_FREQUENCY ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_FSTAT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FSTAT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FSYNC_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FSYNC_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FTRUNCATE_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FTRUNCATE_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_FUNCTION_ENTRY ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_FUNCTION_EXIT ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_GETSOCKOPT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_GETSOCKOPT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_HEAP_ALLOC ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_HEAP_FREE ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_HEAP_SIZE ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_HEAP_USAGE ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_INTERRUPT_ENTRY ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_EXIT ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_INSTALL ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_REMOVE ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_SERVER_ENTRY ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_SERVER_EXIT ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_SERVER_INSTALL ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_SERVER_MOVE ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_SERVER_REMOVE ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_INTERRUPT_SERVER_TRIGGER ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_IOCTL_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_IOCTL_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_IP6_INPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_IP6_OUTPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_IP_INPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_IP_OUTPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_ISR_DISABLE ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_ISR_ENABLE ] = RTEMS_RECORD_CLASS_INTERRUPT,
+  [ RTEMS_RECORD_ISR_LOCK_ACQUIRE_ENTRY ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_ISR_LOCK_ACQUIRE_EXIT ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_ISR_LOCK_ADDRESS ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_ISR_LOCK_DESTROY ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_ISR_LOCK_INITIALIZE ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_ISR_LOCK_NAME ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_ISR_LOCK_RELEASE ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_KEVENT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_KEVENT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_KQUEUE_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_KQUEUE_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_LINE ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_LINK_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_LINK_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_LISTEN_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_LISTEN_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_LSEEK_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_LSEEK_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_MALLOC_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_MALLOC_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_MKNOD_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_MKNOD_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_MMAP_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_MMAP_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_MOUNT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_MOUNT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_MULTILIB ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_OPEN_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_OPEN_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_PAGE_ALLOC ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_PAGE_FREE ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_PER_CPU_COUNT ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_PER_CPU_HEAD ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_PER_CPU_OVERFLOW ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_PER_CPU_TAIL ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_POLL_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_POLL_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_POSIX_MEMALIGN_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_POSIX_MEMALIGN_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_PROCESSOR ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_PROCESSOR_MAXIMUM ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_READ_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_READ_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_READLINK_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_READLINK_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_READV_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_READV_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_REALLOC_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_REALLOC_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_RECV_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RECV_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RECVFROM_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RECVFROM_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RECVMSG_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RECVMSG_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RENAME_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RENAME_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RETURN_0 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_1 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_2 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_3 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_4 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_5 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_6 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_7 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_8 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RETURN_9 ] = RTEMS_RECORD_CLASS_FUNCTION,
+  [ RTEMS_RECORD_RTEMS_BARRIER_CREATE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_BARRIER_DELETE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_BARRIER_RELEASE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_BARRIER_WAIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_CALLOC_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_RTEMS_CALLOC_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_RTEMS_EVENT_RECEIVE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_EVENT_SEND ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_EVENT_SYSTEM_RECEIVE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_EVENT_SYSTEM_SEND ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_MALLOC_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_RTEMS_MALLOC_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_RTEMS_MESSAGE_QUEUE_BROADCAST ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_MESSAGE_QUEUE_CREATE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_MESSAGE_QUEUE_DELETE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_MESSAGE_QUEUE_FLUSH ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_MESSAGE_QUEUE_RECEIVE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_MESSAGE_QUEUE_SEND ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_MESSAGE_QUEUE_URGENT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_PARTITION_CREATE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_PARTITION_DELETE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_PARTITION_GET_BUFFER ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_PARTITION_RETURN_BUFFER ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_RATE_MONOTONIC_CANCEL ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_RATE_MONOTONIC_CREATE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_RATE_MONOTONIC_DELETE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_RATE_MONOTONIC_PERIOD ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_SEMAPHORE_CREATE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_SEMAPHORE_DELETE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_SEMAPHORE_FLUSH ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_SEMAPHORE_OBTAIN ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_SEMAPHORE_RELEASE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_TIMER_CANCEL ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_TIMER_CREATE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_TIMER_DELETE ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_TIMER_FIRE_AFTER ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_TIMER_FIRE_WHEN ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_TIMER_RESET ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_AFTER ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_WHEN ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SBWAIT_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SBWAIT_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SBWAKEUP_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SBWAKEUP_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SCHEDULER_ADD_PROCESSOR ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_ASK_FOR_HELP ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_BLOCK ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_CANCEL_JOB ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_ID ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_MAP_PRIORITY ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_NAME ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_PIN ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_RECONSIDER_HELP_REQUEST ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_RELEASE_JOB ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_REMOVE_PROCESSOR ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_SCHEDULE ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_SET_AFFINITY ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_TICK ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_UNBLOCK ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_UNMAP_PRIORITY ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_UNPIN ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_UPDATE_PRIORITY ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_WITHDRAW_NODE ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SCHEDULER_YIELD ] = RTEMS_RECORD_CLASS_SCHEDULER,
+  [ RTEMS_RECORD_SELECT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SELECT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SEND_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SEND_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SENDMSG_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SENDMSG_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SENDTO_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SENDTO_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SETSOCKOPT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SETSOCKOPT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SHUTDOWN_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SHUTDOWN_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SOABORT_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOABORT_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOACCEPT_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOACCEPT_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOALLOC_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOALLOC_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOBINDAT_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOBINDAT_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOBIND_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOBIND_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOCKET_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SOCKET_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SOCLOSE_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOCLOSE_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOCONNECT2_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOCONNECT2_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOCONNECTAT_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOCONNECTAT_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOCREATE_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOCREATE_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SODEALLOC_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SODEALLOC_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SODISCONNECT_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SODISCONNECT_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOFREE_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOFREE_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOLISTEN_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOLISTEN_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SONEWCONN_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SONEWCONN_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SORECEIVE_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SORECEIVE_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SORFLUSH_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SORFLUSH_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOSEND_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOSEND_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOSHUTDOWN_ENTRY ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_SOSHUTDOWN_EXIT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_STATVFS_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_STATVFS_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SYMLINK_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_SYMLINK_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_TCP_CLOSE ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_TCP_INPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_TCP_OUTPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_THREAD_BEGIN ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_CONTINUE_ENTRY ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_CONTINUE_EXIT ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_CREATE ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_DELETE ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_DISPATCH_DISABLE ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_DISPATCH_ENABLE ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_EXIT ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_EXITTED ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_ID ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_NAME ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_PRIO_CURRENT_HIGH ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_PRIO_CURRENT_LOW ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_PRIO_REAL_HIGH ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_PRIO_REAL_LOW ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_QUEUE_ADDRESS ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_DESTROY ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_ENQUEUE ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_ENQUEUE_STICKY ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_EXTRACT ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_ID ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_INITIALIZE ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_NAME ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_SURRENDER ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_QUEUE_SURRENDER_STICKY ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_RESOURCE_OBTAIN ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_RESOURCE_RELEASE ] = RTEMS_RECORD_CLASS_LOCK,
+  [ RTEMS_RECORD_THREAD_RESTART ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_STACK_CURRENT ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_STACK_SIZE ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_STACK_USAGE ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_START ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_STATE_CLEAR ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_STATE_SET ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_SWITCH_IN ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_SWITCH_OUT ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_TERMINATE ] = RTEMS_RECORD_CLASS_THREAD,
+  [ RTEMS_RECORD_THREAD_TIMER_INSERT_MONOTONIC ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_THREAD_TIMER_INSERT_REALTIME ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_THREAD_TIMER_INSERT_TICKS ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_THREAD_TIMER_REMOVE ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_TOOLS ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_UDP_INPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_UDP_OUTPUT ] = RTEMS_RECORD_CLASS_NETWORK,
+  [ RTEMS_RECORD_UMA_ALLOC_PTR ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_UMA_ALLOC_ZONE ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_UMA_FREE_PTR ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_UMA_FREE_ZONE ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_UNLINK_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_UNLINK_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_UNMOUNT_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_UNMOUNT_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_UPTIME_HIGH ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_UPTIME_LOW ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_VERSION_CONTROL_KEY ] = RTEMS_RECORD_CLASS_CONTROL,
+  [ RTEMS_RECORD_WATCHDOG_ADDRESS ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_WATCHDOG_CPU ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_WATCHDOG_INITIALIZE ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_WATCHDOG_INSERT ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_WATCHDOG_PREINITIALIZE ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_WATCHDOG_REMOVE ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_WATCHDOG_ROUTINE ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_WATCHDOG_STATE ] = RTEMS_RECORD_CLASS_WATCHDOG,
+  [ RTEMS_RECORD_WORKSPACE_ALLOC_ENTRY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_WORKSPACE_ALLOC_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_WORKSPACE_FREE_ENTY ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_WORKSPACE_FREE_EXIT ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_WORKSPACE_SIZE ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_WORKSPACE_USAGE ] = RTEMS_RECORD_CLASS_MEMORY,
+  [ RTEMS_RECORD_WRITE_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_WRITE_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_WRITEV_ENTRY ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+  [ RTEMS_RECORD_WRITEV_EXIT ] = RTEMS_RECORD_CLASS_SYSTEM_CALL,
+};
+
+RTEMS_STATIC_ASSERT( RTEMS_RECORD_CLASS_OTHER == 0, RTEMS_RECORD_CLASS_OTHER );
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_RECORD_CLASS_COUNT <= 32,
+  RTEMS_RECORD_CLASS_COUNT
+);
+
+static const char * const class_text[] = {
+  [ RTEMS_RECORD_CLASS_OTHER ] = "other",
+  [ RTEMS_RECORD_CLASS_CONTROL ] = "control",
+  [ RTEMS_RECORD_CLASS_THREAD ] = "thread",
+  [ RTEMS_RECORD_CLASS_SCHEDULER ] = "scheduler",
+  [ RTEMS_RECORD_CLASS_INTERRUPT ] = "interrupt",
+  [ RTEMS_RECORD_CLASS_LOCK ] = "lock",
+  [ RTEMS_RECORD_CLASS_WATCHDOG ] = "watchdog",
+  [ RTEMS_RECORD_CLASS_MEMORY ] = "memory",
+  [ RTEMS_RECORD_CLASS_SYSTEM_CALL ] = "syscall",
+  [ RTEMS_RECORD_CLASS_NETWORK ] = "network",
+  [ RTEMS_RECORD_CLASS_FUNCTION ] = "function",
+  [ RTEMS_RECORD_CLASS_USER ] = "user"
+};
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_ARRAY_SIZE( class_text ) == RTEMS_RECORD_CLASS_COUNT,
+  class_text
+);
+
+static rtems_mutex _Record_Event_class_mutex =
+  RTEMS_MUTEX_INITIALIZER( "Record Event Classes" );
+
+rtems_record_event_class rtems_record_get_event_class(
+  rtems_record_event event
+)
+{
+  if ( event >= RTEMS_RECORD_USER_0 ) {
+    return RTEMS_RECORD_CLASS_USER;
+  }
+
+  return (rtems_record_event_class) event_classes[ event ];
+}
+
+uint32_t rtems_record_get_event_classes( void )
+{
+  return _Record_Event_classes;
+}
+
+uint32_t rtems_record_set_event_classes( uint32_t classes )
+{
+  uint32_t previous;
+  size_t   i;
+
+  classes |= RTEMS_RECORD_CLASS_BIT( RTEMS_RECORD_CLASS_CONTROL );
+  classes &= RTEMS_RECORD_CLASS_ALL;
+
+  rtems_mutex_lock( &_Record_Event_class_mutex );
+  previous = _Record_Event_classes;
+  _Record_Event_classes = classes;
+
+  /*
+   * The filter words are updated one by one.  Concurrent producers may see a
+   * mix of the old and new filter for a short time, this is harmless.
+   */
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( _Record_Event_filter ); ++i ) {
+    uint32_t filter;
+    uint32_t bit;
+
+    filter = 0;
+
+    for ( bit = 0; bit < 32; ++bit ) {
+      rtems_record_event_class event_class;
+
+      event_class = rtems_record_get_event_class(
+        (rtems_record_event) ( i * 32 + bit )
+      );
+
+      if ( ( classes & RTEMS_RECORD_CLASS_BIT( event_class ) ) != 0 ) {
+        filter |= UINT32_C( 1 ) << bit;
+      }
+    }
+
+    _Record_Event_filter[ i ] = filter;
+  }
+
+  rtems_mutex_unlock( &_Record_Event_class_mutex );
+
+  return previous;
+}
+
+const char *rtems_record_event_class_text(
+  rtems_record_event_class event_class
+)
+{
+  size_t n;
+
+  n = event_class;
+
+  if ( n < RTEMS_ARRAY_SIZE( class_text ) ) {
+    return class_text[ n ];
+  }
+
+  return NULL;
+}
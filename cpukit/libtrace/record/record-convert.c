@@ -0,0 +1,1223 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file must be compatible to general purpose POSIX system, e.g. Linux,
+ * FreeBSD.  It may be used for utility programs.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordconvert.h>
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CPU_MAX RTEMS_RECORD_CLIENT_MAXIMUM_CPU_COUNT
+
+#define FORMAT_HEADER_SIZE 8
+
+typedef struct {
+  size_t   begin;
+  size_t   end;
+  uint32_t cpu;
+} convert_chunk;
+
+/*
+ * The count of decoded chunks which may be buffered for each processor.  This
+ * bounds the memory used by the parallel decoder independent of the stream
+ * size.
+ */
+#define BUFFERS_PER_CPU 2
+
+typedef struct {
+  uint64_t bt;
+  uint64_t data;
+  uint32_t cpu;
+  uint32_t event;
+} convert_item;
+
+typedef struct {
+  convert_item *items;
+  size_t        count;
+  size_t        capacity;
+} convert_buffer;
+
+typedef struct {
+  rtems_record_client_context client;
+  uint32_t                    cpu;
+  bool                        started;
+  bool                        decoding;
+  bool                        done;
+  size_t                      next_chunk;
+  convert_buffer             *fill;
+  rtems_record_client_status  status;
+  convert_buffer              buffers[ BUFFERS_PER_CPU ];
+  size_t                      head;
+  size_t                      count;
+  size_t                      merge_index;
+} convert_cpu;
+
+typedef struct {
+  const char                 *stream;
+  size_t                      prefix_end;
+  const convert_chunk        *chunks;
+  size_t                      chunk_count;
+  convert_cpu                *cpus;
+  uint32_t                    cpu_count;
+  bool                        abort;
+  rtems_record_client_status  status;
+  pthread_mutex_t             mutex;
+  pthread_cond_t              cond;
+} convert_decoder;
+
+static uint32_t read_u32( const char *pos, bool swap )
+{
+  uint32_t value;
+
+  memcpy( &value, pos, sizeof( value ) );
+
+  return swap ? __builtin_bswap32( value ) : value;
+}
+
+static uint64_t read_u64( const char *pos, bool swap )
+{
+  uint64_t value;
+
+  memcpy( &value, pos, sizeof( value ) );
+
+  return swap ? __builtin_bswap64( value ) : value;
+}
+
+static rtems_record_client_status get_format(
+  const char *stream,
+  size_t      size,
+  size_t     *item_size,
+  bool       *swap
+)
+{
+  uint32_t format;
+  bool     is_little_endian;
+
+  if ( size < FORMAT_HEADER_SIZE ) {
+    return RTEMS_RECORD_CLIENT_ERROR_UNKNOWN_FORMAT;
+  }
+
+  format = read_u32( stream, false );
+  is_little_endian = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+
+  switch ( format ) {
+    case RTEMS_RECORD_FORMAT_LE_32:
+      *item_size = sizeof( rtems_record_item_32 );
+      *swap = !is_little_endian;
+      break;
+    case RTEMS_RECORD_FORMAT_LE_64:
+      *item_size = sizeof( rtems_record_item_64 );
+      *swap = !is_little_endian;
+      break;
+    case RTEMS_RECORD_FORMAT_BE_32:
+      *item_size = sizeof( rtems_record_item_32 );
+      *swap = is_little_endian;
+      break;
+    case RTEMS_RECORD_FORMAT_BE_64:
+      *item_size = sizeof( rtems_record_item_64 );
+      *swap = is_little_endian;
+      break;
+    default:
+      return RTEMS_RECORD_CLIENT_ERROR_UNKNOWN_FORMAT;
+  }
+
+  if ( read_u32( stream + 4, *swap ) != RTEMS_RECORD_MAGIC ) {
+    return RTEMS_RECORD_CLIENT_ERROR_INVALID_MAGIC;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+/*
+ * Splits the stream at the RTEMS_RECORD_PROCESSOR items.  The items before
+ * the first RTEMS_RECORD_PROCESSOR item are the common prefix of all
+ * per-processor streams.
+ */
+static rtems_record_client_status split_stream(
+  const char     *stream,
+  size_t          size,
+  size_t         *prefix_end,
+  convert_chunk **chunks,
+  size_t         *chunk_count,
+  uint32_t       *cpu_count
+)
+{
+  rtems_record_client_status status;
+  size_t                     item_size;
+  bool                       swap;
+  size_t                     capacity;
+  size_t                     count;
+  size_t                     pos;
+  convert_chunk             *chunk;
+
+  status = get_format( stream, size, &item_size, &swap );
+
+  if ( status != RTEMS_RECORD_CLIENT_SUCCESS ) {
+    return status;
+  }
+
+  *prefix_end = size;
+  *cpu_count = 1;
+  capacity = 0;
+  count = 0;
+  chunk = NULL;
+
+  for (
+    pos = FORMAT_HEADER_SIZE;
+    pos + item_size <= size;
+    pos += item_size
+  ) {
+    uint32_t event;
+    uint32_t cpu;
+
+    event = read_u32( stream + pos, swap );
+
+    if ( RTEMS_RECORD_GET_EVENT( event ) != RTEMS_RECORD_PROCESSOR ) {
+      continue;
+    }
+
+    if ( item_size == sizeof( rtems_record_item_32 ) ) {
+      cpu = read_u32( stream + pos + 4, swap );
+    } else {
+      cpu = (uint32_t) read_u64( stream + pos + 4, swap );
+    }
+
+    if ( cpu >= CPU_MAX ) {
+      free( chunk );
+      return RTEMS_RECORD_CLIENT_ERROR_UNSUPPORTED_CPU;
+    }
+
+    if ( cpu >= *cpu_count ) {
+      *cpu_count = cpu + 1;
+    }
+
+    if ( count == 0 ) {
+      *prefix_end = pos;
+    } else {
+      chunk[ count - 1 ].end = pos;
+    }
+
+    if ( count == capacity ) {
+      convert_chunk *more;
+
+      capacity = capacity > 0 ? 2 * capacity : 64;
+      more = realloc( chunk, capacity * sizeof( *chunk ) );
+
+      if ( more == NULL ) {
+        free( chunk );
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      chunk = more;
+    }
+
+    chunk[ count ].begin = pos;
+    chunk[ count ].cpu = cpu;
+    ++count;
+  }
+
+  if ( count > 0 ) {
+    chunk[ count - 1 ].end = size;
+  }
+
+  *chunks = chunk;
+  *chunk_count = count;
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static rtems_record_client_status cpu_handler(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  convert_cpu    *per_cpu;
+  convert_buffer *buffer;
+  convert_item   *item;
+
+  per_cpu = arg;
+
+  /* The common prefix is decoded for each processor */
+  if ( cpu != per_cpu->cpu ) {
+    return RTEMS_RECORD_CLIENT_SUCCESS;
+  }
+
+  buffer = per_cpu->fill;
+
+  if ( buffer->count == buffer->capacity ) {
+    convert_item *more;
+    size_t        capacity;
+
+    capacity = buffer->capacity > 0 ? 2 * buffer->capacity : 256;
+    more = realloc( buffer->items, capacity * sizeof( *more ) );
+
+    if ( more == NULL ) {
+      return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+    }
+
+    buffer->items = more;
+    buffer->capacity = capacity;
+  }
+
+  item = &buffer->items[ buffer->count ];
+  item->bt = bt;
+  item->data = data;
+  item->cpu = cpu;
+  item->event = event;
+  ++buffer->count;
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static size_t find_chunk(
+  const convert_decoder *decoder,
+  uint32_t               cpu,
+  size_t                 index
+)
+{
+  while (
+    index < decoder->chunk_count && decoder->chunks[ index ].cpu != cpu
+  ) {
+    ++index;
+  }
+
+  return index;
+}
+
+/*
+ * Decodes the next chunk of the processor into a free buffer.  Returns true,
+ * if the processor has no more chunks.  The decoder mutex shall not be owned
+ * by the caller.  The processor shall be reserved by the caller through the
+ * decoding member.
+ */
+static bool decode_chunk(
+  convert_decoder *decoder,
+  convert_cpu     *per_cpu
+)
+{
+  rtems_record_client_status status;
+  size_t                     index;
+
+  status = RTEMS_RECORD_CLIENT_SUCCESS;
+  per_cpu->fill->count = 0;
+
+  if ( !per_cpu->started ) {
+    per_cpu->started = true;
+    rtems_record_client_init( &per_cpu->client, cpu_handler, per_cpu );
+    status = rtems_record_client_run(
+      &per_cpu->client,
+      decoder->stream,
+      decoder->prefix_end
+    );
+    per_cpu->next_chunk = find_chunk( decoder, per_cpu->cpu, 0 );
+  }
+
+  index = per_cpu->next_chunk;
+
+  if ( status == RTEMS_RECORD_CLIENT_SUCCESS && index < decoder->chunk_count ) {
+    const convert_chunk *chunk;
+
+    chunk = &decoder->chunks[ index ];
+    status = rtems_record_client_run(
+      &per_cpu->client,
+      decoder->stream + chunk->begin,
+      chunk->end - chunk->begin
+    );
+    index = find_chunk( decoder, per_cpu->cpu, index + 1 );
+    per_cpu->next_chunk = index;
+  }
+
+  /* Destroying the client hands over the items held back by the client */
+  if (
+    status != RTEMS_RECORD_CLIENT_SUCCESS || index >= decoder->chunk_count
+  ) {
+    rtems_record_client_destroy( &per_cpu->client );
+    per_cpu->status = status;
+    return true;
+  }
+
+  per_cpu->status = status;
+  return false;
+}
+
+/*
+ * Selects a processor with free buffers and reserves it for decoding.
+ * Processors without decoded items are preferred, since the merge waits for
+ * them.  The decoder mutex shall be owned by the caller.
+ */
+static convert_cpu *reserve_cpu( convert_decoder *decoder )
+{
+  convert_cpu *selected;
+  uint32_t     cpu;
+
+  selected = NULL;
+
+  if ( decoder->abort ) {
+    return NULL;
+  }
+
+  for ( cpu = 0; cpu < decoder->cpu_count; ++cpu ) {
+    convert_cpu *per_cpu;
+
+    per_cpu = &decoder->cpus[ cpu ];
+
+    if (
+      !per_cpu->decoding
+        && !per_cpu->done
+        && per_cpu->count < BUFFERS_PER_CPU
+        && ( selected == NULL || per_cpu->count < selected->count )
+    ) {
+      selected = per_cpu;
+    }
+  }
+
+  if ( selected != NULL ) {
+    selected->decoding = true;
+    selected->fill = &selected->buffers[
+      ( selected->head + selected->count ) % BUFFERS_PER_CPU
+    ];
+  }
+
+  return selected;
+}
+
+/*
+ * Decodes the reserved processor and publishes the buffer.  The decoder mutex
+ * shall be owned by the caller.  It is released while decoding.
+ */
+static void decode_reserved(
+  convert_decoder *decoder,
+  convert_cpu     *per_cpu
+)
+{
+  bool done;
+
+  (void) pthread_mutex_unlock( &decoder->mutex );
+  done = decode_chunk( decoder, per_cpu );
+  (void) pthread_mutex_lock( &decoder->mutex );
+
+  per_cpu->done = done;
+  per_cpu->decoding = false;
+  ++per_cpu->count;
+
+  if ( per_cpu->status != RTEMS_RECORD_CLIENT_SUCCESS ) {
+    decoder->status = per_cpu->status;
+    decoder->abort = true;
+  }
+
+  (void) pthread_cond_broadcast( &decoder->cond );
+}
+
+static bool is_finished( const convert_decoder *decoder )
+{
+  uint32_t cpu;
+
+  if ( decoder->abort ) {
+    return true;
+  }
+
+  for ( cpu = 0; cpu < decoder->cpu_count; ++cpu ) {
+    if ( !decoder->cpus[ cpu ].done ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void *worker_run( void *arg )
+{
+  convert_decoder *decoder;
+
+  decoder = arg;
+  (void) pthread_mutex_lock( &decoder->mutex );
+
+  while ( !is_finished( decoder ) ) {
+    convert_cpu *per_cpu;
+
+    per_cpu = reserve_cpu( decoder );
+
+    if ( per_cpu != NULL ) {
+      decode_reserved( decoder, per_cpu );
+    } else {
+      (void) pthread_cond_wait( &decoder->cond, &decoder->mutex );
+    }
+  }
+
+  (void) pthread_mutex_unlock( &decoder->mutex );
+
+  return NULL;
+}
+
+/*
+ * Gets the processor with the next item in timestamp order.  Returns NULL, if
+ * all items were merged or the decode was aborted.  The decoder mutex shall
+ * be owned by the caller.  The caller helps to decode while it waits for
+ * items.
+ */
+static convert_cpu *next_cpu( convert_decoder *decoder )
+{
+  while ( !decoder->abort ) {
+    convert_cpu *next;
+    convert_cpu *wait;
+    uint32_t     cpu;
+
+    next = NULL;
+    wait = NULL;
+
+    for ( cpu = 0; cpu < decoder->cpu_count; ++cpu ) {
+      convert_cpu    *per_cpu;
+      convert_buffer *buffer;
+
+      per_cpu = &decoder->cpus[ cpu ];
+
+      while ( per_cpu->count > 0 ) {
+        buffer = &per_cpu->buffers[ per_cpu->head ];
+
+        if ( per_cpu->merge_index < buffer->count ) {
+          break;
+        }
+
+        per_cpu->head = ( per_cpu->head + 1 ) % BUFFERS_PER_CPU;
+        --per_cpu->count;
+        per_cpu->merge_index = 0;
+        (void) pthread_cond_broadcast( &decoder->cond );
+      }
+
+      if ( per_cpu->count == 0 ) {
+        if ( !per_cpu->done || per_cpu->decoding ) {
+          wait = per_cpu;
+          break;
+        }
+
+        continue;
+      }
+
+      buffer = &per_cpu->buffers[ per_cpu->head ];
+
+      if (
+        next == NULL
+          || buffer->items[ per_cpu->merge_index ].bt
+            < next->buffers[ next->head ].items[ next->merge_index ].bt
+      ) {
+        next = per_cpu;
+      }
+    }
+
+    if ( wait == NULL ) {
+      return next;
+    }
+
+    wait = reserve_cpu( decoder );
+
+    if ( wait != NULL ) {
+      decode_reserved( decoder, wait );
+    } else {
+      (void) pthread_cond_wait( &decoder->cond, &decoder->mutex );
+    }
+  }
+
+  return NULL;
+}
+
+static rtems_record_client_status merge(
+  convert_decoder             *decoder,
+  rtems_record_client_handler  handler,
+  void                        *arg
+)
+{
+  (void) pthread_mutex_lock( &decoder->mutex );
+
+  while ( true ) {
+    convert_cpu                *per_cpu;
+    convert_item                item;
+    rtems_record_client_status  status;
+
+    per_cpu = next_cpu( decoder );
+
+    if ( per_cpu == NULL ) {
+      break;
+    }
+
+    item = per_cpu->buffers[ per_cpu->head ].items[ per_cpu->merge_index ];
+    ++per_cpu->merge_index;
+
+    (void) pthread_mutex_unlock( &decoder->mutex );
+    status = ( *handler )(
+      item.bt,
+      item.cpu,
+      (rtems_record_event) item.event,
+      item.data,
+      arg
+    );
+    (void) pthread_mutex_lock( &decoder->mutex );
+
+    if ( status != RTEMS_RECORD_CLIENT_SUCCESS ) {
+      decoder->status = status;
+      decoder->abort = true;
+      (void) pthread_cond_broadcast( &decoder->cond );
+      break;
+    }
+  }
+
+  (void) pthread_mutex_unlock( &decoder->mutex );
+
+  return decoder->status;
+}
+
+rtems_record_client_status rtems_record_decode_parallel(
+  const void                  *stream,
+  size_t                       size,
+  uint32_t                     worker_count,
+  rtems_record_client_handler  handler,
+  void                        *arg
+)
+{
+  rtems_record_client_status  status;
+  convert_decoder             decoder;
+  convert_chunk              *chunks;
+  size_t                      chunk_count;
+  size_t                      prefix_end;
+  uint32_t                    cpu_count;
+  pthread_t                  *threads;
+  uint32_t                    thread_count;
+  uint32_t                    i;
+
+  status = split_stream(
+    stream,
+    size,
+    &prefix_end,
+    &chunks,
+    &chunk_count,
+    &cpu_count
+  );
+
+  if ( status != RTEMS_RECORD_CLIENT_SUCCESS ) {
+    return status;
+  }
+
+  if ( worker_count == 0 || worker_count > cpu_count ) {
+    worker_count = cpu_count;
+  }
+
+  memset( &decoder, 0, sizeof( decoder ) );
+  decoder.stream = stream;
+  decoder.prefix_end = prefix_end;
+  decoder.chunks = chunks;
+  decoder.chunk_count = chunk_count;
+  decoder.cpu_count = cpu_count;
+  decoder.status = RTEMS_RECORD_CLIENT_SUCCESS;
+  decoder.cpus = calloc( cpu_count, sizeof( *decoder.cpus ) );
+
+  /* The caller decodes while it waits for items during the merge */
+  threads = calloc( worker_count, sizeof( *threads ) );
+
+  if ( decoder.cpus == NULL || threads == NULL ) {
+    free( threads );
+    free( decoder.cpus );
+    free( chunks );
+    return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+  }
+
+  for ( i = 0; i < cpu_count; ++i ) {
+    decoder.cpus[ i ].cpu = i;
+  }
+
+  (void) pthread_mutex_init( &decoder.mutex, NULL );
+  (void) pthread_cond_init( &decoder.cond, NULL );
+  thread_count = 0;
+
+  for ( i = 1; i < worker_count; ++i ) {
+    if (
+      pthread_create( &threads[ thread_count ], NULL, worker_run, &decoder )
+        == 0
+    ) {
+      ++thread_count;
+    }
+  }
+
+  status = merge( &decoder, handler, arg );
+
+  for ( i = 0; i < thread_count; ++i ) {
+    (void) pthread_join( threads[ i ], NULL );
+  }
+
+  for ( i = 0; i < cpu_count; ++i ) {
+    convert_cpu *per_cpu;
+    size_t       j;
+
+    per_cpu = &decoder.cpus[ i ];
+
+    if ( per_cpu->started && !per_cpu->done ) {
+      rtems_record_client_destroy( &per_cpu->client );
+    }
+
+    for ( j = 0; j < BUFFERS_PER_CPU; ++j ) {
+      free( per_cpu->buffers[ j ].items );
+    }
+  }
+
+  (void) pthread_cond_destroy( &decoder.cond );
+  (void) pthread_mutex_destroy( &decoder.mutex );
+  free( threads );
+  free( decoder.cpus );
+  free( chunks );
+
+  return status;
+}
+
+typedef struct {
+  uint32_t id;
+  char     name[ 64 ];
+} convert_thread;
+
+typedef struct {
+  rtems_record_convert_statistics  stats;
+  FILE                            *file;
+  FILE                            *streams[ CPU_MAX ];
+  const char                      *output;
+  bool                             first;
+  uint64_t                         last_ns;
+  uint32_t                         current[ CPU_MAX ];
+  bool                             in_slice[ CPU_MAX ];
+  bool                             cpu_seen[ CPU_MAX ];
+  convert_thread                  *naming[ CPU_MAX ];
+  size_t                           name_index[ CPU_MAX ];
+  convert_thread                  *threads;
+  size_t                           thread_count;
+  size_t                           thread_capacity;
+} convert_context;
+
+static convert_thread *find_thread( convert_context *ctx, uint32_t id )
+{
+  convert_thread *thread;
+  size_t          i;
+
+  for ( i = 0; i < ctx->thread_count; ++i ) {
+    if ( ctx->threads[ i ].id == id ) {
+      return &ctx->threads[ i ];
+    }
+  }
+
+  if ( ctx->thread_count == ctx->thread_capacity ) {
+    convert_thread *more;
+    size_t          capacity;
+
+    capacity = ctx->thread_capacity > 0 ? 2 * ctx->thread_capacity : 64;
+    more = realloc( ctx->threads, capacity * sizeof( *more ) );
+
+    if ( more == NULL ) {
+      return NULL;
+    }
+
+    /* The name pointers refer to the old thread table */
+    memset( ctx->naming, 0, sizeof( ctx->naming ) );
+    ctx->threads = more;
+    ctx->thread_capacity = capacity;
+  }
+
+  thread = &ctx->threads[ ctx->thread_count ];
+  ++ctx->thread_count;
+  thread->id = id;
+  snprintf( thread->name, sizeof( thread->name ), "%08" PRIx32, id );
+
+  return thread;
+}
+
+/*
+ * Thread names are transferred in chunks of characters packed into the data
+ * of RTEMS_RECORD_THREAD_NAME items following an RTEMS_RECORD_THREAD_ID or
+ * RTEMS_RECORD_THREAD_CREATE item.
+ */
+static void track_thread_name(
+  convert_context    *ctx,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data
+)
+{
+  convert_thread *thread;
+  size_t          i;
+  size_t          k;
+
+  switch ( event ) {
+    case RTEMS_RECORD_THREAD_ID:
+    case RTEMS_RECORD_THREAD_CREATE:
+      ctx->naming[ cpu ] = find_thread( ctx, (uint32_t) data );
+      ctx->name_index[ cpu ] = 0;
+      break;
+    case RTEMS_RECORD_THREAD_NAME:
+      thread = ctx->naming[ cpu ];
+
+      if ( thread == NULL ) {
+        break;
+      }
+
+      i = ctx->name_index[ cpu ];
+
+      for ( k = 0; k < sizeof( data ); ++k ) {
+        char c;
+
+        c = (char) ( data >> ( 8 * k ) );
+
+        if ( c == '"' || c == '\\' || ( c != '\0' && c < ' ' ) ) {
+          c = '_';
+        }
+
+        if ( i < sizeof( thread->name ) - 1 ) {
+          thread->name[ i ] = c;
+          ++i;
+        }
+      }
+
+      thread->name[ i ] = '\0';
+      ctx->name_index[ cpu ] = i;
+      break;
+    default:
+      ctx->naming[ cpu ] = NULL;
+      break;
+  }
+}
+
+static const char *thread_name( convert_context *ctx, uint32_t id )
+{
+  convert_thread *thread;
+
+  thread = find_thread( ctx, id );
+  return thread != NULL ? thread->name : "?";
+}
+
+static void chrome_json_event(
+  convert_context *ctx,
+  const char      *name,
+  char             phase,
+  uint64_t         ns,
+  uint32_t         cpu,
+  const uint64_t  *data
+)
+{
+  fprintf(
+    ctx->file,
+    "%s{\"name\":\"%s\",\"ph\":\"%c\",%s\"ts\":%" PRIu64 ".%03" PRIu32
+      ",\"pid\":0,\"tid\":%" PRIu32,
+    ctx->first ? "" : ",\n",
+    name,
+    phase,
+    phase == 'i' ? "\"s\":\"t\"," : "",
+    ns / 1000,
+    (uint32_t) ( ns % 1000 ),
+    cpu
+  );
+
+  if ( data != NULL ) {
+    fprintf( ctx->file, ",\"args\":{\"data\":\"0x%" PRIx64 "\"}", *data );
+  }
+
+  fputs( "}", ctx->file );
+  ctx->first = false;
+}
+
+static rtems_record_client_status chrome_json_handler(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  convert_context *ctx;
+  uint64_t         ns;
+
+  ctx = arg;
+  ++ctx->stats.items;
+  track_thread_name( ctx, cpu, event, data );
+
+  if ( bt == 0 ) {
+    return RTEMS_RECORD_CLIENT_SUCCESS;
+  }
+
+  ns = rtems_record_client_bintime_to_nanoseconds( bt );
+  ctx->last_ns = ns;
+
+  if ( !ctx->cpu_seen[ cpu ] ) {
+    ctx->cpu_seen[ cpu ] = true;
+    fprintf(
+      ctx->file,
+      "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+        "\"tid\":%" PRIu32 ",\"args\":{\"name\":\"CPU %" PRIu32 "\"}}",
+      ctx->first ? "" : ",\n",
+      cpu,
+      cpu
+    );
+    ctx->first = false;
+  }
+
+  switch ( event ) {
+    case RTEMS_RECORD_THREAD_SWITCH_OUT:
+      if ( ctx->in_slice[ cpu ] ) {
+        chrome_json_event(
+          ctx,
+          thread_name( ctx, ctx->current[ cpu ] ),
+          'E',
+          ns,
+          cpu,
+          NULL
+        );
+        ctx->in_slice[ cpu ] = false;
+      }
+      break;
+    case RTEMS_RECORD_THREAD_SWITCH_IN:
+      ctx->current[ cpu ] = (uint32_t) data;
+      ctx->in_slice[ cpu ] = true;
+      chrome_json_event(
+        ctx,
+        thread_name( ctx, (uint32_t) data ),
+        'B',
+        ns,
+        cpu,
+        NULL
+      );
+      break;
+    case RTEMS_RECORD_THREAD_NAME:
+    case RTEMS_RECORD_THREAD_STACK_CURRENT:
+      break;
+    default:
+      chrome_json_event(
+        ctx,
+        rtems_record_event_text( event ),
+        'i',
+        ns,
+        cpu,
+        &data
+      );
+      break;
+  }
+
+  return ferror( ctx->file ) ? RTEMS_RECORD_CLIENT_ERROR_OUTPUT :
+    RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static rtems_record_client_status chrome_json_convert(
+  convert_context *ctx,
+  const void      *stream,
+  size_t           size,
+  uint32_t         worker_count
+)
+{
+  rtems_record_client_status status;
+  uint32_t                   cpu;
+
+  ctx->file = fopen( ctx->output, "w" );
+
+  if ( ctx->file == NULL ) {
+    return RTEMS_RECORD_CLIENT_ERROR_OUTPUT;
+  }
+
+  ctx->first = true;
+  fputs( "{\"traceEvents\":[\n", ctx->file );
+  status = rtems_record_decode_parallel(
+    stream,
+    size,
+    worker_count,
+    chrome_json_handler,
+    ctx
+  );
+
+  for ( cpu = 0; cpu < CPU_MAX; ++cpu ) {
+    if ( ctx->in_slice[ cpu ] ) {
+      chrome_json_event(
+        ctx,
+        thread_name( ctx, ctx->current[ cpu ] ),
+        'E',
+        ctx->last_ns,
+        cpu,
+        NULL
+      );
+    }
+  }
+
+  fputs( "\n]}\n", ctx->file );
+
+  if ( fclose( ctx->file ) != 0 && status == RTEMS_RECORD_CLIENT_SUCCESS ) {
+    status = RTEMS_RECORD_CLIENT_ERROR_OUTPUT;
+  }
+
+  return status;
+}
+
+#define CTF_MAGIC 0xc1fc1fc1
+
+static FILE *ctf_open( convert_context *ctx, const char *name )
+{
+  char path[ 256 ];
+  int  n;
+
+  n = snprintf( path, sizeof( path ), "%s/%s", ctx->output, name );
+
+  if ( n < 0 || (size_t) n >= sizeof( path ) ) {
+    return NULL;
+  }
+
+  return fopen( path, "wb" );
+}
+
+static bool ctf_write_metadata( convert_context *ctx )
+{
+  FILE     *file;
+  uint32_t  event;
+
+  file = ctf_open( ctx, "metadata" );
+
+  if ( file == NULL ) {
+    return false;
+  }
+
+  fprintf(
+    file,
+    "/* CTF 1.8 */\n\n"
+    "typealias integer { size = 32; align = 8; signed = false; } := uint32_t;\n"
+    "typealias integer { size = 64; align = 8; signed = false; } := uint64_t;\n"
+    "\n"
+    "trace {\n"
+    "\tmajor = 1;\n"
+    "\tminor = 8;\n"
+    "\tbyte_order = %s;\n"
+    "\tpacket.header := struct {\n"
+    "\t\tuint32_t magic;\n"
+    "\t\tuint32_t stream_id;\n"
+    "\t};\n"
+    "};\n\n"
+    "clock {\n"
+    "\tname = monotonic;\n"
+    "\tfreq = 1000000000;\n"
+    "\toffset = 0;\n"
+    "};\n\n"
+    "typealias integer {\n"
+    "\tsize = 64; align = 8; signed = false;\n"
+    "\tmap = clock.monotonic.value;\n"
+    "} := uint64_clock_monotonic_t;\n\n"
+    "stream {\n"
+    "\tid = 0;\n"
+    "\tpacket.context := struct {\n"
+    "\t\tuint32_t cpu_id;\n"
+    "\t};\n"
+    "\tevent.header := struct {\n"
+    "\t\tuint32_t id;\n"
+    "\t\tuint64_clock_monotonic_t timestamp;\n"
+    "\t};\n"
+    "};\n",
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ? "le" : "be"
+  );
+
+  for ( event = 0; event <= RTEMS_RECORD_LAST; ++event ) {
+    fprintf(
+      file,
+      "\nevent {\n"
+      "\tname = \"%s\";\n"
+      "\tid = %" PRIu32 ";\n"
+      "\tstream_id = 0;\n"
+      "\tfields := struct {\n"
+      "\t\tuint64_t data;\n"
+      "\t};\n"
+      "};\n",
+      rtems_record_event_text( (rtems_record_event) event ),
+      event
+    );
+  }
+
+  return fclose( file ) == 0;
+}
+
+static FILE *ctf_stream( convert_context *ctx, uint32_t cpu )
+{
+  FILE     *file;
+  char      name[ 32 ];
+  uint32_t  header[ 3 ];
+
+  file = ctx->streams[ cpu ];
+
+  if ( file != NULL ) {
+    return file;
+  }
+
+  snprintf( name, sizeof( name ), "stream_%" PRIu32, cpu );
+  file = ctf_open( ctx, name );
+
+  if ( file == NULL ) {
+    return NULL;
+  }
+
+  header[ 0 ] = CTF_MAGIC;
+  header[ 1 ] = 0;
+  header[ 2 ] = cpu;
+  (void) fwrite( header, sizeof( header ), 1, file );
+  ctx->streams[ cpu ] = file;
+
+  return file;
+}
+
+static rtems_record_client_status ctf_handler(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  convert_context *ctx;
+  FILE            *file;
+  char             buf[ 20 ];
+  uint32_t         id;
+  uint64_t         ns;
+
+  ctx = arg;
+  ++ctx->stats.items;
+  file = ctf_stream( ctx, cpu );
+
+  if ( file == NULL ) {
+    return RTEMS_RECORD_CLIENT_ERROR_OUTPUT;
+  }
+
+  id = event;
+  ns = rtems_record_client_bintime_to_nanoseconds( bt );
+  memcpy( &buf[ 0 ], &id, sizeof( id ) );
+  memcpy( &buf[ 4 ], &ns, sizeof( ns ) );
+  memcpy( &buf[ 12 ], &data, sizeof( data ) );
+
+  if ( fwrite( buf, sizeof( buf ), 1, file ) != 1 ) {
+    return RTEMS_RECORD_CLIENT_ERROR_OUTPUT;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static rtems_record_client_status ctf_convert(
+  convert_context *ctx,
+  const void      *stream,
+  size_t           size,
+  uint32_t         worker_count
+)
+{
+  rtems_record_client_status status;
+  uint32_t                   cpu;
+
+  if ( mkdir( ctx->output, S_IRWXU | S_IRWXG | S_IRWXO ) != 0 ) {
+    if ( errno != EEXIST ) {
+      return RTEMS_RECORD_CLIENT_ERROR_OUTPUT;
+    }
+  }
+
+  if ( !ctf_write_metadata( ctx ) ) {
+    return RTEMS_RECORD_CLIENT_ERROR_OUTPUT;
+  }
+
+  status = rtems_record_decode_parallel(
+    stream,
+    size,
+    worker_count,
+    ctf_handler,
+    ctx
+  );
+
+  for ( cpu = 0; cpu < CPU_MAX; ++cpu ) {
+    if ( ctx->streams[ cpu ] != NULL ) {
+      if (
+        fclose( ctx->streams[ cpu ] ) != 0
+          && status == RTEMS_RECORD_CLIENT_SUCCESS
+      ) {
+        status = RTEMS_RECORD_CLIENT_ERROR_OUTPUT;
+      }
+    }
+  }
+
+  return status;
+}
+
+rtems_record_client_status rtems_record_convert(
+  const void                      *stream,
+  size_t                           size,
+  uint32_t                         worker_count,
+  rtems_record_convert_format      format,
+  const char                      *output,
+  rtems_record_convert_statistics *stats
+)
+{
+  convert_context            *ctx;
+  rtems_record_client_status  status;
+  uint32_t                    cpu;
+
+  ctx = calloc( 1, sizeof( *ctx ) );
+
+  if ( ctx == NULL ) {
+    return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+  }
+
+  ctx->output = output;
+
+  switch ( format ) {
+    case RTEMS_RECORD_CONVERT_CHROME_JSON:
+      status = chrome_json_convert( ctx, stream, size, worker_count );
+      break;
+    case RTEMS_RECORD_CONVERT_CTF:
+      status = ctf_convert( ctx, stream, size, worker_count );
+      break;
+    default:
+      status = RTEMS_RECORD_CLIENT_ERROR_OUTPUT;
+      break;
+  }
+
+  for ( cpu = 0; cpu < CPU_MAX; ++cpu ) {
+    if ( ctx->cpu_seen[ cpu ] || ctx->streams[ cpu ] != NULL ) {
+      ctx->stats.processors = cpu + 1;
+    }
+  }
+
+  if ( stats != NULL ) {
+    *stats = ctx->stats;
+  }
+
+  free( ctx->threads );
+  free( ctx );
+
+  return status;
+}
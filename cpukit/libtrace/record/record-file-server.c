@@ -0,0 +1,493 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordserver.h>
+#include <rtems/record.h>
+
+#include <sys/uio.h>
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef RTEMS_SMP
+#define CHUNKS (3 * CPU_MAXIMUM_PROCESSORS)
+#else
+#define CHUNKS 4
+#endif
+
+#define WAKEUP_EVENT RTEMS_EVENT_0
+
+#define STOP_EVENT RTEMS_EVENT_1
+
+#define STOPPED_EVENT RTEMS_EVENT_2
+
+typedef struct {
+  int           available;
+  struct iovec *current;
+  uint64_t      items_lost;
+  bool          begin[ CHUNKS ];
+  struct iovec  iov[ CHUNKS ];
+} file_server_drain_context;
+
+/*
+ * The task writes through the file system, for example to a FAT file system
+ * on a block device.  It writes the thread names from an item buffer on its
+ * stack.
+ */
+#define STACK_SIZE \
+  ( RTEMS_MINIMUM_STACK_SIZE + 8192 + sizeof( file_server_drain_context ) )
+
+#define END_MARKER_SIZE ( 2 * sizeof( rtems_record_item ) )
+
+static bool is_header( const rtems_record_item *items, size_t count )
+{
+  uint32_t cpu_index;
+
+  if (
+    count != 3
+      || RTEMS_RECORD_GET_EVENT( items[ 0 ].event ) != RTEMS_RECORD_PROCESSOR
+  ) {
+    return false;
+  }
+
+  cpu_index = (uint32_t) items[ 0 ].data;
+
+  return cpu_index < rtems_configuration_get_maximum_processors()
+    && items == _Per_CPU_Get_by_index( cpu_index )->record->Header;
+}
+
+static void file_server_drain_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  file_server_drain_context *ctx;
+  bool                       begin;
+  size_t                     i;
+
+  ctx = arg;
+  begin = is_header( items, count );
+
+  if ( begin ) {
+    const Record_Control *control;
+    unsigned int          tail;
+    unsigned int          head;
+
+    control = _Per_CPU_Get_by_index( (uint32_t) items[ 0 ].data )->record;
+    tail = (unsigned int) items[ 1 ].data;
+    head = (unsigned int) items[ 2 ].data;
+
+    if ( _Record_Is_overflow( control, tail, head ) ) {
+      ctx->items_lost += head - tail - control->mask;
+    }
+  }
+
+  if ( ctx->available > 0 ) {
+    i = (size_t) ( ctx->current - &ctx->iov[ 0 ] );
+    ctx->begin[ i ] = begin;
+    ctx->current->iov_base = RTEMS_DECONST( rtems_record_item *, items );
+    ctx->current->iov_len = count * sizeof( *items );
+    --ctx->available;
+    ++ctx->current;
+  }
+}
+
+static void file_server_account(
+  rtems_record_file_server *server,
+  ssize_t                   n,
+  size_t                    size
+)
+{
+  rtems_mutex_lock( &server->mutex );
+
+  if ( n < 0 ) {
+    ++server->stats.write_errors;
+    server->stats.bytes_dropped += size;
+  } else {
+    server->offset += n;
+    server->stats.bytes_written += (uint64_t) n;
+
+    if ( (size_t) n < size ) {
+      ++server->stats.write_errors;
+      server->stats.bytes_dropped += size - (size_t) n;
+    }
+  }
+
+  rtems_mutex_unlock( &server->mutex );
+}
+
+static bool file_server_open( rtems_record_file_server *server )
+{
+  int fd;
+
+  if ( server->config.file_count > 0 ) {
+    fd = open(
+      server->file_name,
+      O_WRONLY | O_CREAT | O_TRUNC,
+      S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH
+    );
+  } else {
+    fd = open( server->file_name, O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR );
+  }
+
+  server->fd = fd;
+  server->offset = 0;
+
+  return fd >= 0;
+}
+
+static bool file_server_set_name(
+  rtems_record_file_server *server,
+  uint32_t                  file_index
+)
+{
+  int n;
+
+  if ( server->config.file_count > 0 ) {
+    n = snprintf(
+      server->file_name,
+      sizeof( server->file_name ),
+      "%s.%" PRIu32,
+      server->config.path,
+      file_index
+    );
+  } else {
+    n = snprintf(
+      server->file_name,
+      sizeof( server->file_name ),
+      "%s",
+      server->config.path
+    );
+  }
+
+  server->stats.file_index = file_index;
+
+  return n >= 0 && (size_t) n < sizeof( server->file_name );
+}
+
+static void file_server_begin( rtems_record_file_server *server )
+{
+  Record_Stream_header header;
+  size_t               size;
+  ssize_t              n;
+
+  size = _Record_Stream_header_initialize( &header );
+  n = write( server->fd, &header, size );
+  file_server_account( server, n, size );
+
+  n = _Record_Write_thread_names( server->fd );
+  file_server_account( server, n, n < 0 ? 0 : (size_t) n );
+}
+
+static void file_server_rotate( rtems_record_file_server *server )
+{
+  rtems_mutex_lock( &server->mutex );
+  ++server->stats.rotations;
+  rtems_mutex_unlock( &server->mutex );
+
+  if ( server->config.file_count > 0 ) {
+    uint32_t file_index;
+
+    (void) close( server->fd );
+    file_index = server->stats.file_index + 1;
+
+    if ( file_index >= server->config.file_count ) {
+      file_index = 0;
+    }
+
+    (void) file_server_set_name( server, file_index );
+
+    if ( !file_server_open( server ) ) {
+      return;
+    }
+  } else {
+    (void) lseek( server->fd, 0, SEEK_SET );
+    server->offset = 0;
+  }
+
+  file_server_begin( server );
+}
+
+/*
+ * In the ring buffer mode, the data of the previous round follows the data
+ * written since the last wrap-around.  Mark the end of the valid data.  The
+ * marker is overwritten by the next write.
+ */
+static void file_server_end( rtems_record_file_server *server )
+{
+  rtems_record_item marker[ 2 ];
+  ssize_t           n;
+
+  if ( server->config.file_count > 0 || server->fd < 0 ) {
+    return;
+  }
+
+  marker[ 0 ].event = RTEMS_RECORD_TIME_EVENT( 0, RTEMS_RECORD_EMPTY );
+  marker[ 0 ].data = RTEMS_RECORD_MAGIC;
+  marker[ 1 ].event = RTEMS_RECORD_TIME_EVENT( 0, RTEMS_RECORD_EMPTY );
+  marker[ 1 ].data = server->stats.rotations;
+
+  n = write( server->fd, marker, sizeof( marker ) );
+
+  if ( n != (ssize_t) sizeof( marker ) ) {
+    rtems_mutex_lock( &server->mutex );
+    ++server->stats.write_errors;
+    rtems_mutex_unlock( &server->mutex );
+  }
+
+  (void) lseek( server->fd, server->offset, SEEK_SET );
+}
+
+static bool file_server_fits( rtems_record_file_server *server, size_t size )
+{
+  off_t end;
+
+  end = server->offset + (off_t) size;
+
+  if ( server->config.file_count == 0 ) {
+    end += (off_t) END_MARKER_SIZE;
+  }
+
+  return server->fd >= 0 && end <= server->config.file_size;
+}
+
+static void file_server_write(
+  rtems_record_file_server        *server,
+  const file_server_drain_context *ctx
+)
+{
+  size_t n;
+  size_t i;
+
+  n = CHUNKS - (size_t) ctx->available;
+  i = 0;
+
+  while ( i < n ) {
+    size_t  group_size;
+    size_t  j;
+    ssize_t m;
+
+    /*
+     * Write the items of one processor as a group, so that each file starts
+     * with a per-processor header and can be decoded on its own.
+     */
+    group_size = ctx->iov[ i ].iov_len;
+    j = i + 1;
+
+    while ( j < n && !ctx->begin[ j ] ) {
+      group_size += ctx->iov[ j ].iov_len;
+      ++j;
+    }
+
+    if ( !file_server_fits( server, group_size ) ) {
+      file_server_rotate( server );
+    }
+
+    if ( server->fd >= 0 && file_server_fits( server, group_size ) ) {
+      m = writev( server->fd, &ctx->iov[ i ], (int) ( j - i ) );
+    } else {
+      m = -1;
+    }
+
+    file_server_account( server, m, group_size );
+    i = j;
+  }
+
+  if ( n > 0 ) {
+    file_server_end( server );
+  }
+}
+
+static void file_server_drain( rtems_record_file_server *server )
+{
+  file_server_drain_context ctx;
+
+  ctx.available = CHUNKS;
+  ctx.current = &ctx.iov[ 0 ];
+  ctx.items_lost = 0;
+  rtems_record_drain( file_server_drain_visitor, &ctx );
+
+  if ( ctx.items_lost > 0 ) {
+    rtems_mutex_lock( &server->mutex );
+    server->stats.items_lost += ctx.items_lost;
+    rtems_mutex_unlock( &server->mutex );
+  }
+
+  file_server_write( server, &ctx );
+}
+
+static void file_server_wakeup_timer( rtems_id timer, void *arg )
+{
+  rtems_record_file_server *server;
+
+  server = arg;
+  (void) rtems_event_send( server->task, WAKEUP_EVENT );
+  (void) rtems_timer_reset( timer );
+}
+
+static void file_server_task( rtems_task_argument arg )
+{
+  rtems_record_file_server *server;
+
+  server = (rtems_record_file_server *) arg;
+
+  while ( true ) {
+    rtems_event_set events;
+
+    (void) rtems_event_receive(
+      WAKEUP_EVENT | STOP_EVENT,
+      RTEMS_EVENT_ANY | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+
+    file_server_drain( server );
+
+    if ( ( events & STOP_EVENT ) != 0 ) {
+      break;
+    }
+  }
+
+  (void) rtems_timer_delete( server->timer );
+
+  if ( server->fd >= 0 ) {
+    (void) close( server->fd );
+    server->fd = -1;
+  }
+
+  (void) rtems_event_send( server->caller, STOPPED_EVENT );
+  rtems_task_exit();
+}
+
+rtems_status_code rtems_record_start_file_server(
+  rtems_record_file_server              *server,
+  const rtems_record_file_server_config *config
+)
+{
+  rtems_status_code    sc;
+  Record_Stream_header header;
+  off_t                ring_size;
+  off_t                header_size;
+
+  if ( server == NULL || config == NULL || config->path == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  ring_size = (off_t) sizeof( Record_Control )
+    + (off_t) sizeof( rtems_record_item ) * _Record_Configuration.item_count;
+  header_size = (off_t) _Record_Stream_header_initialize( &header )
+    + (off_t) END_MARKER_SIZE;
+
+  if ( config->file_size < header_size + 4 * ring_size ) {
+    return RTEMS_INVALID_SIZE;
+  }
+
+  memset( server, 0, sizeof( *server ) );
+  server->config = *config;
+  server->fd = -1;
+  rtems_mutex_init( &server->mutex, "Record File Server" );
+
+  if ( !file_server_set_name( server, 0 ) ) {
+    return RTEMS_INVALID_NAME;
+  }
+
+  if ( !file_server_open( server ) ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  file_server_begin( server );
+  file_server_end( server );
+
+  sc = rtems_timer_create(
+    rtems_build_name( 'R', 'C', 'R', 'F' ),
+    &server->timer
+  );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    (void) close( server->fd );
+    return sc;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name( 'R', 'C', 'R', 'F' ),
+    config->priority,
+    STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &server->task
+  );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    (void) rtems_timer_delete( server->timer );
+    (void) close( server->fd );
+    return sc;
+  }
+
+  (void) rtems_task_start(
+    server->task,
+    file_server_task,
+    (rtems_task_argument) server
+  );
+  (void) rtems_timer_fire_after(
+    server->timer,
+    config->period,
+    file_server_wakeup_timer,
+    server
+  );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_record_stop_file_server( rtems_record_file_server *server )
+{
+  rtems_event_set events;
+
+  server->caller = rtems_task_self();
+  (void) rtems_event_send( server->task, STOP_EVENT );
+  (void) rtems_event_receive(
+    STOPPED_EVENT,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+}
+
+void rtems_record_get_file_server_statistics(
+  rtems_record_file_server            *server,
+  rtems_record_file_server_statistics *stats
+)
+{
+  rtems_mutex_lock( &server->mutex );
+  *stats = server->stats;
+  rtems_mutex_unlock( &server->mutex );
+}
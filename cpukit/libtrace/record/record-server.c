@@ -31,65 +31,14 @@
 
 #include <rtems/recordserver.h>
 #include <rtems/record.h>
-#include <rtems/score/threadimpl.h>
 
 #include <sys/socket.h>
-#include <sys/uio.h>
 
 #include <string.h>
 #include <unistd.h>
 
 #include <netinet/in.h>
 
-#ifdef RTEMS_SMP
-#define CHUNKS (3 * CPU_MAXIMUM_PROCESSORS)
-#else
-#define CHUNKS 4
-#endif
-
-typedef struct {
-  int           available;
-  struct iovec *current;
-  struct iovec  iov[CHUNKS];
-} writev_visitor_context;
-
-static void writev_visitor(
-  const rtems_record_item *items,
-  size_t                   count,
-  void                    *arg
-)
-{
-  writev_visitor_context *ctx;
-
-  ctx = arg;
-
-  if ( ctx->available > 0 ) {
-    ctx->current->iov_base = RTEMS_DECONST( rtems_record_item *, items );
-    ctx->current->iov_len = count * sizeof( *items );
-    --ctx->available;
-    ++ctx->current;
-  }
-}
-
-ssize_t rtems_record_writev( int fd, bool *written )
-{
-  writev_visitor_context ctx;
-  int n;
-
-  ctx.available = CHUNKS;
-  ctx.current = &ctx.iov[ 0 ];
-  rtems_record_drain( writev_visitor, &ctx );
-  n = CHUNKS - ctx.available;
-
-  if ( n > 0 ) {
-    *written = true;
-    return writev( fd, &ctx.iov[ 0 ], n );
-  } else {
-    *written = false;
-    return 0;
-  }
-}
-
 #define WAKEUP_EVENT RTEMS_EVENT_0
 
 static void wakeup( rtems_id task )
@@ -118,86 +67,6 @@ static void wakeup_timer( rtems_id timer, void *arg )
   (void) rtems_timer_reset( timer );
 }
 
-static void send_header( int fd )
-{
-  Record_Stream_header header;
-  size_t               size;
-
-  size = _Record_Stream_header_initialize( &header );
-  (void) write( fd, &header, size );
-}
-
-typedef struct {
-  int fd;
-  size_t index;
-  rtems_record_item items[ 128 ];
-} thread_names_context;
-
-static void thread_names_produce(
-  thread_names_context *ctx,
-  rtems_record_event    event,
-  rtems_record_data     data
-)
-{
-  size_t i;
-
-  i = ctx->index;
-  ctx->items[ i ].event = RTEMS_RECORD_TIME_EVENT( 0, event );
-  ctx->items[ i ].data = data;
-
-  if (i == RTEMS_ARRAY_SIZE(ctx->items) - 1) {
-    ctx->index = 0;
-    (void) write( ctx->fd, ctx->items, sizeof( ctx->items ) );
-  } else {
-    ctx->index = i + 1;
-  }
-}
-
-static bool thread_names_visitor( rtems_tcb *tcb, void *arg )
-{
-  thread_names_context *ctx;
-  char                  name[ 2 * THREAD_DEFAULT_MAXIMUM_NAME_SIZE ];
-  size_t                n;
-  size_t                i;
-  rtems_record_data     data;
-
-  ctx = arg;
-  thread_names_produce( ctx, RTEMS_RECORD_THREAD_ID, tcb->Object.id );
-  n = _Thread_Get_name( tcb, name, sizeof( name ) );
-  i = 0;
-
-  while ( i < n ) {
-    size_t j;
-
-    data = 0;
-
-    for ( j = 0; i < n && j < sizeof( data ); ++j ) {
-      rtems_record_data c;
-
-      c = (unsigned char) name[ i ];
-      data |= c << ( j * 8 );
-      ++i;
-    }
-
-    thread_names_produce( ctx, RTEMS_RECORD_THREAD_NAME, data );
-  }
-
-  return false;
-}
-
-static void send_thread_names( int fd )
-{
-  thread_names_context ctx;
-
-  ctx.fd = fd;
-  ctx.index = 0;
-  rtems_task_iterate( thread_names_visitor, &ctx );
-
-  if ( ctx.index > 0 ) {
-    (void) write( ctx.fd, ctx.items, ctx.index * sizeof( ctx.items[ 0 ] ) );
-  }
-}
-
 void rtems_record_server( uint16_t port, rtems_interval period )
 {
   rtems_status_code sc;
@@ -248,8 +117,8 @@ void rtems_record_server( uint16_t port, rtems_interval period )
 
     wait( RTEMS_NO_WAIT );
     (void) rtems_timer_fire_after( timer, period, wakeup_timer, &self );
-    send_header( cd );
-    send_thread_names( cd );
+    (void) _Record_Write_header( cd );
+    (void) _Record_Write_thread_names( cd );
 
     while ( true ) {
       n = rtems_record_writev( cd, &written );
@@ -36,7 +36,11 @@
 #include <sys/endian.h>
 #include <string.h>
 
-size_t _Record_Stream_header_initialize( Record_Stream_header *header )
+size_t _Record_Stream_header_prepare(
+  Record_Stream_header *header,
+  uint32_t              item_count,
+  uint32_t              frequency
+)
 {
   rtems_record_item *items;
   size_t             available;
@@ -73,11 +77,11 @@ size_t _Record_Stream_header_initialize( Record_Stream_header *header )
   header->Processor_maximum.data = rtems_scheduler_get_processor_maximum() - 1;
 
   header->Count.event = RTEMS_RECORD_TIME_EVENT( 0, RTEMS_RECORD_PER_CPU_COUNT );
-  header->Count.data = _Record_Configuration.item_count;
+  header->Count.data = item_count;
 
   header->Frequency.event =
     RTEMS_RECORD_TIME_EVENT( 0, RTEMS_RECORD_FREQUENCY );
-  header->Frequency.data = rtems_counter_frequency();
+  header->Frequency.data = frequency;
 
   items = header->Info;
   available = RTEMS_ARRAY_SIZE( header->Info );
@@ -43,6 +43,10 @@ bool _Record_Thread_create(
   size_t            len;
   size_t            used;
 
+  if ( !_Record_Is_class_enabled( RTEMS_RECORD_CLASS_THREAD ) ) {
+    return true;
+  }
+
   items[ 0 ].event = RTEMS_RECORD_THREAD_CREATE;
   items[ 0 ].data = created->Object.id;
 
@@ -54,7 +58,7 @@ bool _Record_Thread_create(
     &items[ 1 ],
     RTEMS_ARRAY_SIZE( items ) - 1
   );
-  rtems_record_produce_n( items, used + 1 );
+  _Record_Produce_n( items, used + 1 );
 
   return true;
 }
@@ -99,6 +103,10 @@ void _Record_Thread_switch(
 {
   rtems_record_item items[ 3 ];
 
+  if ( !_Record_Is_class_enabled( RTEMS_RECORD_CLASS_THREAD ) ) {
+    return;
+  }
+
   items[ 0 ].event = RTEMS_RECORD_THREAD_SWITCH_OUT;
   items[ 0 ].data = executing->Object.id;
   items[ 1 ].event = RTEMS_RECORD_THREAD_STACK_CURRENT;
@@ -111,7 +119,7 @@ void _Record_Thread_switch(
 #endif
   items[ 2 ].event = RTEMS_RECORD_THREAD_SWITCH_IN;
   items[ 2 ].data = heir->Object.id;
-  rtems_record_produce_n( items, RTEMS_ARRAY_SIZE( items ) );
+  _Record_Produce_n( items, RTEMS_ARRAY_SIZE( items ) );
 }
 
 void _Record_Thread_begin( struct _Thread_Control *executing )
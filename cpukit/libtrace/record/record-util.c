@@ -1218,6 +1218,11 @@ uint32_t rtems_record_interrupt_disable( void )
   rtems_record_context context;
 
   _CPU_ISR_Disable( level );
+
+  if ( !rtems_record_is_event_enabled( RTEMS_RECORD_ISR_DISABLE ) ) {
+    return level;
+  }
+
   rtems_record_prepare_critical( &context, _Per_CPU_Get() );
   rtems_record_add(
     &context,
@@ -1233,6 +1238,11 @@ void rtems_record_interrupt_enable( uint32_t level )
 {
   rtems_record_context context;
 
+  if ( !rtems_record_is_event_enabled( RTEMS_RECORD_ISR_ENABLE ) ) {
+    _CPU_ISR_Enable( level );
+    return;
+  }
+
   rtems_record_prepare_critical( &context, _Per_CPU_Get() );
   rtems_record_add(
     &context,
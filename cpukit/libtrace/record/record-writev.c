@@ -0,0 +1,184 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2018, 2019 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordserver.h>
+#include <rtems/record.h>
+#include <rtems/score/threadimpl.h>
+
+#include <sys/uio.h>
+
+#include <unistd.h>
+
+#ifdef RTEMS_SMP
+#define CHUNKS (3 * CPU_MAXIMUM_PROCESSORS)
+#else
+#define CHUNKS 4
+#endif
+
+typedef struct {
+  int           available;
+  struct iovec *current;
+  struct iovec  iov[CHUNKS];
+} writev_visitor_context;
+
+static void writev_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  writev_visitor_context *ctx;
+
+  ctx = arg;
+
+  if ( ctx->available > 0 ) {
+    ctx->current->iov_base = RTEMS_DECONST( rtems_record_item *, items );
+    ctx->current->iov_len = count * sizeof( *items );
+    --ctx->available;
+    ++ctx->current;
+  }
+}
+
+ssize_t rtems_record_writev( int fd, bool *written )
+{
+  writev_visitor_context ctx;
+  int n;
+
+  ctx.available = CHUNKS;
+  ctx.current = &ctx.iov[ 0 ];
+  rtems_record_drain( writev_visitor, &ctx );
+  n = CHUNKS - ctx.available;
+
+  if ( n > 0 ) {
+    *written = true;
+    return writev( fd, &ctx.iov[ 0 ], n );
+  } else {
+    *written = false;
+    return 0;
+  }
+}
+
+ssize_t _Record_Write_header( int fd )
+{
+  Record_Stream_header header;
+  size_t               size;
+
+  size = _Record_Stream_header_initialize( &header );
+  return write( fd, &header, size );
+}
+
+typedef struct {
+  int fd;
+  size_t index;
+  ssize_t total;
+  rtems_record_item items[ 128 ];
+} thread_names_context;
+
+static void thread_names_write( thread_names_context *ctx, size_t n )
+{
+  ssize_t m;
+
+  m = write( ctx->fd, ctx->items, n * sizeof( ctx->items[ 0 ] ) );
+
+  if ( m < 0 || ctx->total < 0 ) {
+    ctx->total = -1;
+  } else {
+    ctx->total += m;
+  }
+}
+
+static void thread_names_produce(
+  thread_names_context *ctx,
+  rtems_record_event    event,
+  rtems_record_data     data
+)
+{
+  size_t i;
+
+  i = ctx->index;
+  ctx->items[ i ].event = RTEMS_RECORD_TIME_EVENT( 0, event );
+  ctx->items[ i ].data = data;
+
+  if (i == RTEMS_ARRAY_SIZE(ctx->items) - 1) {
+    ctx->index = 0;
+    thread_names_write( ctx, RTEMS_ARRAY_SIZE( ctx->items ) );
+  } else {
+    ctx->index = i + 1;
+  }
+}
+
+static bool thread_names_visitor( rtems_tcb *tcb, void *arg )
+{
+  thread_names_context *ctx;
+  char                  name[ 2 * THREAD_DEFAULT_MAXIMUM_NAME_SIZE ];
+  size_t                n;
+  size_t                i;
+  rtems_record_data     data;
+
+  ctx = arg;
+  thread_names_produce( ctx, RTEMS_RECORD_THREAD_ID, tcb->Object.id );
+  n = _Thread_Get_name( tcb, name, sizeof( name ) );
+  i = 0;
+
+  while ( i < n ) {
+    size_t j;
+
+    data = 0;
+
+    for ( j = 0; i < n && j < sizeof( data ); ++j ) {
+      rtems_record_data c;
+
+      c = (unsigned char) name[ i ];
+      data |= c << ( j * 8 );
+      ++i;
+    }
+
+    thread_names_produce( ctx, RTEMS_RECORD_THREAD_NAME, data );
+  }
+
+  return false;
+}
+
+ssize_t _Record_Write_thread_names( int fd )
+{
+  thread_names_context ctx;
+
+  ctx.fd = fd;
+  ctx.index = 0;
+  ctx.total = 0;
+  rtems_task_iterate( thread_names_visitor, &ctx );
+
+  if ( ctx.index > 0 ) {
+    thread_names_write( &ctx, ctx.index );
+  }
+
+  return ctx.total;
+}
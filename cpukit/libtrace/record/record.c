@@ -44,10 +44,28 @@ RTEMS_STATIC_ASSERT(
   RTEMS_RECORD_EVENT_BITS
 );
 
+#define RECORD_FILTER_ALL UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX
+
+uint32_t _Record_Event_classes = RTEMS_RECORD_CLASS_ALL;
+
+uint32_t _Record_Event_filter[ ( RTEMS_RECORD_LAST + 1 ) / 32 ] = {
+  RECORD_FILTER_ALL, RECORD_FILTER_ALL, RECORD_FILTER_ALL, RECORD_FILTER_ALL,
+  RECORD_FILTER_ALL, RECORD_FILTER_ALL, RECORD_FILTER_ALL, RECORD_FILTER_ALL
+};
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_ARRAY_SIZE( _Record_Event_filter ) == 32,
+  _Record_Event_filter
+);
+
 void rtems_record_produce( rtems_record_event event, rtems_record_data data )
 {
   rtems_record_context context;
 
+  if ( !rtems_record_is_event_enabled( event ) ) {
+    return;
+  }
+
   rtems_record_prepare( &context );
   rtems_record_add( &context, event, data );
   rtems_record_commit( &context );
@@ -62,16 +80,17 @@ void rtems_record_produce_2(
 {
   rtems_record_context context;
 
+  if ( !rtems_record_is_event_enabled( event_0 ) ) {
+    return;
+  }
+
   rtems_record_prepare( &context );
   rtems_record_add( &context, event_0, data_0 );
   rtems_record_add( &context, event_1, data_1 );
   rtems_record_commit( &context );
 }
 
-void rtems_record_produce_n(
-  const rtems_record_item *items,
-  size_t                   n
-)
+void _Record_Produce_n( const rtems_record_item *items, size_t n )
 {
   rtems_record_context context;
 
@@ -88,6 +107,20 @@ void rtems_record_produce_n(
   rtems_record_commit( &context );
 }
 
+void rtems_record_produce_n(
+  const rtems_record_item *items,
+  size_t                   n
+)
+{
+  _Assert( n > 0 );
+
+  if ( !rtems_record_is_event_enabled( items->event ) ) {
+    return;
+  }
+
+  _Record_Produce_n( items, n );
+}
+
 size_t _Record_String_to_items(
   rtems_record_event  event,
   const char         *str,
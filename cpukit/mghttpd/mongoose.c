@@ -24,11 +24,15 @@
 
 #if defined(__rtems__)
 #include <md5.h>
+#include <rtems/score/cpuopts.h>
 #define HAVE_MD5
 #define NO_CGI
 #define NO_POPEN
 #define NO_SSL
 #define USE_WEBSOCKET
+#if defined(RTEMS_MGHTTPD_ZLIB)
+#define USE_ZLIB
+#endif
 #endif // __rtems__
 
 #if defined(_WIN32)
@@ -87,6 +91,10 @@
 #include <rtems/libio_.h>
 #endif
 
+#if defined(USE_ZLIB)
+#include <zlib.h>
+#endif
+
 #if defined(_WIN32) && !defined(__SYMBIAN32__) // Windows specific
 #undef _WIN32_WINNT
 #define _WIN32_WINNT 0x0400 // To make it link in VS2005
@@ -457,6 +465,25 @@ struct file {
 };
 #define STRUCT_FILE_INITIALIZER {0, 0, 0, NULL, NULL, 0}
 
+// Static file kept in memory by the file cache. The cache holds one
+// reference, each request served from the entry holds another one.
+struct cached_file {
+  struct cached_file *next;      // Next entry in the hash chain
+  struct cached_file *lru_prev;  // More recently used entry
+  struct cached_file *lru_next;  // Less recently used entry
+  int refs;                      // Number of references to the entry
+  unsigned hash;                 // Hash of the path
+  char *path;                    // File system path
+  time_t modification_time;      // Modification time of the cached content
+  int64_t size;                  // Size of the cached content
+  char *data;                    // File content
+  char *gz_data;                 // Gzip encoded content, NULL if not smaller
+  int64_t gz_size;               // Size of the gzip encoded content
+  char etag[64];                 // Entity tag of the file content
+};
+
+#define FILE_CACHE_BUCKETS 256
+
 // Describes listening socket, or socket which was accept()-ed by the master
 // thread and queued for future handling by the worker thread.
 struct socket {
@@ -476,6 +503,8 @@ enum {
   EXTRA_MIME_TYPES, LISTENING_PORTS, DOCUMENT_ROOT, SSL_CERTIFICATE,
   NUM_THREADS, RUN_AS_USER, REWRITE, HIDE_FILES, REQUEST_TIMEOUT,
   THREAD_STACK_SIZE, THREAD_PRIORITY, THREAD_POLICY,
+  FILE_CACHE_SIZE, FILE_CACHE_MAX_FILE_SIZE, FILE_CACHE_GZIP_PATTERN,
+  ENABLE_EVENT_LOOP, MAX_IDLE_CONNECTIONS,
   NUM_OPTIONS
 };
 
@@ -508,6 +537,12 @@ static const char *config_options[] = {
   "thread_stack_size", NULL,
   "thread_priority", NULL,
   "thread_policy", NULL,
+  "file_cache_size", NULL,
+  "file_cache_max_file_size", "65536",
+  "file_cache_gzip_pattern",
+    "**.html$|**.htm$|**.css$|**.js$|**.json$|**.svg$|**.txt$|**.xml$",
+  "enable_event_loop", "no",
+  "max_idle_connections", "64",
   NULL
 };
 
@@ -530,6 +565,21 @@ struct mg_context {
   volatile int sq_tail;      // Tail of the socket queue
   pthread_cond_t sq_full;    // Signaled when socket is produced
   pthread_cond_t sq_empty;   // Signaled when socket is consumed
+
+  pthread_mutex_t file_cache_mutex;     // Protects the file cache
+  struct cached_file **file_cache;      // Hash table, NULL if disabled
+  struct cached_file *file_cache_head;  // Most recently used entry
+  struct cached_file *file_cache_tail;  // Least recently used entry
+  int64_t file_cache_used;              // Bytes of cached content
+  int64_t file_cache_size;              // Maximum bytes of cached content
+  int64_t file_cache_max_file_size;     // Maximum size of a cached file
+
+  int event_loop;                   // Idle connections wait in the master
+  struct idle_connection *idle;     // Idle keep-alive connections
+  struct socket *ready;             // Idle connections with a new request
+  int num_idle;                     // Number of idle connections
+  int max_idle;                     // Maximum number of idle connections
+  int wakeup[2];                    // Pipe to wake up the master
 };
 
 struct mg_connection {
@@ -554,6 +604,12 @@ struct mg_connection {
   int64_t last_throttle_bytes;// Bytes sent this second
 };
 
+// Keep-alive connection waiting in the event loop for its next request
+struct idle_connection {
+  struct socket client;
+  time_t since;
+};
+
 // Directory entry
 struct de {
   struct mg_connection *conn;
@@ -2983,7 +3039,8 @@ static void send_file_data(struct mg_connection *conn, struct file *filep,
     if (len > filep->size - offset) {
       len = filep->size - offset;
     }
-    mg_write(conn, filep->membuf + offset, (size_t) len);
+    conn->num_bytes_sent += mg_write(conn, filep->membuf + offset,
+                                     (size_t) len);
   } else if (len > 0 && filep->fp != NULL) {
     fseeko(filep->fp, offset, SEEK_SET);
     while (len > 0) {
@@ -3018,6 +3075,12 @@ static void gmt_time_string(char *buf, size_t buf_len, time_t *t) {
   strftime(buf, buf_len, "%a, %d %b %Y %H:%M:%S GMT", gmtime(t));
 }
 
+static void construct_default_etag(char *buf, size_t buf_len,
+                                   time_t modification_time, int64_t size) {
+  snprintf(buf, buf_len, "\"%lx.%" INT64_FMT "\"",
+           (unsigned long) modification_time, size);
+}
+
 static void construct_etag(const struct mg_connection *conn, const char *path,
                            char *buf, size_t buf_len,
                            const struct file *filep) {
@@ -3025,8 +3088,266 @@ static void construct_etag(const struct mg_connection *conn, const char *path,
       conn->ctx->callbacks.http_etag(conn, path, buf, buf_len)) {
   }
   else {
-    snprintf(buf, buf_len, "\"%lx.%" INT64_FMT "\"",
-             (unsigned long) filep->modification_time, filep->size);
+    construct_default_etag(buf, buf_len, filep->modification_time,
+                           filep->size);
+  }
+}
+
+// The gzip encoded variant of a file gets its own entity tag, since it is
+// a different representation of the file.
+static void construct_gzip_etag(char *buf, size_t buf_len, const char *etag) {
+  size_t len = strlen(etag);
+
+  if (len > 0 && etag[len - 1] == '"') {
+    snprintf(buf, buf_len, "%.*s-gz\"", (int) len - 1, etag);
+  } else {
+    snprintf(buf, buf_len, "%s-gz", etag);
+  }
+}
+
+static unsigned hash_path(const char *path) {
+  unsigned hash = 2166136261U;
+
+  while (*path != '\0') {
+    hash = (hash ^ (unsigned char) *path++) * 16777619U;
+  }
+
+  return hash;
+}
+
+static void free_cached_file(struct cached_file *cf) {
+  free(cf->gz_data);
+  free(cf->data);
+  free(cf->path);
+  free(cf);
+}
+
+// Drop a reference to the entry. Called with the cache mutex locked.
+static void put_cached_file(struct cached_file *cf) {
+  if (--cf->refs == 0) {
+    free_cached_file(cf);
+  }
+}
+
+static void release_cached_file(struct mg_context *ctx,
+                                struct cached_file *cf) {
+  (void) pthread_mutex_lock(&ctx->file_cache_mutex);
+  put_cached_file(cf);
+  (void) pthread_mutex_unlock(&ctx->file_cache_mutex);
+}
+
+static void lru_remove(struct mg_context *ctx, struct cached_file *cf) {
+  if (cf->lru_prev != NULL) {
+    cf->lru_prev->lru_next = cf->lru_next;
+  } else {
+    ctx->file_cache_head = cf->lru_next;
+  }
+  if (cf->lru_next != NULL) {
+    cf->lru_next->lru_prev = cf->lru_prev;
+  } else {
+    ctx->file_cache_tail = cf->lru_prev;
+  }
+}
+
+static void lru_push(struct mg_context *ctx, struct cached_file *cf) {
+  cf->lru_prev = NULL;
+  cf->lru_next = ctx->file_cache_head;
+  if (ctx->file_cache_head != NULL) {
+    ctx->file_cache_head->lru_prev = cf;
+  } else {
+    ctx->file_cache_tail = cf;
+  }
+  ctx->file_cache_head = cf;
+}
+
+// Remove the entry from the cache. Requests still being served from it
+// keep it alive. Called with the cache mutex locked.
+static void remove_cached_file(struct mg_context *ctx,
+                               struct cached_file *cf) {
+  struct cached_file **pp = &ctx->file_cache[cf->hash % FILE_CACHE_BUCKETS];
+
+  while (*pp != cf) {
+    pp = &(*pp)->next;
+  }
+  *pp = cf->next;
+  lru_remove(ctx, cf);
+  ctx->file_cache_used -= cf->size + cf->gz_size;
+  put_cached_file(cf);
+}
+
+// Look up a valid entry and take a reference to it. A stale entry is
+// removed. Called with the cache mutex locked.
+static struct cached_file *lookup_cached_file(struct mg_context *ctx,
+                                              const char *path,
+                                              unsigned hash,
+                                              const struct file *filep) {
+  struct cached_file *cf = ctx->file_cache[hash % FILE_CACHE_BUCKETS];
+
+  while (cf != NULL && (cf->hash != hash || strcmp(cf->path, path) != 0)) {
+    cf = cf->next;
+  }
+
+  if (cf != NULL) {
+    if (cf->modification_time != filep->modification_time ||
+        cf->size != filep->size) {
+      remove_cached_file(ctx, cf);
+      cf = NULL;
+    } else {
+      lru_remove(ctx, cf);
+      lru_push(ctx, cf);
+      ++cf->refs;
+    }
+  }
+
+  return cf;
+}
+
+#if defined(USE_ZLIB)
+static void gzip_cached_file(struct cached_file *cf) {
+  z_stream zs;
+  uLong bound;
+
+  memset(&zs, 0, sizeof(zs));
+  if (deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    return;
+  }
+
+  bound = deflateBound(&zs, (uLong) cf->size);
+  if ((cf->gz_data = (char *) malloc(bound)) != NULL) {
+    zs.next_in = (Bytef *) cf->data;
+    zs.avail_in = (uInt) cf->size;
+    zs.next_out = (Bytef *) cf->gz_data;
+    zs.avail_out = (uInt) bound;
+    if (deflate(&zs, Z_FINISH) == Z_STREAM_END &&
+        (int64_t) zs.total_out < cf->size) {
+      cf->gz_size = (int64_t) zs.total_out;
+    } else {
+      free(cf->gz_data);
+      cf->gz_data = NULL;
+    }
+  }
+
+  (void) deflateEnd(&zs);
+}
+#endif // USE_ZLIB
+
+static struct cached_file *load_cached_file(struct mg_connection *conn,
+                                            const char *path, unsigned hash,
+                                            const struct file *filep) {
+  struct cached_file *cf;
+#if defined(USE_ZLIB)
+  const char *pattern;
+#endif
+  FILE *fp;
+  size_t n;
+
+  if ((cf = (struct cached_file *) calloc(1, sizeof(*cf))) == NULL) {
+    return NULL;
+  }
+
+  cf->hash = hash;
+  cf->modification_time = filep->modification_time;
+  cf->size = filep->size;
+  cf->path = mg_strdup(path);
+  cf->data = (char *) malloc((size_t) cf->size + 1);
+  if (cf->path == NULL || cf->data == NULL ||
+      (fp = fopen(path, "rb")) == NULL) {
+    free_cached_file(cf);
+    return NULL;
+  }
+
+  // The file changed since it was stat()-ed if the size does not match
+  n = fread(cf->data, 1, (size_t) cf->size + 1, fp);
+  fclose(fp);
+  if ((int64_t) n != cf->size) {
+    free_cached_file(cf);
+    return NULL;
+  }
+
+  construct_default_etag(cf->etag, sizeof(cf->etag), cf->modification_time,
+                         cf->size);
+
+#if defined(USE_ZLIB)
+  pattern = conn->ctx->config[FILE_CACHE_GZIP_PATTERN];
+  if (cf->size > 0 && pattern != NULL &&
+      match_prefix(pattern, strlen(pattern), path) > 0) {
+    gzip_cached_file(cf);
+  }
+#else
+  (void) conn;
+#endif
+
+  return cf;
+}
+
+// Return a referenced cache entry for the file, or NULL if the file must be
+// read from the file system.
+static struct cached_file *get_cached_file(struct mg_connection *conn,
+                                           const char *path,
+                                           const struct file *filep) {
+  struct mg_context *ctx = conn->ctx;
+  struct cached_file *cf, *other;
+  unsigned hash;
+
+  if (ctx->file_cache == NULL || filep->membuf != NULL ||
+      filep->size > ctx->file_cache_max_file_size ||
+      filep->size > ctx->file_cache_size) {
+    return NULL;
+  }
+
+  hash = hash_path(path);
+  (void) pthread_mutex_lock(&ctx->file_cache_mutex);
+  cf = lookup_cached_file(ctx, path, hash, filep);
+  (void) pthread_mutex_unlock(&ctx->file_cache_mutex);
+  if (cf != NULL) {
+    return cf;
+  }
+
+  // Read the file without holding the lock
+  if ((cf = load_cached_file(conn, path, hash, filep)) == NULL) {
+    return NULL;
+  }
+
+  (void) pthread_mutex_lock(&ctx->file_cache_mutex);
+
+  // Another request may have cached the file meanwhile
+  if ((other = lookup_cached_file(ctx, path, hash, filep)) != NULL) {
+    (void) pthread_mutex_unlock(&ctx->file_cache_mutex);
+    free_cached_file(cf);
+    return other;
+  }
+
+  while (ctx->file_cache_tail != NULL &&
+         ctx->file_cache_used + cf->size + cf->gz_size >
+         ctx->file_cache_size) {
+    remove_cached_file(ctx, ctx->file_cache_tail);
+  }
+
+  if (ctx->file_cache_used + cf->size + cf->gz_size <=
+      ctx->file_cache_size) {
+    cf->next = ctx->file_cache[hash % FILE_CACHE_BUCKETS];
+    ctx->file_cache[hash % FILE_CACHE_BUCKETS] = cf;
+    lru_push(ctx, cf);
+    ctx->file_cache_used += cf->size + cf->gz_size;
+    ++cf->refs;
+  }
+  ++cf->refs;
+
+  (void) pthread_mutex_unlock(&ctx->file_cache_mutex);
+  return cf;
+}
+
+static void free_file_cache(struct mg_context *ctx) {
+  struct cached_file *cf, *next;
+
+  if (ctx->file_cache != NULL) {
+    for (cf = ctx->file_cache_head; cf != NULL; cf = next) {
+      next = cf->lru_next;
+      free_cached_file(cf);
+    }
+    free(ctx->file_cache);
+    ctx->file_cache = NULL;
   }
 }
 
@@ -3048,6 +3369,8 @@ static void handle_file_request(struct mg_connection *conn, const char *path,
   int n;
   char gz_path[PATH_MAX + 3];
   char const* encoding = "";
+  struct cached_file *cf;
+  int use_gz = 0;
 
   get_mime_type(conn->ctx, path, &mime_vec);
   cl = filep->size;
@@ -3063,14 +3386,18 @@ static void handle_file_request(struct mg_connection *conn, const char *path,
     encoding = "Content-Encoding: gzip\r\n";
   }
 
-  if (!mg_fopen(conn, path, "rb", filep)) {
+  // Serve a cached file from memory, the file system is only read if
+  // the file is not cached or changed since it was cached
+  if ((cf = get_cached_file(conn, path, filep)) != NULL) {
+    filep->membuf = cf->data;
+  } else if (!mg_fopen(conn, path, "rb", filep)) {
     send_http_error(conn, 500, http_500_error,
                     "fopen(%s): %s", path, strerror(ERRNO));
     return;
+  } else {
+    fclose_on_exec(filep);
   }
 
-  fclose_on_exec(filep);
-
   // If Range: header specified, act accordingly
   r1 = r2 = 0;
   hdr = mg_get_header(conn, "Range");
@@ -3080,6 +3407,9 @@ static void handle_file_request(struct mg_connection *conn, const char *path,
     // file (since the range is specified in the uncmpressed space)
     if (filep->gzipped) {
       send_http_error(conn, 501, "Not Implemented", "range requests in gzipped files are not supported");
+      if (cf != NULL) {
+        release_cached_file(conn->ctx, cf);
+      }
       return;
     }
     conn->status_code = 206;
@@ -3090,13 +3420,36 @@ static void handle_file_request(struct mg_connection *conn, const char *path,
                 INT64_FMT "/%" INT64_FMT "\r\n",
                 r1, r1 + cl - 1, filep->size);
     msg = "Partial Content";
+  } else if (cf != NULL && cf->gz_data != NULL && !filep->gzipped) {
+    // Send the gzip encoded variant of a cached file if the client
+    // accepts it
+    hdr = mg_get_header(conn, "Accept-Encoding");
+    if (hdr != NULL && strstr(hdr, "gzip") != NULL) {
+      use_gz = 1;
+      cl = cf->gz_size;
+      encoding = "Content-Encoding: gzip\r\nVary: Accept-Encoding\r\n";
+    } else {
+      encoding = "Vary: Accept-Encoding\r\n";
+    }
   }
 
   // Prepare Etag, Date, Last-Modified headers. Must be in UTC, according to
   // http://www.w3.org/Protocols/rfc2616/rfc2616-sec3.html#sec3.3
   gmt_time_string(date, sizeof(date), &curtime);
   gmt_time_string(lm, sizeof(lm), &filep->modification_time);
-  construct_etag(conn, path, etag, sizeof(etag), filep);
+  if (cf != NULL && conn->ctx->callbacks.http_etag == NULL) {
+    mg_strlcpy(etag, cf->etag, sizeof(etag));
+  } else {
+    construct_etag(conn, path, etag, sizeof(etag), filep);
+  }
+  if (use_gz) {
+    char plain_etag[sizeof(etag)];
+
+    mg_strlcpy(plain_etag, etag, sizeof(plain_etag));
+    construct_gzip_etag(etag, sizeof(etag), plain_etag);
+    filep->membuf = cf->gz_data;
+    filep->size = cf->gz_size;
+  }
 
   (void) mg_printf(conn,
       "HTTP/1.1 %d %s\r\n"
@@ -3114,7 +3467,12 @@ static void handle_file_request(struct mg_connection *conn, const char *path,
   if (strcmp(conn->request_info.request_method, "HEAD") != 0) {
     send_file_data(conn, filep, r1, cl);
   }
-  mg_fclose(filep);
+  if (cf != NULL) {
+    filep->membuf = NULL;
+    release_cached_file(conn->ctx, cf);
+  } else {
+    mg_fclose(filep);
+  }
 }
 
 void mg_send_file(struct mg_connection *conn, const char *path) {
@@ -3258,11 +3616,13 @@ static int substitute_index_file(struct mg_connection *conn, char *path,
 static int is_not_modified(const struct mg_connection *conn,
                            const char *path,
                            const struct file *filep) {
-  char etag[64];
+  char etag[64], gz_etag[68];
   const char *ims = mg_get_header(conn, "If-Modified-Since");
   const char *inm = mg_get_header(conn, "If-None-Match");
   construct_etag(conn, path, etag, sizeof(etag), filep);
-  return (inm != NULL && !mg_strcasecmp(etag, inm)) ||
+  construct_gzip_etag(gz_etag, sizeof(gz_etag), etag);
+  return (inm != NULL &&
+          (!mg_strcasecmp(etag, inm) || !mg_strcasecmp(gz_etag, inm))) ||
     (ims != NULL && filep->modification_time <= parse_date_string(ims));
 }
 
@@ -5156,6 +5516,38 @@ struct mg_connection *mg_download(const char *host, int port, int use_ssl,
   return conn;
 }
 
+static void wakeup_master(struct mg_context *ctx) {
+  char c = 0;
+
+  (void) write(ctx->wakeup[1], &c, 1);
+}
+
+// Hand an idle keep-alive connection to the event loop. Return 0 if the
+// worker has to keep the connection.
+static int park_connection(struct mg_connection *conn) {
+  struct mg_context *ctx = conn->ctx;
+  int parked = 0;
+
+  if (!ctx->event_loop || conn->ssl != NULL) {
+    return 0;
+  }
+
+  (void) pthread_mutex_lock(&ctx->mutex);
+  if (ctx->stop_flag == 0 && ctx->num_idle < ctx->max_idle) {
+    ctx->idle[ctx->num_idle].client = conn->client;
+    ctx->idle[ctx->num_idle].since = time(NULL);
+    ctx->num_idle++;
+    parked = 1;
+  }
+  (void) pthread_mutex_unlock(&ctx->mutex);
+
+  if (parked) {
+    wakeup_master(ctx);
+  }
+
+  return parked;
+}
+
 static void process_new_connection(struct mg_connection *conn) {
   struct mg_request_info *ri = &conn->request_info;
   int keep_alive_enabled, keep_alive, discard_len;
@@ -5210,6 +5602,14 @@ static void process_new_connection(struct mg_connection *conn) {
     conn->data_len -= discard_len;
     assert(conn->data_len >= 0);
     assert(conn->data_len <= conn->buf_size);
+
+    // In event loop mode, the worker does not wait for the next request.
+    // The connection is handed to the master, which queues it again once
+    // the next request arrives.
+    if (keep_alive && conn->data_len == 0 && park_connection(conn)) {
+      conn->client.sock = INVALID_SOCKET;
+      keep_alive = 0;
+    }
   } while (keep_alive);
 }
 
@@ -5359,10 +5759,78 @@ static void accept_new_connection(const struct socket *listener,
   }
 }
 
+// Add the wakeup pipe and the idle connections to the poll set. Workers
+// only append idle connections, so the first n entries stay valid until
+// the master removes them.
+static int add_idle_connections(struct mg_context *ctx, struct pollfd *pfd,
+                                int n) {
+  int i;
+
+  pfd[n].fd = ctx->wakeup[0];
+  pfd[n].events = POLLIN;
+  n++;
+
+  (void) pthread_mutex_lock(&ctx->mutex);
+  for (i = 0; i < ctx->num_idle; i++) {
+    pfd[n + i].fd = ctx->idle[i].client.sock;
+    pfd[n + i].events = POLLIN;
+    pfd[n + i].revents = 0;
+  }
+  n += ctx->num_idle;
+  (void) pthread_mutex_unlock(&ctx->mutex);
+
+  return n;
+}
+
+// Queue the idle connections which received a request and close the ones
+// which timed out. The first entry of pfd is the wakeup pipe, followed by
+// n - 1 idle connections. With n set to 0 only timeouts are checked.
+static void dispatch_idle_connections(struct mg_context *ctx,
+                                      struct pollfd *pfd, int n) {
+  time_t now = time(NULL);
+  time_t timeout = atoi(ctx->config[REQUEST_TIMEOUT]) / 1000;
+  int i, num_ready = 0;
+  char buf[64];
+
+  if (n > 0 && (pfd[0].revents & POLLIN)) {
+    (void) read(ctx->wakeup[0], buf, sizeof(buf));
+  }
+
+  // Removing entries from the end keeps the entries below the current one
+  // in place, so they still match the poll set
+  (void) pthread_mutex_lock(&ctx->mutex);
+  for (i = ctx->num_idle - 1; i >= 0; i--) {
+    if (i < n - 1 && (pfd[i + 1].revents & POLLIN)) {
+      ctx->ready[num_ready++] = ctx->idle[i].client;
+    } else if (now - ctx->idle[i].since > timeout) {
+      closesocket(ctx->idle[i].client.sock);
+    } else {
+      continue;
+    }
+    ctx->idle[i] = ctx->idle[--ctx->num_idle];
+  }
+  (void) pthread_mutex_unlock(&ctx->mutex);
+
+  for (i = 0; i < num_ready; i++) {
+    produce_socket(ctx, &ctx->ready[i]);
+  }
+}
+
+static void close_idle_connections(struct mg_context *ctx) {
+  int i;
+
+  (void) pthread_mutex_lock(&ctx->mutex);
+  for (i = 0; i < ctx->num_idle; i++) {
+    closesocket(ctx->idle[i].client.sock);
+  }
+  ctx->num_idle = 0;
+  (void) pthread_mutex_unlock(&ctx->mutex);
+}
+
 static void *master_thread(void *thread_func_param) {
   struct mg_context *ctx = (struct mg_context *) thread_func_param;
   struct pollfd *pfd;
-  int i;
+  int i, n;
 
   // Increase priority of the master thread
 #if defined(_WIN32)
@@ -5375,14 +5843,22 @@ static void *master_thread(void *thread_func_param) {
   pthread_setschedparam(pthread_self(), SCHED_RR, &sched_param);
 #endif
 
-  pfd = (struct pollfd *) calloc(ctx->num_listening_sockets, sizeof(pfd[0]));
+  n = ctx->num_listening_sockets;
+  if (ctx->event_loop) {
+    n += 1 + ctx->max_idle;
+  }
+  pfd = (struct pollfd *) calloc(n, sizeof(pfd[0]));
   while (pfd != NULL && ctx->stop_flag == 0) {
     for (i = 0; i < ctx->num_listening_sockets; i++) {
       pfd[i].fd = ctx->listening_sockets[i].sock;
       pfd[i].events = POLLIN;
     }
+    n = ctx->num_listening_sockets;
+    if (ctx->event_loop) {
+      n = add_idle_connections(ctx, pfd, n);
+    }
 
-    if (poll(pfd, ctx->num_listening_sockets, 200) > 0) {
+    if (poll(pfd, n, 200) > 0) {
       for (i = 0; i < ctx->num_listening_sockets; i++) {
         // NOTE(lsm): on QNX, poll() returns POLLRDNORM after the
         // successfull poll, and POLLIN is defined as (POLLRDNORM | POLLRDBAND)
@@ -5392,6 +5868,14 @@ static void *master_thread(void *thread_func_param) {
           accept_new_connection(&ctx->listening_sockets[i], ctx);
         }
       }
+      if (ctx->event_loop) {
+        dispatch_idle_connections(ctx, pfd + ctx->num_listening_sockets,
+                                  n - ctx->num_listening_sockets);
+      }
+    }
+    else if (ctx->event_loop) {
+      // Close idle connections which timed out
+      dispatch_idle_connections(ctx, pfd + ctx->num_listening_sockets, 0);
     }
 #if __rtems__
     else {
@@ -5405,6 +5889,7 @@ static void *master_thread(void *thread_func_param) {
 
   // Stop signal received: somebody called mg_stop. Quit.
   close_all_listening_sockets(ctx);
+  close_idle_connections(ctx);
 
   // Wakeup workers that are waiting for connections to handle.
   pthread_cond_broadcast(&ctx->sq_full);
@@ -5421,6 +5906,7 @@ static void *master_thread(void *thread_func_param) {
   (void) pthread_cond_destroy(&ctx->cond);
   (void) pthread_cond_destroy(&ctx->sq_empty);
   (void) pthread_cond_destroy(&ctx->sq_full);
+  (void) pthread_mutex_destroy(&ctx->file_cache_mutex);
 
 #if !defined(NO_SSL)
   uninitialize_ssl(ctx);
@@ -5437,6 +5923,15 @@ static void *master_thread(void *thread_func_param) {
 static void free_context(struct mg_context *ctx) {
   int i;
 
+  free_file_cache(ctx);
+
+  if (ctx->event_loop) {
+    (void) close(ctx->wakeup[0]);
+    (void) close(ctx->wakeup[1]);
+  }
+  free(ctx->idle);
+  free(ctx->ready);
+
   // Deallocate config parameters
   for (i = 0; i < NUM_OPTIONS; i++) {
     if (ctx->config[i] != NULL)
@@ -5472,6 +5967,54 @@ void mg_stop(struct mg_context *ctx) {
 #endif // _WIN32
 }
 
+static int set_file_cache_option(struct mg_context *ctx) {
+  if (ctx->config[FILE_CACHE_SIZE] == NULL ||
+      (ctx->file_cache_size = strtoll(ctx->config[FILE_CACHE_SIZE],
+                                      NULL, 10)) <= 0) {
+    return 1;
+  }
+
+  ctx->file_cache_max_file_size =
+    strtoll(ctx->config[FILE_CACHE_MAX_FILE_SIZE], NULL, 10);
+  ctx->file_cache = (struct cached_file **)
+    calloc(FILE_CACHE_BUCKETS, sizeof(ctx->file_cache[0]));
+  if (ctx->file_cache == NULL) {
+    cry(fc(ctx), "Cannot allocate file cache");
+    return 0;
+  }
+
+  return 1;
+}
+
+static int set_event_loop_option(struct mg_context *ctx) {
+  if (mg_strcasecmp(ctx->config[ENABLE_EVENT_LOOP], "yes") != 0) {
+    return 1;
+  }
+
+  ctx->max_idle = atoi(ctx->config[MAX_IDLE_CONNECTIONS]);
+  if (ctx->max_idle <= 0) {
+    cry(fc(ctx), "Invalid max_idle_connections: %s",
+        ctx->config[MAX_IDLE_CONNECTIONS]);
+    return 0;
+  }
+
+  ctx->idle = (struct idle_connection *)
+    calloc(ctx->max_idle, sizeof(ctx->idle[0]));
+  ctx->ready = (struct socket *) calloc(ctx->max_idle, sizeof(ctx->ready[0]));
+  if (ctx->idle == NULL || ctx->ready == NULL || pipe(ctx->wakeup) != 0) {
+    cry(fc(ctx), "Cannot initialize event loop: %s", strerror(ERRNO));
+    return 0;
+  }
+
+#if !defined(_WIN32)
+  (void) fcntl(ctx->wakeup[1], F_SETFL,
+               fcntl(ctx->wakeup[1], F_GETFL, 0) | O_NONBLOCK);
+#endif
+  ctx->event_loop = 1;
+
+  return 1;
+}
+
 struct mg_context *mg_start(const struct mg_callbacks *callbacks,
                             void *user_data,
                             const char **options) {
@@ -5529,7 +6072,9 @@ struct mg_context *mg_start(const struct mg_callbacks *callbacks,
 #if !defined(_WIN32)
       !set_uid_option(ctx) ||
 #endif
-      !set_acl_option(ctx)) {
+      !set_acl_option(ctx) ||
+      !set_file_cache_option(ctx) ||
+      !set_event_loop_option(ctx)) {
     free_context(ctx);
     return NULL;
   }
@@ -5546,6 +6091,7 @@ struct mg_context *mg_start(const struct mg_callbacks *callbacks,
   (void) pthread_cond_init(&ctx->cond, NULL);
   (void) pthread_cond_init(&ctx->sq_empty, NULL);
   (void) pthread_cond_init(&ctx->sq_full, NULL);
+  (void) pthread_mutex_init(&ctx->file_cache_mutex, NULL);
 
   // Start master (listening) thread
   mg_start_thread(master_thread, ctx);
@@ -43,6 +43,8 @@ int pthread_spin_unlock( pthread_spinlock_t *lock )
   unused_stats.max_section_time = UINT32_MAX;
   unused_context.stats = &unused_stats;
   unused_context.acquire_instant = 0;
+  unused_context.acquire_time = 0;
+  unused_context.call_site = 0;
 #endif
   _SMP_ticket_lock_Release(
     &the_spinlock->Lock,
@@ -69,6 +69,15 @@ rtems_status_code _Timer_Fire(
     Per_CPU_Control *cpu;
 
     cpu = _Timer_Acquire_critical( the_timer, &lock_context );
+
+    if (
+      _Timer_Is_on_task_class( the_class )
+        && _Timer_server_Get( the_timer ) == NULL
+    ) {
+      _Timer_Release( cpu, &lock_context );
+      return RTEMS_INCORRECT_STATE;
+    }
+
     _Timer_Cancel( cpu, the_timer );
     _Watchdog_Initialize( &the_timer->Ticker, adaptor );
     the_timer->the_class = the_class;
@@ -177,7 +186,7 @@ void _Timer_Cancel( Per_CPU_Control *cpu, Timer_Control *the_timer )
     Timer_server_Control *timer_server;
     ISR_lock_Context      lock_context;
 
-    timer_server = _Timer_server;
+    timer_server = _Timer_server_Get( the_timer );
     _Assert( timer_server != NULL );
     _Timer_server_Acquire_critical( timer_server, &lock_context );
 
@@ -211,6 +220,7 @@ rtems_status_code rtems_timer_create(
   }
 
   the_timer->the_class = TIMER_DORMANT;
+  the_timer->server = NULL;
   _Watchdog_Preinitialize( &the_timer->Ticker, _Per_CPU_Get_snapshot() );
 
   *id = _Objects_Open_u32(
@@ -4,7 +4,8 @@
  * @ingroup RTEMSImplClassicTimer
  *
  * @brief This source file contains the implementation of
- *   rtems_timer_initiate_server().
+ *   rtems_timer_initiate_server(), rtems_timer_server_create(),
+ *   rtems_timer_set_server(), and rtems_timer_server_get_statistics().
  */
 
 /*  COPYRIGHT (c) 1989-2008.
@@ -22,12 +23,21 @@
 #endif
 
 #include <rtems.h>
+#include <rtems/counter.h>
 #include <rtems/rtems/timerimpl.h>
 #include <rtems/rtems/tasksimpl.h>
 #include <rtems/score/todimpl.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
 
 static Timer_server_Control _Timer_server_Default;
 
+Chain_Control _Timer_server_Chain =
+  CHAIN_INITIALIZER_EMPTY( _Timer_server_Chain );
+
+ISR_LOCK_DEFINE( static, _Timer_server_Chain_lock, "Timer Server Chain" )
+
 static void _Timer_server_Acquire(
   Timer_server_Control *ts,
   ISR_lock_Context     *lock_context
@@ -52,9 +62,9 @@ void _Timer_server_Routine_adaptor( Watchdog_Control *the_watchdog )
   Timer_server_Control *ts;
   bool                  wakeup;
 
-  ts = _Timer_server;
-  _Assert( ts != NULL );
   the_timer = RTEMS_CONTAINER_OF( the_watchdog, Timer_Control, Ticker );
+  ts = _Timer_server_Get( the_timer );
+  _Assert( ts != NULL );
 
   _Timer_server_Acquire( ts, &lock_context );
 
@@ -62,6 +72,7 @@ void _Timer_server_Routine_adaptor( Watchdog_Control *the_watchdog )
   _Watchdog_Set_state( &the_timer->Ticker, WATCHDOG_PENDING );
   cpu = _Watchdog_Get_CPU( &the_timer->Ticker );
   the_timer->stop_time = _Timer_Get_CPU_ticks( cpu );
+  the_timer->submit_time = rtems_counter_read();
   wakeup = _Chain_Is_empty( &ts->Pending );
   _Chain_Append_unprotected( &ts->Pending, &the_timer->Ticker.Node.Chain );
 
@@ -72,6 +83,41 @@ void _Timer_server_Routine_adaptor( Watchdog_Control *the_watchdog )
   }
 }
 
+static void _Timer_server_Account(
+  Timer_server_Control *ts,
+  const Timer_Control  *the_timer
+)
+{
+  uint64_t lateness;
+  uint64_t microseconds;
+  size_t   bin;
+
+  lateness = rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference( rtems_counter_read(), the_timer->submit_time )
+  );
+
+  if ( lateness > UINT32_MAX ) {
+    lateness = UINT32_MAX;
+  }
+
+  if ( lateness > ts->max_lateness ) {
+    ts->max_lateness = (uint32_t) lateness;
+  }
+
+  bin = 0;
+  microseconds = lateness / 1000;
+
+  while (
+    microseconds != 0 && bin < RTEMS_TIMER_SERVER_LATENESS_BIN_COUNT - 1
+  ) {
+    microseconds >>= 1;
+    ++bin;
+  }
+
+  ++ts->lateness[ bin ];
+  ++ts->routines;
+}
+
 /**
  *  @brief Timer server body.
  *
@@ -103,7 +149,8 @@ static rtems_task _Timer_server_Body(
       Objects_Id                         id;
       void                              *user_data;
 
-      the_watchdog = (Watchdog_Control *) _Chain_Get_unprotected( &ts->Pending );
+      the_watchdog =
+        (Watchdog_Control *) _Chain_Get_unprotected( &ts->Pending );
       if ( the_watchdog == NULL ) {
         break;
       }
@@ -114,6 +161,7 @@ static rtems_task _Timer_server_Body(
       routine = the_timer->routine;
       id = the_timer->Object.id;
       user_data = the_timer->user_data;
+      _Timer_server_Account( ts, the_timer );
 
       _Timer_server_Release( ts, &lock_context );
 
@@ -136,33 +184,52 @@ static rtems_task _Timer_server_Body(
   }
 }
 
-static rtems_status_code _Timer_server_Initiate(
+static rtems_status_code _Timer_server_Set_processor(
+  rtems_id            id,
   rtems_task_priority priority,
-  size_t              stack_size,
-  rtems_attribute     attribute_set
+  uint32_t            cpu_index
 )
 {
-  rtems_status_code     status;
-  rtems_id              id;
-  Timer_server_Control *ts;
+  rtems_status_code status;
+  rtems_id          scheduler_id;
+  cpu_set_t         cpuset;
 
-  /*
-   *  Just to make sure this is only called once.
-   */
-  if ( _Timer_server != NULL ) {
-    return RTEMS_INCORRECT_STATE;
+  status = rtems_scheduler_ident_by_processor( cpu_index, &scheduler_id );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    return status;
+  }
+
+  status = rtems_task_set_scheduler( id, scheduler_id, priority );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    return status;
   }
 
+  CPU_ZERO( &cpuset );
+  CPU_SET( (int) cpu_index, &cpuset );
+  return rtems_task_set_affinity( id, sizeof( cpuset ), &cpuset );
+}
+
+static rtems_status_code _Timer_server_Create(
+  Timer_server_Control *ts,
+  rtems_name            name,
+  rtems_task_priority   priority,
+  size_t                stack_size,
+  rtems_attribute       attribute_set,
+  uint32_t              cpu_index
+)
+{
+  rtems_status_code status;
+  rtems_id          id;
+
   if ( priority == RTEMS_TIMER_SERVER_DEFAULT_PRIORITY ) {
     priority = PRIORITY_PSEUDO_ISR;
   }
 
   /*
-   *  Create the Timer Server with the name the name of "TIME".  The attribute
-   *  RTEMS_SYSTEM_TASK allows us to set a priority to 0 which will makes it
-   *  higher than any other task in the system.  It can be viewed as a low
-   *  priority interrupt.  It is also always NO_PREEMPT so it looks like
-   *  an interrupt to other tasks.
+   *  Create the Timer Server.  The attribute RTEMS_SYSTEM_TASK allows us to
+   *  set a priority to 0 which will makes it higher than any other task in
+   *  the system.  It can be viewed as a low priority interrupt.  It is also
+   *  always NO_PREEMPT so it looks like an interrupt to other tasks.
    *
    *  We allow the user to override the default priority because the Timer
    *  Server can invoke TSRs which must adhere to language run-time or
@@ -172,7 +239,7 @@ static rtems_status_code _Timer_server_Initiate(
    *  GNAT run-time is violated.
    */
   status = rtems_task_create(
-    rtems_build_name('T','I','M','E'),
+    name,
     priority,
     stack_size,
 #ifdef RTEMS_SMP
@@ -189,32 +256,128 @@ static rtems_status_code _Timer_server_Initiate(
     return status;
   }
 
+  if ( cpu_index != RTEMS_TIMER_SERVER_ANY_PROCESSOR ) {
+    status = _Timer_server_Set_processor( id, priority, cpu_index );
+    if ( status != RTEMS_SUCCESSFUL ) {
+      (void) rtems_task_delete( id );
+      return status;
+    }
+  }
+
   /*
    *  Do all the data structure initialization before starting the
    *  Timer Server so we do not have to have a critical section.
    */
 
-  ts = &_Timer_server_Default;
+  memset( ts, 0, sizeof( *ts ) );
   _ISR_lock_Initialize( &ts->Lock, "Timer Server" );
   _Chain_Initialize_empty( &ts->Pending );
   ts->server_id = id;
+  _Chain_Initialize_node( &ts->Node );
 
-  /*
-   * The default timer server is now available.
-   */
-  _Timer_server = ts;
+  return RTEMS_SUCCESSFUL;
+}
+
+static void _Timer_server_Register(
+  Timer_server_Control *ts,
+  bool                  is_default
+)
+{
+  ISR_lock_Context lock_context;
 
   /*
-   *  Start the timer server
+   * The timer server directives check the availability of timer servers
+   * without the object allocator lock.  Publish the timer server in one
+   * critical section.
    */
+  _ISR_lock_ISR_disable_and_acquire( &_Timer_server_Chain_lock, &lock_context );
+  _Chain_Append_unprotected( &_Timer_server_Chain, &ts->Node );
+
+  if ( is_default ) {
+    _Timer_server = ts;
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &_Timer_server_Chain_lock, &lock_context );
+}
+
+static void _Timer_server_Start( Timer_server_Control *ts )
+{
+  rtems_status_code status;
+
   status = rtems_task_start(
-    id,
+    ts->server_id,
     _Timer_server_Body,
     (rtems_task_argument) ts
   );
   _Assert( status == RTEMS_SUCCESSFUL );
+  (void) status;
+}
 
-  return status;
+static Timer_server_Control *_Timer_server_Find( rtems_id server_id )
+{
+  Chain_Node *node;
+
+  if ( server_id == RTEMS_TIMER_SERVER_DEFAULT ) {
+    return _Timer_server;
+  }
+
+  node = _Chain_First( &_Timer_server_Chain );
+
+  while ( node != _Chain_Immutable_tail( &_Timer_server_Chain ) ) {
+    Timer_server_Control *ts;
+
+    ts = RTEMS_CONTAINER_OF( node, Timer_server_Control, Node );
+
+    if ( ts->server_id == server_id ) {
+      return ts;
+    }
+
+    node = _Chain_Next( node );
+  }
+
+  return NULL;
+}
+
+static rtems_status_code _Timer_server_Initiate(
+  rtems_task_priority priority,
+  size_t              stack_size,
+  rtems_attribute     attribute_set
+)
+{
+  rtems_status_code     status;
+  Timer_server_Control *ts;
+
+  /*
+   *  Just to make sure this is only called once.
+   */
+  if ( _Timer_server != NULL ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  ts = &_Timer_server_Default;
+  status = _Timer_server_Create(
+    ts,
+    rtems_build_name('T','I','M','E'),
+    priority,
+    stack_size,
+    attribute_set,
+    RTEMS_TIMER_SERVER_ANY_PROCESSOR
+  );
+  if (status != RTEMS_SUCCESSFUL) {
+    return status;
+  }
+
+  /*
+   * The default timer server is now available.
+   */
+  _Timer_server_Register( ts, true );
+
+  /*
+   *  Start the timer server
+   */
+  _Timer_server_Start( ts );
+
+  return RTEMS_SUCCESSFUL;
 }
 
 rtems_status_code rtems_timer_initiate_server(
@@ -231,3 +394,123 @@ rtems_status_code rtems_timer_initiate_server(
 
   return status;
 }
+
+rtems_status_code rtems_timer_server_create(
+  rtems_name          name,
+  rtems_task_priority priority,
+  size_t              stack_size,
+  rtems_attribute     attribute_set,
+  uint32_t            cpu_index,
+  rtems_id           *id
+)
+{
+  rtems_status_code     status;
+  Timer_server_Control *ts;
+
+  if ( id == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  _Objects_Allocator_lock();
+
+  ts = _Workspace_Allocate( sizeof( *ts ) );
+  if ( ts == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_NO_MEMORY;
+  }
+
+  status = _Timer_server_Create(
+    ts,
+    name,
+    priority,
+    stack_size,
+    attribute_set,
+    cpu_index
+  );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    _Workspace_Free( ts );
+    _Objects_Allocator_unlock();
+    return status;
+  }
+
+  _Timer_server_Register( ts, false );
+  _Timer_server_Start( ts );
+  *id = ts->server_id;
+
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_timer_set_server( rtems_id id, rtems_id server_id )
+{
+  Timer_server_Control *ts;
+  Timer_Control        *the_timer;
+  ISR_lock_Context      lock_context;
+  Per_CPU_Control      *cpu;
+
+  _Objects_Allocator_lock();
+
+  ts = _Timer_server_Find( server_id );
+  if ( ts == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  the_timer = _Timer_Get( id, &lock_context );
+  if ( the_timer == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  cpu = _Timer_Acquire_critical( the_timer, &lock_context );
+  _Timer_Cancel( cpu, the_timer );
+
+  if ( server_id == RTEMS_TIMER_SERVER_DEFAULT ) {
+    the_timer->server = NULL;
+  } else {
+    the_timer->server = ts;
+  }
+
+  _Timer_Release( cpu, &lock_context );
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_timer_server_get_statistics(
+  rtems_id                       server_id,
+  rtems_timer_server_statistics *statistics,
+  bool                           reset
+)
+{
+  Timer_server_Control *ts;
+  ISR_lock_Context      lock_context;
+
+  if ( statistics == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  _Objects_Allocator_lock();
+
+  ts = _Timer_server_Find( server_id );
+  if ( ts == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  _Timer_server_Acquire( ts, &lock_context );
+
+  statistics->server_id = ts->server_id;
+  statistics->routines = ts->routines;
+  statistics->max_lateness = ts->max_lateness;
+  memcpy( statistics->lateness, ts->lateness, sizeof( statistics->lateness ) );
+
+  if ( reset ) {
+    ts->routines = 0;
+    ts->max_lateness = 0;
+    memset( ts->lateness, 0, sizeof( ts->lateness ) );
+  }
+
+  _Timer_server_Release( ts, &lock_context );
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
@@ -29,11 +29,7 @@ rtems_status_code rtems_timer_server_fire_when(
   void                              *user_data
 )
 {
-  Timer_server_Control *timer_server;
-
-  timer_server = _Timer_server;
-
-  if ( !timer_server )
+  if ( !_Timer_server_Is_any_available() )
     return RTEMS_INCORRECT_STATE;
 
   return _Timer_Fire_when(
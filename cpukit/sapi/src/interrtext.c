@@ -70,7 +70,8 @@ static const char *const internal_error_text[] = {
   "INTERNAL_ERROR_ARC4RANDOM_GETENTROPY_FAIL",
   "INTERNAL_ERROR_NO_MEMORY_FOR_PER_CPU_DATA",
   "INTERNAL_ERROR_TOO_LARGE_TLS_SIZE",
-  "INTERNAL_ERROR_RTEMS_INIT_TASK_CONSTRUCT_FAILED"
+  "INTERNAL_ERROR_RTEMS_INIT_TASK_CONSTRUCT_FAILED",
+  "INTERNAL_ERROR_RTL_LAZY_BINDING_FAILED"
 };
 
 const char *rtems_internal_error_text( rtems_fatal_code error )
@@ -0,0 +1,573 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIProfiling
+ *
+ * @brief This source file contains the implementation of the heap
+ *   allocation profiler support.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+#include <rtems/thread.h>
+#include <rtems/score/heapprofiler.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/percpu.h>
+#include <rtems/config.h>
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The count of allocation sites copied or cleared with interrupts disabled.
+ */
+#define HEAP_PROFILER_CHUNK_SIZE 4
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_HEAP_LIFETIME_BIN_COUNT == HEAP_PROFILER_LIFETIME_BIN_COUNT,
+  heap_lifetime_bin_count
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_HEAP_MALLOC == (int) HEAP_PROFILER_MALLOC,
+  heap_kind_malloc
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_HEAP_WORKSPACE == (int) HEAP_PROFILER_WORKSPACE,
+  heap_kind_workspace
+);
+
+static rtems_mutex _Heap_Profiler_Mutex =
+  RTEMS_MUTEX_INITIALIZER( "Heap Profiler" );
+
+static Heap_Profiler_Per_CPU *_Heap_Profiler_Get_per_CPU( uint32_t cpu_max )
+{
+  Heap_Profiler_Per_CPU *per_cpu;
+  uint32_t               cpu_index;
+
+  per_cpu = _Heap_Profiler.per_cpu;
+
+  if ( per_cpu != NULL ) {
+    return per_cpu;
+  }
+
+  per_cpu = calloc( cpu_max, sizeof( *per_cpu ) );
+
+  if ( per_cpu == NULL ) {
+    return NULL;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    _ISR_lock_Initialize( &per_cpu[ cpu_index ].Lock, "Heap Profiler" );
+  }
+
+  return per_cpu;
+}
+
+/*
+ * Acquires all locks in turn, so that no processor accounts an operation with
+ * the previous enabled state after the return of this function.
+ */
+static void _Heap_Profiler_Set_enabled( bool enabled )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    ISR_lock_Context lock_context;
+
+    _ISR_lock_ISR_disable_and_acquire(
+      &_Heap_Profiler.per_cpu[ cpu_index ].Lock,
+      &lock_context
+    );
+    _Heap_Profiler.enabled = enabled;
+    _ISR_lock_Release_and_ISR_enable(
+      &_Heap_Profiler.per_cpu[ cpu_index ].Lock,
+      &lock_context
+    );
+  }
+}
+
+rtems_status_code rtems_profiling_heap_start( uint32_t site_count )
+{
+  Heap_Profiler_Per_CPU  *per_cpu;
+  Heap_Profiler_Site    **tables;
+  uint32_t                cpu_max;
+  uint32_t                cpu_index;
+
+  if ( site_count == 0 ) {
+    site_count = RTEMS_PROFILING_HEAP_DEFAULT_SITE_COUNT;
+  }
+
+  if ( ( site_count & ( site_count - 1 ) ) != 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  rtems_mutex_lock( &_Heap_Profiler_Mutex );
+
+  if ( _Heap_Profiler.enabled ) {
+    rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+  per_cpu = _Heap_Profiler_Get_per_CPU( cpu_max );
+  tables = calloc( cpu_max, sizeof( *tables ) );
+
+  if ( per_cpu == NULL || tables == NULL ) {
+    if ( _Heap_Profiler.per_cpu == NULL ) {
+      free( per_cpu );
+    }
+
+    free( tables );
+    rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+    return RTEMS_NO_MEMORY;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    tables[ cpu_index ] = calloc( site_count, sizeof( Heap_Profiler_Site ) );
+
+    if ( tables[ cpu_index ] == NULL ) {
+      while ( cpu_index > 0 ) {
+        --cpu_index;
+        free( tables[ cpu_index ] );
+      }
+
+      if ( _Heap_Profiler.per_cpu == NULL ) {
+        free( per_cpu );
+      }
+
+      free( tables );
+      rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+      return RTEMS_NO_MEMORY;
+    }
+  }
+
+  /*
+   * Blocks of a previous run shall not be accounted in the new tables.  The
+   * tables are only accessed under the lock, so the tables of a previous run
+   * can be replaced and freed.
+   */
+  ++_Heap_Profiler.generation;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Heap_Profiler_Per_CPU *control;
+    Heap_Profiler_Site    *previous;
+    ISR_lock_Context       lock_context;
+
+    control = &per_cpu[ cpu_index ];
+    _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+    previous = control->sites;
+    control->sites = tables[ cpu_index ];
+    control->mask = site_count - 1;
+    control->dropped = 0;
+    _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+    tables[ cpu_index ] = previous;
+  }
+
+  _Heap_Profiler.per_cpu = per_cpu;
+  _Heap_Profiler_Set_enabled( true );
+
+  rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    free( tables[ cpu_index ] );
+  }
+
+  free( tables );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_profiling_heap_stop( void )
+{
+  rtems_mutex_lock( &_Heap_Profiler_Mutex );
+
+  if ( _Heap_Profiler.enabled ) {
+    _Heap_Profiler_Set_enabled( false );
+  }
+
+  rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+}
+
+void rtems_profiling_heap_reset( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  rtems_mutex_lock( &_Heap_Profiler_Mutex );
+
+  if ( _Heap_Profiler.per_cpu != NULL ) {
+    bool enabled;
+
+    /*
+     * No allocation is accounted while the tables are cleared.  Blocks
+     * allocated before the reset are no longer accounted, so the freed bytes
+     * of a site cannot exceed its allocated bytes.
+     */
+    enabled = _Heap_Profiler.enabled;
+    _Heap_Profiler_Set_enabled( false );
+    ++_Heap_Profiler.generation;
+    cpu_max = rtems_configuration_get_maximum_processors();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Heap_Profiler_Per_CPU *control;
+      uint32_t               i;
+
+      control = &_Heap_Profiler.per_cpu[ cpu_index ];
+
+      for ( i = 0; control->sites != NULL && i <= control->mask; ) {
+        ISR_lock_Context lock_context;
+        uint32_t         end;
+
+        end = i + HEAP_PROFILER_CHUNK_SIZE;
+        _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+
+        while ( i < end && i <= control->mask ) {
+          memset( &control->sites[ i ], 0, sizeof( control->sites[ i ] ) );
+          ++i;
+        }
+
+        if ( i > control->mask ) {
+          control->dropped = 0;
+        }
+
+        _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+      }
+    }
+
+    _Heap_Profiler_Set_enabled( enabled );
+  }
+
+  rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+}
+
+uint32_t rtems_profiling_heap_get_dropped( void )
+{
+  uint32_t dropped;
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  dropped = 0;
+  rtems_mutex_lock( &_Heap_Profiler_Mutex );
+
+  if ( _Heap_Profiler.per_cpu != NULL ) {
+    cpu_max = rtems_configuration_get_maximum_processors();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      dropped += _Heap_Profiler.per_cpu[ cpu_index ].dropped;
+    }
+  }
+
+  rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+
+  return dropped;
+}
+
+typedef struct {
+  rtems_profiling_heap_site *sites;
+  size_t                     count;
+  size_t                     capacity;
+} Heap_Profiler_Snapshot;
+
+static bool _Heap_Profiler_Append(
+  Heap_Profiler_Snapshot   *snapshot,
+  const Heap_Profiler_Site *entry
+)
+{
+  rtems_profiling_heap_site *site;
+  size_t                     i;
+
+  if ( snapshot->count == snapshot->capacity ) {
+    rtems_profiling_heap_site *more;
+    size_t                     capacity;
+
+    capacity = snapshot->capacity > 0 ? 2 * snapshot->capacity : 64;
+    more = realloc( snapshot->sites, capacity * sizeof( *more ) );
+
+    if ( more == NULL ) {
+      return false;
+    }
+
+    snapshot->sites = more;
+    snapshot->capacity = capacity;
+  }
+
+  site = &snapshot->sites[ snapshot->count ];
+  ++snapshot->count;
+  site->site = entry->site;
+  site->heap = (rtems_profiling_heap_kind) entry->kind;
+  site->allocations = entry->allocations;
+  site->frees = entry->frees;
+
+  _Assert( entry->allocated_bytes >= entry->freed_bytes );
+  site->live_bytes = entry->allocated_bytes - entry->freed_bytes;
+  site->allocated_bytes = entry->allocated_bytes;
+
+  for ( i = 0; i < RTEMS_PROFILING_HEAP_LIFETIME_BIN_COUNT; ++i ) {
+    site->lifetimes[ i ] = entry->lifetimes[ i ];
+  }
+
+  return true;
+}
+
+static int _Heap_Profiler_Compare_site( const void *a, const void *b )
+{
+  const rtems_profiling_heap_site *x;
+  const rtems_profiling_heap_site *y;
+
+  x = a;
+  y = b;
+
+  if ( x->site != y->site ) {
+    return x->site < y->site ? -1 : 1;
+  }
+
+  if ( x->heap != y->heap ) {
+    return x->heap < y->heap ? -1 : 1;
+  }
+
+  return 0;
+}
+
+static bool _Heap_Profiler_Take_snapshot( Heap_Profiler_Snapshot *snapshot )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+  size_t   i;
+  size_t   n;
+
+  memset( snapshot, 0, sizeof( *snapshot ) );
+  rtems_mutex_lock( &_Heap_Profiler_Mutex );
+
+  if ( _Heap_Profiler.per_cpu != NULL ) {
+    cpu_max = rtems_configuration_get_maximum_processors();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Heap_Profiler_Per_CPU *control;
+      uint32_t               j;
+
+      control = &_Heap_Profiler.per_cpu[ cpu_index ];
+
+      for ( j = 0; control->sites != NULL && j <= control->mask; ) {
+        Heap_Profiler_Site chunk[ HEAP_PROFILER_CHUNK_SIZE ];
+        ISR_lock_Context   lock_context;
+        uint32_t           k;
+        uint32_t           m;
+
+        m = 0;
+        _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+
+        while ( m < HEAP_PROFILER_CHUNK_SIZE && j <= control->mask ) {
+          chunk[ m ] = control->sites[ j ];
+          ++m;
+          ++j;
+        }
+
+        _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+
+        for ( k = 0; k < m; ++k ) {
+          if (
+            chunk[ k ].site != 0
+              && !_Heap_Profiler_Append( snapshot, &chunk[ k ] )
+          ) {
+            rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+            free( snapshot->sites );
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  rtems_mutex_unlock( &_Heap_Profiler_Mutex );
+
+  /* Sum up the per-processor entries of each allocation site */
+  qsort(
+    snapshot->sites,
+    snapshot->count,
+    sizeof( *snapshot->sites ),
+    _Heap_Profiler_Compare_site
+  );
+
+  n = 0;
+
+  for ( i = 0; i < snapshot->count; ++i ) {
+    rtems_profiling_heap_site *site;
+
+    site = &snapshot->sites[ i ];
+
+    if (
+      n > 0
+        && _Heap_Profiler_Compare_site( &snapshot->sites[ n - 1 ], site ) == 0
+    ) {
+      rtems_profiling_heap_site *sum;
+      size_t                     j;
+
+      sum = &snapshot->sites[ n - 1 ];
+      sum->allocations += site->allocations;
+      sum->frees += site->frees;
+      sum->live_bytes += site->live_bytes;
+      sum->allocated_bytes += site->allocated_bytes;
+
+      for ( j = 0; j < RTEMS_PROFILING_HEAP_LIFETIME_BIN_COUNT; ++j ) {
+        sum->lifetimes[ j ] += site->lifetimes[ j ];
+      }
+    } else {
+      snapshot->sites[ n ] = *site;
+      ++n;
+    }
+  }
+
+  snapshot->count = n;
+
+  return true;
+}
+
+rtems_status_code rtems_profiling_heap_iterate(
+  rtems_profiling_heap_visitor  visitor,
+  void                         *arg
+)
+{
+  Heap_Profiler_Snapshot snapshot;
+  size_t                 i;
+
+  if ( !_Heap_Profiler_Take_snapshot( &snapshot ) ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  for ( i = 0; i < snapshot.count; ++i ) {
+    ( *visitor )( arg, &snapshot.sites[ i ] );
+  }
+
+  free( snapshot.sites );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static int _Heap_Profiler_Compare_live_bytes( const void *a, const void *b )
+{
+  const rtems_profiling_heap_site *x;
+  const rtems_profiling_heap_site *y;
+
+  x = a;
+  y = b;
+
+  if ( x->live_bytes != y->live_bytes ) {
+    return x->live_bytes > y->live_bytes ? -1 : 1;
+  }
+
+  if ( x->allocated_bytes != y->allocated_bytes ) {
+    return x->allocated_bytes > y->allocated_bytes ? -1 : 1;
+  }
+
+  return _Heap_Profiler_Compare_site( a, b );
+}
+
+rtems_status_code rtems_profiling_heap_report(
+  const rtems_printer *printer,
+  size_t               limit
+)
+{
+  Heap_Profiler_Snapshot           snapshot;
+  rtems_profiling_sampler_resolver resolver;
+  size_t                           i;
+
+  if ( !_Heap_Profiler_Take_snapshot( &snapshot ) ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  qsort(
+    snapshot.sites,
+    snapshot.count,
+    sizeof( *snapshot.sites ),
+    _Heap_Profiler_Compare_live_bytes
+  );
+
+  if ( limit > snapshot.count ) {
+    limit = snapshot.count;
+  }
+
+  resolver = rtems_profiling_sampler_get_resolver();
+  rtems_printf(
+    printer,
+    "LIVE BYTES    ALLOCS     FREES  TOTAL BYTES  HEAP       SITE\n"
+  );
+
+  for ( i = 0; i < limit; ++i ) {
+    const rtems_profiling_heap_site *site;
+    const char                      *name;
+    uintptr_t                        begin;
+
+    site = &snapshot.sites[ i ];
+    rtems_printf(
+      printer,
+      "%10" PRIu64 "  %8" PRIu64 "  %8" PRIu64 "  %11" PRIu64 "  %-9s  ",
+      site->live_bytes,
+      site->allocations,
+      site->frees,
+      site->allocated_bytes,
+      site->heap == RTEMS_PROFILING_HEAP_MALLOC ? "malloc" : "workspace"
+    );
+
+    name = NULL;
+
+    if ( resolver != NULL ) {
+      name = ( *resolver )( site->site, &begin );
+    }
+
+    if ( name != NULL ) {
+      rtems_printf(
+        printer,
+        "%s+0x%" PRIxPTR "\n",
+        name,
+        site->site - begin
+      );
+    } else {
+      rtems_printf( printer, "0x%08" PRIxPTR "\n", site->site );
+    }
+  }
+
+  rtems_printf(
+    printer,
+    "%" PRIu32 " dropped\n",
+    rtems_profiling_heap_get_dropped()
+  );
+  free( snapshot.sites );
+
+  return RTEMS_SUCCESSFUL;
+}
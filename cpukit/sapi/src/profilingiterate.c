@@ -147,6 +147,65 @@ static void smp_lock_stats_iterate(
 #endif
 }
 
+static void smp_lock_call_site_stats_iterate(
+  rtems_profiling_visitor visitor,
+  void *visitor_arg,
+  rtems_profiling_data *data
+)
+{
+#if defined(RTEMS_PROFILING) && defined(RTEMS_SMP)
+  const SMP_lock_Stats_call_site_table *tables;
+  uint32_t n;
+  uint32_t i;
+
+  tables = _SMP_lock_Stats_call_sites.tables;
+
+  if (tables == NULL) {
+    return;
+  }
+
+  memset(data, 0, sizeof(*data));
+  data->header.type = RTEMS_PROFILING_SMP_LOCK_CALL_SITE;
+  n = rtems_scheduler_get_processor_maximum();
+
+  for (i = 0; i < n; ++i) {
+    size_t j;
+
+    for (j = 0; j < SMP_LOCK_STATS_CALL_SITE_COUNT; ++j) {
+      rtems_profiling_smp_lock_call_site *call_site_data =
+        &data->smp_lock_call_site;
+      SMP_lock_Stats_call_site snapshot;
+
+      /* The snapshot may be inconsistent, if the entry is in use */
+      snapshot = tables[i].sites[j];
+
+      if (snapshot.call_site == 0) {
+        continue;
+      }
+
+      call_site_data->name = snapshot.name;
+      call_site_data->call_site = snapshot.call_site;
+      call_site_data->processor_index = i;
+      call_site_data->max_acquire_time =
+        rtems_counter_ticks_to_nanoseconds(snapshot.max_acquire_time);
+      call_site_data->max_section_time =
+        rtems_counter_ticks_to_nanoseconds(snapshot.max_section_time);
+      call_site_data->usage_count = snapshot.usage_count;
+      call_site_data->total_acquire_time =
+        rtems_counter_ticks_to_nanoseconds(snapshot.total_acquire_time);
+      call_site_data->total_section_time =
+        rtems_counter_ticks_to_nanoseconds(snapshot.total_section_time);
+
+      (*visitor)(visitor_arg, data);
+    }
+  }
+#else
+  (void) visitor;
+  (void) visitor_arg;
+  (void) data;
+#endif
+}
+
 void rtems_profiling_iterate(
   rtems_profiling_visitor visitor,
   void *visitor_arg
@@ -156,4 +215,5 @@ void rtems_profiling_iterate(
 
   per_cpu_stats_iterate(visitor, visitor_arg, &data);
   smp_lock_stats_iterate(visitor, visitor_arg, &data);
+  smp_lock_call_site_stats_iterate(visitor, visitor_arg, &data);
 }
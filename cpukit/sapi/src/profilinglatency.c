@@ -0,0 +1,190 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIProfiling
+ *
+ * @brief This source file contains the implementation of the wake-up latency
+ *   profiling support.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+#include <rtems/counter.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems.h>
+
+#include <string.h>
+
+#if defined(RTEMS_PROFILING)
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_LATENCY_BIN_COUNT == LATENCY_STATS_BIN_COUNT,
+  latency_bin_count
+);
+
+static uint64_t latency_ticks_to_nanoseconds(uint64_t ticks)
+{
+  rtems_counter_ticks chunk;
+
+  /* The conversion function accepts only values of the counter tick type */
+  chunk = (rtems_counter_ticks) 1 << 30;
+
+  return (ticks / chunk) * rtems_counter_ticks_to_nanoseconds(chunk)
+    + rtems_counter_ticks_to_nanoseconds((rtems_counter_ticks) (ticks % chunk));
+}
+
+static void latency_stats_convert(
+  rtems_profiling_latency *latency,
+  const Latency_Stats *stats
+)
+{
+  latency->count = stats->count;
+  latency->total_latency = latency_ticks_to_nanoseconds(stats->total_latency);
+  latency->max_latency = latency_ticks_to_nanoseconds(stats->max_latency);
+  memcpy(&latency->bins[0], &stats->bins[0], sizeof(latency->bins));
+}
+
+static bool latency_stats_reset(Thread_Control *the_thread, void *arg)
+{
+  ISR_lock_Context lock_context;
+
+  (void) arg;
+
+  _ISR_lock_ISR_disable(&lock_context);
+  memset(
+    &the_thread->Wake_up_latency.Stats,
+    0,
+    sizeof(the_thread->Wake_up_latency.Stats)
+  );
+  _ISR_lock_ISR_enable(&lock_context);
+
+  return false;
+}
+#endif
+
+rtems_status_code rtems_profiling_get_thread_latency(
+  rtems_id id,
+  rtems_profiling_latency *latency
+)
+{
+#if defined(RTEMS_PROFILING)
+  Thread_Control *the_thread;
+  ISR_lock_Context lock_context;
+  Latency_Stats snapshot;
+
+  if (latency == NULL) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  the_thread = _Thread_Get(id, &lock_context);
+  if (the_thread == NULL) {
+    return RTEMS_INVALID_ID;
+  }
+
+  snapshot = the_thread->Wake_up_latency.Stats;
+  _ISR_lock_ISR_enable(&lock_context);
+
+  latency_stats_convert(latency, &snapshot);
+  return RTEMS_SUCCESSFUL;
+#else
+  (void) id;
+  (void) latency;
+  return RTEMS_NOT_IMPLEMENTED;
+#endif
+}
+
+rtems_status_code rtems_profiling_get_processor_latency(
+  uint32_t cpu_index,
+  rtems_profiling_latency *latency
+)
+{
+#if defined(RTEMS_PROFILING)
+  const Per_CPU_Control *cpu;
+  ISR_Level level;
+  Latency_Stats snapshot;
+
+  if (latency == NULL) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if (cpu_index >= rtems_scheduler_get_processor_maximum()) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  cpu = _Per_CPU_Get_by_index(cpu_index);
+  _ISR_Local_disable(level);
+  snapshot = cpu->Stats.wake_up_latency;
+  _ISR_Local_enable(level);
+
+  latency_stats_convert(latency, &snapshot);
+  return RTEMS_SUCCESSFUL;
+#else
+  (void) cpu_index;
+  (void) latency;
+  return RTEMS_NOT_IMPLEMENTED;
+#endif
+}
+
+void rtems_profiling_reset_latency(void)
+{
+#if defined(RTEMS_PROFILING)
+  uint32_t n;
+  uint32_t i;
+
+  n = rtems_scheduler_get_processor_maximum();
+
+  for (i = 0; i < n; ++i) {
+    Per_CPU_Control *cpu;
+    ISR_Level level;
+
+    cpu = _Per_CPU_Get_by_index(i);
+    _ISR_Local_disable(level);
+    memset(
+      &cpu->Stats.wake_up_latency,
+      0,
+      sizeof(cpu->Stats.wake_up_latency)
+    );
+    _ISR_Local_enable(level);
+  }
+
+  rtems_task_iterate(latency_stats_reset, NULL);
+#endif
+}
+
+uint64_t rtems_profiling_latency_bin_limit(size_t bin)
+{
+  if (bin >= RTEMS_PROFILING_LATENCY_BIN_COUNT - 1) {
+    return UINT64_MAX;
+  }
+
+  return rtems_counter_ticks_to_nanoseconds((rtems_counter_ticks) 1 << bin);
+}
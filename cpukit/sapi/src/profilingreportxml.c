@@ -262,6 +262,119 @@ static void report_smp_lock(context *ctx, const rtems_profiling_smp_lock *smp_lo
   update_retval(ctx, rv);
 }
 
+static void report_smp_lock_call_site(
+  context *ctx,
+  const rtems_profiling_smp_lock_call_site *call_site
+)
+{
+  rtems_profiling_sampler_resolver resolver;
+  const char *function;
+  uintptr_t begin;
+  int rv;
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "<SMPLockCallSiteProfilingReport name=\"%s\" callSite=\"0x%08" PRIxPTR
+      "\" processorIndex=\"%" PRIu32 "\"",
+    call_site->name,
+    call_site->call_site,
+    call_site->processor_index
+  );
+  update_retval(ctx, rv);
+
+  resolver = rtems_profiling_sampler_get_resolver();
+  function = NULL;
+
+  if (resolver != NULL) {
+    function = (*resolver)(call_site->call_site, &begin);
+  }
+
+  if (function != NULL) {
+    rv = rtems_printf(
+      ctx->printer,
+      " function=\"%s+0x%" PRIxPTR "\"",
+      function,
+      call_site->call_site - begin
+    );
+    update_retval(ctx, rv);
+  }
+
+  rv = rtems_printf(ctx->printer, ">\n");
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxAcquireTime unit=\"ns\">%" PRIu32 "</MaxAcquireTime>\n",
+    call_site->max_acquire_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxSectionTime unit=\"ns\">%" PRIu32 "</MaxSectionTime>\n",
+    call_site->max_section_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MeanAcquireTime unit=\"ns\">%" PRIu64
+      "</MeanAcquireTime>\n",
+    arithmetic_mean(
+      call_site->total_acquire_time,
+      call_site->usage_count
+    )
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MeanSectionTime unit=\"ns\">%" PRIu64
+      "</MeanSectionTime>\n",
+    arithmetic_mean(
+      call_site->total_section_time,
+      call_site->usage_count
+    )
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<TotalAcquireTime unit=\"ns\">%" PRIu64 "</TotalAcquireTime>\n",
+    call_site->total_acquire_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<TotalSectionTime unit=\"ns\">%" PRIu64 "</TotalSectionTime>\n",
+    call_site->total_section_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<UsageCount>%" PRIu64 "</UsageCount>\n",
+    call_site->usage_count
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "</SMPLockCallSiteProfilingReport>\n"
+  );
+  update_retval(ctx, rv);
+}
+
 static void report(void *arg, const rtems_profiling_data *data)
 {
   context *ctx = arg;
@@ -273,6 +386,9 @@ static void report(void *arg, const rtems_profiling_data *data)
     case RTEMS_PROFILING_SMP_LOCK:
       report_smp_lock(ctx, &data->smp_lock);
       break;
+    case RTEMS_PROFILING_SMP_LOCK_CALL_SITE:
+      report_smp_lock_call_site(ctx, &data->smp_lock_call_site);
+      break;
   }
 }
 
@@ -0,0 +1,547 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIProfiling
+ *
+ * @brief This source file contains the implementation of the sampling
+ *   profiler.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+#include <rtems/thread.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/config.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * The count of entries probed for a free entry.  This bounds the time spent in
+ * the clock tick interrupt.
+ */
+#define SAMPLER_PROBE_LIMIT 16
+
+/*
+ * The count of entries copied or cleared with interrupts disabled.
+ */
+#define SAMPLER_CHUNK_SIZE 32
+
+typedef struct {
+  uintptr_t  pc;
+  Objects_Id thread;
+  uint32_t   count;
+} Sampler_Entry;
+
+typedef struct {
+  Watchdog_Control Watchdog;
+  ISR_LOCK_MEMBER( Lock )
+  bool             active;
+  Sampler_Entry   *entries;
+  uint32_t         mask;
+  uint64_t         samples;
+  uint64_t         dropped;
+} Sampler_Per_CPU;
+
+typedef struct {
+  rtems_mutex      mutex;
+  Sampler_Per_CPU *per_cpu;
+  uint32_t         period;
+  bool             started;
+} Sampler_Control;
+
+static Sampler_Control _Sampler = {
+  .mutex = RTEMS_MUTEX_INITIALIZER( "Profiling Sampler" )
+};
+
+/*
+ * There is no generic way to get the interrupted program counter in the clock
+ * tick.  This weak reference is NULL, if no BSP or application provides an
+ * implementation.
+ */
+RTEMS_WEAK uintptr_t rtems_profiling_sampler_get_interrupted_pc( void );
+
+static void _Sampler_Add(
+  Sampler_Per_CPU *control,
+  uintptr_t        pc,
+  Objects_Id       thread
+)
+{
+  uint32_t index;
+  uint32_t probe;
+
+  index = (uint32_t) ( pc ^ ( pc >> 9 ) ) ^ ( thread * UINT32_C( 0x9e3779b1 ) );
+
+  for ( probe = 0; probe < SAMPLER_PROBE_LIMIT; ++probe ) {
+    Sampler_Entry *entry;
+
+    entry = &control->entries[ ( index + probe ) & control->mask ];
+
+    if ( entry->count == 0 ) {
+      entry->pc = pc;
+      entry->thread = thread;
+      entry->count = 1;
+      ++control->samples;
+      return;
+    }
+
+    if ( entry->pc == pc && entry->thread == thread ) {
+      ++entry->count;
+      ++control->samples;
+      return;
+    }
+  }
+
+  ++control->dropped;
+}
+
+void rtems_profiling_sampler_sample( uintptr_t pc )
+{
+  Sampler_Per_CPU  *per_cpu;
+  Sampler_Per_CPU  *control;
+  Per_CPU_Control  *cpu;
+  ISR_lock_Context  lock_context;
+
+  per_cpu = _Sampler.per_cpu;
+
+  if ( per_cpu == NULL ) {
+    return;
+  }
+
+  _ISR_lock_ISR_disable( &lock_context );
+  cpu = _Per_CPU_Get();
+  control = &per_cpu[ _Per_CPU_Get_index( cpu ) ];
+  _ISR_lock_Acquire( &control->Lock, &lock_context );
+
+  if ( control->active ) {
+    _Sampler_Add( control, pc, _Per_CPU_Get_executing( cpu )->Object.id );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+}
+
+static void _Sampler_Watchdog( Watchdog_Control *watchdog )
+{
+  Sampler_Per_CPU  *control;
+  Per_CPU_Control  *cpu;
+  ISR_lock_Context  lock_context;
+
+  control = RTEMS_CONTAINER_OF( watchdog, Sampler_Per_CPU, Watchdog );
+  cpu = _Watchdog_Get_CPU( watchdog );
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+
+  /*
+   * The active indicator is checked under the lock, so that the watchdog is
+   * not inserted again after rtems_profiling_sampler_stop() removed it.
+   */
+  if ( control->active ) {
+    _Watchdog_Per_CPU_insert_ticks( watchdog, cpu, _Sampler.period );
+    _Sampler_Add(
+      control,
+      rtems_profiling_sampler_get_interrupted_pc(),
+      _Per_CPU_Get_executing( cpu )->Object.id
+    );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+}
+
+static Sampler_Per_CPU *_Sampler_Get_per_CPU( uint32_t cpu_max )
+{
+  Sampler_Per_CPU *per_cpu;
+  uint32_t         cpu_index;
+
+  per_cpu = _Sampler.per_cpu;
+
+  if ( per_cpu != NULL ) {
+    return per_cpu;
+  }
+
+  /*
+   * The per-processor controls are never freed since the watchdog and sample
+   * functions may access them at any time.
+   */
+  per_cpu = calloc( cpu_max, sizeof( *per_cpu ) );
+
+  if ( per_cpu == NULL ) {
+    return NULL;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Sampler_Per_CPU *control;
+
+    control = &per_cpu[ cpu_index ];
+    _ISR_lock_Initialize( &control->Lock, "Profiling Sampler" );
+    _Watchdog_Preinitialize(
+      &control->Watchdog,
+      _Per_CPU_Get_by_index( cpu_index )
+    );
+    _Watchdog_Initialize( &control->Watchdog, _Sampler_Watchdog );
+  }
+
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  _Sampler.per_cpu = per_cpu;
+
+  return per_cpu;
+}
+
+static void _Sampler_Free_tables( Sampler_Entry **tables, uint32_t cpu_max )
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    free( tables[ cpu_index ] );
+  }
+
+  free( tables );
+}
+
+rtems_status_code rtems_profiling_sampler_start(
+  const rtems_profiling_sampler_config *config
+)
+{
+  Sampler_Per_CPU  *per_cpu;
+  Sampler_Entry   **tables;
+  uint32_t          entry_count;
+  uint32_t          cpu_max;
+  uint32_t          cpu_index;
+
+  if ( config == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  entry_count = config->entry_count;
+
+  if ( entry_count == 0 ) {
+    entry_count = RTEMS_PROFILING_SAMPLER_DEFAULT_ENTRY_COUNT;
+  }
+
+  if ( ( entry_count & ( entry_count - 1 ) ) != 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  if (
+    config->period > 0 && rtems_profiling_sampler_get_interrupted_pc == NULL
+  ) {
+    return RTEMS_NOT_IMPLEMENTED;
+  }
+
+  rtems_mutex_lock( &_Sampler.mutex );
+
+  if ( _Sampler.started ) {
+    rtems_mutex_unlock( &_Sampler.mutex );
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+  per_cpu = _Sampler_Get_per_CPU( cpu_max );
+  tables = calloc( cpu_max, sizeof( *tables ) );
+
+  if ( per_cpu == NULL || tables == NULL ) {
+    free( tables );
+    rtems_mutex_unlock( &_Sampler.mutex );
+    return RTEMS_NO_MEMORY;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    tables[ cpu_index ] = calloc( entry_count, sizeof( Sampler_Entry ) );
+
+    if ( tables[ cpu_index ] == NULL ) {
+      _Sampler_Free_tables( tables, cpu_max );
+      rtems_mutex_unlock( &_Sampler.mutex );
+      return RTEMS_NO_MEMORY;
+    }
+  }
+
+  _Sampler.period = config->period;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Sampler_Per_CPU  *control;
+    Sampler_Entry    *previous;
+    ISR_lock_Context  lock_context;
+
+    control = &per_cpu[ cpu_index ];
+    _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+    previous = control->entries;
+    control->entries = tables[ cpu_index ];
+    control->mask = entry_count - 1;
+    control->samples = 0;
+    control->dropped = 0;
+    control->active = true;
+
+    if (
+      config->period > 0
+        && _Per_CPU_Is_processor_online( _Per_CPU_Get_by_index( cpu_index ) )
+    ) {
+      _Watchdog_Per_CPU_insert_ticks(
+        &control->Watchdog,
+        _Per_CPU_Get_by_index( cpu_index ),
+        config->period
+      );
+    }
+
+    _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+    tables[ cpu_index ] = previous;
+  }
+
+  _Sampler_Free_tables( tables, cpu_max );
+  _Sampler.started = true;
+  rtems_mutex_unlock( &_Sampler.mutex );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_profiling_sampler_stop( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  rtems_mutex_lock( &_Sampler.mutex );
+
+  if ( _Sampler.started ) {
+    cpu_max = rtems_configuration_get_maximum_processors();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Sampler_Per_CPU  *control;
+      ISR_lock_Context  lock_context;
+
+      control = &_Sampler.per_cpu[ cpu_index ];
+      _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+      control->active = false;
+      _Watchdog_Per_CPU_remove_ticks( &control->Watchdog );
+      _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+    }
+
+    _Sampler.started = false;
+  }
+
+  rtems_mutex_unlock( &_Sampler.mutex );
+}
+
+void rtems_profiling_sampler_reset( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  rtems_mutex_lock( &_Sampler.mutex );
+
+  if ( _Sampler.per_cpu != NULL ) {
+    cpu_max = rtems_configuration_get_maximum_processors();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Sampler_Per_CPU  *control;
+      ISR_lock_Context  lock_context;
+      uint32_t          i;
+
+      control = &_Sampler.per_cpu[ cpu_index ];
+
+      for ( i = 0; control->entries != NULL && i <= control->mask; ) {
+        uint32_t end;
+
+        end = i + SAMPLER_CHUNK_SIZE;
+        _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+
+        while ( i < end && i <= control->mask ) {
+          control->entries[ i ].count = 0;
+          ++i;
+        }
+
+        _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+      }
+
+      _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+      control->samples = 0;
+      control->dropped = 0;
+      _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+    }
+  }
+
+  rtems_mutex_unlock( &_Sampler.mutex );
+}
+
+void rtems_profiling_sampler_get_statistics(
+  rtems_profiling_sampler_statistics *statistics
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  memset( statistics, 0, sizeof( *statistics ) );
+  rtems_mutex_lock( &_Sampler.mutex );
+
+  if ( _Sampler.per_cpu != NULL ) {
+    cpu_max = rtems_configuration_get_maximum_processors();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Sampler_Per_CPU  *control;
+      ISR_lock_Context  lock_context;
+
+      control = &_Sampler.per_cpu[ cpu_index ];
+      _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+      statistics->samples += control->samples;
+      statistics->dropped += control->dropped;
+      _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+    }
+  }
+
+  rtems_mutex_unlock( &_Sampler.mutex );
+}
+
+void rtems_profiling_sampler_iterate(
+  rtems_profiling_sampler_visitor  visitor,
+  void                            *arg
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  rtems_mutex_lock( &_Sampler.mutex );
+
+  if ( _Sampler.per_cpu != NULL ) {
+    cpu_max = rtems_configuration_get_maximum_processors();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Sampler_Per_CPU *control;
+      uint32_t         i;
+
+      control = &_Sampler.per_cpu[ cpu_index ];
+
+      for ( i = 0; control->entries != NULL && i <= control->mask; ) {
+        Sampler_Entry    chunk[ SAMPLER_CHUNK_SIZE ];
+        ISR_lock_Context lock_context;
+        uint32_t         n;
+        uint32_t         j;
+
+        n = 0;
+        _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+
+        while ( n < SAMPLER_CHUNK_SIZE && i <= control->mask ) {
+          chunk[ n ] = control->entries[ i ];
+          ++n;
+          ++i;
+        }
+
+        _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+
+        for ( j = 0; j < n; ++j ) {
+          rtems_profiling_sampler_entry entry;
+
+          if ( chunk[ j ].count == 0 ) {
+            continue;
+          }
+
+          entry.pc = chunk[ j ].pc;
+          entry.thread = chunk[ j ].thread;
+          entry.cpu_index = cpu_index;
+          entry.count = chunk[ j ].count;
+          ( *visitor )( arg, &entry );
+        }
+      }
+    }
+  }
+
+  rtems_mutex_unlock( &_Sampler.mutex );
+}
+
+typedef struct {
+  int      fd;
+  bool     failed;
+  size_t   used;
+  uint32_t buffer[ 5 * SAMPLER_CHUNK_SIZE ];
+} Sampler_Export_context;
+
+static void _Sampler_Export_write(
+  Sampler_Export_context *ctx,
+  const void             *data,
+  size_t                  size
+)
+{
+  if ( !ctx->failed && write( ctx->fd, data, size ) != (ssize_t) size ) {
+    ctx->failed = true;
+  }
+}
+
+static void _Sampler_Export_visitor(
+  void                                *arg,
+  const rtems_profiling_sampler_entry *entry
+)
+{
+  Sampler_Export_context *ctx;
+  uint64_t                pc;
+  uint32_t               *item;
+
+  ctx = arg;
+
+  if ( ctx->used == RTEMS_ARRAY_SIZE( ctx->buffer ) ) {
+    _Sampler_Export_write( ctx, ctx->buffer, sizeof( ctx->buffer ) );
+    ctx->used = 0;
+  }
+
+  item = &ctx->buffer[ ctx->used ];
+  pc = entry->pc;
+  memcpy( &item[ 0 ], &pc, sizeof( pc ) );
+  item[ 2 ] = entry->thread;
+  item[ 3 ] = entry->cpu_index;
+  item[ 4 ] = entry->count;
+  ctx->used += 5;
+}
+
+rtems_status_code rtems_profiling_sampler_export( int fd )
+{
+  Sampler_Export_context *ctx;
+  uint32_t                header[ 4 ];
+  bool                    failed;
+
+  ctx = calloc( 1, sizeof( *ctx ) );
+
+  if ( ctx == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  ctx->fd = fd;
+  header[ 0 ] = RTEMS_PROFILING_SAMPLER_EXPORT_MAGIC;
+  header[ 1 ] = 1;
+  header[ 2 ] = 5 * sizeof( uint32_t );
+  header[ 3 ] = sizeof( uintptr_t );
+  _Sampler_Export_write( ctx, header, sizeof( header ) );
+  rtems_profiling_sampler_iterate( _Sampler_Export_visitor, ctx );
+  _Sampler_Export_write( ctx, ctx->buffer, ctx->used * sizeof( uint32_t ) );
+  failed = ctx->failed;
+  free( ctx );
+
+  return failed ? RTEMS_IO_ERROR : RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,239 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIProfiling
+ *
+ * @brief This source file contains the implementation of the sampling
+ *   profiler report.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+typedef struct {
+  uintptr_t   begin;
+  const char *name;
+  uint64_t    count;
+} Sampler_Function;
+
+typedef struct {
+  rtems_profiling_sampler_resolver  resolver;
+  Sampler_Function                 *functions;
+  size_t                            count;
+  size_t                            capacity;
+  uint64_t                          total;
+  bool                              no_memory;
+} Sampler_Report_context;
+
+static rtems_profiling_sampler_resolver _Sampler_Resolver;
+
+void rtems_profiling_sampler_set_resolver(
+  rtems_profiling_sampler_resolver resolver
+)
+{
+  _Sampler_Resolver = resolver;
+}
+
+rtems_profiling_sampler_resolver rtems_profiling_sampler_get_resolver( void )
+{
+  return _Sampler_Resolver;
+}
+
+static void _Sampler_Report_visitor(
+  void                                *arg,
+  const rtems_profiling_sampler_entry *entry
+)
+{
+  Sampler_Report_context *ctx;
+  Sampler_Function       *function;
+  uintptr_t               begin;
+  const char             *name;
+
+  ctx = arg;
+  ctx->total += entry->count;
+
+  if ( ctx->no_memory ) {
+    return;
+  }
+
+  if ( ctx->count == ctx->capacity ) {
+    Sampler_Function *more;
+    size_t            capacity;
+
+    capacity = ctx->capacity > 0 ? 2 * ctx->capacity : 256;
+    more = realloc( ctx->functions, capacity * sizeof( *more ) );
+
+    if ( more == NULL ) {
+      ctx->no_memory = true;
+      return;
+    }
+
+    ctx->functions = more;
+    ctx->capacity = capacity;
+  }
+
+  begin = entry->pc;
+  name = NULL;
+
+  if ( entry->pc != 0 && ctx->resolver != NULL ) {
+    name = ( *ctx->resolver )( entry->pc, &begin );
+
+    if ( name == NULL ) {
+      begin = entry->pc;
+    }
+  }
+
+  function = &ctx->functions[ ctx->count ];
+  function->begin = begin;
+  function->name = name;
+  function->count = entry->count;
+  ++ctx->count;
+}
+
+static int _Sampler_Compare_begin( const void *a, const void *b )
+{
+  const Sampler_Function *x;
+  const Sampler_Function *y;
+
+  x = a;
+  y = b;
+
+  if ( x->begin != y->begin ) {
+    return x->begin < y->begin ? -1 : 1;
+  }
+
+  return 0;
+}
+
+static int _Sampler_Compare_count( const void *a, const void *b )
+{
+  const Sampler_Function *x;
+  const Sampler_Function *y;
+
+  x = a;
+  y = b;
+
+  if ( x->count != y->count ) {
+    return x->count > y->count ? -1 : 1;
+  }
+
+  return _Sampler_Compare_begin( a, b );
+}
+
+rtems_status_code rtems_profiling_sampler_report(
+  const rtems_printer *printer,
+  size_t               limit
+)
+{
+  Sampler_Report_context             ctx;
+  rtems_profiling_sampler_statistics stats;
+  size_t                             i;
+  size_t                             n;
+
+  ctx.resolver = _Sampler_Resolver;
+  ctx.functions = NULL;
+  ctx.count = 0;
+  ctx.capacity = 0;
+  ctx.total = 0;
+  ctx.no_memory = false;
+  rtems_profiling_sampler_iterate( _Sampler_Report_visitor, &ctx );
+
+  if ( ctx.no_memory ) {
+    free( ctx.functions );
+    return RTEMS_NO_MEMORY;
+  }
+
+  /* Merge the entries of all threads and processors by function */
+  qsort(
+    ctx.functions,
+    ctx.count,
+    sizeof( *ctx.functions ),
+    _Sampler_Compare_begin
+  );
+
+  n = 0;
+
+  for ( i = 0; i < ctx.count; ++i ) {
+    if ( n > 0 && ctx.functions[ n - 1 ].begin == ctx.functions[ i ].begin ) {
+      ctx.functions[ n - 1 ].count += ctx.functions[ i ].count;
+    } else {
+      ctx.functions[ n ] = ctx.functions[ i ];
+      ++n;
+    }
+  }
+
+  qsort( ctx.functions, n, sizeof( *ctx.functions ), _Sampler_Compare_count );
+
+  if ( limit > n ) {
+    limit = n;
+  }
+
+  rtems_printf( printer, "SAMPLES  PERCENT  FUNCTION\n" );
+
+  for ( i = 0; i < limit; ++i ) {
+    const Sampler_Function *function;
+    uint64_t                permille;
+
+    function = &ctx.functions[ i ];
+    permille = ( 1000 * function->count ) / ctx.total;
+    rtems_printf(
+      printer,
+      "%7" PRIu64 "  %3" PRIu64 ".%" PRIu64 "%%  ",
+      function->count,
+      permille / 10,
+      permille % 10
+    );
+
+    if ( function->name != NULL ) {
+      rtems_printf( printer, "%s\n", function->name );
+    } else if ( function->begin == 0 ) {
+      rtems_printf( printer, "[unknown]\n" );
+    } else {
+      rtems_printf( printer, "0x%08" PRIxPTR "\n", function->begin );
+    }
+  }
+
+  rtems_profiling_sampler_get_statistics( &stats );
+  rtems_printf(
+    printer,
+    "%" PRIu64 " samples, %" PRIu64 " dropped\n",
+    stats.samples,
+    stats.dropped
+  );
+  free( ctx.functions );
+
+  return RTEMS_SUCCESSFUL;
+}
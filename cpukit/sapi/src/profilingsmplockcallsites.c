@@ -0,0 +1,143 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIProfiling
+ *
+ * @brief This source file contains the implementation of the SMP lock call
+ *   site profiling support.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+#include <rtems/config.h>
+#include <rtems/thread.h>
+#include <rtems/score/smplock.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+static rtems_mutex _SMP_lock_Call_sites_mutex =
+  RTEMS_MUTEX_INITIALIZER( "SMP Lock Call Sites" );
+#endif
+
+rtems_status_code rtems_profiling_smp_lock_call_sites_enable(void)
+{
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+  SMP_lock_Stats_call_site_table *tables;
+
+  rtems_mutex_lock(&_SMP_lock_Call_sites_mutex);
+
+  tables = _SMP_lock_Stats_call_sites.tables;
+
+  if (tables == NULL) {
+    tables = calloc(
+      rtems_configuration_get_maximum_processors(),
+      sizeof(*tables)
+    );
+
+    if (tables == NULL) {
+      rtems_mutex_unlock(&_SMP_lock_Call_sites_mutex);
+      return RTEMS_NO_MEMORY;
+    }
+
+    _SMP_lock_Stats_call_sites.tables = tables;
+  }
+
+  /*
+   * Make sure the tables are visible on other processors before the lock
+   * releases observe the enabled call site profiling.
+   */
+  _Atomic_Fence(ATOMIC_ORDER_RELEASE);
+  _SMP_lock_Stats_call_sites.enabled = true;
+
+  rtems_mutex_unlock(&_SMP_lock_Call_sites_mutex);
+  return RTEMS_SUCCESSFUL;
+#else
+  return RTEMS_NOT_IMPLEMENTED;
+#endif
+}
+
+void rtems_profiling_smp_lock_call_sites_disable(void)
+{
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+  _SMP_lock_Stats_call_sites.enabled = false;
+#endif
+}
+
+void rtems_profiling_smp_lock_call_sites_reset(void)
+{
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+  SMP_lock_Stats_call_site_table *tables;
+
+  rtems_mutex_lock(&_SMP_lock_Call_sites_mutex);
+
+  tables = _SMP_lock_Stats_call_sites.tables;
+
+  if (tables != NULL) {
+    memset(
+      tables,
+      0,
+      rtems_configuration_get_maximum_processors() * sizeof(*tables)
+    );
+  }
+
+  rtems_mutex_unlock(&_SMP_lock_Call_sites_mutex);
+#endif
+}
+
+uint32_t rtems_profiling_smp_lock_call_sites_get_dropped(void)
+{
+  uint32_t dropped;
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+  const SMP_lock_Stats_call_site_table *tables;
+  uint32_t n;
+  uint32_t i;
+#endif
+
+  dropped = 0;
+
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+  tables = _SMP_lock_Stats_call_sites.tables;
+
+  if (tables != NULL) {
+    n = rtems_configuration_get_maximum_processors();
+
+    for (i = 0; i < n; ++i) {
+      dropped += tables[i].dropped;
+    }
+  }
+#endif
+
+  return dropped;
+}
@@ -0,0 +1,110 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIStackCache
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_stack_cache_get_information() and rtems_stack_cache_prefill().
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/stackcache.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/stackimpl.h>
+#include <rtems/score/wkspace.h>
+
+rtems_status_code rtems_stack_cache_get_information(
+  rtems_stack_cache_information *info
+)
+{
+  const Stack_Cache_Control *cache;
+
+  if ( info == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  cache = &_Stack_Cache;
+
+  _Objects_Allocator_lock();
+  info->maximum = _Stack_Cache_maximum;
+  info->count = cache->count;
+  info->size = cache->size;
+  info->hits = cache->hits;
+  info->misses = cache->misses;
+  info->overflows = cache->overflows;
+  _Objects_Allocator_unlock();
+
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_stack_cache_prefill(
+  size_t   stack_size,
+  bool     is_fp,
+  uint32_t count
+)
+{
+  rtems_status_code status;
+  size_t            size;
+  uint32_t          i;
+
+  if ( _Stack_Cache_maximum == 0 ) {
+    return RTEMS_NOT_CONFIGURED;
+  }
+
+  size = _Stack_Ensure_minimum( stack_size );
+  size = _Stack_Extend_size( size, is_fp );
+  status = RTEMS_SUCCESSFUL;
+
+  _Objects_Allocator_lock();
+
+  for ( i = 0; i < count; ++i ) {
+    void *stack_area;
+
+    stack_area = _Workspace_Allocate( size );
+
+    if ( stack_area == NULL ) {
+      status = RTEMS_UNSATISFIED;
+      break;
+    }
+
+    if ( !_Stack_Cache_Put( stack_area ) ) {
+      _Workspace_Free( stack_area );
+      status = RTEMS_TOO_MANY;
+      break;
+    }
+  }
+
+  _Objects_Allocator_unlock();
+
+  return status;
+}
@@ -0,0 +1,370 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief This source file contains the implementation of the heap
+ *   allocation profiler hooks.
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapprofiler.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/watchdogticks.h>
+
+#include <string.h>
+
+#define HEAP_PROFILER_MAGIC 0x48505246
+
+/*
+ * The count of entries probed for a free entry.  This bounds the time spent
+ * with interrupts disabled.
+ */
+#define HEAP_PROFILER_PROBE_LIMIT 16
+
+Heap_Profiler_Control _Heap_Profiler;
+
+static uint32_t _Heap_Profiler_Check(
+  uintptr_t                    alloc_begin,
+  const Heap_Profiler_Trailer *trailer
+)
+{
+  uintptr_t check;
+
+  check = HEAP_PROFILER_MAGIC ^ alloc_begin ^ trailer->site ^ trailer->size;
+  check ^= (uintptr_t) trailer->ticks * 0x9e3779b1;
+  check ^= (uintptr_t) trailer->generation * 0x85ebca6b;
+  check ^= (uintptr_t) trailer->cpu_index << 24;
+
+  return (uint32_t) check ^ (uint32_t) ( (uint64_t) check >> 32 );
+}
+
+static char *_Heap_Profiler_Trailer_location(
+  Heap_Control *heap,
+  void         *alloc_begin
+)
+{
+  uintptr_t alloc_size;
+
+  if ( !_Heap_Size_of_alloc_area( heap, alloc_begin, &alloc_size ) ) {
+    return NULL;
+  }
+
+  if ( alloc_size < sizeof( Heap_Profiler_Trailer ) ) {
+    return NULL;
+  }
+
+  return (char *) alloc_begin + alloc_size - sizeof( Heap_Profiler_Trailer );
+}
+
+static void _Heap_Profiler_Write_trailer(
+  char                  *where,
+  void                  *alloc_begin,
+  Heap_Profiler_Trailer *trailer
+)
+{
+  trailer->check = _Heap_Profiler_Check( (uintptr_t) alloc_begin, trailer );
+  memcpy( where, trailer, sizeof( *trailer ) );
+}
+
+static Heap_Profiler_Site *_Heap_Profiler_Get_site(
+  Heap_Profiler_Per_CPU *control,
+  uintptr_t              site,
+  Heap_Profiler_Kind     kind
+)
+{
+  uint32_t index;
+  uint32_t probe;
+
+  index = (uint32_t) ( site ^ ( site >> 11 ) ) * UINT32_C( 0x9e3779b1 );
+  index ^= index >> 16;
+
+  for ( probe = 0; probe < HEAP_PROFILER_PROBE_LIMIT; ++probe ) {
+    Heap_Profiler_Site *entry;
+
+    entry = &control->sites[ ( index + probe ) & control->mask ];
+
+    if ( entry->site == site && entry->kind == kind ) {
+      return entry;
+    }
+
+    if ( entry->site == 0 ) {
+      entry->site = site;
+      entry->kind = kind;
+      return entry;
+    }
+  }
+
+  ++control->dropped;
+  return NULL;
+}
+
+static uint32_t _Heap_Profiler_Lifetime_bin( uint32_t lifetime )
+{
+  uint32_t bin;
+
+  bin = 0;
+
+  while ( lifetime != 0 && bin < HEAP_PROFILER_LIFETIME_BIN_COUNT - 1 ) {
+    lifetime >>= 1;
+    ++bin;
+  }
+
+  return bin;
+}
+
+typedef enum {
+  HEAP_PROFILER_ALLOCATE,
+  HEAP_PROFILER_FREE,
+  HEAP_PROFILER_GROW,
+  HEAP_PROFILER_SHRINK
+} Heap_Profiler_Operation;
+
+/*
+ * Accounts the operation.  An allocation is accounted in the table of the
+ * current processor if the profiler is enabled.  It sets the generation and
+ * processor index of the trailer.  The other operations are accounted in the
+ * table of the processor which accounted the allocation, if the block belongs
+ * to the current generation.  Returns true, if the operation was accounted.
+ */
+static bool _Heap_Profiler_Account(
+  Heap_Profiler_Trailer   *trailer,
+  Heap_Profiler_Kind       kind,
+  Heap_Profiler_Operation  operation,
+  uintptr_t                size
+)
+{
+  Heap_Profiler_Per_CPU *per_cpu;
+  Heap_Profiler_Per_CPU *control;
+  Heap_Profiler_Site    *site;
+  ISR_lock_Context       lock_context;
+  bool                   accounted;
+
+  per_cpu = _Heap_Profiler.per_cpu;
+  accounted = false;
+  _ISR_lock_ISR_disable( &lock_context );
+
+  if ( operation == HEAP_PROFILER_ALLOCATE ) {
+    trailer->cpu_index = _Per_CPU_Get_index( _Per_CPU_Get() );
+  }
+
+  control = &per_cpu[ trailer->cpu_index ];
+  _ISR_lock_Acquire( &control->Lock, &lock_context );
+
+  if ( operation == HEAP_PROFILER_ALLOCATE ) {
+    trailer->generation = _Heap_Profiler.generation;
+
+    if ( !_Heap_Profiler.enabled ) {
+      /* Make the generation check fail */
+      trailer->generation = ~_Heap_Profiler.generation;
+    }
+  }
+
+  if ( trailer->generation == _Heap_Profiler.generation ) {
+    site = _Heap_Profiler_Get_site( control, trailer->site, kind );
+
+    if ( site != NULL ) {
+      accounted = true;
+
+      switch ( operation ) {
+        case HEAP_PROFILER_ALLOCATE:
+          ++site->allocations;
+          site->allocated_bytes += size;
+          break;
+        case HEAP_PROFILER_FREE:
+          _Assert( site->freed_bytes + size <= site->allocated_bytes );
+          ++site->frees;
+          site->freed_bytes += size;
+          ++site->lifetimes[
+            _Heap_Profiler_Lifetime_bin(
+              _Watchdog_Ticks_since_boot - trailer->ticks
+            )
+          ];
+          break;
+        case HEAP_PROFILER_GROW:
+          site->allocated_bytes += size;
+          break;
+        default:
+          _Assert( site->freed_bytes + size <= site->allocated_bytes );
+          site->freed_bytes += size;
+          break;
+      }
+    }
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+
+  return accounted;
+}
+
+void _Heap_Profiler_Allocate(
+  Heap_Control       *heap,
+  void               *alloc_begin,
+  uintptr_t           size,
+  void               *site,
+  Heap_Profiler_Kind  kind
+)
+{
+  Heap_Profiler_Trailer  trailer;
+  char                  *where;
+
+  where = _Heap_Profiler_Trailer_location( heap, alloc_begin );
+
+  if ( where == NULL ) {
+    return;
+  }
+
+  trailer.site = (uintptr_t) site;
+  trailer.size = size;
+  trailer.ticks = _Watchdog_Ticks_since_boot;
+
+  /*
+   * Only accounted blocks get a trailer, so that a free is never accounted
+   * without the corresponding allocation.
+   */
+  if (
+    _Heap_Profiler_Account( &trailer, kind, HEAP_PROFILER_ALLOCATE, size )
+  ) {
+    _Heap_Profiler_Write_trailer( where, alloc_begin, &trailer );
+  }
+}
+
+bool _Heap_Profiler_Get_trailer(
+  Heap_Control          *heap,
+  void                  *alloc_begin,
+  Heap_Profiler_Trailer *trailer
+)
+{
+  char *where;
+
+  if ( _Heap_Profiler.per_cpu == NULL ) {
+    return false;
+  }
+
+  where = _Heap_Profiler_Trailer_location( heap, alloc_begin );
+
+  if ( where == NULL ) {
+    return false;
+  }
+
+  memcpy( trailer, where, sizeof( *trailer ) );
+
+  return trailer->check
+    == _Heap_Profiler_Check( (uintptr_t) alloc_begin, trailer );
+}
+
+void _Heap_Profiler_Resize(
+  Heap_Control                *heap,
+  void                        *alloc_begin,
+  const Heap_Profiler_Trailer *trailer,
+  uintptr_t                    size,
+  Heap_Profiler_Kind           kind
+)
+{
+  Heap_Profiler_Trailer  new_trailer;
+  char                  *where;
+
+  where = _Heap_Profiler_Trailer_location( heap, alloc_begin );
+
+  if ( where == NULL ) {
+    return;
+  }
+
+  new_trailer = *trailer;
+
+  /*
+   * The size of the trailer is the accounted size.  It is only changed if the
+   * resize was accounted.  The trailer moves to the new end of the allocated
+   * area in any case.
+   */
+  if ( size > trailer->size ) {
+    if (
+      _Heap_Profiler_Account(
+        &new_trailer,
+        kind,
+        HEAP_PROFILER_GROW,
+        size - trailer->size
+      )
+    ) {
+      new_trailer.size = size;
+    }
+  } else {
+    if (
+      _Heap_Profiler_Account(
+        &new_trailer,
+        kind,
+        HEAP_PROFILER_SHRINK,
+        trailer->size - size
+      )
+    ) {
+      new_trailer.size = size;
+    }
+  }
+
+  _Heap_Profiler_Write_trailer( where, alloc_begin, &new_trailer );
+}
+
+void _Heap_Profiler_Do_free(
+  Heap_Control       *heap,
+  void               *alloc_begin,
+  Heap_Profiler_Kind  kind
+)
+{
+  Heap_Profiler_Trailer  trailer;
+  char                  *where;
+
+  where = _Heap_Profiler_Trailer_location( heap, alloc_begin );
+
+  if ( where == NULL ) {
+    return;
+  }
+
+  memcpy( &trailer, where, sizeof( trailer ) );
+
+  if (
+    trailer.check != _Heap_Profiler_Check( (uintptr_t) alloc_begin, &trailer )
+  ) {
+    return;
+  }
+
+  /* Make sure a later allocation of this area is not taken as profiled */
+  memset( where, 0, sizeof( trailer ) );
+  (void) _Heap_Profiler_Account(
+    &trailer,
+    kind,
+    HEAP_PROFILER_FREE,
+    trailer.size
+  );
+}
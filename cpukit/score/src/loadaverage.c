@@ -0,0 +1,211 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreLoadAverage
+ *
+ * @brief This source file contains the implementation of
+ *   _Load_average_Do_add_busy() and _Load_average_Get().
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/loadaverage.h>
+
+#include <string.h>
+
+/*
+ * The decay factors per period are exp(-1/16 / tau) * LOAD_AVERAGE_ONE for
+ * the time constants tau of one second, ten seconds, and one minute.
+ */
+static const uint32_t _Load_average_Decay[ LOAD_AVERAGE_COUNT ] = {
+  61565,
+  65128,
+  65468
+};
+
+static uint32_t _Load_average_Multiply( uint32_t a, uint32_t b )
+{
+  uint64_t product;
+
+  product = (uint64_t) a * b + LOAD_AVERAGE_ONE / 2;
+
+  return (uint32_t) ( product >> LOAD_AVERAGE_SHIFT );
+}
+
+/*
+ * Computes x**n by exponentiation by squaring.  Since x is less than one, the
+ * loop terminates after a few iterations even for large n.
+ */
+static uint32_t _Load_average_Power( uint32_t x, uint64_t n )
+{
+  uint32_t result;
+
+  result = LOAD_AVERAGE_ONE;
+
+  while ( n != 0 ) {
+    if ( ( n & 1 ) != 0 ) {
+      result = _Load_average_Multiply( result, x );
+    }
+
+    n >>= 1;
+    x = _Load_average_Multiply( x, x );
+
+    if ( x == 0 && n != 0 ) {
+      return 0;
+    }
+  }
+
+  return result;
+}
+
+/*
+ * Accounts the busy time of the current period and the idle periods up to the
+ * begin of the specified period which shall be later than the current period.
+ */
+static void _Load_average_Advance(
+  Load_average_Control *load,
+  int64_t               period
+)
+{
+  uint32_t busy;
+  uint64_t idle;
+  size_t   i;
+
+  busy = (uint32_t) (
+    load->busy >> ( LOAD_AVERAGE_PERIOD_SHIFT - LOAD_AVERAGE_SHIFT )
+  );
+
+  if ( busy > LOAD_AVERAGE_ONE ) {
+    busy = LOAD_AVERAGE_ONE;
+  }
+
+  idle = (uint64_t) ( period - load->period - 1 );
+
+  for ( i = 0; i < LOAD_AVERAGE_COUNT; ++i ) {
+    uint32_t decay;
+    uint64_t sum;
+    uint32_t average;
+
+    decay = _Load_average_Decay[ i ];
+    sum = (uint64_t) load->average[ i ] * decay +
+      (uint64_t) busy * ( LOAD_AVERAGE_ONE - decay ) + LOAD_AVERAGE_ONE / 2;
+    average = (uint32_t) ( sum >> LOAD_AVERAGE_SHIFT );
+
+    if ( idle != 0 ) {
+      average = _Load_average_Multiply(
+        average,
+        _Load_average_Power( decay, idle )
+      );
+    }
+
+    load->average[ i ] = average;
+  }
+
+  load->busy = 0;
+  load->period = period;
+}
+
+void _Load_average_Do_add_busy(
+  Load_average_Control *load,
+  Timestamp_Control     begin,
+  Timestamp_Control     end
+)
+{
+  int64_t first;
+  int64_t last;
+  int64_t full;
+
+  first = begin >> LOAD_AVERAGE_PERIOD_SHIFT;
+  last = end >> LOAD_AVERAGE_PERIOD_SHIFT;
+
+  if ( last < load->period ) {
+    return;
+  }
+
+  if ( first < load->period ) {
+    first = load->period;
+    begin = first << LOAD_AVERAGE_PERIOD_SHIFT;
+  } else if ( first > load->period ) {
+    _Load_average_Advance( load, first );
+  }
+
+  if ( first == last ) {
+    load->busy += end - begin;
+    return;
+  }
+
+  load->busy += ( ( first + 1 ) << LOAD_AVERAGE_PERIOD_SHIFT ) - begin;
+  _Load_average_Advance( load, first + 1 );
+
+  /*
+   * For a constant busy fraction of one, the average after n periods is
+   * 1 - ( 1 - average ) * decay**n.
+   */
+  full = last - first - 1;
+
+  if ( full != 0 ) {
+    size_t i;
+
+    for ( i = 0; i < LOAD_AVERAGE_COUNT; ++i ) {
+      uint32_t idle;
+
+      idle = _Load_average_Multiply(
+        LOAD_AVERAGE_ONE - load->average[ i ],
+        _Load_average_Power( _Load_average_Decay[ i ], (uint64_t) full )
+      );
+      load->average[ i ] = LOAD_AVERAGE_ONE - idle;
+    }
+
+    load->period = last;
+  }
+
+  load->busy = end - ( last << LOAD_AVERAGE_PERIOD_SHIFT );
+}
+
+void _Load_average_Get(
+  const Load_average_Control *load,
+  Timestamp_Control           now,
+  uint32_t                    average[ LOAD_AVERAGE_COUNT ]
+)
+{
+  Load_average_Control current;
+  int64_t              period;
+
+  current = *load;
+  period = now >> LOAD_AVERAGE_PERIOD_SHIFT;
+
+  if ( period > current.period ) {
+    _Load_average_Advance( &current, period );
+  }
+
+  memcpy( average, current.average, sizeof( current.average ) );
+}
@@ -29,6 +29,8 @@
 
 #include <rtems/score/smplock.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/isrlevel.h>
+#include <rtems/score/smp.h>
 
 #include <string.h>
 
@@ -61,6 +63,76 @@ static SMP_lock_Stats_control _SMP_lock_Stats_control = {
   )
 };
 
+SMP_lock_Stats_call_site_control _SMP_lock_Stats_call_sites;
+
+/*
+ * The maximum count of hash table entries probed for a call site.
+ */
+#define SMP_LOCK_STATS_CALL_SITE_PROBE_LIMIT 16
+
+void _SMP_lock_Stats_call_site_update(
+  const SMP_lock_Stats_context *stats_context,
+  CPU_Counter_ticks             section_time
+)
+{
+  SMP_lock_Stats_call_site_table *table;
+  uintptr_t                       call_site;
+  const char                     *name;
+  uintptr_t                       hash;
+  ISR_Level                       level;
+  uint32_t                        i;
+
+  call_site = stats_context->call_site;
+
+  if ( call_site == 0 ) {
+    return;
+  }
+
+  name = stats_context->stats->name;
+  hash = ( call_site >> 2 ) ^ ( (uintptr_t) name >> 3 );
+
+  /*
+   * Each processor owns its table.  The interrupts are disabled to protect
+   * the table against lock uses in interrupt handlers.  No SMP lock can be
+   * used here, since this function is called by the lock release.
+   */
+  _ISR_Local_disable( level );
+  table = &_SMP_lock_Stats_call_sites.tables[ _SMP_Get_current_processor() ];
+
+  for ( i = 0; i < SMP_LOCK_STATS_CALL_SITE_PROBE_LIMIT; ++i ) {
+    SMP_lock_Stats_call_site *site;
+
+    site = &table->sites[
+      ( hash + i ) & ( SMP_LOCK_STATS_CALL_SITE_COUNT - 1 )
+    ];
+
+    if ( site->call_site == 0 ) {
+      site->call_site = call_site;
+      site->name = name;
+    } else if ( site->call_site != call_site || site->name != name ) {
+      continue;
+    }
+
+    ++site->usage_count;
+    site->total_acquire_time += stats_context->acquire_time;
+    site->total_section_time += section_time;
+
+    if ( site->max_acquire_time < stats_context->acquire_time ) {
+      site->max_acquire_time = stats_context->acquire_time;
+    }
+
+    if ( site->max_section_time < section_time ) {
+      site->max_section_time = section_time;
+    }
+
+    _ISR_Local_enable( level );
+    return;
+  }
+
+  ++table->dropped;
+  _ISR_Local_enable( level );
+}
+
 void _SMP_lock_Stats_destroy( SMP_lock_Stats *stats )
 {
   if ( !_Chain_Is_node_off_chain( &stats->Node ) ) {
@@ -50,6 +50,9 @@ void _SMP_lock_Acquire(
 )
 {
   _SMP_lock_Acquire_inline( lock, context );
+#if defined(RTEMS_PROFILING)
+  context->Stats_context.call_site = (uintptr_t) RTEMS_RETURN_ADDRESS();
+#endif
 }
 
 #if defined(RTEMS_SMP_LOCK_DO_NOT_INLINE)
@@ -68,6 +71,9 @@ void _SMP_lock_ISR_disable_and_acquire(
 )
 {
   _SMP_lock_ISR_disable_and_acquire_inline( lock, context );
+#if defined(RTEMS_PROFILING)
+  context->Stats_context.call_site = (uintptr_t) RTEMS_RETURN_ADDRESS();
+#endif
 }
 
 #if defined(RTEMS_SMP_LOCK_DO_NOT_INLINE)
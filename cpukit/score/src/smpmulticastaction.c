@@ -6,7 +6,9 @@
  * @ingroup RTEMSScoreSMP
  *
  * @brief This source file contains the implementation of
- *   _SMP_Multicast_action().
+ *   _SMP_Multicast_action(), _SMP_Multicast_action_async(),
+ *   _SMP_Multicast_batch_add(), _SMP_Multicast_batch_flush(),
+ *   _SMP_Multicast_request_is_done(), and _SMP_Multicast_request_wait().
  */
 
 /*
@@ -106,3 +108,171 @@ void _SMP_Multicast_action(
   _SMP_Issue_action_jobs( targets, &jobs, cpu_max );
   _SMP_Wait_for_action_jobs( targets, &jobs, cpu_max );
 }
+
+static void _SMP_Multicast_request_handler( void *arg )
+{
+  SMP_Multicast_request      *request;
+  SMP_Multicast_done_handler  done;
+  void                       *done_arg;
+  unsigned int                pending;
+
+  request = arg;
+  done = request->done;
+  done_arg = request->done_arg;
+
+  ( *request->handler )( request->arg );
+
+  /*
+   * The storage of the request is valid until the job done indicator of this
+   * job is set by _Per_CPU_Perform_jobs() after the return of this handler.
+   */
+  pending = _Atomic_Fetch_sub_uint(
+    &request->pending,
+    1,
+    ATOMIC_ORDER_ACQ_REL
+  );
+
+  if ( pending == 1 && done != NULL ) {
+    ( *done )( done_arg );
+  }
+}
+
+void _SMP_Multicast_batch_add(
+  SMP_Multicast_batch        *batch,
+  SMP_Multicast_request      *request,
+  const Processor_mask       *targets,
+  SMP_Action_handler          handler,
+  void                       *arg,
+  SMP_Multicast_done_handler  done,
+  void                       *done_arg
+)
+{
+  uint32_t     cpu_max;
+  uint32_t     cpu_index;
+  unsigned int count;
+
+  cpu_max = _SMP_Get_processor_maximum();
+  _Assert( cpu_max <= RTEMS_ARRAY_SIZE( request->Jobs ) );
+
+  request->Context.handler = _SMP_Multicast_request_handler;
+  request->Context.arg = request;
+  request->handler = handler;
+  request->arg = arg;
+  request->done = done;
+  request->done_arg = done_arg;
+  _Processor_mask_Zero( &request->targets );
+
+  count = 0;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( targets, cpu_index ) ) {
+      _Processor_mask_Set( &request->targets, cpu_index );
+      ++count;
+    }
+  }
+
+  /* The pending count must be valid before the first job is added */
+  _Atomic_Init_uint( &request->pending, count );
+
+  if ( count == 0 ) {
+    if ( done != NULL ) {
+      ( *done )( done_arg );
+    }
+
+    return;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &request->targets, cpu_index ) ) {
+      Per_CPU_Job *job;
+
+      job = &request->Jobs[ cpu_index ];
+      job->context = &request->Context;
+      _Per_CPU_Add_job( _Per_CPU_Get_by_index( cpu_index ), job );
+    }
+  }
+
+  _Processor_mask_Or( &batch->targets, &batch->targets, &request->targets );
+}
+
+void _SMP_Multicast_batch_flush( SMP_Multicast_batch *batch )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &batch->targets, cpu_index ) ) {
+      _SMP_Send_message(
+        _Per_CPU_Get_by_index( cpu_index ),
+        SMP_MESSAGE_PERFORM_JOBS
+      );
+    }
+  }
+
+  _Processor_mask_Zero( &batch->targets );
+}
+
+void _SMP_Multicast_action_async(
+  SMP_Multicast_request      *request,
+  const Processor_mask       *targets,
+  SMP_Action_handler          handler,
+  void                       *arg,
+  SMP_Multicast_done_handler  done,
+  void                       *done_arg
+)
+{
+  SMP_Multicast_batch batch;
+
+  _SMP_Multicast_batch_initialize( &batch );
+  _SMP_Multicast_batch_add(
+    &batch,
+    request,
+    targets,
+    handler,
+    arg,
+    done,
+    done_arg
+  );
+  _SMP_Multicast_batch_flush( &batch );
+}
+
+bool _SMP_Multicast_request_is_done( const SMP_Multicast_request *request )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if (
+      _Processor_mask_Is_set( &request->targets, cpu_index )
+        && _Atomic_Load_ulong(
+          &request->Jobs[ cpu_index ].done,
+          ATOMIC_ORDER_ACQUIRE
+        ) != PER_CPU_JOB_DONE
+    ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void _SMP_Multicast_request_wait( const SMP_Multicast_request *request )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &request->targets, cpu_index ) ) {
+      _Per_CPU_Wait_for_job(
+        _Per_CPU_Get_by_index( cpu_index ),
+        &request->Jobs[ cpu_index ]
+      );
+    }
+  }
+}
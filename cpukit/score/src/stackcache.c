@@ -0,0 +1,202 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreStack
+ *
+ * @brief This source file contains the implementation of
+ *   _Stack_Cache_allocate(), _Stack_Cache_free(), and _Stack_Cache_Put().
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/stackimpl.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/wkspace.h>
+
+Stack_Cache_Control _Stack_Cache;
+
+bool _Stack_Cache_Put( void *stack_area )
+{
+  Stack_Cache_Control *cache;
+  Stack_Cache_Entry   *entry;
+  uintptr_t            size;
+  size_t               bin;
+
+  cache = &_Stack_Cache;
+
+  if ( cache->count >= _Stack_Cache_maximum ) {
+    ++cache->overflows;
+    return false;
+  }
+
+  if ( !_Heap_Size_of_alloc_area( &_Workspace_Area, stack_area, &size ) ) {
+    return false;
+  }
+
+  bin = _Stack_Cache_Get_bin( size );
+  entry = stack_area;
+  entry->size = size;
+  entry->next = cache->bins[ bin ];
+  cache->bins[ bin ] = entry;
+  ++cache->count;
+  cache->size += size;
+
+  return true;
+}
+
+/*
+ * Returns the usable size of the smallest workspace block which satisfies an
+ * allocation request of the size.  The cache bins stack areas by their usable
+ * size, so the lookup has to use the same size.
+ */
+static uintptr_t _Stack_Cache_Usable_size( size_t stack_size )
+{
+  uintptr_t page_size;
+  uintptr_t block_size;
+
+  page_size = _Workspace_Area.page_size;
+  block_size = _Heap_Align_up(
+    stack_size + HEAP_BLOCK_HEADER_SIZE - HEAP_ALLOC_BONUS,
+    page_size
+  );
+
+  if ( block_size < _Workspace_Area.min_block_size ) {
+    block_size = _Workspace_Area.min_block_size;
+  }
+
+  return block_size - HEAP_BLOCK_HEADER_SIZE + HEAP_ALLOC_BONUS;
+}
+
+static Stack_Cache_Entry *_Stack_Cache_Take(
+  Stack_Cache_Control *cache,
+  size_t               bin,
+  size_t               stack_size
+)
+{
+  Stack_Cache_Entry **link;
+  Stack_Cache_Entry  *entry;
+
+  link = &cache->bins[ bin ];
+  entry = *link;
+
+  while ( entry != NULL ) {
+    if ( entry->size >= stack_size ) {
+      *link = entry->next;
+      --cache->count;
+      cache->size -= entry->size;
+      return entry;
+    }
+
+    link = &entry->next;
+    entry = *link;
+  }
+
+  return NULL;
+}
+
+static void _Stack_Cache_Drain( Stack_Cache_Control *cache )
+{
+  size_t bin;
+
+  for ( bin = 0; bin < STACK_CACHE_BIN_COUNT; ++bin ) {
+    Stack_Cache_Entry *entry;
+
+    entry = cache->bins[ bin ];
+    cache->bins[ bin ] = NULL;
+
+    while ( entry != NULL ) {
+      Stack_Cache_Entry *next;
+
+      next = entry->next;
+      _Workspace_Free( entry );
+      entry = next;
+    }
+  }
+
+  cache->count = 0;
+  cache->size = 0;
+}
+
+void *_Stack_Cache_allocate( size_t stack_size )
+{
+  Stack_Cache_Control *cache;
+  Stack_Cache_Entry   *entry;
+  size_t               bin;
+  void                *stack_area;
+
+  cache = &_Stack_Cache;
+  bin = _Stack_Cache_Get_bin( _Stack_Cache_Usable_size( stack_size ) );
+
+  /*
+   * The stack areas of a bin differ in size by less than a factor of two.
+   * Usually the bin contains only stack areas of exactly the requested size,
+   * so this search ends at the first entry.  The workspace may hand out a
+   * block slightly larger than requested if the remainder is too small to be
+   * split off.  Such a stack area may end up in the next bin.  All stack
+   * areas of the next bin are large enough.
+   */
+  entry = _Stack_Cache_Take( cache, bin, stack_size );
+
+  if ( entry == NULL && bin < STACK_CACHE_BIN_COUNT - 1 ) {
+    entry = _Stack_Cache_Take( cache, bin + 1, stack_size );
+  }
+
+  if ( entry != NULL ) {
+    ++cache->hits;
+    return entry;
+  }
+
+  ++cache->misses;
+  stack_area = _Workspace_Allocate( stack_size );
+
+  /*
+   * The cached stack areas may fragment the workspace or simply use up the
+   * space needed for this stack.  Give them back and try again.
+   */
+  if ( stack_area == NULL && cache->count > 0 ) {
+    _Stack_Cache_Drain( cache );
+    stack_area = _Workspace_Allocate( stack_size );
+  }
+
+  return stack_area;
+}
+
+void _Stack_Cache_free( void *addr )
+{
+  if ( addr == NULL ) {
+    return;
+  }
+
+  if ( !_Stack_Cache_Put( addr ) ) {
+    _Workspace_Free( addr );
+  }
+}
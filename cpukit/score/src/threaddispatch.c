@@ -280,6 +280,7 @@ void _Thread_Do_dispatch( Per_CPU_Control *cpu_self, ISR_Level level )
 
     level = _Thread_Preemption_intervention( executing, cpu_self, level );
     heir = _Thread_Get_heir_and_make_it_executing( cpu_self );
+    _Thread_Wake_up_latency_dispatch( cpu_self, heir );
 
     /*
      *  When the heir and executing are the same, then we are being
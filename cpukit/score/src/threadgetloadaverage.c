@@ -0,0 +1,93 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThread
+ *
+ * @brief This source file contains the implementation of
+ *   _Thread_Get_load_average() and _Thread_Get_processor_load_average().
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/schedulerimpl.h>
+
+void _Thread_Get_load_average(
+  Thread_Control *the_thread,
+  uint32_t        average[ LOAD_AVERAGE_COUNT ]
+)
+{
+  const Scheduler_Control *scheduler;
+  ISR_lock_Context         state_lock_context;
+  ISR_lock_Context         scheduler_lock_context;
+  Timestamp_Control        now;
+
+  _Thread_State_acquire( the_thread, &state_lock_context );
+  scheduler = _Thread_Scheduler_get_home( the_thread );
+  _Scheduler_Acquire_critical( scheduler, &scheduler_lock_context );
+
+  /* Account the processor time used since the last update */
+  (void) _Thread_Get_CPU_time_used_locked( the_thread );
+
+  _TOD_Get_uptime( &now );
+  _Load_average_Get( &the_thread->Load_average, now, average );
+
+  _Scheduler_Release_critical( scheduler, &scheduler_lock_context );
+  _Thread_State_release( the_thread, &state_lock_context );
+}
+
+void _Thread_Get_processor_load_average(
+  Per_CPU_Control *cpu,
+  uint32_t         average[ LOAD_AVERAGE_COUNT ]
+)
+{
+  const Scheduler_Control *scheduler;
+  ISR_lock_Context         lock_context;
+  Timestamp_Control        now;
+
+  _ISR_lock_ISR_disable( &lock_context );
+  scheduler = _Scheduler_Get_by_CPU( cpu );
+
+  if ( scheduler != NULL ) {
+    _Scheduler_Acquire_critical( scheduler, &lock_context );
+    _Thread_Update_CPU_time_used( cpu->heir, cpu );
+  }
+
+  _TOD_Get_uptime( &now );
+  _Load_average_Get( &cpu->Load_average, now, average );
+
+  if ( scheduler != NULL ) {
+    _Scheduler_Release_critical( scheduler, &lock_context );
+  }
+
+  _ISR_lock_ISR_enable( &lock_context );
+}
@@ -40,8 +40,25 @@
 
 #include <rtems/score/wkspace.h>
 #include <rtems/score/heapimpl.h>
+#include <rtems/score/heapprofiler.h>
 
 void *_Workspace_Allocate( size_t size )
 {
-  return _Heap_Allocate( &_Workspace_Area, size );
+  void      *area;
+  uintptr_t  alloc_size;
+
+  alloc_size = _Heap_Profiler_Extend_size( size );
+  area = _Heap_Allocate( &_Workspace_Area, alloc_size );
+
+  if ( RTEMS_PREDICT_FALSE( alloc_size != size ) && area != NULL ) {
+    _Heap_Profiler_Allocate(
+      &_Workspace_Area,
+      area,
+      size,
+      RTEMS_RETURN_ADDRESS(),
+      HEAP_PROFILER_WORKSPACE
+    );
+  }
+
+  return area;
 }
@@ -40,11 +40,16 @@
 #include <rtems/score/wkspace.h>
 #include <rtems/score/assert.h>
 #include <rtems/score/heapimpl.h>
+#include <rtems/score/heapprofiler.h>
 
 void _Workspace_Free( void *block )
 {
   bool ok;
 
+  if ( block != NULL ) {
+    _Heap_Profiler_Free( &_Workspace_Area, block, HEAP_PROFILER_WORKSPACE );
+  }
+
   ok = _Heap_Free( &_Workspace_Area, block );
   _Assert( ok );
   (void) ok;
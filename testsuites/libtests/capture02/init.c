@@ -0,0 +1,239 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/captureimpl.h>
+#include <rtems/record.h>
+#include <rtems/recordclient.h>
+#include <rtems.h>
+
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "CAPTURE 2";
+
+#define PRIO_INIT 20
+
+#define PRIO_WORKER 10
+
+typedef struct {
+  rtems_id worker_id;
+  char buf[ 8192 ];
+  size_t size;
+  uint64_t last_bt;
+  bool thread_id_seen;
+  bool thread_name_seen;
+  bool create_seen;
+  bool start_seen;
+  bool begin_seen;
+  bool switch_in_seen;
+  bool switch_out_seen;
+} test_context;
+
+static test_context test_instance;
+
+static void worker( rtems_task_argument arg )
+{
+  rtems_status_code sc;
+
+  (void) arg;
+
+  sc = rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void export_chunk( void *arg, const void *data, size_t length )
+{
+  test_context *ctx;
+
+  ctx = arg;
+  rtems_test_assert( ctx->size + length <= sizeof( ctx->buf ) );
+  memcpy( &ctx->buf[ ctx->size ], data, length );
+  ctx->size += length;
+}
+
+static rtems_record_client_status handler(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  test_context *ctx;
+  bool          is_worker;
+
+  ctx = arg;
+  is_worker = ( data == ctx->worker_id );
+  rtems_test_assert( cpu == 0 );
+
+  if ( bt != 0 ) {
+    rtems_test_assert( bt >= ctx->last_bt );
+    ctx->last_bt = bt;
+  }
+
+  switch ( event ) {
+    case RTEMS_RECORD_THREAD_ID:
+      ctx->thread_id_seen = is_worker;
+      break;
+    case RTEMS_RECORD_THREAD_NAME:
+      if ( ctx->thread_id_seen ) {
+        /* "WORK" packed in the record item data */
+        rtems_test_assert( data == UINT64_C( 0x4b524f57 ) );
+        ctx->thread_name_seen = true;
+        ctx->thread_id_seen = false;
+      }
+      break;
+    case RTEMS_RECORD_THREAD_CREATE:
+      ctx->create_seen |= is_worker;
+      break;
+    case RTEMS_RECORD_THREAD_START:
+      ctx->start_seen |= is_worker;
+      break;
+    case RTEMS_RECORD_THREAD_BEGIN:
+      ctx->begin_seen |= is_worker;
+      break;
+    case RTEMS_RECORD_THREAD_SWITCH_IN:
+      ctx->switch_in_seen |= is_worker;
+      break;
+    case RTEMS_RECORD_THREAD_SWITCH_OUT:
+      ctx->switch_out_seen |= is_worker;
+      break;
+    default:
+      break;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static void test_export( test_context *ctx )
+{
+  rtems_record_client_context client;
+  rtems_record_client_status  cs;
+  Record_Stream_header        header;
+  rtems_status_code           sc;
+  rtems_task_priority         prio;
+  rtems_name                  name;
+
+  sc = rtems_task_set_priority( RTEMS_SELF, PRIO_INIT, &prio );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_capture_open( 4096, NULL );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_capture_watch_global( true );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  name = rtems_build_name( 'W', 'O', 'R', 'K' );
+  sc = rtems_capture_set_trigger(
+    0,
+    0,
+    name,
+    0,
+    rtems_capture_from_any,
+    rtems_capture_create
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_capture_set_control( true );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_create(
+    name,
+    PRIO_WORKER,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker_id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( ctx->worker_id, worker, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_capture_set_control( false );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_capture_export_records( export_chunk, ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_record_client_init( &client, handler, ctx );
+  cs = rtems_record_client_run( &client, ctx->buf, ctx->size );
+  rtems_test_assert( cs == RTEMS_RECORD_CLIENT_SUCCESS );
+  rtems_record_client_destroy( &client );
+
+  rtems_test_assert( ctx->thread_name_seen );
+  rtems_test_assert( ctx->create_seen );
+  rtems_test_assert( ctx->start_seen );
+  rtems_test_assert( ctx->begin_seen );
+  rtems_test_assert( ctx->switch_in_seen );
+  rtems_test_assert( ctx->switch_out_seen );
+
+  /* All records were released by the export, only the header remains */
+  ctx->size = 0;
+  sc = rtems_capture_export_records( export_chunk, ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert(
+    ctx->size == _Record_Stream_header_prepare( &header, 1, 1000000000 )
+  );
+
+  sc = rtems_task_delete( ctx->worker_id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_capture_close();
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_export( &test_instance );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
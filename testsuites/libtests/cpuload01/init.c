@@ -0,0 +1,148 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/cpuuse.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "CPULOAD 1";
+
+#define INVALID_ID 0xfffffffd
+
+#define INTERVAL_IN_SECONDS 2
+
+static void busy_wait( uint64_t nanoseconds )
+{
+  uint64_t end;
+
+  end = rtems_clock_get_uptime_nanoseconds() + nanoseconds;
+
+  while ( rtems_clock_get_uptime_nanoseconds() < end ) {
+    /* Wait */
+  }
+}
+
+static void get_loads(
+  rtems_cpu_load_average *task_load,
+  rtems_cpu_load_average *processor_load
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_cpu_load_average_get_by_task( RTEMS_SELF, task_load );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_cpu_load_average_get_by_processor(
+    rtems_scheduler_get_processor(),
+    processor_load
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_errors( void )
+{
+  rtems_status_code      sc;
+  rtems_cpu_load_average load_average;
+
+  sc = rtems_cpu_load_average_get_by_task( RTEMS_SELF, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_cpu_load_average_get_by_task( INVALID_ID, &load_average );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_cpu_load_average_get_by_processor( 0, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_cpu_load_average_get_by_processor(
+    rtems_scheduler_get_processor_maximum(),
+    &load_average
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+}
+
+static void test_busy_and_idle( void )
+{
+  rtems_status_code      sc;
+  rtems_cpu_load_average busy_task;
+  rtems_cpu_load_average busy_processor;
+  rtems_cpu_load_average idle_task;
+  rtems_cpu_load_average idle_processor;
+
+  busy_wait( INTERVAL_IN_SECONDS * UINT64_C( 1000000000 ) );
+  get_loads( &busy_task, &busy_processor );
+
+  rtems_test_assert( busy_task.one_second > RTEMS_CPU_LOAD_AVERAGE_ONE / 2 );
+  rtems_test_assert( busy_task.one_second <= RTEMS_CPU_LOAD_AVERAGE_ONE );
+  rtems_test_assert( busy_task.ten_seconds < busy_task.one_second );
+  rtems_test_assert( busy_task.one_minute < busy_task.ten_seconds );
+  rtems_test_assert(
+    busy_processor.one_second > RTEMS_CPU_LOAD_AVERAGE_ONE / 2
+  );
+
+  sc = rtems_task_wake_after(
+    INTERVAL_IN_SECONDS * rtems_clock_get_ticks_per_second()
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  get_loads( &idle_task, &idle_processor );
+
+  rtems_test_assert( idle_task.one_second < busy_task.one_second / 2 );
+  rtems_test_assert( idle_task.ten_seconds > 0 );
+  rtems_test_assert( idle_task.ten_seconds < busy_task.ten_seconds );
+  rtems_test_assert(
+    idle_processor.one_second < busy_processor.one_second / 2
+  );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_errors();
+  test_busy_and_idle();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
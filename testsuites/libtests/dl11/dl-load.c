@@ -0,0 +1,188 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <dlfcn.h>
+
+#include "dl-load.h"
+#include "dl11-funcs.h"
+
+#include <rtems/counter.h>
+#include <rtems/rtl/rtl.h>
+#include <rtems/rtl/rtl-sym.h>
+
+#define LOAD_COUNT 16
+
+#define LOOKUP_COUNT 4096
+
+#define DL11_DEFINE(i) int dl11_func_##i(int x) { return x + i; }
+
+DL11_FUNCS(DL11_DEFINE)
+
+#define DL11_NAME(i) "dl11_func_" #i,
+
+static const char* const base_names[] = { DL11_FUNCS(DL11_NAME) };
+
+#define DL11_ADDRESS(i) dl11_func_##i,
+
+/*
+ * Reference the functions so they are part of the base image symbol table.
+ */
+int (* const volatile dl11_base_funcs[])(int) = { DL11_FUNCS(DL11_ADDRESS) };
+
+typedef int (*call_t)(int x);
+
+static uint64_t elapsed_ns(rtems_counter_ticks begin)
+{
+  return rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference(rtems_counter_read(), begin));
+}
+
+static int load_and_call(void)
+{
+  void*  handle;
+  call_t call;
+  int    unresolved;
+
+  handle = dlopen("/dl11-o1.o", RTLD_NOW | RTLD_GLOBAL);
+  if (handle == NULL)
+  {
+    printf("dlopen failed: %s\n", dlerror());
+    return 1;
+  }
+
+  if (dlinfo(handle, RTLD_DI_UNRESOLVED, &unresolved) < 0 || unresolved)
+  {
+    printf("dlinfo failed or unresolved externals\n");
+    return 1;
+  }
+
+  call = dlsym(handle, "dl11_call_all");
+  if (call == NULL)
+  {
+    printf("dlsym failed: symbol not found\n");
+    return 1;
+  }
+
+  if (call(1) != 4 * DL11_SUM(1))
+  {
+    printf("dlsym call failed: ret value bad\n");
+    return 1;
+  }
+
+  if (dlclose(handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+
+  return 0;
+}
+
+static int lookups(void)
+{
+  rtems_rtl_data*     rtl;
+  rtems_counter_ticks begin;
+  uint64_t            hit_ns;
+  uint64_t            miss_ns;
+  char                missing[DL11_FUNC_COUNT][32];
+  size_t              i;
+
+  for (i = 0; i < DL11_FUNC_COUNT; ++i)
+    snprintf(missing[i], sizeof(missing[i]), "dl11_missing_%zu", i);
+
+  rtl = rtems_rtl_lock();
+  if (rtl == NULL)
+  {
+    printf("rtl lock failed\n");
+    return 1;
+  }
+
+  begin = rtems_counter_read();
+  for (i = 0; i < LOOKUP_COUNT; ++i)
+  {
+    if (rtems_rtl_symbol_global_find(base_names[i % DL11_FUNC_COUNT]) == NULL)
+    {
+      rtems_rtl_unlock();
+      printf("base symbol not found: %s\n", base_names[i % DL11_FUNC_COUNT]);
+      return 1;
+    }
+  }
+  hit_ns = elapsed_ns(begin);
+
+  begin = rtems_counter_read();
+  for (i = 0; i < LOOKUP_COUNT; ++i)
+  {
+    if (rtems_rtl_symbol_global_find(missing[i % DL11_FUNC_COUNT]) != NULL)
+    {
+      rtems_rtl_unlock();
+      printf("missing symbol found: %s\n", missing[i % DL11_FUNC_COUNT]);
+      return 1;
+    }
+  }
+  miss_ns = elapsed_ns(begin);
+
+  printf("global symbols: %zu, buckets: %zu\n",
+         rtl->globals.nsyms, rtl->globals.nbuckets);
+
+  rtems_rtl_unlock();
+
+  printf("lookup hit: %" PRIu64 "ns, miss: %" PRIu64 "ns\n",
+         hit_ns / LOOKUP_COUNT, miss_ns / LOOKUP_COUNT);
+
+  return 0;
+}
+
+int dl_load_test(void)
+{
+  rtems_counter_ticks begin;
+  uint64_t            first_ns;
+  uint64_t            total_ns;
+  int                 i;
+
+  printf("load: /dl11-o1.o\n");
+
+  begin = rtems_counter_read();
+  if (load_and_call() != 0)
+    return 1;
+  first_ns = elapsed_ns(begin);
+
+  begin = rtems_counter_read();
+  for (i = 0; i < LOAD_COUNT; ++i)
+  {
+    if (load_and_call() != 0)
+      return 1;
+  }
+  total_ns = elapsed_ns(begin);
+
+  printf("dlopen first: %" PRIu64 "ns, average: %" PRIu64 "ns\n",
+         first_ns, total_ns / LOAD_COUNT);
+
+  return lookups();
+}
@@ -0,0 +1,57 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#if !defined(_DL11_FUNCS_H_)
+#define _DL11_FUNCS_H_
+
+/*
+ * The base image functions referenced by the loadable object. Every call
+ * site in the object is a relocation against a global base image symbol.
+ */
+#define DL11_FUNCS(f) \
+  f(0)  f(1)  f(2)  f(3)  f(4)  f(5)  f(6)  f(7) \
+  f(8)  f(9)  f(10) f(11) f(12) f(13) f(14) f(15) \
+  f(16) f(17) f(18) f(19) f(20) f(21) f(22) f(23) \
+  f(24) f(25) f(26) f(27) f(28) f(29) f(30) f(31) \
+  f(32) f(33) f(34) f(35) f(36) f(37) f(38) f(39) \
+  f(40) f(41) f(42) f(43) f(44) f(45) f(46) f(47) \
+  f(48) f(49) f(50) f(51) f(52) f(53) f(54) f(55) \
+  f(56) f(57) f(58) f(59) f(60) f(61) f(62) f(63)
+
+#define DL11_FUNC_COUNT 64
+
+#define DL11_DECLARE(i) int dl11_func_##i(int x);
+
+DL11_FUNCS(DL11_DECLARE)
+
+/*
+ * The sum of all functions called with an argument of x.
+ */
+#define DL11_SUM(x) \
+  ((DL11_FUNC_COUNT * (x)) + ((DL11_FUNC_COUNT * (DL11_FUNC_COUNT - 1)) / 2))
+
+#endif
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dl11-funcs.h"
+
+/*
+ * Each function calls all base image functions so the object has several
+ * hundred relocations against global symbols.
+ */
+#define DL11_CALL(i) r += dl11_func_##i(x);
+
+int dl11_call_0(int x);
+int dl11_call_1(int x);
+int dl11_call_2(int x);
+int dl11_call_3(int x);
+int dl11_call_all(int x);
+
+int dl11_call_0(int x)
+{
+  int r = 0;
+  DL11_FUNCS(DL11_CALL)
+  return r;
+}
+
+int dl11_call_1(int x)
+{
+  int r = 0;
+  DL11_FUNCS(DL11_CALL)
+  return r;
+}
+
+int dl11_call_2(int x)
+{
+  int r = 0;
+  DL11_FUNCS(DL11_CALL)
+  return r;
+}
+
+int dl11_call_3(int x)
+{
+  int r = 0;
+  DL11_FUNCS(DL11_CALL)
+  return r;
+}
+
+int dl11_call_all(int x)
+{
+  return dl11_call_0(x) + dl11_call_1(x) + dl11_call_2(x) + dl11_call_3(x);
+}
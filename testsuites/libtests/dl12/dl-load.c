@@ -0,0 +1,98 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <dlfcn.h>
+
+#include "dl-load.h"
+#include "dl12-chain.h"
+
+#include <rtems/counter.h>
+
+typedef int (*call_t)(void);
+
+static uint64_t elapsed_ns(rtems_counter_ticks begin)
+{
+  return rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference(rtems_counter_read(), begin));
+}
+
+int dl_load_test(void)
+{
+  rtems_counter_ticks begin;
+  uint64_t            load_ns;
+  void*               handle;
+  call_t              call;
+  int                 unresolved;
+
+  printf("load: /dl12-o1.o, chain: %d\n", DL12_CHAIN);
+
+  /*
+   * The first link leaves the second link's symbols unresolved. Resolving
+   * them loads the next link from the archive until the chain is complete.
+   */
+  begin = rtems_counter_read();
+  handle = dlopen("/dl12-o1.o", RTLD_NOW | RTLD_GLOBAL);
+  load_ns = elapsed_ns(begin);
+  if (handle == NULL)
+  {
+    printf("dlopen failed: %s\n", dlerror());
+    return 1;
+  }
+
+  if (dlinfo(handle, RTLD_DI_UNRESOLVED, &unresolved) < 0 || unresolved)
+  {
+    printf("dlinfo failed or unresolved externals\n");
+    return 1;
+  }
+
+  call = dlsym(handle, "dl12_link_1");
+  if (call == NULL)
+  {
+    printf("dlsym failed: symbol not found\n");
+    return 1;
+  }
+
+  if (call() != DL12_SUM)
+  {
+    printf("dlsym call failed: ret value bad\n");
+    return 1;
+  }
+
+  printf("dlopen chain: %" PRIu64 "ns, per object: %" PRIu64 "ns\n",
+         load_ns, load_ns / DL12_CHAIN);
+
+  if (dlclose(handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A link in the chain of object files. The build compiles this file once for
+ * each link with DL12_LINK set to the link's number and DL12_NEXT set to the
+ * next link's number. The last link has no DL12_NEXT. Each link references the
+ * next link's function and data so each load leaves the next link's symbols
+ * unresolved until the next link is loaded from the archive.
+ */
+
+#include "dl12-chain.h"
+
+#define DL12_FUNC(link) DL12_NAME(dl12_link_, link)
+#define DL12_DATA(link) DL12_NAME(dl12_data_, link)
+
+int DL12_DATA(DL12_LINK) = DL12_LINK;
+
+int DL12_FUNC(DL12_LINK)(void);
+
+#if defined(DL12_NEXT)
+extern int DL12_DATA(DL12_NEXT);
+
+int DL12_FUNC(DL12_NEXT)(void);
+
+int DL12_FUNC(DL12_LINK)(void)
+{
+  return DL12_DATA(DL12_LINK) + DL12_FUNC(DL12_NEXT)() +
+    (DL12_DATA(DL12_NEXT) - DL12_NEXT);
+}
+#else
+int DL12_FUNC(DL12_LINK)(void)
+{
+  return DL12_DATA(DL12_LINK);
+}
+#endif
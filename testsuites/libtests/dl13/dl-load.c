@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include <dlfcn.h>
+
+#include "dl-load.h"
+
+#include <rtems/rtl/rtl.h>
+#include <rtems/rtl/rtl-obj.h>
+
+int dl13_base_func(int x);
+
+int dl13_base_func(int x)
+{
+  return x + 7;
+}
+
+/*
+ * Reference the function so it is part of the base image symbol table.
+ */
+int (* const volatile dl13_base_funcs[])(int) = { dl13_base_func };
+
+#define DL13_RESULT(x) ((x) + 7 + ((x) * 3))
+
+typedef int (*call_t)(int x);
+
+static void* dl_load_obj(const char* name, int mode)
+{
+  void* handle;
+  int   unresolved;
+
+  handle = dlopen(name, mode);
+  if (handle == NULL)
+  {
+    printf("dlopen failed: %s\n", dlerror());
+    return NULL;
+  }
+
+  if (dlinfo(handle, RTLD_DI_UNRESOLVED, &unresolved) < 0 || unresolved)
+  {
+    printf("dlinfo failed or unresolved externals\n");
+    dlclose(handle);
+    return NULL;
+  }
+
+  return handle;
+}
+
+static int dl_call(void* handle)
+{
+  call_t call;
+
+  call = dlsym(handle, "dl13_o1_call");
+  if (call == NULL)
+  {
+    printf("dlsym failed: symbol not found\n");
+    return 1;
+  }
+
+  if (call(1) != DL13_RESULT(1) || call(2) != DL13_RESULT(2))
+  {
+    printf("dlsym call failed: ret value bad\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int dl_lazy(void)
+{
+  void*          handle;
+  rtems_rtl_obj* obj;
+  bool           lazy;
+
+  printf("load: /dl13-o1.o (lazy bind)\n");
+
+  handle = dl_load_obj("/dl13-o1.o",
+                       RTLD_LAZY | RTLD_GLOBAL | RTEMS_RTL_LAZY_BIND);
+  if (handle == NULL)
+    return 1;
+
+  /*
+   * The loader clears the flag on architectures that cannot bind lazily.
+   */
+  obj = (rtems_rtl_obj*) handle;
+  lazy = (obj->flags & RTEMS_RTL_OBJ_LAZY) != 0;
+
+  if (lazy && (obj->lazy_syms != 2 || obj->lazy_resolved != 0))
+  {
+    printf("lazy bind failed: symbols: %zu, resolved: %zu\n",
+           obj->lazy_syms, obj->lazy_resolved);
+    return 1;
+  }
+
+  if (dl_call(handle) != 0)
+    return 1;
+
+  if (lazy && obj->lazy_resolved != 2)
+  {
+    printf("lazy resolve failed: resolved: %zu\n", obj->lazy_resolved);
+    return 1;
+  }
+
+  if (dl_call(handle) != 0)
+    return 1;
+
+  if (lazy && obj->lazy_resolved != 2)
+  {
+    printf("lazy resolve repeated: resolved: %zu\n", obj->lazy_resolved);
+    return 1;
+  }
+
+  if (dlclose(handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+
+  return 0;
+}
+
+static int dl_eager(void)
+{
+  void*          handle;
+  rtems_rtl_obj* obj;
+
+  printf("load: /dl13-o1.o\n");
+
+  handle = dl_load_obj("/dl13-o1.o", RTLD_LAZY | RTLD_GLOBAL);
+  if (handle == NULL)
+    return 1;
+
+  obj = (rtems_rtl_obj*) handle;
+  if ((obj->flags & RTEMS_RTL_OBJ_LAZY) != 0 || obj->lazy_syms != 0)
+  {
+    printf("RTLD_LAZY bound lazily: symbols: %zu\n", obj->lazy_syms);
+    return 1;
+  }
+
+  if (dl_call(handle) != 0)
+    return 1;
+
+  if (dlclose(handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+
+  return 0;
+}
+
+int dl_load_test(void)
+{
+  void* o2;
+
+  printf("load: /dl13-o2.o\n");
+
+  o2 = dl_load_obj("/dl13-o2.o", RTLD_NOW | RTLD_GLOBAL);
+  if (o2 == NULL)
+    return 1;
+
+  if (dl_lazy() != 0 || dl_eager() != 0)
+    return 1;
+
+  if (dlclose(o2) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+
+  return 0;
+}
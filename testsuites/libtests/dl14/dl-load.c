@@ -0,0 +1,249 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <dlfcn.h>
+
+#include "dl-load.h"
+
+#include <rtems/rtl/rtl.h>
+#include <rtems/rtl/rtl-image-cache.h>
+#include <rtems/rtl/rtl-obj.h>
+
+#define CACHE_PATH "/cache"
+
+typedef int (*call_t)(int x);
+
+static void* dl_load_obj(const char* name, int mode)
+{
+  void* handle;
+  int   unresolved;
+
+  handle = dlopen(name, mode);
+  if (handle == NULL)
+  {
+    printf("dlopen failed: %s\n", dlerror());
+    return NULL;
+  }
+
+  if (dlinfo(handle, RTLD_DI_UNRESOLVED, &unresolved) < 0 || unresolved)
+  {
+    printf("dlinfo failed or unresolved externals\n");
+    dlclose(handle);
+    return NULL;
+  }
+
+  return handle;
+}
+
+static int dl_close_obj(void* handle)
+{
+  if (dlclose(handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+  return 0;
+}
+
+static bool dl_from_image(void* handle)
+{
+  const rtems_rtl_obj* obj = (const rtems_rtl_obj*) handle;
+  return (obj->flags & RTEMS_RTL_OBJ_IMAGE) != 0;
+}
+
+static int dl_call(void* handle, int expected)
+{
+  call_t call;
+
+  call = dlsym(handle, "dl14_o1_call");
+  if (call == NULL)
+  {
+    printf("dlsym failed: symbol not found\n");
+    return 1;
+  }
+
+  if (call(3) != expected)
+  {
+    printf("dlsym call failed: ret value bad\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int dl_image_count(void)
+{
+  DIR*           dir;
+  struct dirent* entry;
+  int            count = 0;
+
+  dir = opendir(CACHE_PATH);
+  if (dir == NULL)
+    return -1;
+
+  while ((entry = readdir(dir)) != NULL)
+  {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+      ++count;
+  }
+
+  closedir(dir);
+
+  return count;
+}
+
+/*
+ * Load the object file depending on the loaded dependent and check if it is
+ * loaded from an image as expected.
+ */
+static void* dl_load_o1(bool hit, int expected)
+{
+  void* o1;
+
+  o1 = dl_load_obj("/dl14-o1.o", RTLD_NOW | RTLD_GLOBAL);
+  if (o1 == NULL)
+    return NULL;
+
+  if (dl_from_image(o1) != hit)
+  {
+    printf("image cache %s expected: /dl14-o1.o\n", hit ? "hit" : "miss");
+    dl_close_obj(o1);
+    return NULL;
+  }
+
+  if (dl_call(o1, expected) != 0)
+  {
+    dl_close_obj(o1);
+    return NULL;
+  }
+
+  return o1;
+}
+
+int dl_load_test(void)
+{
+  void* o1;
+  void* o2;
+
+  if (mkdir(CACHE_PATH, S_IRWXU) < 0)
+  {
+    printf("mkdir failed: %s\n", CACHE_PATH);
+    return 1;
+  }
+
+  if (!rtems_rtl_image_cache_path(CACHE_PATH))
+  {
+    printf("image cache path failed: %s\n", dlerror());
+    return 1;
+  }
+
+  /*
+   * The cache is empty so both object files miss and an image is stored for
+   * each.
+   */
+  printf("miss: /dl14-o2.o /dl14-o1.o\n");
+
+  o2 = dl_load_obj("/dl14-o2.o", RTLD_NOW | RTLD_GLOBAL);
+  if (o2 == NULL)
+    return 1;
+
+  if (dl_from_image(o2))
+  {
+    printf("image cache miss expected: /dl14-o2.o\n");
+    return 1;
+  }
+
+  o1 = dl_load_o1(false, (3 * 2) + 1);
+  if (o1 == NULL)
+    return 1;
+
+  if (dl_image_count() != 2)
+  {
+    printf("image count bad: %d\n", dl_image_count());
+    return 1;
+  }
+
+  /*
+   * The memory freed by the close is allocated again at the same addresses
+   * so the image of the object file is used.
+   */
+  printf("hit: /dl14-o1.o\n");
+
+  if (dl_close_obj(o1) != 0)
+    return 1;
+
+  o1 = dl_load_o1(true, (3 * 2) + 1);
+  if (o1 == NULL)
+    return 1;
+
+  /*
+   * Replace the dependent with a changed object file providing the same
+   * symbol. The image of the object file depending on it is invalid even
+   * though the object file is not changed.
+   */
+  printf("dependent changed: /dl14-o3.o /dl14-o1.o\n");
+
+  if (dl_close_obj(o1) != 0 || dl_close_obj(o2) != 0)
+    return 1;
+
+  o2 = dl_load_obj("/dl14-o3.o", RTLD_NOW | RTLD_GLOBAL);
+  if (o2 == NULL)
+    return 1;
+
+  o1 = dl_load_o1(false, (3 * 5) + 1);
+  if (o1 == NULL)
+    return 1;
+
+  /*
+   * The changed dependent adds an image and the object file's image is
+   * replaced.
+   */
+  if (dl_image_count() != 3)
+  {
+    printf("image count bad: %d\n", dl_image_count());
+    return 1;
+  }
+
+  printf("hit: /dl14-o1.o\n");
+
+  if (dl_close_obj(o1) != 0)
+    return 1;
+
+  o1 = dl_load_o1(true, (3 * 5) + 1);
+  if (o1 == NULL)
+    return 1;
+
+  if (dl_close_obj(o1) != 0 || dl_close_obj(o2) != 0)
+    return 1;
+
+  return 0;
+}
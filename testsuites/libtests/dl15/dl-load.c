@@ -0,0 +1,242 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <dlfcn.h>
+
+#include "dl-load.h"
+
+#include <rtems/rtl/rtl.h>
+#include <rtems/rtl/rtl-obj-cache.h>
+
+#define DL15_OBJ  "/dl15-o1.o"
+#define DL15_COPY "/dl15-copy.o"
+
+int dl15_base_func(int x);
+
+int dl15_base_func(int x)
+{
+  return x + 3;
+}
+
+/*
+ * Reference the function so it is part of the base image symbol table.
+ */
+int (* const volatile dl15_base_funcs[])(int) = { dl15_base_func };
+
+/*
+ * The bss variable accumulates the arguments of all calls of a load.
+ */
+#define DL15_RESULT(x, sum) ((((x) + 3) * 5) + (sum))
+
+typedef int (*call_t)(int x);
+
+static size_t dl_cache_reads(void)
+{
+  rtems_rtl_obj_cache* symbols;
+  rtems_rtl_obj_cache* strings;
+  rtems_rtl_obj_cache* relocs;
+  size_t               reads;
+
+  if (rtems_rtl_lock() == NULL)
+    return 0;
+  rtems_rtl_obj_caches(&symbols, &strings, &relocs);
+  reads = symbols->reads + strings->reads + relocs->reads;
+  rtems_rtl_unlock();
+
+  return reads;
+}
+
+static int dl_map(void)
+{
+  rtems_rtl_obj_cache* cache;
+  struct stat          sb;
+  void*                buffer;
+  size_t               length;
+  size_t               reads;
+  bool                 ok;
+  int                  fd;
+
+  printf("map: " DL15_OBJ "\n");
+
+  fd = open(DL15_OBJ, O_RDONLY);
+  if (fd < 0 || fstat(fd, &sb) < 0)
+  {
+    printf("open failed: " DL15_OBJ "\n");
+    return 1;
+  }
+
+  if (rtems_rtl_lock() == NULL)
+  {
+    printf("rtl lock failed\n");
+    close(fd);
+    return 1;
+  }
+
+  rtems_rtl_obj_caches(&cache, NULL, NULL);
+  rtems_rtl_obj_cache_flush(cache);
+  reads = cache->reads;
+
+  /*
+   * A reference to the whole file is not limited by the size of the cache
+   * buffer if the file is referenced in place.
+   */
+  length = sb.st_size;
+  ok = rtems_rtl_obj_cache_read(cache, fd, 0, &buffer, &length) &&
+    cache->image != NULL && buffer == cache->image &&
+    length == (size_t) sb.st_size && cache->reads == reads &&
+    rtems_rtl_obj_cache_in_place(cache, fd);
+
+  rtems_rtl_obj_cache_flush(cache);
+  rtems_rtl_unlock();
+  close(fd);
+
+  if (!ok)
+  {
+    printf("file not referenced in place: " DL15_OBJ "\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int dl_copy(void)
+{
+  char    buffer[256];
+  ssize_t n;
+  int     in;
+  int     out;
+  int     ret = 0;
+
+  in = open(DL15_OBJ, O_RDONLY);
+  out = open(DL15_COPY, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (in < 0 || out < 0)
+  {
+    printf("copy open failed\n");
+    return 1;
+  }
+
+  while ((n = read(in, buffer, sizeof(buffer))) > 0)
+  {
+    if (write(out, buffer, n) != n)
+    {
+      ret = 1;
+      break;
+    }
+  }
+
+  if (n < 0)
+    ret = 1;
+
+  close(in);
+  if (close(out) < 0)
+    ret = 1;
+
+  if (ret != 0)
+    printf("copy failed: " DL15_COPY "\n");
+
+  return ret;
+}
+
+/*
+ * Load the object file and check if the object caches read the file into
+ * their buffers as expected.
+ */
+static int dl_load(const char* name, bool buffered)
+{
+  void*  handle;
+  call_t call;
+  size_t reads;
+  int    unresolved;
+
+  printf("load: %s\n", name);
+
+  reads = dl_cache_reads();
+
+  handle = dlopen(name, RTLD_NOW | RTLD_GLOBAL);
+  if (handle == NULL)
+  {
+    printf("dlopen failed: %s\n", dlerror());
+    return 1;
+  }
+
+  if ((dl_cache_reads() != reads) != buffered)
+  {
+    printf("object cache %s expected: %s\n",
+           buffered ? "reads" : "no reads", name);
+    return 1;
+  }
+
+  if (dlinfo(handle, RTLD_DI_UNRESOLVED, &unresolved) < 0 || unresolved)
+  {
+    printf("dlinfo failed or unresolved externals\n");
+    return 1;
+  }
+
+  call = dlsym(handle, "dl15_o1_call");
+  if (call == NULL)
+  {
+    printf("dlsym failed: symbol not found\n");
+    return 1;
+  }
+
+  if (call(1) != DL15_RESULT(1, 1) || call(2) != DL15_RESULT(2, 3))
+  {
+    printf("dlsym call failed: ret value bad\n");
+    return 1;
+  }
+
+  if (dlclose(handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+
+  return 0;
+}
+
+int dl_load_test(void)
+{
+  if (dl_map() != 0)
+    return 1;
+
+  if (dl_load(DL15_OBJ, false) != 0)
+    return 1;
+
+  /*
+   * A file written to the IMFS is a memory file which cannot be mapped.
+   */
+  if (dl_copy() != 0)
+    return 1;
+
+  return dl_load(DL15_COPY, true);
+}
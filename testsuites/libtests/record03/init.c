@@ -0,0 +1,296 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <inttypes.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 3";
+
+#define SAMPLES 1000
+
+typedef struct {
+  size_t user_events;
+} test_context;
+
+static test_context test_instance;
+
+static void drain_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  test_context *ctx;
+  size_t        i;
+
+  ctx = arg;
+
+  for ( i = 0; i < count; ++i ) {
+    if (
+      RTEMS_RECORD_GET_EVENT( items[ i ].event ) == RTEMS_RECORD_USER_0
+    ) {
+      ++ctx->user_events;
+    }
+  }
+}
+
+static size_t drain_user_events( test_context *ctx )
+{
+  ctx->user_events = 0;
+  rtems_record_drain( drain_visitor, ctx );
+  return ctx->user_events;
+}
+
+static void test_filter( test_context *ctx )
+{
+  uint32_t classes;
+  uint32_t previous;
+  size_t   i;
+
+  rtems_test_assert(
+    rtems_record_get_event_classes() == RTEMS_RECORD_CLASS_ALL
+  );
+  rtems_test_assert(
+    rtems_record_get_event_class( RTEMS_RECORD_USER_0 )
+      == RTEMS_RECORD_CLASS_USER
+  );
+  rtems_test_assert(
+    rtems_record_get_event_class( RTEMS_RECORD_THREAD_SWITCH_IN )
+      == RTEMS_RECORD_CLASS_THREAD
+  );
+  rtems_test_assert(
+    rtems_record_get_event_class( RTEMS_RECORD_UPTIME_LOW )
+      == RTEMS_RECORD_CLASS_CONTROL
+  );
+  rtems_test_assert(
+    rtems_record_get_event_class( RTEMS_RECORD_ISR_DISABLE )
+      == RTEMS_RECORD_CLASS_INTERRUPT
+  );
+
+  for ( i = 0; i < RTEMS_RECORD_CLASS_COUNT; ++i ) {
+    rtems_test_assert(
+      rtems_record_event_class_text( (rtems_record_event_class) i ) != NULL
+    );
+  }
+
+  rtems_test_assert(
+    rtems_record_event_class_text( RTEMS_RECORD_CLASS_COUNT ) == NULL
+  );
+
+  (void) drain_user_events( ctx );
+
+  classes = RTEMS_RECORD_CLASS_ALL
+    & ~RTEMS_RECORD_CLASS_BIT( RTEMS_RECORD_CLASS_USER );
+  previous = rtems_record_set_event_classes( classes );
+  rtems_test_assert( previous == RTEMS_RECORD_CLASS_ALL );
+  rtems_test_assert( rtems_record_get_event_classes() == classes );
+  rtems_test_assert( !rtems_record_is_event_enabled( RTEMS_RECORD_USER_0 ) );
+  rtems_test_assert(
+    rtems_record_is_event_enabled( RTEMS_RECORD_THREAD_SWITCH_IN )
+  );
+
+  rtems_record_produce( RTEMS_RECORD_USER_0, 0 );
+  rtems_record_produce_2( RTEMS_RECORD_USER_0, 1, RTEMS_RECORD_USER_0, 2 );
+  rtems_test_assert( drain_user_events( ctx ) == 0 );
+
+  /* The control class cannot be disabled */
+  previous = rtems_record_set_event_classes( 0 );
+  rtems_test_assert( previous == classes );
+  rtems_test_assert(
+    rtems_record_get_event_classes()
+      == RTEMS_RECORD_CLASS_BIT( RTEMS_RECORD_CLASS_CONTROL )
+  );
+  rtems_test_assert(
+    rtems_record_is_event_enabled( RTEMS_RECORD_UPTIME_LOW )
+  );
+  rtems_test_assert(
+    !rtems_record_is_event_enabled( RTEMS_RECORD_THREAD_SWITCH_IN )
+  );
+
+  rtems_record_set_event_classes( RTEMS_RECORD_CLASS_ALL );
+  rtems_record_produce( RTEMS_RECORD_USER_0, 0 );
+  rtems_record_produce_2( RTEMS_RECORD_USER_0, 1, RTEMS_RECORD_USER_0, 2 );
+  rtems_test_assert( drain_user_events( ctx ) == 3 );
+}
+
+static uint64_t measure_produce( void )
+{
+  rtems_counter_ticks begin;
+  rtems_counter_ticks end;
+  int                 i;
+
+  begin = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLES; ++i ) {
+    rtems_record_produce( RTEMS_RECORD_USER_0, (rtems_record_data) i );
+  }
+
+  end = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference( end, begin )
+  );
+}
+
+static uint64_t measure_produce_n( void )
+{
+  rtems_record_item   items[ 3 ];
+  rtems_counter_ticks begin;
+  rtems_counter_ticks end;
+  int                 i;
+
+  items[ 0 ].event = RTEMS_RECORD_USER_0;
+  items[ 0 ].data = 0;
+  items[ 1 ].event = RTEMS_RECORD_USER_1;
+  items[ 1 ].data = 1;
+  items[ 2 ].event = RTEMS_RECORD_USER_2;
+  items[ 2 ].data = 2;
+
+  begin = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLES; ++i ) {
+    rtems_record_produce_n( items, RTEMS_ARRAY_SIZE( items ) );
+  }
+
+  end = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference( end, begin )
+  );
+}
+
+static uint64_t measure_interrupt( void )
+{
+  rtems_counter_ticks begin;
+  rtems_counter_ticks end;
+  int                 i;
+
+  begin = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLES; ++i ) {
+    uint32_t level;
+
+    level = rtems_record_interrupt_disable();
+    rtems_record_interrupt_enable( level );
+  }
+
+  end = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference( end, begin )
+  );
+}
+
+static void print_result(
+  const char *name,
+  uint64_t    enabled,
+  uint64_t    disabled
+)
+{
+  printf(
+    "%-28s: enabled %6" PRIu64 "ns, disabled %6" PRIu64 "ns\n",
+    name,
+    enabled / SAMPLES,
+    disabled / SAMPLES
+  );
+}
+
+static void measure(
+  const char               *name,
+  rtems_record_event_class  event_class,
+  uint64_t               ( *body )( void )
+)
+{
+  uint64_t enabled;
+  uint64_t disabled;
+
+  rtems_record_set_event_classes( RTEMS_RECORD_CLASS_ALL );
+  enabled = ( *body )();
+  rtems_record_set_event_classes(
+    RTEMS_RECORD_CLASS_ALL & ~RTEMS_RECORD_CLASS_BIT( event_class )
+  );
+  disabled = ( *body )();
+  rtems_record_set_event_classes( RTEMS_RECORD_CLASS_ALL );
+
+  print_result( name, enabled, disabled );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  test_filter( ctx );
+
+  measure(
+    "rtems_record_produce()",
+    RTEMS_RECORD_CLASS_USER,
+    measure_produce
+  );
+  measure(
+    "rtems_record_produce_n( 3 )",
+    RTEMS_RECORD_CLASS_USER,
+    measure_produce_n
+  );
+  measure(
+    "rtems_record_interrupt_*()",
+    RTEMS_RECORD_CLASS_INTERRUPT,
+    measure_interrupt
+  );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS 512
+
+#define CONFIGURE_RECORD_EXTENSIONS_ENABLED
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,322 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordserver.h>
+#include <rtems/record.h>
+#include <rtems.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 4";
+
+#define ITEM_COUNT 128
+
+#define FILE_COUNT 3
+
+#define PRIO_SERVER 2
+
+typedef struct {
+  rtems_record_file_server        server;
+  rtems_record_file_server_config config;
+} test_context;
+
+static test_context test_instance;
+
+static off_t ring_size( void )
+{
+  return (off_t) sizeof( Record_Control )
+    + (off_t) sizeof( rtems_record_item ) * ITEM_COUNT;
+}
+
+static off_t header_size( void )
+{
+  Record_Stream_header header;
+
+  return (off_t) _Record_Stream_header_initialize( &header )
+    + (off_t) ( 2 * sizeof( rtems_record_item ) );
+}
+
+static off_t file_size( void )
+{
+  return header_size() + 4 * ring_size();
+}
+
+static void produce_events( size_t count )
+{
+  size_t i;
+
+  for ( i = 0; i < count; ++i ) {
+    rtems_record_produce( RTEMS_RECORD_USER_0, (rtems_record_data) i );
+  }
+}
+
+static void check_file( const test_context *ctx, uint32_t file_index )
+{
+  Record_Stream_header expected;
+  Record_Stream_header actual;
+  char                 name[ 32 ];
+  struct stat          st;
+  size_t               size;
+  ssize_t              n;
+  int                  fd;
+  int                  rv;
+
+  snprintf( name, sizeof( name ), "%s.%" PRIu32, ctx->config.path, file_index );
+  rv = stat( name, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size <= ctx->config.file_size );
+
+  size = _Record_Stream_header_initialize( &expected );
+  rtems_test_assert( st.st_size >= (off_t) size );
+
+  fd = open( name, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+  n = read( fd, &actual, size );
+  rtems_test_assert( n == (ssize_t) size );
+  rtems_test_assert( actual.format == expected.format );
+  rtems_test_assert( actual.magic == expected.magic );
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_invalid( test_context *ctx )
+{
+  rtems_record_file_server_config config;
+  rtems_status_code               sc;
+
+  sc = rtems_record_start_file_server( NULL, &ctx->config );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_record_start_file_server( &ctx->server, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  config = ctx->config;
+  config.path = NULL;
+  sc = rtems_record_start_file_server( &ctx->server, &config );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  config = ctx->config;
+  config.file_size = ring_size();
+  sc = rtems_record_start_file_server( &ctx->server, &config );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+
+  config = ctx->config;
+  config.file_size = file_size() - 1;
+  sc = rtems_record_start_file_server( &ctx->server, &config );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+
+  config = ctx->config;
+  config.path = "/nix/trace";
+  sc = rtems_record_start_file_server( &ctx->server, &config );
+  rtems_test_assert( sc == RTEMS_IO_ERROR );
+}
+
+static void test_rotation( test_context *ctx )
+{
+  rtems_record_file_server_statistics stats;
+  rtems_status_code                   sc;
+  rtems_mode                          mode;
+  uint32_t                            i;
+
+  sc = rtems_record_start_file_server( &ctx->server, &ctx->config );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Fill each file a couple of times, let the server drain in between */
+  for ( i = 0; i < 4 * FILE_COUNT * 4; ++i ) {
+    produce_events( ITEM_COUNT / 2 );
+    sc = rtems_task_wake_after( 2 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /* Overflow the ring buffer before the server can drain it */
+  sc = rtems_task_mode( RTEMS_NO_PREEMPT, RTEMS_PREEMPT_MASK, &mode );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  produce_events( 4 * ITEM_COUNT );
+  sc = rtems_task_mode( mode, RTEMS_PREEMPT_MASK, &mode );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  sc = rtems_task_wake_after( 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_record_stop_file_server( &ctx->server );
+  rtems_record_get_file_server_statistics( &ctx->server, &stats );
+
+  printf(
+    "bytes written %" PRIu64 ", items lost %" PRIu64 ", rotations %" PRIu32
+      ", write errors %" PRIu32 "\n",
+    stats.bytes_written,
+    stats.items_lost,
+    stats.rotations,
+    stats.write_errors
+  );
+
+  rtems_test_assert( stats.bytes_written > 0 );
+  rtems_test_assert( stats.rotations >= FILE_COUNT );
+  rtems_test_assert( stats.items_lost >= 2 * ITEM_COUNT );
+  rtems_test_assert( stats.write_errors == 0 );
+  rtems_test_assert( stats.bytes_dropped == 0 );
+  rtems_test_assert( stats.file_index < FILE_COUNT );
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    check_file( ctx, i );
+  }
+}
+
+static bool is_end_marker( const rtems_record_item *items )
+{
+  return items[ 0 ].event == RTEMS_RECORD_TIME_EVENT( 0, RTEMS_RECORD_EMPTY )
+    && items[ 0 ].data == RTEMS_RECORD_MAGIC
+    && items[ 1 ].event == RTEMS_RECORD_TIME_EVENT( 0, RTEMS_RECORD_EMPTY );
+}
+
+static void test_ring( test_context *ctx )
+{
+  rtems_record_file_server_config     config;
+  rtems_record_file_server_statistics stats;
+  rtems_record_item                   marker[ 2 ];
+  Record_Stream_header                expected;
+  struct stat                         st;
+  rtems_status_code                   sc;
+  char                               *data;
+  size_t                              size;
+  size_t                              offset;
+  size_t                              i;
+  ssize_t                             n;
+  int                                 fd;
+  int                                 rv;
+
+  config = ctx->config;
+  config.path = "/ring";
+  config.file_count = 0;
+  sc = rtems_record_start_file_server( &ctx->server, &config );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  for ( i = 0; i < 4 * 4; ++i ) {
+    produce_events( ITEM_COUNT / 2 );
+    sc = rtems_task_wake_after( 2 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  rtems_record_stop_file_server( &ctx->server );
+  rtems_record_get_file_server_statistics( &ctx->server, &stats );
+  rtems_test_assert( stats.rotations >= 1 );
+  rtems_test_assert( stats.write_errors == 0 );
+  rtems_test_assert( stats.bytes_dropped == 0 );
+
+  rv = stat( config.path, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size <= config.file_size );
+
+  data = malloc( (size_t) st.st_size );
+  rtems_test_assert( data != NULL );
+
+  fd = open( config.path, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+  n = read( fd, data, (size_t) st.st_size );
+  rtems_test_assert( n == (ssize_t) st.st_size );
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  /* The file starts with the stream header of the last wrap-around */
+  size = _Record_Stream_header_initialize( &expected );
+  rtems_test_assert( memcmp( data, &expected, size ) == 0 );
+
+  /* The end marker follows the data written since the last wrap-around */
+  offset = size;
+
+  while ( offset + sizeof( marker ) <= (size_t) st.st_size ) {
+    memcpy( marker, &data[ offset ], sizeof( marker ) );
+
+    if ( is_end_marker( marker ) ) {
+      break;
+    }
+
+    offset += sizeof( marker[ 0 ] );
+  }
+
+  rtems_test_assert( offset + sizeof( marker ) <= (size_t) st.st_size );
+  rtems_test_assert( marker[ 1 ].data == stats.rotations );
+
+  free( data );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  ctx->config.path = "/trace";
+  ctx->config.file_count = FILE_COUNT;
+  ctx->config.file_size = file_size();
+  ctx->config.period = 1;
+  ctx->config.priority = PRIO_SERVER;
+
+  test_invalid( ctx );
+  test_rotation( ctx );
+  test_ring( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS ( 16 * 1024 )
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 3
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS ITEM_COUNT
+
+#define CONFIGURE_RECORD_EXTENSIONS_ENABLED
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
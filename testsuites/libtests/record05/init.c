@@ -0,0 +1,408 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordconvert.h>
+#include <rtems/record.h>
+#include <rtems.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 5";
+
+#define ITEM_COUNT 128
+
+#define CPU_COUNT 4
+
+#define ROUND_COUNT 64
+
+#define ITEMS_PER_CHUNK ( ITEM_COUNT / 4 )
+
+#define USER_ITEM_COUNT \
+  ( ROUND_COUNT * CPU_COUNT * ITEMS_PER_CHUNK - 2 * CPU_COUNT )
+
+/*
+ * With this counter frequency, one counter tick is exactly 2**16 binary time
+ * units.
+ */
+#define FREQUENCY ( UINT32_C( 1 ) << 16 )
+
+#define UPTIME_BASE ( UINT64_C( 1 ) << 32 )
+
+typedef struct {
+  char     *stream;
+  size_t    size;
+  size_t    capacity;
+  uint64_t  items;
+  uint64_t  user_items;
+  uint32_t  last_time;
+} test_context;
+
+static test_context test_instance;
+
+static void add_item(
+  test_context       *ctx,
+  uint32_t            time,
+  rtems_record_event  event,
+  rtems_record_data   data
+)
+{
+  rtems_record_item item;
+
+  rtems_test_assert( ctx->size + sizeof( item ) <= ctx->capacity );
+  item.event = RTEMS_RECORD_TIME_EVENT( time, event );
+  item.data = data;
+  memcpy( &ctx->stream[ ctx->size ], &item, sizeof( item ) );
+  ctx->size += sizeof( item );
+}
+
+static uint64_t time_to_bt( uint32_t time )
+{
+  return UPTIME_BASE + ( (uint64_t) time << 16 );
+}
+
+static uint32_t time_to_cpu( uint32_t time )
+{
+  return ( ( time - 1 ) / ITEMS_PER_CHUNK ) % CPU_COUNT;
+}
+
+/*
+ * Builds a capture in the native format which looks like the concatenated
+ * output of several drain operations on a system with CPU_COUNT processors.
+ * The time increases globally, so the items of all processors have a unique
+ * order by timestamp.  The data of the user items is the time.
+ */
+static void build_stream( test_context *ctx )
+{
+  Record_Stream_header header;
+  size_t               size;
+  uint32_t             round;
+  uint32_t             cpu;
+  uint32_t             time;
+
+  ctx->capacity = sizeof( header ) + ROUND_COUNT * CPU_COUNT
+    * ( 5 + ITEMS_PER_CHUNK ) * sizeof( rtems_record_item );
+  ctx->stream = malloc( ctx->capacity );
+  rtems_test_assert( ctx->stream != NULL );
+
+  size = _Record_Stream_header_prepare( &header, ITEM_COUNT, FREQUENCY );
+  header.Processor_maximum.data = CPU_COUNT - 1;
+  memcpy( ctx->stream, &header, size );
+  ctx->size = size;
+  time = 1;
+
+  for ( round = 0; round < ROUND_COUNT; ++round ) {
+    for ( cpu = 0; cpu < CPU_COUNT; ++cpu ) {
+      uint32_t tail;
+      uint32_t i;
+
+      tail = round * ITEMS_PER_CHUNK;
+      add_item( ctx, 0, RTEMS_RECORD_PROCESSOR, cpu );
+      add_item( ctx, 0, RTEMS_RECORD_PER_CPU_TAIL, tail );
+      add_item( ctx, 0, RTEMS_RECORD_PER_CPU_HEAD, tail + ITEMS_PER_CHUNK );
+
+      for ( i = 0; i < ITEMS_PER_CHUNK; ++i ) {
+        if ( round == 0 && i == 0 ) {
+          add_item(
+            ctx,
+            time,
+            RTEMS_RECORD_UPTIME_LOW,
+            (uint32_t) time_to_bt( time )
+          );
+        } else if ( round == 0 && i == 1 ) {
+          add_item(
+            ctx,
+            time,
+            RTEMS_RECORD_UPTIME_HIGH,
+            time_to_bt( time - 1 ) >> 32
+          );
+        } else {
+          add_item( ctx, time, RTEMS_RECORD_USER_0, time );
+        }
+
+        ++time;
+      }
+    }
+  }
+}
+
+static rtems_record_client_status count_items(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  test_context *ctx;
+
+  (void) bt;
+  (void) cpu;
+  (void) event;
+  (void) data;
+
+  ctx = arg;
+  ++ctx->items;
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static rtems_record_client_status check_order(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  test_context *ctx;
+
+  ctx = arg;
+  ++ctx->items;
+
+  if ( event == RTEMS_RECORD_USER_0 ) {
+    uint32_t time;
+
+    time = (uint32_t) data;
+    rtems_test_assert( time > ctx->last_time );
+    rtems_test_assert( cpu == time_to_cpu( time ) );
+    rtems_test_assert( bt == time_to_bt( time ) );
+    ctx->last_time = time;
+    ++ctx->user_items;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static void print_rate( const char *name, uint64_t items, uint64_t ns )
+{
+  if ( ns == 0 ) {
+    ns = 1;
+  }
+
+  printf(
+    "%s: %" PRIu64 " items, %" PRIu64 " items/s\n",
+    name,
+    items,
+    ( items * 1000000000 ) / ns
+  );
+}
+
+static uint64_t test_serial( test_context *ctx )
+{
+  rtems_record_client_context *client;
+  rtems_record_client_status   status;
+  uint64_t                     t0;
+  uint64_t                     t1;
+
+  client = malloc( sizeof( *client ) );
+  rtems_test_assert( client != NULL );
+
+  ctx->items = 0;
+  t0 = rtems_clock_get_uptime_nanoseconds();
+  rtems_record_client_init( client, count_items, ctx );
+  status = rtems_record_client_run( client, ctx->stream, ctx->size );
+  rtems_test_assert( status == RTEMS_RECORD_CLIENT_SUCCESS );
+  rtems_record_client_destroy( client );
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  print_rate( "serial", ctx->items, t1 - t0 );
+  free( client );
+
+  return ctx->items;
+}
+
+static void test_parallel( test_context *ctx, uint64_t expected_items )
+{
+  uint32_t workers;
+
+  for ( workers = 1; workers <= CPU_COUNT; workers *= 2 ) {
+    rtems_record_client_status status;
+    uint64_t                   t0;
+    uint64_t                   t1;
+    char                       name[ 32 ];
+
+    ctx->items = 0;
+    ctx->user_items = 0;
+    ctx->last_time = 0;
+    t0 = rtems_clock_get_uptime_nanoseconds();
+    status = rtems_record_decode_parallel(
+      ctx->stream,
+      ctx->size,
+      workers,
+      check_order,
+      ctx
+    );
+    t1 = rtems_clock_get_uptime_nanoseconds();
+    rtems_test_assert( status == RTEMS_RECORD_CLIENT_SUCCESS );
+    rtems_test_assert( ctx->items == expected_items );
+
+    /*
+     * The times of the user items strictly increase and all user items were
+     * reported, so the merged user items are in the generation order.
+     */
+    rtems_test_assert( ctx->user_items == USER_ITEM_COUNT );
+    snprintf( name, sizeof( name ), "parallel %" PRIu32, workers );
+    print_rate( name, ctx->items, t1 - t0 );
+  }
+}
+
+static void test_invalid( test_context *ctx )
+{
+  rtems_record_client_status status;
+  uint32_t                   bad[ 2 ];
+
+  memcpy( bad, ctx->stream, sizeof( bad ) );
+  bad[ 1 ] = ~bad[ 1 ];
+  status = rtems_record_decode_parallel(
+    bad,
+    sizeof( bad ),
+    0,
+    count_items,
+    ctx
+  );
+  rtems_test_assert( status == RTEMS_RECORD_CLIENT_ERROR_INVALID_MAGIC );
+
+  bad[ 0 ] = 0;
+  status = rtems_record_decode_parallel(
+    bad,
+    sizeof( bad ),
+    0,
+    count_items,
+    ctx
+  );
+  rtems_test_assert( status == RTEMS_RECORD_CLIENT_ERROR_UNKNOWN_FORMAT );
+}
+
+static void test_convert( test_context *ctx, uint64_t expected_items )
+{
+  static const char               prefix[] = "{\"traceEvents\":[";
+  rtems_record_convert_statistics stats;
+  rtems_record_client_status      status;
+  char                            buf[ sizeof( prefix ) ];
+  FILE                           *file;
+  size_t                          n;
+  int                             rv;
+
+  status = rtems_record_convert(
+    ctx->stream,
+    ctx->size,
+    2,
+    RTEMS_RECORD_CONVERT_CHROME_JSON,
+    "/trace.json",
+    &stats
+  );
+  rtems_test_assert( status == RTEMS_RECORD_CLIENT_SUCCESS );
+  rtems_test_assert( stats.items == expected_items );
+  rtems_test_assert( stats.processors == CPU_COUNT );
+
+  file = fopen( "/trace.json", "r" );
+  rtems_test_assert( file != NULL );
+  n = fread( buf, 1, sizeof( prefix ) - 1, file );
+  rtems_test_assert( n == sizeof( prefix ) - 1 );
+  rtems_test_assert( memcmp( buf, prefix, n ) == 0 );
+  rv = fclose( file );
+  rtems_test_assert( rv == 0 );
+
+  status = rtems_record_convert(
+    ctx->stream,
+    ctx->size,
+    0,
+    RTEMS_RECORD_CONVERT_CTF,
+    "/ctf",
+    &stats
+  );
+  rtems_test_assert( status == RTEMS_RECORD_CLIENT_SUCCESS );
+  rtems_test_assert( stats.items == expected_items );
+  rtems_test_assert( stats.processors == CPU_COUNT );
+
+  file = fopen( "/ctf/stream_3", "r" );
+  rtems_test_assert( file != NULL );
+  rv = fclose( file );
+  rtems_test_assert( rv == 0 );
+
+  status = rtems_record_convert(
+    ctx->stream,
+    ctx->size,
+    0,
+    RTEMS_RECORD_CONVERT_CHROME_JSON,
+    "/nix/trace.json",
+    NULL
+  );
+  rtems_test_assert( status == RTEMS_RECORD_CLIENT_ERROR_OUTPUT );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+  uint64_t      items;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  build_stream( ctx );
+  items = test_serial( ctx );
+  rtems_test_assert( items > USER_ITEM_COUNT );
+  test_parallel( ctx, items );
+  test_invalid( ctx );
+  test_convert( ctx, items );
+  free( ctx->stream );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS CPU_COUNT
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS ITEM_COUNT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,323 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <rtems/termiostypes.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "TERMIOS 12";
+
+#define DEVICE_PATH "/loopback"
+
+#define CBUF_SIZE 4096
+
+#define RAW_INPUT_SIZE 8192
+
+#define RAW_OUTPUT_SIZE 8192
+
+#define CHUNK_SIZE 4096
+
+#define PATTERN_SIZE 26
+
+#define TRANSFER_SIZE (4 * 1024 * 1024)
+
+typedef struct {
+  rtems_termios_device_context base;
+  rtems_termios_tty *tty;
+  const char *tx_buf;
+  size_t tx_pending;
+  size_t tx_max_chunk;
+  size_t tx_chunks;
+  int fd;
+  struct termios term;
+  char pattern[CHUNK_SIZE + PATTERN_SIZE];
+  char rx_buf[CHUNK_SIZE];
+} test_context;
+
+static test_context test_instance = {
+  .base = RTEMS_TERMIOS_DEVICE_CONTEXT_INITIALIZER("Loopback")
+};
+
+static bool first_open(
+  rtems_termios_tty *tty,
+  rtems_termios_device_context *base,
+  struct termios *term,
+  rtems_libio_open_close_args_t *args
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  ctx->tty = tty;
+
+  return true;
+}
+
+/*
+ * Called with the device lock acquired.  The stand-in transmitter just
+ * remembers the chunk, it is transmitted by loopback().
+ */
+static void write_loopback(
+  rtems_termios_device_context *base,
+  const char *buf,
+  size_t len
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  ctx->tx_buf = buf;
+  ctx->tx_pending = len;
+
+  if (len > 0) {
+    ++ctx->tx_chunks;
+
+    if (len > ctx->tx_max_chunk) {
+      ctx->tx_max_chunk = len;
+    }
+  }
+}
+
+static const rtems_termios_device_handler handler = {
+  .first_open = first_open,
+  .write = write_loopback,
+  .mode = TERMIOS_IRQ_DRIVEN
+};
+
+static size_t raw_input_space(const rtems_termios_tty *tty)
+{
+  unsigned int size = tty->rawInBuf.Size;
+
+  return size - 1 - (tty->rawInBuf.Tail + size - tty->rawInBuf.Head) % size;
+}
+
+/*
+ * Emulate the transmit and receive interrupts of a device with its transmit
+ * line connected to its receive line.  Only as many characters are
+ * transmitted as fit into the raw input queue, so no characters are dropped.
+ */
+static void loopback(test_context *ctx)
+{
+  size_t n;
+  int dropped;
+
+  n = raw_input_space(ctx->tty);
+
+  if (n > ctx->tx_pending) {
+    n = ctx->tx_pending;
+  }
+
+  if (n == 0) {
+    return;
+  }
+
+  dropped = rtems_termios_enqueue_raw_characters(ctx->tty, ctx->tx_buf, (int) n);
+  rtems_test_assert(dropped == 0);
+
+  rtems_termios_dequeue_characters(ctx->tty, (int) n);
+}
+
+static void set_raw(test_context *ctx)
+{
+  int rv;
+
+  rv = tcgetattr(ctx->fd, &ctx->term);
+  rtems_test_assert(rv == 0);
+
+  cfmakeraw(&ctx->term);
+  ctx->term.c_cc[VMIN] = 0;
+  ctx->term.c_cc[VTIME] = 0;
+
+  rv = tcsetattr(ctx->fd, TCSANOW, &ctx->term);
+  rtems_test_assert(rv == 0);
+}
+
+static void clear_set_flags(
+  test_context *ctx,
+  tcflag_t iflag,
+  tcflag_t lflag,
+  bool set
+)
+{
+  int rv;
+
+  if (set) {
+    ctx->term.c_iflag |= iflag;
+    ctx->term.c_lflag |= lflag;
+  } else {
+    ctx->term.c_iflag &= ~iflag;
+    ctx->term.c_lflag &= ~lflag;
+  }
+
+  rv = tcsetattr(ctx->fd, TCSANOW, &ctx->term);
+  rtems_test_assert(rv == 0);
+}
+
+static void setup(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+  int flags;
+  int rv;
+
+  for (i = 0; i < sizeof(ctx->pattern); ++i) {
+    ctx->pattern[i] = (char) ('a' + i % PATTERN_SIZE);
+  }
+
+  sc = rtems_termios_bufsize(CBUF_SIZE, RAW_INPUT_SIZE, RAW_OUTPUT_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_termios_device_install(DEVICE_PATH, &handler, NULL, &ctx->base);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->fd = open(DEVICE_PATH, O_RDWR);
+  rtems_test_assert(ctx->fd >= 0);
+
+  flags = fcntl(ctx->fd, F_GETFL, 0);
+  rtems_test_assert(flags >= 0);
+
+  rv = fcntl(ctx->fd, F_SETFL, flags | O_NONBLOCK);
+  rtems_test_assert(rv == 0);
+
+  set_raw(ctx);
+}
+
+static void transfer(test_context *ctx, const char *name)
+{
+  size_t sent;
+  size_t received;
+  uint64_t begin;
+  uint64_t ns;
+
+  sent = 0;
+  received = 0;
+  ctx->tx_max_chunk = 0;
+  ctx->tx_chunks = 0;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  while (received < TRANSFER_SIZE) {
+    ssize_t n;
+
+    if (sent < TRANSFER_SIZE) {
+      size_t len;
+
+      len = TRANSFER_SIZE - sent;
+      if (len > CHUNK_SIZE) {
+        len = CHUNK_SIZE;
+      }
+
+      n = write(ctx->fd, &ctx->pattern[sent % PATTERN_SIZE], len);
+      rtems_test_assert(n >= 0);
+      sent += (size_t) n;
+    }
+
+    loopback(ctx);
+
+    n = read(ctx->fd, ctx->rx_buf, sizeof(ctx->rx_buf));
+    rtems_test_assert(n >= 0);
+    rtems_test_assert(
+      memcmp(ctx->rx_buf, &ctx->pattern[received % PATTERN_SIZE], (size_t) n)
+        == 0
+    );
+    received += (size_t) n;
+  }
+
+  ns = rtems_clock_get_uptime_nanoseconds() - begin;
+  rtems_test_assert(received == TRANSFER_SIZE);
+  rtems_test_assert(ctx->tx_pending == 0);
+
+  printf(
+    "%s: %zu bytes in %" PRIu64 " us, %" PRIu64 " bytes/s, "
+    "%zu transmit chunks, max. chunk %zu bytes\n",
+    name,
+    received,
+    ns / 1000,
+    ns != 0 ? (uint64_t) received * 1000000000 / ns : 0,
+    ctx->tx_chunks,
+    ctx->tx_max_chunk
+  );
+}
+
+static void test_raw(test_context *ctx)
+{
+  transfer(ctx, "raw");
+
+  /*
+   * The characters of a write() are handed to the driver as one contiguous
+   * chunk unless the raw output queue wraps.
+   */
+  rtems_test_assert(ctx->tx_max_chunk >= CHUNK_SIZE);
+}
+
+static void test_processed(test_context *ctx)
+{
+  /*
+   * The pattern is not changed by these flags, however, they disable the bulk
+   * receive path.
+   */
+  clear_set_flags(ctx, ICRNL, ISIG, true);
+  transfer(ctx, "processed");
+  clear_set_flags(ctx, ICRNL, ISIG, false);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  setup(ctx);
+  test_raw(ctx);
+  test_processed(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,768 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/libio.h>
+#include <rtems/tftp.h>
+#include <rtems.h>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "TFTPFS 1";
+
+/*
+ * The test provides the UDP socket and host name functions used by the TFTP
+ * file system.
+ * A stand-in TFTP server answers the requests sent to it.  The first
+ * response to each request is delayed by one clock tick to simulate the
+ * round trip time of a network.
+ */
+
+#define MOUNT_POINT "/TFTP"
+
+#define FILE_PATH MOUNT_POINT "/127.0.0.1:/image"
+
+#define UNKNOWN_HOST_PATH MOUNT_POINT "/unknown:/image"
+
+#define FILE_SIZE ( 128 * 1024 + 100 )
+
+#define SERVER_PORT 1069
+
+#define QUEUE_SIZE 64
+
+#define OPCODE_RRQ 1
+
+#define OPCODE_WRQ 2
+
+#define OPCODE_DATA 3
+
+#define OPCODE_ACK 4
+
+#define OPCODE_ERROR 5
+
+#define OPCODE_OACK 6
+
+#define ERROR_OPTION 8
+
+typedef enum {
+  SERVER_OPTIONS,
+  SERVER_NO_OPTIONS,
+  SERVER_REJECT_OPTIONS,
+  SERVER_BAD_OPTIONS
+} server_mode;
+
+typedef struct {
+  uint16_t opcode;
+  uint16_t value;
+  size_t   size;
+  char     options[ 40 ];
+} packet;
+
+typedef struct {
+  int         socket;
+  server_mode mode;
+  uint32_t    drop_block;
+  bool        dropped;
+  bool        writing;
+  bool        delay;
+  int         blocksize;
+  int         windowsize;
+  size_t      received;
+  uint32_t    round_trips;
+  uint32_t    option_errors;
+  uint32_t    client_errors;
+  uint32_t    host_lookups;
+  int         receive_buffer;
+  size_t      head;
+  size_t      count;
+  packet      queue[ QUEUE_SIZE ];
+  uint8_t     file[ FILE_SIZE ];
+  uint8_t     upload[ FILE_SIZE ];
+  uint8_t     buffer[ 4096 ];
+} test_context;
+
+static test_context test_instance;
+
+static void enqueue(
+  test_context *ctx,
+  uint16_t      opcode,
+  uint16_t      value,
+  const char   *options,
+  size_t        size
+)
+{
+  packet *p;
+
+  rtems_test_assert( ctx->count < QUEUE_SIZE );
+  p = &ctx->queue[ ( ctx->head + ctx->count ) % QUEUE_SIZE ];
+  p->opcode = opcode;
+  p->value = value;
+  p->size = size;
+  memcpy( p->options, options, size );
+  ++ctx->count;
+}
+
+static bool block_exists( const test_context *ctx, uint32_t block )
+{
+  return ( block - 1 ) * (uint32_t) ctx->blocksize <= FILE_SIZE;
+}
+
+static void send_window( test_context *ctx, uint32_t first )
+{
+  uint32_t block;
+
+  for (
+    block = first;
+    block < first + ctx->windowsize && block_exists( ctx, block );
+    ++block
+  ) {
+    if ( block == ctx->drop_block && !ctx->dropped ) {
+      ctx->dropped = true;
+      continue;
+    }
+
+    enqueue( ctx, OPCODE_DATA, (uint16_t) block, NULL, 0 );
+  }
+}
+
+static void receive_request(
+  test_context *ctx,
+  const char   *p,
+  const char   *end
+)
+{
+  const char *filename;
+  const char *mode;
+  char        oack[ sizeof( ctx->queue[ 0 ].options ) ];
+  size_t      oack_size;
+  bool        options;
+
+  filename = p;
+  rtems_test_assert( strcmp( filename, "image" ) == 0 );
+  mode = filename + strlen( filename ) + 1;
+  rtems_test_assert( strcmp( mode, "octet" ) == 0 );
+  p = mode + strlen( mode ) + 1;
+
+  ctx->blocksize = 512;
+  ctx->windowsize = 1;
+  ctx->received = 0;
+  options = false;
+  oack_size = 0;
+
+  while ( p < end ) {
+    const char *name;
+    const char *value;
+    int         v;
+
+    name = p;
+    value = name + strlen( name ) + 1;
+    p = value + strlen( value ) + 1;
+    v = atoi( value );
+    options = true;
+
+    if ( ctx->mode == SERVER_BAD_OPTIONS ) {
+      ++v;
+    }
+
+    oack_size += (size_t) sprintf( &oack[ oack_size ], "%s", name ) + 1;
+    oack_size += (size_t) sprintf( &oack[ oack_size ], "%d", v ) + 1;
+
+    if ( strcmp( name, "blksize" ) == 0 ) {
+      rtems_test_assert( v >= 8 && v <= 65465 );
+      ctx->blocksize = v;
+    } else {
+      rtems_test_assert( strcmp( name, "windowsize" ) == 0 );
+      rtems_test_assert( !ctx->writing );
+      ctx->windowsize = v;
+    }
+  }
+
+  if ( options && ctx->mode == SERVER_REJECT_OPTIONS ) {
+    ++ctx->option_errors;
+    enqueue( ctx, OPCODE_ERROR, ERROR_OPTION, NULL, 0 );
+    return;
+  }
+
+  if ( options && ctx->mode != SERVER_NO_OPTIONS ) {
+    enqueue( ctx, OPCODE_OACK, 0, oack, oack_size );
+    return;
+  }
+
+  ctx->blocksize = 512;
+  ctx->windowsize = 1;
+
+  if ( ctx->writing ) {
+    enqueue( ctx, OPCODE_ACK, 0, NULL, 0 );
+  } else {
+    send_window( ctx, 1 );
+  }
+}
+
+static void receive_data(
+  test_context  *ctx,
+  uint16_t       block,
+  const uint8_t *data,
+  size_t         size
+)
+{
+  size_t offset;
+
+  offset = ( block - 1 ) * (size_t) ctx->blocksize;
+  rtems_test_assert( offset == ctx->received );
+  rtems_test_assert( size <= (size_t) ctx->blocksize );
+  rtems_test_assert( offset + size <= FILE_SIZE );
+  memcpy( &ctx->upload[ offset ], data, size );
+  ctx->received += size;
+  enqueue( ctx, OPCODE_ACK, block, NULL, 0 );
+}
+
+int inet_aton( const char *cp, struct in_addr *addr )
+{
+  if ( strcmp( cp, "127.0.0.1" ) != 0 ) {
+    return 0;
+  }
+
+  addr->s_addr = htonl( INADDR_LOOPBACK );
+  return 1;
+}
+
+struct hostent *gethostbyname( const char *name )
+{
+  rtems_test_assert( strcmp( name, "unknown" ) == 0 );
+  ++test_instance.host_lookups;
+  return NULL;
+}
+
+int socket( int domain, int type, int protocol )
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+  rtems_test_assert( domain == AF_INET );
+  rtems_test_assert( type == SOCK_DGRAM );
+  rtems_test_assert( protocol == 0 );
+  rtems_test_assert( ctx->socket < 0 );
+  ctx->socket = open( "/socket", O_RDWR | O_CREAT, S_IRWXU );
+  ctx->head = 0;
+  ctx->count = 0;
+  ctx->receive_buffer = 0;
+  return ctx->socket;
+}
+
+int bind( int s, const struct sockaddr *name, socklen_t namelen )
+{
+  rtems_test_assert( s == test_instance.socket );
+  rtems_test_assert( name->sa_family == AF_INET );
+  rtems_test_assert( namelen == sizeof( struct sockaddr_in ) );
+  return 0;
+}
+
+int setsockopt(
+  int         s,
+  int         level,
+  int         optname,
+  const void *optval,
+  socklen_t   optlen
+)
+{
+  rtems_test_assert( s == test_instance.socket );
+  rtems_test_assert( level == SOL_SOCKET );
+
+  if ( optname == SO_RCVBUF ) {
+    rtems_test_assert( optlen == sizeof( int ) );
+    memcpy( &test_instance.receive_buffer, optval, sizeof( int ) );
+  }
+
+  return 0;
+}
+
+ssize_t sendto(
+  int                    s,
+  const void            *buf,
+  size_t                 len,
+  int                    flags,
+  const struct sockaddr *to,
+  socklen_t              tolen
+)
+{
+  test_context             *ctx;
+  const struct sockaddr_in *sin;
+  const uint8_t            *p;
+  uint16_t                  opcode;
+  uint16_t                  value;
+  size_t                    count;
+
+  ctx = &test_instance;
+  rtems_test_assert( s == ctx->socket );
+  rtems_test_assert( flags == 0 );
+  rtems_test_assert( tolen == sizeof( *sin ) );
+  rtems_test_assert( len >= 4 );
+  sin = (const struct sockaddr_in *) to;
+  rtems_test_assert( sin->sin_addr.s_addr == htonl( INADDR_LOOPBACK ) );
+  p = buf;
+  opcode = (uint16_t) ( ( p[ 0 ] << 8 ) | p[ 1 ] );
+  value = (uint16_t) ( ( p[ 2 ] << 8 ) | p[ 3 ] );
+  count = ctx->count;
+
+  switch ( opcode ) {
+    case OPCODE_RRQ:
+    case OPCODE_WRQ:
+      rtems_test_assert( ntohs( sin->sin_port ) == 69 );
+      rtems_test_assert( ((const char *) buf)[ len - 1 ] == '\0' );
+      ctx->writing = ( opcode == OPCODE_WRQ );
+      receive_request( ctx, (const char *) buf + 2, (const char *) buf + len );
+      break;
+    case OPCODE_ACK:
+      rtems_test_assert( ntohs( sin->sin_port ) == SERVER_PORT );
+      rtems_test_assert( !ctx->writing );
+      rtems_test_assert( len == 4 );
+
+      if ( block_exists( ctx, (uint32_t) value + 1 ) ) {
+        send_window( ctx, (uint32_t) value + 1 );
+      }
+      break;
+    case OPCODE_DATA:
+      rtems_test_assert( ntohs( sin->sin_port ) == SERVER_PORT );
+      rtems_test_assert( ctx->writing );
+      receive_data( ctx, value, p + 4, len - 4 );
+      break;
+    default:
+      rtems_test_assert( opcode == OPCODE_ERROR );
+      ++ctx->client_errors;
+      ctx->count = 0;
+      break;
+  }
+
+  if ( ctx->count > count ) {
+    ++ctx->round_trips;
+    ctx->delay = true;
+  }
+
+  return (ssize_t) len;
+}
+
+ssize_t recvfrom(
+  int              s,
+  void            *buf,
+  size_t           len,
+  int              flags,
+  struct sockaddr *from,
+  socklen_t       *fromlen
+)
+{
+  test_context       *ctx;
+  struct sockaddr_in  sin;
+  const packet       *p;
+  uint8_t            *b;
+  size_t              n;
+
+  ctx = &test_instance;
+  rtems_test_assert( s == ctx->socket );
+  rtems_test_assert( flags == 0 );
+  rtems_test_assert( *fromlen >= sizeof( sin ) );
+
+  if ( ctx->count == 0 ) {
+    errno = EAGAIN;
+    return -1;
+  }
+
+  if ( ctx->delay ) {
+    ctx->delay = false;
+    rtems_task_wake_after( 1 );
+  }
+
+  p = &ctx->queue[ ctx->head ];
+  ctx->head = ( ctx->head + 1 ) % QUEUE_SIZE;
+  --ctx->count;
+
+  b = buf;
+  rtems_test_assert( len >= 4 + p->size );
+  b[ 0 ] = 0;
+  b[ 1 ] = (uint8_t) p->opcode;
+  b[ 2 ] = (uint8_t) ( p->value >> 8 );
+  b[ 3 ] = (uint8_t) p->value;
+
+  if ( p->opcode == OPCODE_DATA ) {
+    size_t offset;
+
+    offset = ( p->value - 1 ) * (size_t) ctx->blocksize;
+    n = FILE_SIZE - offset;
+
+    if ( n > (size_t) ctx->blocksize ) {
+      n = (size_t) ctx->blocksize;
+    }
+
+    rtems_test_assert( len >= 4 + n );
+    memcpy( &b[ 4 ], &ctx->file[ offset ], n );
+    n += 4;
+  } else if ( p->opcode == OPCODE_OACK ) {
+    memcpy( &b[ 2 ], p->options, p->size );
+    n = 2 + p->size;
+  } else if ( p->opcode == OPCODE_ERROR ) {
+    b[ 4 ] = '\0';
+    n = 5;
+  } else {
+    n = 4;
+  }
+
+  memset( &sin, 0, sizeof( sin ) );
+  sin.sin_family = AF_INET;
+  sin.sin_port = htons( SERVER_PORT );
+  sin.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+  memcpy( from, &sin, sizeof( sin ) );
+  *fromlen = sizeof( sin );
+  return (ssize_t) n;
+}
+
+static void prepare(
+  test_context *ctx,
+  server_mode   mode,
+  uint32_t      drop_block
+)
+{
+  ctx->mode = mode;
+  ctx->drop_block = drop_block;
+  ctx->dropped = false;
+  ctx->round_trips = 0;
+  ctx->option_errors = 0;
+  ctx->client_errors = 0;
+}
+
+static void mount_tftpfs( const char *options )
+{
+  int rv;
+
+  rv = mount(
+    "",
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_TFTPFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void unmount_tftpfs( void )
+{
+  int rv;
+
+  rv = unmount( MOUNT_POINT );
+  rtems_test_assert( rv == 0 );
+}
+
+static uint64_t read_file( test_context *ctx )
+{
+  uint64_t begin;
+  size_t   offset;
+  ssize_t  n;
+  int      fd;
+  int      rv;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  fd = open( FILE_PATH, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+  offset = 0;
+
+  do {
+    n = read( fd, ctx->buffer, sizeof( ctx->buffer ) );
+    rtems_test_assert( n >= 0 );
+    rtems_test_assert( offset + (size_t) n <= FILE_SIZE );
+    rtems_test_assert(
+      memcmp( ctx->buffer, &ctx->file[ offset ], (size_t) n ) == 0
+    );
+    offset += (size_t) n;
+  } while ( n > 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( ctx->socket >= 0 );
+  ctx->socket = -1;
+  rtems_test_assert( offset == FILE_SIZE );
+  return rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static void write_file( test_context *ctx )
+{
+  size_t  offset;
+  ssize_t n;
+  int     fd;
+  int     rv;
+
+  memset( ctx->upload, 0, sizeof( ctx->upload ) );
+  fd = open( FILE_PATH, O_WRONLY );
+  rtems_test_assert( fd >= 0 );
+
+  for ( offset = 0; offset < FILE_SIZE; offset += (size_t) n ) {
+    n = FILE_SIZE - offset;
+
+    if ( n > 1000 ) {
+      n = 1000;
+    }
+
+    n = write( fd, &ctx->file[ offset ], (size_t) n );
+    rtems_test_assert( n > 0 );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+  ctx->socket = -1;
+  rtems_test_assert( ctx->received == FILE_SIZE );
+  rtems_test_assert( memcmp( ctx->upload, ctx->file, FILE_SIZE ) == 0 );
+}
+
+static uint32_t expected_round_trips( int blocksize, int windowsize )
+{
+  uint32_t blocks;
+  uint32_t windows;
+
+  blocks = FILE_SIZE / (uint32_t) blocksize + 1;
+  windows = ( blocks + (uint32_t) windowsize - 1 ) / (uint32_t) windowsize;
+
+  if ( blocksize != 512 || windowsize != 1 ) {
+    return 1 + windows;
+  }
+
+  return windows;
+}
+
+static const struct {
+  int blocksize;
+  int windowsize;
+} transfers[] = {
+  { 512, 1 },
+  { 512, 8 },
+  { 1456, 1 },
+  { 1456, 8 },
+  { 8192, 1 },
+  { 8192, 16 },
+  { 65464, 1 },
+  { 65464, 4 }
+};
+
+static void test_throughput( test_context *ctx )
+{
+  size_t i;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( transfers ); ++i ) {
+    char     options[ 64 ];
+    uint64_t ns;
+
+    snprintf(
+      options,
+      sizeof( options ),
+      "blocksize=%i windowsize=%i",
+      transfers[ i ].blocksize,
+      transfers[ i ].windowsize
+    );
+    mount_tftpfs( options );
+    prepare( ctx, SERVER_OPTIONS, 0 );
+    ns = read_file( ctx );
+    rtems_test_assert( ctx->blocksize == transfers[ i ].blocksize );
+    rtems_test_assert( ctx->windowsize == transfers[ i ].windowsize );
+    rtems_test_assert(
+      ctx->round_trips == expected_round_trips(
+        transfers[ i ].blocksize,
+        transfers[ i ].windowsize
+      )
+    );
+
+    if ( transfers[ i ].windowsize > 1 ) {
+      rtems_test_assert( ctx->receive_buffer > 0 );
+    }
+
+    unmount_tftpfs();
+    printf(
+      "blocksize %5i, windowsize %2i: %4" PRIu32 " round trips, %6" PRIu64
+        " KiB/s\n",
+      transfers[ i ].blocksize,
+      transfers[ i ].windowsize,
+      ctx->round_trips,
+      ( (uint64_t) FILE_SIZE * 1000000000 ) / ( ns * 1024 )
+    );
+  }
+}
+
+static void test_fallback( test_context *ctx )
+{
+  int fd;
+
+  /* The default options with a server which does not know them */
+  mount_tftpfs( NULL );
+  prepare( ctx, SERVER_NO_OPTIONS, 0 );
+  read_file( ctx );
+  rtems_test_assert( ctx->round_trips == expected_round_trips( 512, 1 ) );
+
+  /* The default options with a server which refuses them */
+  prepare( ctx, SERVER_REJECT_OPTIONS, 0 );
+  read_file( ctx );
+  rtems_test_assert( ctx->option_errors == 1 );
+  rtems_test_assert( ctx->round_trips == 1 + expected_round_trips( 512, 1 ) );
+
+  /* A server which raises the requested values */
+  prepare( ctx, SERVER_BAD_OPTIONS, 0 );
+  errno = 0;
+  fd = open( FILE_PATH, O_RDONLY );
+  rtems_test_assert( fd == -1 );
+  rtems_test_assert( errno == EPROTO );
+  rtems_test_assert( ctx->client_errors == 1 );
+  ctx->socket = -1;
+
+  unmount_tftpfs();
+}
+
+static void test_lost_block( test_context *ctx )
+{
+  mount_tftpfs( "blocksize=1456 windowsize=8" );
+  prepare( ctx, SERVER_OPTIONS, 5 );
+  read_file( ctx );
+  rtems_test_assert( ctx->dropped );
+  rtems_test_assert( ctx->round_trips == 1 + expected_round_trips( 1456, 8 ) );
+  unmount_tftpfs();
+}
+
+static void test_write( test_context *ctx )
+{
+  mount_tftpfs( "blocksize=8192 windowsize=16" );
+  prepare( ctx, SERVER_OPTIONS, 0 );
+  write_file( ctx );
+  rtems_test_assert( ctx->blocksize == 8192 );
+  rtems_test_assert( ctx->windowsize == 1 );
+  unmount_tftpfs();
+
+  mount_tftpfs( NULL );
+  prepare( ctx, SERVER_NO_OPTIONS, 0 );
+  write_file( ctx );
+  rtems_test_assert( ctx->blocksize == 512 );
+  unmount_tftpfs();
+}
+
+static void test_unknown_host( test_context *ctx )
+{
+  int fd;
+
+  mount_tftpfs( NULL );
+  ctx->host_lookups = 0;
+  errno = 0;
+  fd = open( UNKNOWN_HOST_PATH, O_RDONLY );
+  rtems_test_assert( fd == -1 );
+  rtems_test_assert( errno == ENOENT );
+  rtems_test_assert( ctx->host_lookups == 1 );
+  rtems_test_assert( ctx->socket == -1 );
+  unmount_tftpfs();
+}
+
+static void test_mount_options( void )
+{
+  static const char * const invalid[] = {
+    "blocksize=7",
+    "blocksize=65465",
+    "windowsize=0",
+    "windowsize=65536"
+  };
+  size_t i;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( invalid ); ++i ) {
+    int rv;
+
+    errno = 0;
+    rv = mount(
+      "",
+      MOUNT_POINT,
+      RTEMS_FILESYSTEM_TYPE_TFTPFS,
+      RTEMS_FILESYSTEM_READ_WRITE,
+      invalid[ i ]
+    );
+    rtems_test_assert( rv == -1 );
+    rtems_test_assert( errno == EINVAL );
+  }
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+  size_t        i;
+  int           rv;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+  ctx->socket = -1;
+
+  for ( i = 0; i < FILE_SIZE; ++i ) {
+    ctx->file[ i ] = (uint8_t) ( i * 7 + i / 251 );
+  }
+
+  rv = mkdir( MOUNT_POINT, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  test_mount_options();
+  test_throughput( ctx );
+  test_fallback( ctx );
+  test_lost_block( ctx );
+  test_write( ctx );
+  test_unknown_host( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_FILESYSTEM_TFTPFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
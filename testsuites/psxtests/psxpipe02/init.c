@@ -0,0 +1,368 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/uio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/pipe.h>
+
+#include <pmacros.h>
+
+const char rtems_test_name[] = "PSXPIPE 2";
+
+#define DEFAULT_SIZE ( 2 * PIPE_BUF )
+
+#define TRANSFER_SIZE ( 4 * 1024 * 1024 )
+
+#define WRITE_SIZE ( 64 * 1024 )
+
+#define EVENT_DONE RTEMS_EVENT_0
+
+typedef struct {
+  int fd[ 2 ];
+  rtems_id runner_id;
+  uint32_t context_switches;
+  char write_buf[ WRITE_SIZE ];
+  char read_buf[ WRITE_SIZE ];
+} test_context;
+
+static test_context test_instance;
+
+static void create_pipe( test_context *ctx )
+{
+  int rv;
+
+  rv = pipe( ctx->fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void delete_pipe( test_context *ctx )
+{
+  int rv;
+
+  rv = close( ctx->fd[ 0 ] );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( ctx->fd[ 1 ] );
+  rtems_test_assert( rv == 0 );
+}
+
+static void set_non_blocking( int fd, bool enable )
+{
+  int flags;
+  int rv;
+
+  flags = fcntl( fd, F_GETFL, 0 );
+  rtems_test_assert( flags >= 0 );
+
+  if ( enable ) {
+    flags |= O_NONBLOCK;
+  } else {
+    flags &= ~O_NONBLOCK;
+  }
+
+  rv = fcntl( fd, F_SETFL, flags );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_size( test_context *ctx )
+{
+  ssize_t n;
+  int fd;
+  int rv;
+
+  puts( "Init - pipe buffer size" );
+
+  create_pipe( ctx );
+
+  rv = fcntl( ctx->fd[ 0 ], F_GETPIPE_SZ );
+  rtems_test_assert( rv == DEFAULT_SIZE );
+
+  rv = fcntl( ctx->fd[ 1 ], F_SETPIPE_SZ, 1 );
+  rtems_test_assert( rv == PIPE_BUF );
+
+  rv = fcntl( ctx->fd[ 0 ], F_GETPIPE_SZ );
+  rtems_test_assert( rv == PIPE_BUF );
+
+  errno = 0;
+  rv = fcntl( ctx->fd[ 1 ], F_SETPIPE_SZ, -1 );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  /* The content is preserved if the buffer grows */
+  memset( ctx->write_buf, 'a', PIPE_BUF );
+  n = write( ctx->fd[ 1 ], ctx->write_buf, PIPE_BUF );
+  rtems_test_assert( n == PIPE_BUF );
+
+  rv = fcntl( ctx->fd[ 1 ], F_SETPIPE_SZ, WRITE_SIZE );
+  rtems_test_assert( rv == WRITE_SIZE );
+
+  memset( ctx->write_buf, 'b', WRITE_SIZE - PIPE_BUF );
+  n = write( ctx->fd[ 1 ], ctx->write_buf, WRITE_SIZE - PIPE_BUF );
+  rtems_test_assert( n == WRITE_SIZE - PIPE_BUF );
+
+  /* The buffer cannot shrink below its content */
+  errno = 0;
+  rv = fcntl( ctx->fd[ 1 ], F_SETPIPE_SZ, PIPE_BUF );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EBUSY );
+
+  n = read( ctx->fd[ 0 ], ctx->read_buf, WRITE_SIZE );
+  rtems_test_assert( n == WRITE_SIZE );
+  rtems_test_assert( ctx->read_buf[ 0 ] == 'a' );
+  rtems_test_assert( ctx->read_buf[ PIPE_BUF - 1 ] == 'a' );
+  rtems_test_assert( ctx->read_buf[ PIPE_BUF ] == 'b' );
+  rtems_test_assert( ctx->read_buf[ WRITE_SIZE - 1 ] == 'b' );
+
+  delete_pipe( ctx );
+
+  /* Regular files have no pipe buffer */
+  fd = open( "/file", O_CREAT | O_RDWR, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  rv = fcntl( fd, F_GETPIPE_SZ );
+  rtems_test_assert( rv == -1 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( "/file" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_vectored( test_context *ctx )
+{
+  struct iovec iov[ 3 ];
+  ssize_t n;
+  int rv;
+
+  puts( "Init - readv() and writev()" );
+
+  create_pipe( ctx );
+
+  memcpy( &ctx->write_buf[ 0 ], "abc", 3 );
+  memcpy( &ctx->write_buf[ 8 ], "de", 2 );
+  memcpy( &ctx->write_buf[ 16 ], "fghi", 4 );
+
+  iov[ 0 ].iov_base = &ctx->write_buf[ 0 ];
+  iov[ 0 ].iov_len = 3;
+  iov[ 1 ].iov_base = &ctx->write_buf[ 8 ];
+  iov[ 1 ].iov_len = 2;
+  iov[ 2 ].iov_base = &ctx->write_buf[ 16 ];
+  iov[ 2 ].iov_len = 4;
+
+  n = writev( ctx->fd[ 1 ], iov, 3 );
+  rtems_test_assert( n == 9 );
+
+  memset( ctx->read_buf, 0, 32 );
+  iov[ 0 ].iov_base = &ctx->read_buf[ 0 ];
+  iov[ 0 ].iov_len = 4;
+  iov[ 1 ].iov_base = &ctx->read_buf[ 8 ];
+  iov[ 1 ].iov_len = 0;
+  iov[ 2 ].iov_base = &ctx->read_buf[ 16 ];
+  iov[ 2 ].iov_len = 8;
+
+  n = readv( ctx->fd[ 0 ], iov, 3 );
+  rtems_test_assert( n == 9 );
+  rtems_test_assert( memcmp( &ctx->read_buf[ 0 ], "abcd", 4 ) == 0 );
+  rtems_test_assert( ctx->read_buf[ 8 ] == '\0' );
+  rtems_test_assert( memcmp( &ctx->read_buf[ 16 ], "efghi", 6 ) == 0 );
+
+  /* A vectored write which fits into the buffer is not split */
+  rv = fcntl( ctx->fd[ 1 ], F_SETPIPE_SZ, PIPE_BUF );
+  rtems_test_assert( rv == PIPE_BUF );
+
+  n = write( ctx->fd[ 1 ], ctx->write_buf, 1 );
+  rtems_test_assert( n == 1 );
+
+  iov[ 0 ].iov_base = &ctx->write_buf[ 0 ];
+  iov[ 0 ].iov_len = PIPE_BUF / 2;
+  iov[ 1 ].iov_base = &ctx->write_buf[ 0 ];
+  iov[ 1 ].iov_len = PIPE_BUF / 2;
+
+  set_non_blocking( ctx->fd[ 1 ], true );
+  errno = 0;
+  n = writev( ctx->fd[ 1 ], iov, 2 );
+  rtems_test_assert( n == -1 );
+  rtems_test_assert( errno == EAGAIN );
+  set_non_blocking( ctx->fd[ 1 ], false );
+
+  delete_pipe( ctx );
+}
+
+static void writer( rtems_task_argument arg )
+{
+  test_context *ctx;
+  size_t todo;
+
+  ctx = (test_context *) arg;
+  todo = TRANSFER_SIZE;
+
+  while ( todo > 0 ) {
+    ssize_t n;
+
+    n = write( ctx->fd[ 1 ], ctx->write_buf, WRITE_SIZE );
+    rtems_test_assert( n == WRITE_SIZE );
+    todo -= (size_t) n;
+  }
+
+  (void) rtems_event_send( ctx->runner_id, EVENT_DONE );
+  rtems_task_exit();
+}
+
+static void benchmark( test_context *ctx, int size )
+{
+  rtems_status_code   sc;
+  rtems_task_priority priority;
+  rtems_event_set     events;
+  rtems_id            id;
+  uint64_t            begin;
+  uint64_t            ns;
+  uint32_t            switches;
+  size_t              received;
+  int                 rv;
+
+  create_pipe( ctx );
+
+  rv = fcntl( ctx->fd[ 1 ], F_SETPIPE_SZ, size );
+  rtems_test_assert( rv == size );
+
+  sc = rtems_task_set_priority(
+    RTEMS_SELF,
+    RTEMS_CURRENT_PRIORITY,
+    &priority
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'R', 'I', 'T' ),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ctx->runner_id = rtems_task_self();
+  received = 0;
+  switches = ctx->context_switches;
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  sc = rtems_task_start( id, writer, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  while ( received < TRANSFER_SIZE ) {
+    ssize_t n;
+
+    n = read( ctx->fd[ 0 ], ctx->read_buf, WRITE_SIZE );
+    rtems_test_assert( n > 0 );
+    received += (size_t) n;
+  }
+
+  ns = rtems_clock_get_uptime_nanoseconds() - begin;
+  switches = ctx->context_switches - switches;
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  printf(
+    "Init - buffer size %6i: %" PRIu64 " bytes/s, %" PRIu32
+      " context switches\n",
+    size,
+    ns != 0 ? (uint64_t) received * 1000000000 / ns : 0,
+    switches
+  );
+
+  delete_pipe( ctx );
+}
+
+static void test_benchmark( test_context *ctx )
+{
+  puts( "Init - pipe throughput" );
+  benchmark( ctx, PIPE_BUF );
+  benchmark( ctx, 4 * 1024 );
+  benchmark( ctx, 16 * 1024 );
+  benchmark( ctx, 64 * 1024 );
+}
+
+static rtems_task Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_size( ctx );
+  test_vectored( ctx );
+  test_benchmark( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+static void switch_extension( Thread_Control *executing, Thread_Control *heir )
+{
+  ++test_instance.context_switches;
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS \
+  { .thread_switch = switch_extension }, \
+  RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_IMFS_ENABLE_MKFIFO
+
+#define CONFIGURE_PIPE_BUFFER_SIZE DEFAULT_SIZE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
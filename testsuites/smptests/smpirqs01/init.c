@@ -32,7 +32,10 @@
 #include <rtems/test.h>
 #include <rtems/test-info.h>
 
+#include <string.h>
+
 #include <rtems.h>
+#include <rtems/counter.h>
 #include <rtems/irq-extension.h>
 #include <rtems/malloc.h>
 
@@ -219,6 +222,323 @@ T_TEST_CASE(InterruptServerSMPInitializeNoScheduler)
   T_rsc_success(sc);
 }
 
+static void dummy_handler(void *arg)
+{
+  (void) arg;
+}
+
+T_TEST_CASE(InterruptServerSMPBalance)
+{
+  rtems_status_code sc;
+  rtems_interrupt_server_statistics stats;
+  uint32_t server_count;
+
+  T_assert_eq_u32(rtems_scheduler_get_processor_maximum(), 2);
+
+  sc = rtems_interrupt_server_handler_install(
+    RTEMS_INTERRUPT_SERVER_BALANCED,
+    UINT32_MAX,
+    "Dummy",
+    RTEMS_INTERRUPT_SHARED,
+    dummy_handler,
+    NULL
+  );
+  T_rsc(sc, RTEMS_INVALID_ID);
+
+  server_count = 456;
+  sc = rtems_interrupt_server_initialize(
+    123,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &server_count
+  );
+  T_rsc_success(sc);
+  T_eq_u32(server_count, 2);
+
+  sc = rtems_interrupt_server_get_statistics(0, NULL);
+  T_rsc(sc, RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_interrupt_server_get_statistics(UINT32_MAX, &stats);
+  T_rsc(sc, RTEMS_INVALID_ID);
+
+  sc = rtems_interrupt_server_balance();
+  T_rsc_success(sc);
+
+  sc = rtems_interrupt_server_delete(0);
+  T_rsc_success(sc);
+  ensure_server_termination();
+
+  sc = rtems_interrupt_server_delete(1);
+  T_rsc_success(sc);
+  ensure_server_termination();
+}
+
+#define SERVICE_COUNT 10
+
+#define HEAVY_SERVICE_TIME 100000
+
+#define LIGHT_SERVICE_TIME 10000
+
+static rtems_id runner_id;
+
+static void heavy_handler(void *arg)
+{
+  (void) arg;
+  rtems_counter_delay_nanoseconds(HEAVY_SERVICE_TIME);
+  rtems_event_transient_send(runner_id);
+}
+
+static void light_handler(void *arg)
+{
+  (void) arg;
+  rtems_counter_delay_nanoseconds(LIGHT_SERVICE_TIME);
+  rtems_event_transient_send(runner_id);
+}
+
+typedef struct {
+  rtems_interrupt_handler handler;
+  void *arg;
+  bool installed;
+} handler_query;
+
+static void query_handler(
+  void *arg,
+  const char *info,
+  rtems_option options,
+  rtems_interrupt_handler handler,
+  void *handler_arg
+)
+{
+  handler_query *query;
+
+  (void) info;
+  (void) options;
+
+  query = arg;
+  query->handler = handler;
+  query->arg = handler_arg;
+  query->installed = true;
+}
+
+static bool has_handlers_installed(rtems_vector_number vector)
+{
+  handler_query query;
+
+  query.installed = false;
+  (void) rtems_interrupt_handler_iterate(vector, query_handler, &query);
+
+  return query.installed;
+}
+
+static size_t get_unused_vectors(rtems_vector_number *vectors, size_t count)
+{
+  rtems_vector_number vector;
+  size_t found;
+
+  found = 0;
+
+  for (vector = 0; found < count; ++vector) {
+    rtems_status_code sc;
+    rtems_interrupt_attributes attr;
+
+    sc = rtems_interrupt_get_attributes(vector, &attr);
+
+    if (sc == RTEMS_INVALID_ID) {
+      break;
+    }
+
+    if (
+      sc == RTEMS_SUCCESSFUL
+        && attr.is_maskable
+        && !has_handlers_installed(vector)
+    ) {
+      vectors[found] = vector;
+      ++found;
+    }
+  }
+
+  return found;
+}
+
+/*
+ * Carries out what an interrupt on the vector would do: call the handler
+ * installed by the interrupt server to submit the entry.  Wait for the
+ * service.
+ */
+static void service(rtems_vector_number vector)
+{
+  rtems_status_code sc;
+  handler_query query;
+
+  query.installed = false;
+  sc = rtems_interrupt_handler_iterate(vector, query_handler, &query);
+  T_rsc_success(sc);
+  T_assert_true(query.installed);
+
+  (*query.handler)(query.arg);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  T_rsc_success(sc);
+}
+
+static rtems_interrupt_server_statistics get_statistics(
+  rtems_vector_number vector
+)
+{
+  rtems_status_code sc;
+  rtems_interrupt_server_statistics stats;
+
+  memset(&stats, 0xff, sizeof(stats));
+  sc = rtems_interrupt_server_get_statistics(vector, &stats);
+  T_rsc_success(sc);
+
+  return stats;
+}
+
+T_TEST_CASE(InterruptServerSMPBalanceService)
+{
+  rtems_status_code sc;
+  rtems_interrupt_server_statistics stats;
+  rtems_vector_number vectors[2];
+  rtems_vector_number heavy;
+  rtems_vector_number light;
+  uint32_t server_count;
+  int i;
+
+  T_assert_eq_u32(rtems_scheduler_get_processor_maximum(), 2);
+
+  if (get_unused_vectors(vectors, RTEMS_ARRAY_SIZE(vectors)) < 2) {
+    T_log(T_NORMAL, "not enough unused interrupt vectors");
+    return;
+  }
+
+  heavy = vectors[0];
+  light = vectors[1];
+  runner_id = rtems_task_self();
+  rtems_interrupt_server_set_balance_interval(0);
+
+  server_count = 456;
+  sc = rtems_interrupt_server_initialize(
+    123,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &server_count
+  );
+  T_rsc_success(sc);
+  T_eq_u32(server_count, 2);
+
+  /* Without a load, the balanced handler goes to the first server */
+  sc = rtems_interrupt_server_handler_install(
+    RTEMS_INTERRUPT_SERVER_BALANCED,
+    light,
+    "Light",
+    RTEMS_INTERRUPT_UNIQUE,
+    light_handler,
+    NULL
+  );
+  T_rsc_success(sc);
+
+  sc = rtems_interrupt_server_handler_install(
+    0,
+    heavy,
+    "Heavy",
+    RTEMS_INTERRUPT_UNIQUE,
+    heavy_handler,
+    NULL
+  );
+  T_rsc_success(sc);
+
+  stats = get_statistics(light);
+  T_eq_u32(stats.server_index, 0);
+  T_true(stats.balanced);
+  T_eq_ulong(stats.count, 0);
+  T_eq_u64(stats.total_service_time, 0);
+
+  stats = get_statistics(heavy);
+  T_eq_u32(stats.server_index, 0);
+  T_false(stats.balanced);
+
+  for (i = 0; i < SERVICE_COUNT; ++i) {
+    service(heavy);
+    service(light);
+  }
+
+  stats = get_statistics(heavy);
+  T_eq_ulong(stats.count, SERVICE_COUNT);
+  T_ge_u64(stats.max_service_time, HEAVY_SERVICE_TIME);
+  T_ge_u64(stats.total_service_time, SERVICE_COUNT * HEAVY_SERVICE_TIME);
+  T_le_u64(stats.max_latency, stats.total_latency);
+
+  stats = get_statistics(light);
+  T_eq_ulong(stats.count, SERVICE_COUNT);
+  T_ge_u64(stats.max_service_time, LIGHT_SERVICE_TIME);
+  T_ge_u64(stats.total_service_time, SERVICE_COUNT * LIGHT_SERVICE_TIME);
+  T_le_u64(stats.max_latency, stats.total_latency);
+
+  /* The heavy handler keeps the first server busy */
+  sc = rtems_interrupt_server_balance();
+  T_rsc_success(sc);
+
+  stats = get_statistics(light);
+  T_eq_u32(stats.server_index, 1);
+  T_eq_ulong(stats.count, SERVICE_COUNT);
+
+  stats = get_statistics(heavy);
+  T_eq_u32(stats.server_index, 0);
+
+  service(light);
+  stats = get_statistics(light);
+  T_eq_ulong(stats.count, SERVICE_COUNT + 1);
+
+  /* Let the first server move the balanced handler away by itself */
+  sc = rtems_interrupt_server_move(1, light, 0);
+  T_rsc_success(sc);
+
+  stats = get_statistics(light);
+  T_eq_u32(stats.server_index, 0);
+
+  rtems_interrupt_server_set_balance_interval(1);
+
+  for (i = 0; i < 1000; ++i) {
+    service(heavy);
+    service(light);
+
+    stats = get_statistics(light);
+
+    if (stats.server_index != 0) {
+      break;
+    }
+  }
+
+  T_eq_u32(stats.server_index, 1);
+
+  stats = get_statistics(heavy);
+  T_eq_u32(stats.server_index, 0);
+
+  rtems_interrupt_server_set_balance_interval(
+    rtems_clock_get_ticks_per_second()
+  );
+
+  sc = rtems_interrupt_server_handler_remove(1, light, light_handler, NULL);
+  T_rsc_success(sc);
+
+  sc = rtems_interrupt_server_handler_remove(0, heavy, heavy_handler, NULL);
+  T_rsc_success(sc);
+
+  sc = rtems_interrupt_server_get_statistics(light, &stats);
+  T_rsc(sc, RTEMS_UNSATISFIED);
+
+  sc = rtems_interrupt_server_delete(0);
+  T_rsc_success(sc);
+  ensure_server_termination();
+
+  sc = rtems_interrupt_server_delete(1);
+  T_rsc_success(sc);
+  ensure_server_termination();
+}
+
 const char rtems_test_name[] = "SMPIRQS 1";
 
 static void Init(rtems_task_argument argument)
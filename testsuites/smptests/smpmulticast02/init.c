@@ -0,0 +1,342 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <rtems/test.h>
+#include <rtems/test-info.h>
+
+#include <inttypes.h>
+
+#define CPU_COUNT 32
+
+#define BATCH_SIZE 8
+
+#define SAMPLE_COUNT 100
+
+typedef struct {
+  Atomic_Uint actions;
+  Atomic_Uint done;
+  SMP_Multicast_request requests[BATCH_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static void action(void *arg)
+{
+  test_context *ctx;
+
+  ctx = arg;
+  _Atomic_Fetch_add_uint(&ctx->actions, 1, ATOMIC_ORDER_RELAXED);
+}
+
+static void done(void *arg)
+{
+  test_context *ctx;
+
+  ctx = arg;
+  _Atomic_Fetch_add_uint(&ctx->done, 1, ATOMIC_ORDER_RELAXED);
+}
+
+static void reset(test_context *ctx)
+{
+  _Atomic_Store_uint(&ctx->actions, 0, ATOMIC_ORDER_RELAXED);
+  _Atomic_Store_uint(&ctx->done, 0, ATOMIC_ORDER_RELAXED);
+}
+
+static void first_n_processors(Processor_mask *targets, uint32_t n)
+{
+  uint32_t cpu_index;
+
+  _Processor_mask_Zero(targets);
+
+  for (cpu_index = 0; cpu_index < n; ++cpu_index) {
+    _Processor_mask_Set(targets, cpu_index);
+  }
+}
+
+T_TEST_CASE(MulticastAsync)
+{
+  test_context *ctx;
+  Processor_mask targets;
+  Per_CPU_Control *cpu_self;
+  uint32_t cpu_max;
+
+  ctx = &test_instance;
+  cpu_max = rtems_scheduler_get_processor_maximum();
+  first_n_processors(&targets, cpu_max);
+  reset(ctx);
+
+  cpu_self = _Thread_Dispatch_disable();
+  _SMP_Multicast_action_async(
+    &ctx->requests[0],
+    &targets,
+    action,
+    ctx,
+    done,
+    ctx
+  );
+  _SMP_Multicast_request_wait(&ctx->requests[0]);
+  _Thread_Dispatch_enable(cpu_self);
+
+  T_true(_SMP_Multicast_request_is_done(&ctx->requests[0]));
+  T_eq_uint(_Atomic_Load_uint(&ctx->actions, ATOMIC_ORDER_RELAXED), cpu_max);
+  T_eq_uint(_Atomic_Load_uint(&ctx->done, ATOMIC_ORDER_RELAXED), 1);
+}
+
+T_TEST_CASE(MulticastAsyncNoTargets)
+{
+  test_context *ctx;
+  Processor_mask targets;
+
+  ctx = &test_instance;
+  _Processor_mask_Zero(&targets);
+  reset(ctx);
+
+  _SMP_Multicast_action_async(
+    &ctx->requests[0],
+    &targets,
+    action,
+    ctx,
+    done,
+    ctx
+  );
+
+  T_true(_SMP_Multicast_request_is_done(&ctx->requests[0]));
+  T_eq_uint(_Atomic_Load_uint(&ctx->actions, ATOMIC_ORDER_RELAXED), 0);
+  T_eq_uint(_Atomic_Load_uint(&ctx->done, ATOMIC_ORDER_RELAXED), 1);
+}
+
+T_TEST_CASE(MulticastBatch)
+{
+  test_context *ctx;
+  SMP_Multicast_batch batch;
+  Processor_mask targets;
+  Per_CPU_Control *cpu_self;
+  uint32_t cpu_max;
+  size_t i;
+
+  ctx = &test_instance;
+  cpu_max = rtems_scheduler_get_processor_maximum();
+  first_n_processors(&targets, cpu_max);
+  reset(ctx);
+
+  cpu_self = _Thread_Dispatch_disable();
+  _SMP_Multicast_batch_initialize(&batch);
+
+  for (i = 0; i < BATCH_SIZE; ++i) {
+    _SMP_Multicast_batch_add(
+      &batch,
+      &ctx->requests[i],
+      &targets,
+      action,
+      ctx,
+      done,
+      ctx
+    );
+  }
+
+  _SMP_Multicast_batch_flush(&batch);
+
+  for (i = 0; i < BATCH_SIZE; ++i) {
+    _SMP_Multicast_request_wait(&ctx->requests[i]);
+  }
+
+  _Thread_Dispatch_enable(cpu_self);
+
+  T_eq_uint(
+    _Atomic_Load_uint(&ctx->actions, ATOMIC_ORDER_RELAXED),
+    cpu_max * BATCH_SIZE
+  );
+  T_eq_uint(_Atomic_Load_uint(&ctx->done, ATOMIC_ORDER_RELAXED), BATCH_SIZE);
+}
+
+static void empty_action(void *arg)
+{
+  (void) arg;
+}
+
+static uint64_t measure_sync(const Processor_mask *targets)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  Per_CPU_Control *cpu_self;
+  size_t i;
+
+  cpu_self = _Thread_Dispatch_disable();
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    _SMP_Multicast_action(targets, empty_action, NULL);
+  }
+
+  t1 = rtems_counter_read();
+  _Thread_Dispatch_enable(cpu_self);
+
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(t1, t0))
+    / SAMPLE_COUNT;
+}
+
+static uint64_t measure_async_issue(
+  test_context *ctx,
+  const Processor_mask *targets
+)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  rtems_counter_ticks total;
+  Per_CPU_Control *cpu_self;
+  size_t i;
+
+  total = 0;
+  cpu_self = _Thread_Dispatch_disable();
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    t0 = rtems_counter_read();
+    _SMP_Multicast_action_async(
+      &ctx->requests[0],
+      targets,
+      empty_action,
+      NULL,
+      NULL,
+      NULL
+    );
+    t1 = rtems_counter_read();
+    total += rtems_counter_difference(t1, t0);
+    _SMP_Multicast_request_wait(&ctx->requests[0]);
+  }
+
+  _Thread_Dispatch_enable(cpu_self);
+
+  return rtems_counter_ticks_to_nanoseconds(total) / SAMPLE_COUNT;
+}
+
+static uint64_t measure_batch(
+  test_context *ctx,
+  const Processor_mask *targets
+)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  SMP_Multicast_batch batch;
+  Per_CPU_Control *cpu_self;
+  size_t i;
+  size_t j;
+
+  cpu_self = _Thread_Dispatch_disable();
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    _SMP_Multicast_batch_initialize(&batch);
+
+    for (j = 0; j < BATCH_SIZE; ++j) {
+      _SMP_Multicast_batch_add(
+        &batch,
+        &ctx->requests[j],
+        targets,
+        empty_action,
+        NULL,
+        NULL,
+        NULL
+      );
+    }
+
+    _SMP_Multicast_batch_flush(&batch);
+
+    for (j = 0; j < BATCH_SIZE; ++j) {
+      _SMP_Multicast_request_wait(&ctx->requests[j]);
+    }
+  }
+
+  t1 = rtems_counter_read();
+  _Thread_Dispatch_enable(cpu_self);
+
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(t1, t0))
+    / ( SAMPLE_COUNT * BATCH_SIZE );
+}
+
+T_TEST_CASE(MulticastBenchmark)
+{
+  test_context *ctx;
+  uint32_t cpu_max;
+  uint32_t n;
+
+  ctx = &test_instance;
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  T_printf(
+    "<MulticastBenchmark unit=\"ns\" samples=\"%u\" batch=\"%u\">\n",
+    SAMPLE_COUNT,
+    BATCH_SIZE
+  );
+
+  for (n = 1; n <= cpu_max; ++n) {
+    Processor_mask targets;
+
+    first_n_processors(&targets, n);
+    T_printf(
+      "  <Targets count=\"%" PRIu32 "\" sync=\"%" PRIu64 "\" "
+        "async-issue=\"%" PRIu64 "\" batch-per-action=\"%" PRIu64 "\"/>\n",
+      n,
+      measure_sync(&targets),
+      measure_async_issue(ctx, &targets),
+      measure_batch(ctx, &targets)
+    );
+  }
+
+  T_printf("</MulticastBenchmark>\n");
+}
+
+const char rtems_test_name[] = "SMPMULTICAST 2";
+
+static void Init(rtems_task_argument argument)
+{
+  rtems_test_run(argument, TEST_STATE);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
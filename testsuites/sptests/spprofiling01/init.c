@@ -125,12 +125,147 @@ static void test_report_xml(void)
   printf("characters produced by rtems_profiling_report_xml(): %i\n", rv);
 }
 
+typedef struct {
+  const char *name;
+  uint64_t usage_count;
+} call_site_context;
+
+static void call_site_visitor(void *arg, const rtems_profiling_data *data)
+{
+  call_site_context *ctx = arg;
+
+  if (data->header.type == RTEMS_PROFILING_SMP_LOCK_CALL_SITE) {
+    const rtems_profiling_smp_lock_call_site *pcs = &data->smp_lock_call_site;
+
+    rtems_test_assert(pcs->call_site != 0);
+
+    if (strcmp(pcs->name, ctx->name) == 0) {
+      ctx->usage_count += pcs->usage_count;
+    }
+  }
+}
+
+RTEMS_INTERRUPT_LOCK_DEFINE(static, call_site_lock, "e")
+
+static void test_call_sites(void)
+{
+  rtems_interrupt_lock_context lock_context;
+  call_site_context ctx;
+  rtems_status_code sc;
+  int i;
+
+  sc = rtems_profiling_smp_lock_call_sites_enable();
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+#else
+  rtems_test_assert(sc == RTEMS_NOT_IMPLEMENTED);
+#endif
+
+  for (i = 0; i < 3; ++i) {
+    rtems_interrupt_lock_acquire(&call_site_lock, &lock_context);
+    rtems_interrupt_lock_release(&call_site_lock, &lock_context);
+  }
+
+  rtems_profiling_smp_lock_call_sites_disable();
+
+  /* Lock uses are not accounted if the call site profiling is disabled */
+  rtems_interrupt_lock_acquire(&call_site_lock, &lock_context);
+  rtems_interrupt_lock_release(&call_site_lock, &lock_context);
+
+  ctx.name = "e";
+  ctx.usage_count = 0;
+  rtems_profiling_iterate(call_site_visitor, &ctx);
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+  rtems_test_assert(ctx.usage_count == 3);
+#else
+  rtems_test_assert(ctx.usage_count == 0);
+#endif
+  rtems_test_assert(rtems_profiling_smp_lock_call_sites_get_dropped() == 0);
+
+  rtems_profiling_smp_lock_call_sites_reset();
+  ctx.usage_count = 0;
+  rtems_profiling_iterate(call_site_visitor, &ctx);
+  rtems_test_assert(ctx.usage_count == 0);
+}
+
+static uint64_t latency_bin_sum(const rtems_profiling_latency *latency)
+{
+  uint64_t sum = 0;
+  size_t i;
+
+  for (i = 0; i < RTEMS_PROFILING_LATENCY_BIN_COUNT; ++i) {
+    sum += latency->bins[i];
+  }
+
+  return sum;
+}
+
+static void test_latency(void)
+{
+  rtems_profiling_latency latency;
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < RTEMS_PROFILING_LATENCY_BIN_COUNT - 1; ++i) {
+    rtems_test_assert(
+      rtems_profiling_latency_bin_limit(i)
+        <= rtems_profiling_latency_bin_limit(i + 1)
+    );
+  }
+
+  rtems_test_assert(
+    rtems_profiling_latency_bin_limit(RTEMS_PROFILING_LATENCY_BIN_COUNT - 1)
+      == UINT64_MAX
+  );
+
+  sc = rtems_profiling_get_thread_latency(RTEMS_SELF, NULL);
+#if defined(RTEMS_PROFILING)
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_profiling_get_processor_latency(
+    rtems_scheduler_get_processor_maximum(),
+    &latency
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_profiling_get_thread_latency(0xffffffff, &latency);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  rtems_profiling_reset_latency();
+
+  sc = rtems_profiling_get_thread_latency(RTEMS_SELF, &latency);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(latency.count == 0);
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_profiling_get_thread_latency(RTEMS_SELF, &latency);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(latency.count == 1);
+  rtems_test_assert(latency_bin_sum(&latency) == 1);
+  rtems_test_assert(latency.total_latency >= latency.max_latency);
+
+  sc = rtems_profiling_get_processor_latency(0, &latency);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(latency.count >= 1);
+  rtems_test_assert(latency_bin_sum(&latency) == latency.count);
+#else
+  rtems_test_assert(sc == RTEMS_NOT_IMPLEMENTED);
+
+  sc = rtems_profiling_get_processor_latency(0, &latency);
+  rtems_test_assert(sc == RTEMS_NOT_IMPLEMENTED);
+#endif
+}
+
 static void Init(rtems_task_argument arg)
 {
   TEST_BEGIN();
 
   test_iterate();
   test_report_xml();
+  test_latency();
+  test_call_sites();
 
   TEST_END();
 
@@ -0,0 +1,275 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+#include <rtems.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPPROFILING 2";
+
+#define PC_A 0x1000
+
+#define PC_B 0x2000
+
+typedef struct {
+  char   buf[ 512 ];
+  size_t used;
+} report_buffer;
+
+typedef struct {
+  uint32_t entries;
+  uint32_t count;
+  uint32_t self;
+} iterate_context;
+
+static const char *resolve( uintptr_t pc, uintptr_t *begin )
+{
+  if ( pc >= PC_A && pc < PC_B ) {
+    *begin = PC_A;
+    return "a";
+  }
+
+  if ( pc >= PC_B && pc < PC_B + 0x1000 ) {
+    *begin = PC_B;
+    return "b";
+  }
+
+  return NULL;
+}
+
+static int report_print( void *arg, const char *fmt, va_list ap )
+{
+  report_buffer *report;
+  int            n;
+
+  report = arg;
+  n = vsnprintf(
+    &report->buf[ report->used ],
+    sizeof( report->buf ) - report->used,
+    fmt,
+    ap
+  );
+  rtems_test_assert( n >= 0 );
+  report->used += (size_t) n;
+  rtems_test_assert( report->used < sizeof( report->buf ) );
+
+  return n;
+}
+
+static void visit( void *arg, const rtems_profiling_sampler_entry *entry )
+{
+  iterate_context *ctx;
+
+  ctx = arg;
+  ++ctx->entries;
+  ctx->count += entry->count;
+  rtems_test_assert( entry->cpu_index == 0 );
+
+  if ( entry->thread == rtems_task_self() ) {
+    ctx->self += entry->count;
+  }
+}
+
+static void test_invalid( void )
+{
+  rtems_profiling_sampler_config config;
+  rtems_status_code              sc;
+
+  sc = rtems_profiling_sampler_start( NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  memset( &config, 0, sizeof( config ) );
+  config.entry_count = 3;
+  sc = rtems_profiling_sampler_start( &config );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+}
+
+static void test_explicit_samples( void )
+{
+  rtems_profiling_sampler_config     config;
+  rtems_profiling_sampler_statistics stats;
+  rtems_status_code                  sc;
+  iterate_context                    ctx;
+  report_buffer                      report;
+  rtems_printer                      printer;
+  uint32_t                           header[ 4 ];
+  struct stat                        st;
+  ssize_t                            n;
+  int                                fd;
+  int                                rv;
+
+  memset( &config, 0, sizeof( config ) );
+  config.entry_count = 64;
+  sc = rtems_profiling_sampler_start( &config );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_profiling_sampler_start( &config );
+  rtems_test_assert( sc == RTEMS_RESOURCE_IN_USE );
+
+  rtems_profiling_sampler_sample( PC_A );
+  rtems_profiling_sampler_sample( PC_A );
+  rtems_profiling_sampler_sample( PC_A + 4 );
+  rtems_profiling_sampler_sample( PC_B );
+  rtems_profiling_sampler_sample( 0 );
+  rtems_profiling_sampler_stop();
+
+  /* Samples are ignored if the profiler is stopped */
+  rtems_profiling_sampler_sample( PC_B );
+
+  rtems_profiling_sampler_get_statistics( &stats );
+  rtems_test_assert( stats.samples == 5 );
+  rtems_test_assert( stats.dropped == 0 );
+
+  memset( &ctx, 0, sizeof( ctx ) );
+  rtems_profiling_sampler_iterate( visit, &ctx );
+  rtems_test_assert( ctx.entries == 4 );
+  rtems_test_assert( ctx.count == 5 );
+  rtems_test_assert( ctx.self == 5 );
+
+  memset( &report, 0, sizeof( report ) );
+  printer.context = &report;
+  printer.printer = report_print;
+  rtems_profiling_sampler_set_resolver( resolve );
+  sc = rtems_profiling_sampler_report( &printer, 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_profiling_sampler_set_resolver( NULL );
+  printf( "%s", report.buf );
+  rtems_test_assert( strstr( report.buf, "      3   60.0%  a\n" ) != NULL );
+  rtems_test_assert( strstr( report.buf, "[unknown]\n" ) != NULL );
+  rtems_test_assert( strstr( report.buf, "  b\n" ) == NULL );
+
+  fd = open( "/profile", O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+  rtems_test_assert( fd >= 0 );
+  sc = rtems_profiling_sampler_export( fd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = stat( "/profile", &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size == sizeof( header ) + 4 * 20 );
+
+  fd = open( "/profile", O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+  n = read( fd, header, sizeof( header ) );
+  rtems_test_assert( n == (ssize_t) sizeof( header ) );
+  rtems_test_assert( header[ 0 ] == RTEMS_PROFILING_SAMPLER_EXPORT_MAGIC );
+  rtems_test_assert( header[ 1 ] == 1 );
+  rtems_test_assert( header[ 2 ] == 20 );
+  rtems_test_assert( header[ 3 ] == sizeof( uintptr_t ) );
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rtems_profiling_sampler_reset();
+  memset( &ctx, 0, sizeof( ctx ) );
+  rtems_profiling_sampler_iterate( visit, &ctx );
+  rtems_test_assert( ctx.entries == 0 );
+  rtems_profiling_sampler_get_statistics( &stats );
+  rtems_test_assert( stats.samples == 0 );
+}
+
+static void test_full_histogram( void )
+{
+  rtems_profiling_sampler_config     config;
+  rtems_profiling_sampler_statistics stats;
+  rtems_status_code                  sc;
+
+  memset( &config, 0, sizeof( config ) );
+  config.entry_count = 1;
+  sc = rtems_profiling_sampler_start( &config );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_profiling_sampler_sample( PC_A );
+  rtems_profiling_sampler_sample( PC_B );
+  rtems_profiling_sampler_sample( PC_A );
+  rtems_profiling_sampler_stop();
+
+  rtems_profiling_sampler_get_statistics( &stats );
+  rtems_test_assert( stats.samples == 2 );
+  rtems_test_assert( stats.dropped == 1 );
+}
+
+static void test_clock_tick( void )
+{
+  rtems_profiling_sampler_config config;
+  rtems_status_code              sc;
+
+  /*
+   * This test provides no rtems_profiling_sampler_get_interrupted_pc(), so
+   * sampling in the clock tick is not available.
+   */
+  memset( &config, 0, sizeof( config ) );
+  config.period = 1;
+  sc = rtems_profiling_sampler_start( &config );
+  rtems_test_assert( sc == RTEMS_NOT_IMPLEMENTED );
+
+  config.period = 0;
+  sc = rtems_profiling_sampler_start( &config );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_profiling_sampler_stop();
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_invalid();
+  test_explicit_samples();
+  test_full_histogram();
+  test_clock_tick();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,399 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+#include <rtems/score/wkspace.h>
+#include <rtems.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPPROFILING 3";
+
+typedef struct {
+  char   buf[ 1024 ];
+  size_t used;
+} report_buffer;
+
+typedef struct {
+  rtems_profiling_heap_kind heap;
+  uint64_t                  allocations;
+  uint64_t                  allocated_bytes;
+  uint32_t                  matches;
+  rtems_profiling_heap_site site;
+} find_context;
+
+static void *blocks[ 4 ];
+
+static RTEMS_NO_INLINE void *alloc_a( void )
+{
+  void *p;
+
+  p = malloc( 100 );
+  RTEMS_OBFUSCATE_VARIABLE( p );
+  return p;
+}
+
+static RTEMS_NO_INLINE void *alloc_b( void )
+{
+  void *p;
+
+  p = malloc( 200 );
+  RTEMS_OBFUSCATE_VARIABLE( p );
+  return p;
+}
+
+static RTEMS_NO_INLINE void *alloc_c( void )
+{
+  void *p;
+
+  p = realloc( NULL, 50 );
+  RTEMS_OBFUSCATE_VARIABLE( p );
+  return p;
+}
+
+static int report_print( void *arg, const char *fmt, va_list ap )
+{
+  report_buffer *report;
+  int            n;
+
+  report = arg;
+  n = vsnprintf(
+    &report->buf[ report->used ],
+    sizeof( report->buf ) - report->used,
+    fmt,
+    ap
+  );
+  rtems_test_assert( n >= 0 );
+  report->used += (size_t) n;
+  rtems_test_assert( report->used < sizeof( report->buf ) );
+
+  return n;
+}
+
+static void find( void *arg, const rtems_profiling_heap_site *site )
+{
+  find_context *ctx;
+
+  ctx = arg;
+
+  if (
+    site->heap == ctx->heap
+      && site->allocations == ctx->allocations
+      && site->allocated_bytes == ctx->allocated_bytes
+  ) {
+    ++ctx->matches;
+    ctx->site = *site;
+  }
+}
+
+static void count( void *arg, const rtems_profiling_heap_site *site )
+{
+  uint32_t *entries;
+
+  (void) site;
+  entries = arg;
+  ++( *entries );
+}
+
+static const rtems_profiling_heap_site *find_site(
+  find_context              *ctx,
+  rtems_profiling_heap_kind  heap,
+  uint64_t                   allocations,
+  uint64_t                   allocated_bytes
+)
+{
+  rtems_status_code sc;
+
+  memset( ctx, 0, sizeof( *ctx ) );
+  ctx->heap = heap;
+  ctx->allocations = allocations;
+  ctx->allocated_bytes = allocated_bytes;
+  sc = rtems_profiling_heap_iterate( find, ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->matches == 1 );
+
+  return &ctx->site;
+}
+
+static void sum_live_bytes( void *arg, const rtems_profiling_heap_site *site )
+{
+  uint64_t *live_bytes;
+
+  live_bytes = arg;
+  *live_bytes += site->live_bytes;
+}
+
+static uint64_t get_live_bytes( void )
+{
+  rtems_status_code sc;
+  uint64_t          live_bytes;
+
+  live_bytes = 0;
+  sc = rtems_profiling_heap_iterate( sum_live_bytes, &live_bytes );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return live_bytes;
+}
+
+static uint32_t get_site_count( void )
+{
+  rtems_status_code sc;
+  uint32_t          entries;
+
+  entries = 0;
+  sc = rtems_profiling_heap_iterate( count, &entries );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return entries;
+}
+
+static uint64_t sum_lifetimes( const rtems_profiling_heap_site *site )
+{
+  uint64_t sum;
+  size_t   i;
+
+  sum = 0;
+
+  for ( i = 0; i < RTEMS_PROFILING_HEAP_LIFETIME_BIN_COUNT; ++i ) {
+    sum += site->lifetimes[ i ];
+  }
+
+  return sum;
+}
+
+static void test_invalid( void )
+{
+  rtems_status_code sc;
+
+  sc = rtems_profiling_heap_start( 3 );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+}
+
+static void test_malloc( void )
+{
+  const rtems_profiling_heap_site *site;
+  find_context                     ctx;
+  rtems_status_code                sc;
+  report_buffer                    report;
+  rtems_printer                    printer;
+  uint32_t                         entries;
+  void                            *p;
+  void                            *q;
+
+  sc = rtems_profiling_heap_start( 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_profiling_heap_start( 0 );
+  rtems_test_assert( sc == RTEMS_RESOURCE_IN_USE );
+
+  blocks[ 0 ] = alloc_a();
+  blocks[ 1 ] = alloc_a();
+  blocks[ 2 ] = alloc_a();
+  blocks[ 3 ] = alloc_b();
+  rtems_test_assert( blocks[ 0 ] != NULL );
+  rtems_test_assert( blocks[ 1 ] != NULL );
+  rtems_test_assert( blocks[ 2 ] != NULL );
+  rtems_test_assert( blocks[ 3 ] != NULL );
+  free( blocks[ 0 ] );
+  free( blocks[ 1 ] );
+
+  site = find_site( &ctx, RTEMS_PROFILING_HEAP_MALLOC, 3, 300 );
+  rtems_test_assert( site->frees == 2 );
+  rtems_test_assert( site->live_bytes == 100 );
+  rtems_test_assert( sum_lifetimes( site ) == 2 );
+
+  site = find_site( &ctx, RTEMS_PROFILING_HEAP_MALLOC, 1, 200 );
+  rtems_test_assert( site->frees == 0 );
+  rtems_test_assert( site->live_bytes == 200 );
+
+  /* A shrink is always done in place */
+  p = alloc_c();
+  rtems_test_assert( p != NULL );
+  memset( p, 0xaa, 50 );
+  q = realloc( p, 20 );
+  rtems_test_assert( q == p );
+  free( blocks[ 3 ] );
+
+  site = find_site( &ctx, RTEMS_PROFILING_HEAP_MALLOC, 1, 200 );
+  rtems_test_assert( site->frees == 1 );
+  rtems_test_assert( site->live_bytes == 0 );
+
+  site = find_site( &ctx, RTEMS_PROFILING_HEAP_MALLOC, 1, 50 );
+  rtems_test_assert( site->frees == 0 );
+  rtems_test_assert( site->live_bytes == 20 );
+  free( q );
+  rtems_profiling_heap_stop();
+
+  memset( &report, 0, sizeof( report ) );
+  printer.context = &report;
+  printer.printer = report_print;
+  sc = rtems_profiling_heap_report( &printer, 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( strstr( report.buf, "LIVE BYTES" ) != NULL );
+  rtems_test_assert( strstr( report.buf, "       100  " ) != NULL );
+  rtems_test_assert( strstr( report.buf, "0 dropped\n" ) != NULL );
+
+  /* Blocks profiled by a stopped profiler are still accounted */
+  free( blocks[ 2 ] );
+  site = find_site( &ctx, RTEMS_PROFILING_HEAP_MALLOC, 3, 300 );
+  rtems_test_assert( site->frees == 3 );
+  rtems_test_assert( site->live_bytes == 0 );
+
+  rtems_profiling_heap_reset();
+  entries = 0;
+  sc = rtems_profiling_heap_iterate( count, &entries );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( entries == 0 );
+}
+
+static void test_workspace( void )
+{
+  const rtems_profiling_heap_site *site;
+  find_context                     ctx;
+  rtems_status_code                sc;
+  void                            *p;
+
+  sc = rtems_profiling_heap_start( 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  p = _Workspace_Allocate( 64 );
+  rtems_test_assert( p != NULL );
+
+  site = find_site( &ctx, RTEMS_PROFILING_HEAP_WORKSPACE, 1, 64 );
+  rtems_test_assert( site->frees == 0 );
+  rtems_test_assert( site->live_bytes == 64 );
+
+  _Workspace_Free( p );
+
+  site = find_site( &ctx, RTEMS_PROFILING_HEAP_WORKSPACE, 1, 64 );
+  rtems_test_assert( site->frees == 1 );
+  rtems_test_assert( site->live_bytes == 0 );
+
+  rtems_profiling_heap_stop();
+  rtems_profiling_heap_reset();
+}
+
+static void test_generation( void )
+{
+  rtems_status_code sc;
+  void             *p;
+  void             *q;
+
+  sc = rtems_profiling_heap_start( 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Blocks allocated before a reset are no longer accounted */
+  p = alloc_a();
+  rtems_test_assert( p != NULL );
+  rtems_profiling_heap_reset();
+  free( p );
+  rtems_test_assert( get_site_count() == 0 );
+
+  /* Blocks allocated by a previous run are no longer accounted */
+  p = alloc_b();
+  rtems_test_assert( p != NULL );
+  rtems_profiling_heap_stop();
+  sc = rtems_profiling_heap_start( 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  free( p );
+  rtems_test_assert( get_site_count() == 0 );
+
+  /* The live bytes follow a block moved by realloc() */
+  p = alloc_c();
+  rtems_test_assert( p != NULL );
+  rtems_test_assert( get_live_bytes() == 50 );
+  q = malloc( 10 );
+  rtems_test_assert( q != NULL );
+  p = realloc( p, 4000 );
+  rtems_test_assert( p != NULL );
+  rtems_test_assert( get_live_bytes() == 4010 );
+  p = realloc( p, 30 );
+  rtems_test_assert( p != NULL );
+  rtems_test_assert( get_live_bytes() == 40 );
+  free( p );
+  free( q );
+  rtems_test_assert( get_live_bytes() == 0 );
+
+  rtems_profiling_heap_stop();
+  rtems_profiling_heap_reset();
+}
+
+static void test_dropped( void )
+{
+  rtems_status_code sc;
+
+  sc = rtems_profiling_heap_start( 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  blocks[ 0 ] = alloc_a();
+  blocks[ 1 ] = alloc_b();
+  rtems_profiling_heap_stop();
+
+  rtems_test_assert( rtems_profiling_heap_get_dropped() >= 1 );
+  free( blocks[ 0 ] );
+  free( blocks[ 1 ] );
+
+  rtems_profiling_heap_reset();
+  rtems_test_assert( rtems_profiling_heap_get_dropped() == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_invalid();
+  test_malloc();
+  test_workspace();
+  test_generation();
+  test_dropped();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
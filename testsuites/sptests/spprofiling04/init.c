@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+#include <rtems.h>
+
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPPROFILING 4";
+
+typedef struct {
+  uint32_t entries;
+  uint32_t count;
+  uint32_t busy;
+} iterate_context;
+
+static volatile uintptr_t busy_pc;
+
+static void busy_wait( rtems_interval ticks )
+{
+  rtems_interval start;
+
+  busy_pc = (uintptr_t) busy_wait;
+  start = rtems_clock_get_ticks_since_boot();
+
+  while ( rtems_clock_get_ticks_since_boot() - start < ticks ) {
+    /* Wait */
+  }
+
+  busy_pc = 0;
+}
+
+/*
+ * The interrupt frame layout is not known to this test.  The busy loop
+ * publishes its location, so that the clock tick samples can be checked.
+ */
+uintptr_t rtems_profiling_sampler_get_interrupted_pc( void )
+{
+  return busy_pc;
+}
+
+static void visit( void *arg, const rtems_profiling_sampler_entry *entry )
+{
+  iterate_context *ctx;
+
+  ctx = arg;
+  ++ctx->entries;
+  ctx->count += entry->count;
+  rtems_test_assert( entry->pc != 0 );
+  rtems_test_assert( entry->cpu_index == 0 );
+
+  if (
+    entry->pc == (uintptr_t) busy_wait && entry->thread == rtems_task_self()
+  ) {
+    ctx->busy += entry->count;
+  }
+}
+
+static void test_clock_tick( void )
+{
+  rtems_profiling_sampler_config     config;
+  rtems_profiling_sampler_statistics stats;
+  rtems_status_code                  sc;
+  iterate_context                    ctx;
+
+  memset( &config, 0, sizeof( config ) );
+  config.period = 1;
+  sc = rtems_profiling_sampler_start( &config );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Keep the processor busy, so that this task is sampled */
+  busy_wait( 5 );
+  rtems_profiling_sampler_stop();
+
+  rtems_profiling_sampler_get_statistics( &stats );
+  rtems_test_assert( stats.samples >= 3 );
+  rtems_test_assert( stats.dropped == 0 );
+
+  memset( &ctx, 0, sizeof( ctx ) );
+  rtems_profiling_sampler_iterate( visit, &ctx );
+  rtems_test_assert( ctx.count == stats.samples );
+  rtems_test_assert( ctx.busy >= 3 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_clock_tick();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
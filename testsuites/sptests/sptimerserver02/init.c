@@ -0,0 +1,266 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPTIMERSERVER 2";
+
+#define TIMER_COUNT 2
+
+#define ROUTINE_COUNT 3
+
+typedef struct {
+  rtems_id timer[TIMER_COUNT];
+  rtems_id server[TIMER_COUNT];
+  rtems_id executing[TIMER_COUNT];
+  rtems_id master;
+} test_context;
+
+static test_context ctx_instance;
+
+static void routine(rtems_id id, void *arg)
+{
+  test_context *ctx = arg;
+  rtems_status_code sc;
+  size_t i;
+
+  i = ( id == ctx->timer[0] ) ? 0 : 1;
+  rtems_test_assert(id == ctx->timer[i]);
+  ctx->executing[i] = rtems_task_self();
+
+  sc = rtems_event_transient_send(ctx->master);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void fire_and_wait(test_context *ctx, size_t i)
+{
+  rtems_status_code sc;
+
+  ctx->executing[i] = 0;
+
+  sc = rtems_timer_server_fire_after(ctx->timer[i], 1, routine, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static uint32_t histogram_sum(const rtems_timer_server_statistics *stats)
+{
+  uint32_t sum;
+  size_t i;
+
+  sum = 0;
+
+  for (i = 0; i < RTEMS_TIMER_SERVER_LATENESS_BIN_COUNT; ++i) {
+    sum += stats->lateness[i];
+  }
+
+  return sum;
+}
+
+static void test_errors(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_timer_server_statistics stats;
+  rtems_id id;
+
+  sc = rtems_timer_server_fire_after(ctx->timer[0], 1, routine, ctx);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_timer_server_create(
+    rtems_build_name('T', 'S', 'R', 'V'),
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    RTEMS_TIMER_SERVER_ANY_PROCESSOR,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_timer_server_create(
+    rtems_build_name('T', 'S', 'R', 'V'),
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    rtems_scheduler_get_processor_maximum(),
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+
+  sc = rtems_timer_set_server(ctx->timer[0], RTEMS_TIMER_SERVER_DEFAULT);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_timer_set_server(ctx->timer[0], ctx->master);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_timer_server_get_statistics(
+    RTEMS_TIMER_SERVER_DEFAULT,
+    &stats,
+    false
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_timer_server_get_statistics(ctx->master, NULL, false);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+}
+
+static void test_servers(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_timer_server_statistics stats;
+  size_t i;
+  size_t j;
+
+  sc = rtems_timer_server_create(
+    rtems_build_name('T', 'S', 'V', '0'),
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    0,
+    &ctx->server[0]
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_server_create(
+    rtems_build_name('T', 'S', 'V', '1'),
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    RTEMS_TIMER_SERVER_ANY_PROCESSOR,
+    &ctx->server[1]
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->server[0] != ctx->server[1]);
+
+  for (i = 0; i < TIMER_COUNT; ++i) {
+    sc = rtems_timer_set_server(ctx->timer[i], ctx->server[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (j = 0; j < ROUTINE_COUNT; ++j) {
+    for (i = 0; i < TIMER_COUNT; ++i) {
+      fire_and_wait(ctx, i);
+      rtems_test_assert(ctx->executing[i] == ctx->server[i]);
+    }
+  }
+
+  for (i = 0; i < TIMER_COUNT; ++i) {
+    sc = rtems_timer_server_get_statistics(ctx->server[i], &stats, true);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(stats.server_id == ctx->server[i]);
+    rtems_test_assert(stats.routines == ROUTINE_COUNT);
+    rtems_test_assert(histogram_sum(&stats) == ROUTINE_COUNT);
+
+    sc = rtems_timer_server_get_statistics(ctx->server[i], &stats, false);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(stats.routines == 0);
+    rtems_test_assert(stats.max_lateness == 0);
+    rtems_test_assert(histogram_sum(&stats) == 0);
+  }
+}
+
+static void test_default_server(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_timer_server_statistics stats;
+
+  sc = rtems_timer_initiate_server(
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_set_server(ctx->timer[1], RTEMS_TIMER_SERVER_DEFAULT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fire_and_wait(ctx, 0);
+  rtems_test_assert(ctx->executing[0] == ctx->server[0]);
+
+  fire_and_wait(ctx, 1);
+  rtems_test_assert(ctx->executing[1] != ctx->server[1]);
+
+  sc = rtems_timer_server_get_statistics(
+    RTEMS_TIMER_SERVER_DEFAULT,
+    &stats,
+    false
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(stats.server_id == ctx->executing[1]);
+  rtems_test_assert(stats.routines == 1);
+
+  sc = rtems_timer_server_get_statistics(ctx->server[1], &stats, false);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(stats.routines == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &ctx_instance;
+  rtems_status_code sc;
+  size_t i;
+
+  TEST_BEGIN();
+
+  ctx->master = rtems_task_self();
+
+  for (i = 0; i < TIMER_COUNT; ++i) {
+    sc = rtems_timer_create(
+      rtems_build_name('T', 'M', 'R', '0' + i),
+      &ctx->timer[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  test_errors(ctx);
+  test_servers(ctx);
+  test_default_server(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+#define CONFIGURE_MAXIMUM_TIMERS TIMER_COUNT
+
+#define CONFIGURE_MEMORY_OVERHEAD 4
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,238 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/stackcache.h>
+
+const char rtems_test_name[] = "TMSTACKCACHE 1";
+
+#define CYCLES 32
+
+#define PREFILL_COUNT 4
+
+#define MAX_TASKS (PREFILL_COUNT + 1)
+
+#define CACHE_MAXIMUM (PREFILL_COUNT + 4)
+
+typedef struct {
+  rtems_id ids[MAX_TASKS];
+  rtems_counter_ticks cold;
+  rtems_counter_ticks min;
+  rtems_counter_ticks max;
+  uint64_t sum;
+} test_context;
+
+static test_context test_instance;
+
+static void worker(rtems_task_argument arg)
+{
+  rtems_test_assert(0);
+}
+
+static rtems_counter_ticks create_start_delete(size_t stack_size)
+{
+  rtems_status_code sc;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_id id;
+
+  a = rtems_counter_read();
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    2,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, worker, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  b = rtems_counter_read();
+
+  return rtems_counter_difference(b, a);
+}
+
+static void print_ticks(const char *name, rtems_counter_ticks t)
+{
+  printf(
+    "<%s unit=\"ns\">%" PRIu64 "</%s>",
+    name,
+    rtems_counter_ticks_to_nanoseconds(t),
+    name
+  );
+}
+
+static void print_cache_information(void)
+{
+  rtems_status_code sc;
+  rtems_stack_cache_information info;
+
+  sc = rtems_stack_cache_get_information(&info);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "\n    <Cache count=\"%" PRIu32 "\" size=\"%zu\" hits=\"%" PRIu32
+      "\" misses=\"%" PRIu32 "\" overflows=\"%" PRIu32 "\"/>",
+    info.count,
+    info.size,
+    info.hits,
+    info.misses,
+    info.overflows
+  );
+}
+
+static void test_stack_size(test_context *ctx, size_t stack_size)
+{
+  size_t i;
+
+  ctx->cold = create_start_delete(stack_size);
+  ctx->min = (rtems_counter_ticks) -1;
+  ctx->max = 0;
+  ctx->sum = 0;
+
+  for (i = 0; i < CYCLES; ++i) {
+    rtems_counter_ticks d;
+
+    d = create_start_delete(stack_size);
+    ctx->sum += d;
+
+    if (d < ctx->min) {
+      ctx->min = d;
+    }
+
+    if (d > ctx->max) {
+      ctx->max = d;
+    }
+  }
+
+  printf("  <Sample>\n    <StackSize>%zu</StackSize>", stack_size);
+  print_ticks("Cold", ctx->cold);
+  print_ticks("Min", ctx->min);
+  print_ticks("Max", ctx->max);
+  print_ticks("Avg", (rtems_counter_ticks) (ctx->sum / CYCLES));
+  print_cache_information();
+  printf("\n  </Sample>\n");
+}
+
+static void test_prefill(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_stack_cache_information before;
+  rtems_stack_cache_information after;
+  size_t stack_size;
+  size_t i;
+
+  stack_size = 8 * RTEMS_MINIMUM_STACK_SIZE;
+
+  sc = rtems_stack_cache_get_information(&before);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_stack_cache_prefill(stack_size, false, PREFILL_COUNT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < PREFILL_COUNT; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('P', 'R', 'E', 'F'),
+      2,
+      stack_size,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_stack_cache_get_information(&after);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(after.hits - before.hits == PREFILL_COUNT);
+  rtems_test_assert(after.misses == before.misses);
+
+  for (i = 0; i < PREFILL_COUNT; ++i) {
+    sc = rtems_task_delete(ctx->ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test(void)
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  printf("<TMStackCache01>\n");
+  test_stack_size(ctx, RTEMS_MINIMUM_STACK_SIZE);
+  test_stack_size(ctx, 4 * RTEMS_MINIMUM_STACK_SIZE);
+  test_stack_size(ctx, 16 * RTEMS_MINIMUM_STACK_SIZE);
+  printf("</TMStackCache01>\n");
+
+  test_prefill(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + MAX_TASKS)
+
+#define CONFIGURE_TASK_STACK_CACHE_MAXIMUM CACHE_MAXIMUM
+
+#define CONFIGURE_EXTRA_TASK_STACKS \
+  ((MAX_TASKS + CACHE_MAXIMUM) * 16 * RTEMS_MINIMUM_STACK_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,424 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSTestCaseRtemsBarrierValPerformance
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tx-support.h"
+
+#include <rtems/test.h>
+
+/**
+ * @defgroup RTEMSTestCaseRtemsBarrierValPerformance Barrier Manager performance
+ *
+ * @ingroup RTEMSTestSuiteTestsuitesPerformance0
+ *
+ * @brief This test case provides a context to run Barrier Manager
+ *   performance tests.
+ *
+ * @{
+ */
+
+/**
+ * @brief Test context for the Barrier Manager performance test case.
+ */
+typedef struct {
+  /**
+   * @brief This member provides a barrier with the manual release policy.
+   */
+  rtems_id barrier_id;
+
+  /**
+   * @brief This member provides the worker task identifier.
+   */
+  rtems_id worker_id;
+
+  /**
+   * @brief This member provides a status code.
+   */
+  rtems_status_code status;
+
+  /**
+   * @brief This member provides the count of released tasks.
+   */
+  uint32_t released;
+
+  /**
+   * @brief This member references the measure runtime context.
+   */
+  T_measure_runtime_context *context;
+
+  /**
+   * @brief This member provides the measure runtime request.
+   */
+  T_measure_runtime_request request;
+} RtemsBarrierValPerformance_Context;
+
+static RtemsBarrierValPerformance_Context
+  RtemsBarrierValPerformance_Instance;
+
+static void Worker( rtems_task_argument arg )
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = (RtemsBarrierValPerformance_Context *) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    (void) ReceiveAnyEvents();
+
+    sc = rtems_barrier_wait( ctx->barrier_id, RTEMS_NO_TIMEOUT );
+    T_quiet_rsc_success( sc );
+  }
+}
+
+static void RtemsBarrierValPerformance_Setup_Context(
+  RtemsBarrierValPerformance_Context *ctx
+)
+{
+  T_measure_runtime_config config;
+
+  memset( &config, 0, sizeof( config ) );
+  config.sample_count = 1000;
+  ctx->request.arg = ctx;
+  ctx->context = T_measure_runtime_create( &config );
+  T_assert_not_null( ctx->context );
+}
+
+/**
+ * @brief Creates the test barrier and the worker task.
+ */
+static void RtemsBarrierValPerformance_Setup(
+  RtemsBarrierValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  SetSelfPriority( PRIO_NORMAL );
+
+  sc = rtems_barrier_create(
+    rtems_build_name( 'B', 'A', 'R', ' ' ),
+    RTEMS_BARRIER_MANUAL_RELEASE,
+    0,
+    &ctx->barrier_id
+  );
+  T_assert_rsc_success( sc );
+
+  ctx->worker_id = CreateTask( "WORK", PRIO_HIGH );
+  StartTask( ctx->worker_id, Worker, ctx );
+}
+
+static void RtemsBarrierValPerformance_Setup_Wrap( void *arg )
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsBarrierValPerformance_Setup_Context( ctx );
+  RtemsBarrierValPerformance_Setup( ctx );
+}
+
+/**
+ * @brief Deletes the worker task and the test barrier.
+ */
+static void RtemsBarrierValPerformance_Teardown(
+  RtemsBarrierValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  if ( ctx->worker_id != 0 ) {
+    DeleteTask( ctx->worker_id );
+  }
+
+  if ( ctx->barrier_id != 0 ) {
+    sc = rtems_barrier_delete( ctx->barrier_id );
+    T_rsc_success( sc );
+  }
+
+  RestoreRunnerPriority();
+}
+
+static void RtemsBarrierValPerformance_Teardown_Wrap( void *arg )
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsBarrierValPerformance_Teardown( ctx );
+}
+
+static T_fixture RtemsBarrierValPerformance_Fixture = {
+  .setup = RtemsBarrierValPerformance_Setup_Wrap,
+  .stop = NULL,
+  .teardown = RtemsBarrierValPerformance_Teardown_Wrap,
+  .scope = NULL,
+  .initial_context = &RtemsBarrierValPerformance_Instance
+};
+
+/**
+ * @brief Release the barrier which has no waiting tasks.
+ */
+static void RtemsBarrierReqPerfReleaseNoWaiters_Body(
+  RtemsBarrierValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_barrier_release( ctx->barrier_id, &ctx->released );
+}
+
+static void RtemsBarrierReqPerfReleaseNoWaiters_Body_Wrap( void *arg )
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsBarrierReqPerfReleaseNoWaiters_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the released count.
+ */
+static bool RtemsBarrierReqPerfReleaseNoWaiters_Teardown(
+  RtemsBarrierValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->released, 0 );
+
+  return tic == toc;
+}
+
+static bool RtemsBarrierReqPerfReleaseNoWaiters_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsBarrierReqPerfReleaseNoWaiters_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Let the worker wait on the barrier at a priority lower than the
+ *   runner priority.
+ */
+static void RtemsBarrierReqPerfReleaseOne_Setup(
+  RtemsBarrierValPerformance_Context *ctx
+)
+{
+  SendEvents( ctx->worker_id, RTEMS_EVENT_0 );
+  SetPriority( ctx->worker_id, PRIO_LOW );
+}
+
+static void RtemsBarrierReqPerfReleaseOne_Setup_Wrap( void *arg )
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsBarrierReqPerfReleaseOne_Setup( ctx );
+}
+
+/**
+ * @brief Release the barrier.  The worker is unblocked without a thread
+ *   dispatch.
+ */
+static void RtemsBarrierReqPerfReleaseOne_Body(
+  RtemsBarrierValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_barrier_release( ctx->barrier_id, &ctx->released );
+}
+
+static void RtemsBarrierReqPerfReleaseOne_Body_Wrap( void *arg )
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsBarrierReqPerfReleaseOne_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the released count.  Let the worker wait
+ *   for the next request.
+ */
+static bool RtemsBarrierReqPerfReleaseOne_Teardown(
+  RtemsBarrierValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->released, 1 );
+  SetPriority( ctx->worker_id, PRIO_HIGH );
+
+  return tic == toc;
+}
+
+static bool RtemsBarrierReqPerfReleaseOne_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsBarrierReqPerfReleaseOne_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Let the worker wait on the barrier at a priority higher than the
+ *   runner priority.
+ */
+static void RtemsBarrierReqPerfReleasePreempt_Setup(
+  RtemsBarrierValPerformance_Context *ctx
+)
+{
+  SendEvents( ctx->worker_id, RTEMS_EVENT_0 );
+}
+
+static void RtemsBarrierReqPerfReleasePreempt_Setup_Wrap( void *arg )
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsBarrierReqPerfReleasePreempt_Setup( ctx );
+}
+
+/**
+ * @brief Release the barrier.  The worker preempts the runner and waits for
+ *   the next request.
+ */
+static void RtemsBarrierReqPerfReleasePreempt_Body(
+  RtemsBarrierValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_barrier_release( ctx->barrier_id, &ctx->released );
+}
+
+static void RtemsBarrierReqPerfReleasePreempt_Body_Wrap( void *arg )
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsBarrierReqPerfReleasePreempt_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the released count.
+ */
+static bool RtemsBarrierReqPerfReleasePreempt_Teardown(
+  RtemsBarrierValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->released, 1 );
+
+  return tic == toc;
+}
+
+static bool RtemsBarrierReqPerfReleasePreempt_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsBarrierReqPerfReleasePreempt_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @fn void T_case_body_RtemsBarrierValPerformance( void )
+ */
+T_TEST_CASE_FIXTURE(
+  RtemsBarrierValPerformance,
+  &RtemsBarrierValPerformance_Fixture
+)
+{
+  RtemsBarrierValPerformance_Context *ctx;
+
+  ctx = T_fixture_context();
+
+  ctx->request.name = "RtemsBarrierReqPerfReleaseNoWaiters";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsBarrierReqPerfReleaseNoWaiters_Body_Wrap;
+  ctx->request.teardown = RtemsBarrierReqPerfReleaseNoWaiters_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsBarrierReqPerfReleaseOne";
+  ctx->request.setup = RtemsBarrierReqPerfReleaseOne_Setup_Wrap;
+  ctx->request.body = RtemsBarrierReqPerfReleaseOne_Body_Wrap;
+  ctx->request.teardown = RtemsBarrierReqPerfReleaseOne_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsBarrierReqPerfReleasePreempt";
+  ctx->request.setup = RtemsBarrierReqPerfReleasePreempt_Setup_Wrap;
+  ctx->request.body = RtemsBarrierReqPerfReleasePreempt_Body_Wrap;
+  ctx->request.teardown = RtemsBarrierReqPerfReleasePreempt_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+}
+
+/** @} */
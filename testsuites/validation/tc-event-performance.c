@@ -0,0 +1,525 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSTestCaseRtemsEventValPerformance
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tx-support.h"
+
+#include <rtems/test.h>
+
+/**
+ * @defgroup RTEMSTestCaseRtemsEventValPerformance Event Manager performance
+ *
+ * @ingroup RTEMSTestSuiteTestsuitesPerformance0
+ *
+ * @brief This test case provides a context to run Event Manager
+ *   performance tests.
+ *
+ * @{
+ */
+
+/*
+ * Do not use RTEMS_EVENT_0 since it is used by T_measure_runtime() to wake up
+ * the runner.
+ */
+#define EVENT_MEASURE RTEMS_EVENT_7
+
+/**
+ * @brief Test context for the Event Manager performance test case.
+ */
+typedef struct {
+  /**
+   * @brief This member provides the worker task identifier.
+   */
+  rtems_id worker_id;
+
+  /**
+   * @brief This member provides a status code.
+   */
+  rtems_status_code status;
+
+  /**
+   * @brief This member provides an event set.
+   */
+  rtems_event_set events;
+
+  /**
+   * @brief This member references the measure runtime context.
+   */
+  T_measure_runtime_context *context;
+
+  /**
+   * @brief This member provides the measure runtime request.
+   */
+  T_measure_runtime_request request;
+} RtemsEventValPerformance_Context;
+
+static RtemsEventValPerformance_Context
+  RtemsEventValPerformance_Instance;
+
+static void Worker( rtems_task_argument arg )
+{
+  (void) arg;
+
+  while ( true ) {
+    (void) ReceiveAnyEvents();
+  }
+}
+
+static void RtemsEventValPerformance_Setup_Context(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  T_measure_runtime_config config;
+
+  memset( &config, 0, sizeof( config ) );
+  config.sample_count = 1000;
+  ctx->request.arg = ctx;
+  ctx->context = T_measure_runtime_create( &config );
+  T_assert_not_null( ctx->context );
+}
+
+/**
+ * @brief Creates the worker task.
+ */
+static void RtemsEventValPerformance_Setup(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  SetSelfPriority( PRIO_NORMAL );
+  ctx->worker_id = CreateTask( "WORK", PRIO_HIGH );
+  StartTask( ctx->worker_id, Worker, ctx );
+}
+
+static void RtemsEventValPerformance_Setup_Wrap( void *arg )
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsEventValPerformance_Setup_Context( ctx );
+  RtemsEventValPerformance_Setup( ctx );
+}
+
+/**
+ * @brief Deletes the worker task.
+ */
+static void RtemsEventValPerformance_Teardown(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  if ( ctx->worker_id != 0 ) {
+    DeleteTask( ctx->worker_id );
+  }
+
+  RestoreRunnerPriority();
+}
+
+static void RtemsEventValPerformance_Teardown_Wrap( void *arg )
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsEventValPerformance_Teardown( ctx );
+}
+
+static T_fixture RtemsEventValPerformance_Fixture = {
+  .setup = RtemsEventValPerformance_Setup_Wrap,
+  .stop = NULL,
+  .teardown = RtemsEventValPerformance_Teardown_Wrap,
+  .scope = NULL,
+  .initial_context = &RtemsEventValPerformance_Instance
+};
+
+/**
+ * @brief Send an event to the runner which does not wait for events.
+ */
+static void RtemsEventReqPerfSend_Body(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_event_send( RTEMS_SELF, EVENT_MEASURE );
+}
+
+static void RtemsEventReqPerfSend_Body_Wrap( void *arg )
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsEventReqPerfSend_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and receive the event.
+ */
+static bool RtemsEventReqPerfSend_Teardown(
+  RtemsEventValPerformance_Context *ctx,
+  T_ticks                          *delta,
+  uint32_t                          tic,
+  uint32_t                          toc,
+  unsigned int                      retry
+)
+{
+  rtems_status_code sc;
+
+  T_quiet_rsc_success( ctx->status );
+
+  sc = rtems_event_receive(
+    EVENT_MEASURE,
+    RTEMS_EVENT_ALL | RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &ctx->events
+  );
+  T_quiet_rsc_success( sc );
+
+  return tic == toc;
+}
+
+static bool RtemsEventReqPerfSend_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsEventReqPerfSend_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Send an event to the runner.
+ */
+static void RtemsEventReqPerfReceive_Setup(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_send( RTEMS_SELF, EVENT_MEASURE );
+  T_quiet_rsc_success( sc );
+}
+
+static void RtemsEventReqPerfReceive_Setup_Wrap( void *arg )
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsEventReqPerfReceive_Setup( ctx );
+}
+
+/**
+ * @brief Receive the pending event.
+ */
+static void RtemsEventReqPerfReceive_Body(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_event_receive(
+    EVENT_MEASURE,
+    RTEMS_EVENT_ALL | RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &ctx->events
+  );
+}
+
+static void RtemsEventReqPerfReceive_Body_Wrap( void *arg )
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsEventReqPerfReceive_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the received events.
+ */
+static bool RtemsEventReqPerfReceive_Teardown(
+  RtemsEventValPerformance_Context *ctx,
+  T_ticks                          *delta,
+  uint32_t                          tic,
+  uint32_t                          toc,
+  unsigned int                      retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->events, EVENT_MEASURE );
+
+  return tic == toc;
+}
+
+static bool RtemsEventReqPerfReceive_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsEventReqPerfReceive_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Try to receive an event which is not pending.
+ */
+static void RtemsEventReqPerfReceiveNotSatisfied_Body(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_event_receive(
+    EVENT_MEASURE,
+    RTEMS_EVENT_ALL | RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &ctx->events
+  );
+}
+
+static void RtemsEventReqPerfReceiveNotSatisfied_Body_Wrap( void *arg )
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsEventReqPerfReceiveNotSatisfied_Body( ctx );
+}
+
+/**
+ * @brief Check the status code.
+ */
+static bool RtemsEventReqPerfReceiveNotSatisfied_Teardown(
+  RtemsEventValPerformance_Context *ctx,
+  T_ticks                          *delta,
+  uint32_t                          tic,
+  uint32_t                          toc,
+  unsigned int                      retry
+)
+{
+  T_quiet_rsc( ctx->status, RTEMS_UNSATISFIED );
+
+  return tic == toc;
+}
+
+static bool RtemsEventReqPerfReceiveNotSatisfied_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsEventReqPerfReceiveNotSatisfied_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Lower the worker priority below the runner priority.
+ */
+static void RtemsEventReqPerfSendOther_Prepare(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  SetPriority( ctx->worker_id, PRIO_LOW );
+}
+
+/**
+ * @brief Send an event to the waiting worker.  The worker is unblocked
+ *   without a thread dispatch.
+ */
+static void RtemsEventReqPerfSendOther_Body(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_event_send( ctx->worker_id, EVENT_MEASURE );
+}
+
+static void RtemsEventReqPerfSendOther_Body_Wrap( void *arg )
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsEventReqPerfSendOther_Body( ctx );
+}
+
+/**
+ * @brief Let the worker wait for the next event.
+ */
+static bool RtemsEventReqPerfSendOther_Teardown(
+  RtemsEventValPerformance_Context *ctx,
+  T_ticks                          *delta,
+  uint32_t                          tic,
+  uint32_t                          toc,
+  unsigned int                      retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  SetPriority( ctx->worker_id, PRIO_HIGH );
+  SetPriority( ctx->worker_id, PRIO_LOW );
+
+  return tic == toc;
+}
+
+static bool RtemsEventReqPerfSendOther_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsEventReqPerfSendOther_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Restore the worker priority.
+ */
+static void RtemsEventReqPerfSendOther_Cleanup(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  SetPriority( ctx->worker_id, PRIO_HIGH );
+}
+
+/**
+ * @brief Send an event to the waiting worker.  The worker preempts the
+ *   runner and waits for the next event.
+ */
+static void RtemsEventReqPerfSendPreempt_Body(
+  RtemsEventValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_event_send( ctx->worker_id, EVENT_MEASURE );
+}
+
+static void RtemsEventReqPerfSendPreempt_Body_Wrap( void *arg )
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsEventReqPerfSendPreempt_Body( ctx );
+}
+
+/**
+ * @brief Check the status code.
+ */
+static bool RtemsEventReqPerfSendPreempt_Teardown(
+  RtemsEventValPerformance_Context *ctx,
+  T_ticks                          *delta,
+  uint32_t                          tic,
+  uint32_t                          toc,
+  unsigned int                      retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsEventReqPerfSendPreempt_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsEventReqPerfSendPreempt_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @fn void T_case_body_RtemsEventValPerformance( void )
+ */
+T_TEST_CASE_FIXTURE(
+  RtemsEventValPerformance,
+  &RtemsEventValPerformance_Fixture
+)
+{
+  RtemsEventValPerformance_Context *ctx;
+
+  ctx = T_fixture_context();
+
+  ctx->request.name = "RtemsEventReqPerfSend";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsEventReqPerfSend_Body_Wrap;
+  ctx->request.teardown = RtemsEventReqPerfSend_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsEventReqPerfReceive";
+  ctx->request.setup = RtemsEventReqPerfReceive_Setup_Wrap;
+  ctx->request.body = RtemsEventReqPerfReceive_Body_Wrap;
+  ctx->request.teardown = RtemsEventReqPerfReceive_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsEventReqPerfReceiveNotSatisfied";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsEventReqPerfReceiveNotSatisfied_Body_Wrap;
+  ctx->request.teardown = RtemsEventReqPerfReceiveNotSatisfied_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  RtemsEventReqPerfSendOther_Prepare( ctx );
+  ctx->request.name = "RtemsEventReqPerfSendOther";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsEventReqPerfSendOther_Body_Wrap;
+  ctx->request.teardown = RtemsEventReqPerfSendOther_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+  RtemsEventReqPerfSendOther_Cleanup( ctx );
+
+  ctx->request.name = "RtemsEventReqPerfSendPreempt";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsEventReqPerfSendPreempt_Body_Wrap;
+  ctx->request.teardown = RtemsEventReqPerfSendPreempt_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+}
+
+/** @} */
@@ -0,0 +1,916 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSTestCaseRtemsMessageValPerformance
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tx-support.h"
+
+#include <rtems/test.h>
+
+/**
+ * @defgroup RTEMSTestCaseRtemsMessageValPerformance Message Manager performance
+ *
+ * @ingroup RTEMSTestSuiteTestsuitesPerformance0
+ *
+ * @brief This test case provides a context to run Message Manager
+ *   performance tests.
+ *
+ * @{
+ */
+
+#define MAXIMUM_MESSAGE_SIZE 1024
+
+static RTEMS_MESSAGE_QUEUE_BUFFER( MAXIMUM_MESSAGE_SIZE ) queue_storage[ 1 ];
+
+static RTEMS_MESSAGE_QUEUE_BUFFER( MAXIMUM_MESSAGE_SIZE )
+  worker_queue_storage[ 1 ];
+
+/**
+ * @brief Test context for the Message Manager performance test case.
+ */
+typedef struct {
+  /**
+   * @brief This member provides a message queue which has no receivers.
+   */
+  rtems_id queue_id;
+
+  /**
+   * @brief This member provides a message queue which has the worker as the
+   *   receiver.
+   */
+  rtems_id worker_queue_id;
+
+  /**
+   * @brief This member provides the worker task identifier.
+   */
+  rtems_id worker_id;
+
+  /**
+   * @brief This member provides a status code.
+   */
+  rtems_status_code status;
+
+  /**
+   * @brief This member provides the size of the message received by the
+   *   runner.
+   */
+  size_t size;
+
+  /**
+   * @brief This member provides the size of the message received by the
+   *   worker.
+   */
+  size_t worker_size;
+
+  /**
+   * @brief This member provides the message buffer of the runner.
+   */
+  long buffer[ MAXIMUM_MESSAGE_SIZE / sizeof( long ) ];
+
+  /**
+   * @brief This member provides the message buffer of the worker.
+   */
+  long worker_buffer[ MAXIMUM_MESSAGE_SIZE / sizeof( long ) ];
+
+  /**
+   * @brief This member references the measure runtime context.
+   */
+  T_measure_runtime_context *context;
+
+  /**
+   * @brief This member provides the measure runtime request.
+   */
+  T_measure_runtime_request request;
+} RtemsMessageValPerformance_Context;
+
+static RtemsMessageValPerformance_Context
+  RtemsMessageValPerformance_Instance;
+
+static void Worker( rtems_task_argument arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = (RtemsMessageValPerformance_Context *) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    sc = rtems_message_queue_receive(
+      ctx->worker_queue_id,
+      ctx->worker_buffer,
+      &ctx->worker_size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    T_quiet_rsc_success( sc );
+  }
+}
+
+static rtems_id CreateQueue( rtems_name name, void *storage, size_t size )
+{
+  rtems_status_code          sc;
+  rtems_message_queue_config config;
+  rtems_id                   id;
+
+  memset( &config, 0, sizeof( config ) );
+  config.name = name;
+  config.maximum_pending_messages = 1;
+  config.maximum_message_size = MAXIMUM_MESSAGE_SIZE;
+  config.storage_size = size;
+  config.storage_area = storage;
+  config.attributes = RTEMS_PRIORITY;
+
+  sc = rtems_message_queue_construct( &config, &id );
+  T_assert_rsc_success( sc );
+
+  return id;
+}
+
+static void RtemsMessageValPerformance_Setup_Context(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  T_measure_runtime_config config;
+
+  memset( &config, 0, sizeof( config ) );
+  config.sample_count = 1000;
+  ctx->request.arg = ctx;
+  ctx->context = T_measure_runtime_create( &config );
+  T_assert_not_null( ctx->context );
+}
+
+/**
+ * @brief Creates the test message queues and the worker task.
+ */
+static void RtemsMessageValPerformance_Setup(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  SetSelfPriority( PRIO_NORMAL );
+
+  ctx->queue_id = CreateQueue(
+    rtems_build_name( 'Q', 'U', 'E', 'U' ),
+    queue_storage,
+    sizeof( queue_storage )
+  );
+
+  ctx->worker_queue_id = CreateQueue(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    worker_queue_storage,
+    sizeof( worker_queue_storage )
+  );
+
+  ctx->worker_id = CreateTask( "WORK", PRIO_HIGH );
+  StartTask( ctx->worker_id, Worker, ctx );
+}
+
+static void RtemsMessageValPerformance_Setup_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageValPerformance_Setup_Context( ctx );
+  RtemsMessageValPerformance_Setup( ctx );
+}
+
+/**
+ * @brief Deletes the worker task and the test message queues.
+ */
+static void RtemsMessageValPerformance_Teardown(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  if ( ctx->worker_id != 0 ) {
+    DeleteTask( ctx->worker_id );
+  }
+
+  if ( ctx->worker_queue_id != 0 ) {
+    sc = rtems_message_queue_delete( ctx->worker_queue_id );
+    T_rsc_success( sc );
+  }
+
+  if ( ctx->queue_id != 0 ) {
+    sc = rtems_message_queue_delete( ctx->queue_id );
+    T_rsc_success( sc );
+  }
+
+  RestoreRunnerPriority();
+}
+
+static void RtemsMessageValPerformance_Teardown_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageValPerformance_Teardown( ctx );
+}
+
+static T_fixture RtemsMessageValPerformance_Fixture = {
+  .setup = RtemsMessageValPerformance_Setup_Wrap,
+  .stop = NULL,
+  .teardown = RtemsMessageValPerformance_Teardown_Wrap,
+  .scope = NULL,
+  .initial_context = &RtemsMessageValPerformance_Instance
+};
+
+/**
+ * @brief Send a message of 4 bytes to the empty message queue.
+ */
+static void RtemsMessageReqPerfSend4_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send( ctx->queue_id, ctx->buffer, 4 );
+}
+
+static void RtemsMessageReqPerfSend4_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSend4_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and receive the message.
+ */
+static bool RtemsMessageReqPerfSend4_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  rtems_status_code sc;
+  size_t            size;
+
+  T_quiet_rsc_success( ctx->status );
+
+  sc = rtems_message_queue_receive(
+    ctx->queue_id,
+    ctx->buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  T_quiet_rsc_success( sc );
+  T_quiet_eq_sz( size, 4 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSend4_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSend4_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Send a message of 4 bytes to the message queue.
+ */
+static void RtemsMessageReqPerfReceive4_Setup(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_send( ctx->queue_id, ctx->buffer, 4 );
+  T_quiet_rsc_success( sc );
+}
+
+static void RtemsMessageReqPerfReceive4_Setup_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceive4_Setup( ctx );
+}
+
+/**
+ * @brief Receive the pending message.
+ */
+static void RtemsMessageReqPerfReceive4_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_receive(
+    ctx->queue_id,
+    ctx->buffer,
+    &ctx->size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static void RtemsMessageReqPerfReceive4_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceive4_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the message size.
+ */
+static bool RtemsMessageReqPerfReceive4_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_sz( ctx->size, 4 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfReceive4_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfReceive4_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Send a message of 4 bytes to the waiting worker.  The worker
+ *   preempts the runner and waits for the next message.
+ */
+static void RtemsMessageReqPerfSendPreempt4_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send(
+    ctx->worker_queue_id,
+    ctx->buffer,
+    4
+  );
+}
+
+static void RtemsMessageReqPerfSendPreempt4_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSendPreempt4_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the message size.
+ */
+static bool RtemsMessageReqPerfSendPreempt4_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_sz( ctx->worker_size, 4 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSendPreempt4_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSendPreempt4_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Send a message of 64 bytes to the empty message queue.
+ */
+static void RtemsMessageReqPerfSend64_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send( ctx->queue_id, ctx->buffer, 64 );
+}
+
+static void RtemsMessageReqPerfSend64_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSend64_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and receive the message.
+ */
+static bool RtemsMessageReqPerfSend64_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  rtems_status_code sc;
+  size_t            size;
+
+  T_quiet_rsc_success( ctx->status );
+
+  sc = rtems_message_queue_receive(
+    ctx->queue_id,
+    ctx->buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  T_quiet_rsc_success( sc );
+  T_quiet_eq_sz( size, 64 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSend64_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSend64_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Send a message of 64 bytes to the message queue.
+ */
+static void RtemsMessageReqPerfReceive64_Setup(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_send( ctx->queue_id, ctx->buffer, 64 );
+  T_quiet_rsc_success( sc );
+}
+
+static void RtemsMessageReqPerfReceive64_Setup_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceive64_Setup( ctx );
+}
+
+/**
+ * @brief Receive the pending message.
+ */
+static void RtemsMessageReqPerfReceive64_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_receive(
+    ctx->queue_id,
+    ctx->buffer,
+    &ctx->size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static void RtemsMessageReqPerfReceive64_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceive64_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the message size.
+ */
+static bool RtemsMessageReqPerfReceive64_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_sz( ctx->size, 64 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfReceive64_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfReceive64_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Send a message of 64 bytes to the waiting worker.  The worker
+ *   preempts the runner and waits for the next message.
+ */
+static void RtemsMessageReqPerfSendPreempt64_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send(
+    ctx->worker_queue_id,
+    ctx->buffer,
+    64
+  );
+}
+
+static void RtemsMessageReqPerfSendPreempt64_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSendPreempt64_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the message size.
+ */
+static bool RtemsMessageReqPerfSendPreempt64_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_sz( ctx->worker_size, 64 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSendPreempt64_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSendPreempt64_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Send a message of 1024 bytes to the empty message queue.
+ */
+static void RtemsMessageReqPerfSend1024_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send( ctx->queue_id, ctx->buffer, 1024 );
+}
+
+static void RtemsMessageReqPerfSend1024_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSend1024_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and receive the message.
+ */
+static bool RtemsMessageReqPerfSend1024_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  rtems_status_code sc;
+  size_t            size;
+
+  T_quiet_rsc_success( ctx->status );
+
+  sc = rtems_message_queue_receive(
+    ctx->queue_id,
+    ctx->buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  T_quiet_rsc_success( sc );
+  T_quiet_eq_sz( size, 1024 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSend1024_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSend1024_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Send a message of 1024 bytes to the message queue.
+ */
+static void RtemsMessageReqPerfReceive1024_Setup(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_send( ctx->queue_id, ctx->buffer, 1024 );
+  T_quiet_rsc_success( sc );
+}
+
+static void RtemsMessageReqPerfReceive1024_Setup_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceive1024_Setup( ctx );
+}
+
+/**
+ * @brief Receive the pending message.
+ */
+static void RtemsMessageReqPerfReceive1024_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_receive(
+    ctx->queue_id,
+    ctx->buffer,
+    &ctx->size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static void RtemsMessageReqPerfReceive1024_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceive1024_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the message size.
+ */
+static bool RtemsMessageReqPerfReceive1024_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_sz( ctx->size, 1024 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfReceive1024_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfReceive1024_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Send a message of 1024 bytes to the waiting worker.  The worker
+ *   preempts the runner and waits for the next message.
+ */
+static void RtemsMessageReqPerfSendPreempt1024_Body(
+  RtemsMessageValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send(
+    ctx->worker_queue_id,
+    ctx->buffer,
+    1024
+  );
+}
+
+static void RtemsMessageReqPerfSendPreempt1024_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSendPreempt1024_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and the message size.
+ */
+static bool RtemsMessageReqPerfSendPreempt1024_Teardown(
+  RtemsMessageValPerformance_Context *ctx,
+  T_ticks                            *delta,
+  uint32_t                            tic,
+  uint32_t                            toc,
+  unsigned int                        retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_sz( ctx->worker_size, 1024 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSendPreempt1024_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSendPreempt1024_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @fn void T_case_body_RtemsMessageValPerformance( void )
+ */
+T_TEST_CASE_FIXTURE(
+  RtemsMessageValPerformance,
+  &RtemsMessageValPerformance_Fixture
+)
+{
+  RtemsMessageValPerformance_Context *ctx;
+
+  ctx = T_fixture_context();
+
+  ctx->request.name = "RtemsMessageReqPerfSend4";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSend4_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSend4_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfReceive4";
+  ctx->request.setup = RtemsMessageReqPerfReceive4_Setup_Wrap;
+  ctx->request.body = RtemsMessageReqPerfReceive4_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfReceive4_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfSendPreempt4";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSendPreempt4_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSendPreempt4_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfSend64";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSend64_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSend64_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfReceive64";
+  ctx->request.setup = RtemsMessageReqPerfReceive64_Setup_Wrap;
+  ctx->request.body = RtemsMessageReqPerfReceive64_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfReceive64_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfSendPreempt64";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSendPreempt64_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSendPreempt64_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfSend1024";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSend1024_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSend1024_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfReceive1024";
+  ctx->request.setup = RtemsMessageReqPerfReceive1024_Setup_Wrap;
+  ctx->request.body = RtemsMessageReqPerfReceive1024_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfReceive1024_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfSendPreempt1024";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSendPreempt1024_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSendPreempt1024_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+}
+
+/** @} */
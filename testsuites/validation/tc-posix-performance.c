@@ -0,0 +1,666 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSTestCasePosixValPerformance
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <rtems.h>
+
+#include "tx-support.h"
+
+#include <rtems/test.h>
+
+/**
+ * @defgroup RTEMSTestCasePosixValPerformance POSIX performance
+ *
+ * @ingroup RTEMSTestSuiteTestsuitesPerformance0
+ *
+ * @brief This test case provides a context to run POSIX mutex and
+ *   semaphore performance tests.
+ *
+ * @{
+ */
+
+#define EVENT_LOCK RTEMS_EVENT_0
+
+#define EVENT_UNLOCK RTEMS_EVENT_1
+
+#define EVENT_SEM_WAIT RTEMS_EVENT_2
+
+/**
+ * @brief Test context for the POSIX performance test case.
+ */
+typedef struct {
+  /**
+   * @brief This member provides a mutex with the default attributes.
+   */
+  pthread_mutex_t mutex;
+
+  /**
+   * @brief This member provides a semaphore with an initial value of one.
+   */
+  sem_t sem;
+
+  /**
+   * @brief This member provides a semaphore on which the worker waits.
+   */
+  sem_t worker_sem;
+
+  /**
+   * @brief This member provides the worker task identifier.
+   */
+  rtems_id worker_id;
+
+  /**
+   * @brief This member provides a return value.
+   */
+  int rv;
+
+  /**
+   * @brief This member references the measure runtime context.
+   */
+  T_measure_runtime_context *context;
+
+  /**
+   * @brief This member provides the measure runtime request.
+   */
+  T_measure_runtime_request request;
+} PosixValPerformance_Context;
+
+static PosixValPerformance_Context
+  PosixValPerformance_Instance;
+
+static void Worker( rtems_task_argument arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = (PosixValPerformance_Context *) arg;
+
+  while ( true ) {
+    rtems_event_set events;
+    int             rv;
+
+    events = ReceiveAnyEvents();
+
+    if ( ( events & EVENT_LOCK ) != 0 ) {
+      rv = pthread_mutex_lock( &ctx->mutex );
+      T_quiet_eq_int( rv, 0 );
+    }
+
+    if ( ( events & EVENT_UNLOCK ) != 0 ) {
+      rv = pthread_mutex_unlock( &ctx->mutex );
+      T_quiet_eq_int( rv, 0 );
+    }
+
+    if ( ( events & EVENT_SEM_WAIT ) != 0 ) {
+      rv = sem_wait( &ctx->worker_sem );
+      T_quiet_psx_success( rv );
+    }
+  }
+}
+
+static void PosixValPerformance_Setup_Context(
+  PosixValPerformance_Context *ctx
+)
+{
+  T_measure_runtime_config config;
+
+  memset( &config, 0, sizeof( config ) );
+  config.sample_count = 1000;
+  ctx->request.arg = ctx;
+  ctx->context = T_measure_runtime_create( &config );
+  T_assert_not_null( ctx->context );
+}
+
+/**
+ * @brief Initializes the test mutex and semaphores and creates the worker
+ *   task.
+ */
+static void PosixValPerformance_Setup(
+  PosixValPerformance_Context *ctx
+)
+{
+  int rv;
+
+  SetSelfPriority( PRIO_NORMAL );
+
+  rv = pthread_mutex_init( &ctx->mutex, NULL );
+  T_assert_eq_int( rv, 0 );
+
+  rv = sem_init( &ctx->sem, 0, 1 );
+  T_assert_psx_success( rv );
+
+  rv = sem_init( &ctx->worker_sem, 0, 0 );
+  T_assert_psx_success( rv );
+
+  ctx->worker_id = CreateTask( "WORK", PRIO_HIGH );
+  StartTask( ctx->worker_id, Worker, ctx );
+}
+
+static void PosixValPerformance_Setup_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixValPerformance_Setup_Context( ctx );
+  PosixValPerformance_Setup( ctx );
+}
+
+/**
+ * @brief Deletes the worker task and destroys the test mutex and
+ *   semaphores.
+ */
+static void PosixValPerformance_Teardown(
+  PosixValPerformance_Context *ctx
+)
+{
+  int rv;
+
+  if ( ctx->worker_id != 0 ) {
+    DeleteTask( ctx->worker_id );
+  }
+
+  rv = sem_destroy( &ctx->worker_sem );
+  T_psx_success( rv );
+
+  rv = sem_destroy( &ctx->sem );
+  T_psx_success( rv );
+
+  rv = pthread_mutex_destroy( &ctx->mutex );
+  T_eq_int( rv, 0 );
+
+  RestoreRunnerPriority();
+}
+
+static void PosixValPerformance_Teardown_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixValPerformance_Teardown( ctx );
+}
+
+static T_fixture PosixValPerformance_Fixture = {
+  .setup = PosixValPerformance_Setup_Wrap,
+  .stop = NULL,
+  .teardown = PosixValPerformance_Teardown_Wrap,
+  .scope = NULL,
+  .initial_context = &PosixValPerformance_Instance
+};
+
+/**
+ * @brief Lock the available mutex.
+ */
+static void PosixReqPerfMutexLock_Body(
+  PosixValPerformance_Context *ctx
+)
+{
+  ctx->rv = pthread_mutex_lock( &ctx->mutex );
+}
+
+static void PosixReqPerfMutexLock_Body_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfMutexLock_Body( ctx );
+}
+
+/**
+ * @brief Check the return value and unlock the mutex.
+ */
+static bool PosixReqPerfMutexLock_Teardown(
+  PosixValPerformance_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  int rv;
+
+  T_quiet_eq_int( ctx->rv, 0 );
+
+  rv = pthread_mutex_unlock( &ctx->mutex );
+  T_quiet_eq_int( rv, 0 );
+
+  return tic == toc;
+}
+
+static bool PosixReqPerfMutexLock_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  return PosixReqPerfMutexLock_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Lock the mutex.
+ */
+static void PosixReqPerfMutexUnlock_Setup(
+  PosixValPerformance_Context *ctx
+)
+{
+  int rv;
+
+  rv = pthread_mutex_lock( &ctx->mutex );
+  T_quiet_eq_int( rv, 0 );
+}
+
+static void PosixReqPerfMutexUnlock_Setup_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfMutexUnlock_Setup( ctx );
+}
+
+/**
+ * @brief Unlock the mutex.
+ */
+static void PosixReqPerfMutexUnlock_Body(
+  PosixValPerformance_Context *ctx
+)
+{
+  ctx->rv = pthread_mutex_unlock( &ctx->mutex );
+}
+
+static void PosixReqPerfMutexUnlock_Body_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfMutexUnlock_Body( ctx );
+}
+
+/**
+ * @brief Check the return value.
+ */
+static bool PosixReqPerfMutexUnlock_Teardown(
+  PosixValPerformance_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_eq_int( ctx->rv, 0 );
+
+  return tic == toc;
+}
+
+static bool PosixReqPerfMutexUnlock_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  return PosixReqPerfMutexUnlock_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Lock the mutex and let the worker wait for the mutex at a priority
+ *   higher than the runner priority.
+ */
+static void PosixReqPerfMutexUnlockPreempt_Setup(
+  PosixValPerformance_Context *ctx
+)
+{
+  int rv;
+
+  rv = pthread_mutex_lock( &ctx->mutex );
+  T_quiet_eq_int( rv, 0 );
+
+  SendEvents( ctx->worker_id, EVENT_LOCK );
+}
+
+static void PosixReqPerfMutexUnlockPreempt_Setup_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfMutexUnlockPreempt_Setup( ctx );
+}
+
+/**
+ * @brief Unlock the mutex.  The ownership is transferred to the worker
+ *   which preempts the runner.
+ */
+static void PosixReqPerfMutexUnlockPreempt_Body(
+  PosixValPerformance_Context *ctx
+)
+{
+  ctx->rv = pthread_mutex_unlock( &ctx->mutex );
+}
+
+static void PosixReqPerfMutexUnlockPreempt_Body_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfMutexUnlockPreempt_Body( ctx );
+}
+
+/**
+ * @brief Check the return value and let the worker unlock the mutex.
+ */
+static bool PosixReqPerfMutexUnlockPreempt_Teardown(
+  PosixValPerformance_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_eq_int( ctx->rv, 0 );
+
+  SendEvents( ctx->worker_id, EVENT_UNLOCK );
+
+  return tic == toc;
+}
+
+static bool PosixReqPerfMutexUnlockPreempt_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  return PosixReqPerfMutexUnlockPreempt_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Wait on the semaphore which has a positive value.
+ */
+static void PosixReqPerfSemWait_Body(
+  PosixValPerformance_Context *ctx
+)
+{
+  ctx->rv = sem_wait( &ctx->sem );
+}
+
+static void PosixReqPerfSemWait_Body_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfSemWait_Body( ctx );
+}
+
+/**
+ * @brief Check the return value and post the semaphore.
+ */
+static bool PosixReqPerfSemWait_Teardown(
+  PosixValPerformance_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  int rv;
+
+  T_quiet_psx_success( ctx->rv );
+
+  rv = sem_post( &ctx->sem );
+  T_quiet_psx_success( rv );
+
+  return tic == toc;
+}
+
+static bool PosixReqPerfSemWait_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  return PosixReqPerfSemWait_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Wait on the semaphore.
+ */
+static void PosixReqPerfSemPost_Setup(
+  PosixValPerformance_Context *ctx
+)
+{
+  int rv;
+
+  rv = sem_wait( &ctx->sem );
+  T_quiet_psx_success( rv );
+}
+
+static void PosixReqPerfSemPost_Setup_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfSemPost_Setup( ctx );
+}
+
+/**
+ * @brief Post the semaphore which has no waiting tasks.
+ */
+static void PosixReqPerfSemPost_Body(
+  PosixValPerformance_Context *ctx
+)
+{
+  ctx->rv = sem_post( &ctx->sem );
+}
+
+static void PosixReqPerfSemPost_Body_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfSemPost_Body( ctx );
+}
+
+/**
+ * @brief Check the return value.
+ */
+static bool PosixReqPerfSemPost_Teardown(
+  PosixValPerformance_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_psx_success( ctx->rv );
+
+  return tic == toc;
+}
+
+static bool PosixReqPerfSemPost_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  return PosixReqPerfSemPost_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Let the worker wait on the semaphore at a priority higher than the
+ *   runner priority.
+ */
+static void PosixReqPerfSemPostPreempt_Setup(
+  PosixValPerformance_Context *ctx
+)
+{
+  SendEvents( ctx->worker_id, EVENT_SEM_WAIT );
+}
+
+static void PosixReqPerfSemPostPreempt_Setup_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfSemPostPreempt_Setup( ctx );
+}
+
+/**
+ * @brief Post the semaphore.  The worker preempts the runner and waits for
+ *   the next request.
+ */
+static void PosixReqPerfSemPostPreempt_Body(
+  PosixValPerformance_Context *ctx
+)
+{
+  ctx->rv = sem_post( &ctx->worker_sem );
+}
+
+static void PosixReqPerfSemPostPreempt_Body_Wrap( void *arg )
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  PosixReqPerfSemPostPreempt_Body( ctx );
+}
+
+/**
+ * @brief Check the return value.
+ */
+static bool PosixReqPerfSemPostPreempt_Teardown(
+  PosixValPerformance_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_psx_success( ctx->rv );
+
+  return tic == toc;
+}
+
+static bool PosixReqPerfSemPostPreempt_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = arg;
+  return PosixReqPerfSemPostPreempt_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @fn void T_case_body_PosixValPerformance( void )
+ */
+T_TEST_CASE_FIXTURE(
+  PosixValPerformance,
+  &PosixValPerformance_Fixture
+)
+{
+  PosixValPerformance_Context *ctx;
+
+  ctx = T_fixture_context();
+
+  ctx->request.name = "PosixReqPerfMutexLock";
+  ctx->request.setup = NULL;
+  ctx->request.body = PosixReqPerfMutexLock_Body_Wrap;
+  ctx->request.teardown = PosixReqPerfMutexLock_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "PosixReqPerfMutexUnlock";
+  ctx->request.setup = PosixReqPerfMutexUnlock_Setup_Wrap;
+  ctx->request.body = PosixReqPerfMutexUnlock_Body_Wrap;
+  ctx->request.teardown = PosixReqPerfMutexUnlock_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "PosixReqPerfMutexUnlockPreempt";
+  ctx->request.setup = PosixReqPerfMutexUnlockPreempt_Setup_Wrap;
+  ctx->request.body = PosixReqPerfMutexUnlockPreempt_Body_Wrap;
+  ctx->request.teardown = PosixReqPerfMutexUnlockPreempt_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "PosixReqPerfSemWait";
+  ctx->request.setup = NULL;
+  ctx->request.body = PosixReqPerfSemWait_Body_Wrap;
+  ctx->request.teardown = PosixReqPerfSemWait_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "PosixReqPerfSemPost";
+  ctx->request.setup = PosixReqPerfSemPost_Setup_Wrap;
+  ctx->request.body = PosixReqPerfSemPost_Body_Wrap;
+  ctx->request.teardown = PosixReqPerfSemPost_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "PosixReqPerfSemPostPreempt";
+  ctx->request.setup = PosixReqPerfSemPostPreempt_Setup_Wrap;
+  ctx->request.body = PosixReqPerfSemPostPreempt_Body_Wrap;
+  ctx->request.teardown = PosixReqPerfSemPostPreempt_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+}
+
+/** @} */
@@ -0,0 +1,774 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSTestCaseRtemsSemValPerformance
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tx-support.h"
+
+#include <rtems/test.h>
+
+/**
+ * @defgroup RTEMSTestCaseRtemsSemValPerformance Semaphore Manager performance
+ *
+ * @ingroup RTEMSTestSuiteTestsuitesPerformance0
+ *
+ * @brief This test case provides a context to run Semaphore Manager
+ *   performance tests.
+ *
+ * @{
+ */
+
+#define EVENT_OBTAIN RTEMS_EVENT_0
+
+#define EVENT_RELEASE RTEMS_EVENT_1
+
+/**
+ * @brief Test context for the Semaphore Manager performance test case.
+ */
+typedef struct {
+  /**
+   * @brief This member provides a counting semaphore with a count of one.
+   */
+  rtems_id counting_id;
+
+  /**
+   * @brief This member provides a binary semaphore using the priority
+   *   inheritance locking protocol.
+   */
+  rtems_id mutex_id;
+
+  /**
+   * @brief This member provides the worker task identifier.
+   */
+  rtems_id worker_id;
+
+  /**
+   * @brief This member provides a status code.
+   */
+  rtems_status_code status;
+
+  /**
+   * @brief This member references the measure runtime context.
+   */
+  T_measure_runtime_context *context;
+
+  /**
+   * @brief This member provides the measure runtime request.
+   */
+  T_measure_runtime_request request;
+} RtemsSemValPerformance_Context;
+
+static RtemsSemValPerformance_Context
+  RtemsSemValPerformance_Instance;
+
+static void Worker( rtems_task_argument arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = (RtemsSemValPerformance_Context *) arg;
+
+  while ( true ) {
+    rtems_event_set   events;
+    rtems_status_code sc;
+
+    events = ReceiveAnyEvents();
+
+    if ( ( events & EVENT_OBTAIN ) != 0 ) {
+      sc = rtems_semaphore_obtain(
+        ctx->mutex_id,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      T_quiet_rsc_success( sc );
+    }
+
+    if ( ( events & EVENT_RELEASE ) != 0 ) {
+      sc = rtems_semaphore_release( ctx->mutex_id );
+      T_quiet_rsc_success( sc );
+    }
+  }
+}
+
+static void RtemsSemValPerformance_Setup_Context(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  T_measure_runtime_config config;
+
+  memset( &config, 0, sizeof( config ) );
+  config.sample_count = 1000;
+  ctx->request.arg = ctx;
+  ctx->context = T_measure_runtime_create( &config );
+  T_assert_not_null( ctx->context );
+}
+
+/**
+ * @brief Creates the test semaphores and the worker task.
+ */
+static void RtemsSemValPerformance_Setup(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  SetSelfPriority( PRIO_NORMAL );
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'C', 'N', 'T', ' ' ),
+    1,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->counting_id
+  );
+  T_assert_rsc_success( sc );
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'M', 'U', 'T', 'X' ),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &ctx->mutex_id
+  );
+  T_assert_rsc_success( sc );
+
+  ctx->worker_id = CreateTask( "WORK", PRIO_HIGH );
+  StartTask( ctx->worker_id, Worker, ctx );
+}
+
+static void RtemsSemValPerformance_Setup_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemValPerformance_Setup_Context( ctx );
+  RtemsSemValPerformance_Setup( ctx );
+}
+
+/**
+ * @brief Deletes the worker task and the test semaphores.
+ */
+static void RtemsSemValPerformance_Teardown(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  if ( ctx->worker_id != 0 ) {
+    DeleteTask( ctx->worker_id );
+  }
+
+  if ( ctx->mutex_id != 0 ) {
+    sc = rtems_semaphore_delete( ctx->mutex_id );
+    T_rsc_success( sc );
+  }
+
+  if ( ctx->counting_id != 0 ) {
+    sc = rtems_semaphore_delete( ctx->counting_id );
+    T_rsc_success( sc );
+  }
+
+  RestoreRunnerPriority();
+}
+
+static void RtemsSemValPerformance_Teardown_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemValPerformance_Teardown( ctx );
+}
+
+static T_fixture RtemsSemValPerformance_Fixture = {
+  .setup = RtemsSemValPerformance_Setup_Wrap,
+  .stop = NULL,
+  .teardown = RtemsSemValPerformance_Teardown_Wrap,
+  .scope = NULL,
+  .initial_context = &RtemsSemValPerformance_Instance
+};
+
+/**
+ * @brief Obtain the available counting semaphore.
+ */
+static void RtemsSemReqPerfSemObtain_Body(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_semaphore_obtain(
+    ctx->counting_id,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static void RtemsSemReqPerfSemObtain_Body_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfSemObtain_Body( ctx );
+}
+
+/**
+ * @brief Release the counting semaphore.
+ */
+static bool RtemsSemReqPerfSemObtain_Teardown(
+  RtemsSemValPerformance_Context *ctx,
+  T_ticks                        *delta,
+  uint32_t                        tic,
+  uint32_t                        toc,
+  unsigned int                    retry
+)
+{
+  rtems_status_code sc;
+
+  T_quiet_rsc_success( ctx->status );
+
+  sc = rtems_semaphore_release( ctx->counting_id );
+  T_quiet_rsc_success( sc );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfSemObtain_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfSemObtain_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Obtain the counting semaphore.
+ */
+static void RtemsSemReqPerfSemRelease_Setup(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain(
+    ctx->counting_id,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  T_quiet_rsc_success( sc );
+}
+
+static void RtemsSemReqPerfSemRelease_Setup_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfSemRelease_Setup( ctx );
+}
+
+/**
+ * @brief Release the counting semaphore.
+ */
+static void RtemsSemReqPerfSemRelease_Body(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_semaphore_release( ctx->counting_id );
+}
+
+static void RtemsSemReqPerfSemRelease_Body_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfSemRelease_Body( ctx );
+}
+
+/**
+ * @brief Check the status code.
+ */
+static bool RtemsSemReqPerfSemRelease_Teardown(
+  RtemsSemValPerformance_Context *ctx,
+  T_ticks                        *delta,
+  uint32_t                        tic,
+  uint32_t                        toc,
+  unsigned int                    retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfSemRelease_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfSemRelease_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Obtain the available mutex.
+ */
+static void RtemsSemReqPerfMtxObtain_Body(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_semaphore_obtain(
+    ctx->mutex_id,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static void RtemsSemReqPerfMtxObtain_Body_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxObtain_Body( ctx );
+}
+
+/**
+ * @brief Release the mutex.
+ */
+static bool RtemsSemReqPerfMtxObtain_Teardown(
+  RtemsSemValPerformance_Context *ctx,
+  T_ticks                        *delta,
+  uint32_t                        tic,
+  uint32_t                        toc,
+  unsigned int                    retry
+)
+{
+  rtems_status_code sc;
+
+  T_quiet_rsc_success( ctx->status );
+
+  sc = rtems_semaphore_release( ctx->mutex_id );
+  T_quiet_rsc_success( sc );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfMtxObtain_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfMtxObtain_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Obtain the mutex.
+ */
+static void RtemsSemReqPerfMtxRelease_Setup(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain( ctx->mutex_id, RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  T_quiet_rsc_success( sc );
+}
+
+static void RtemsSemReqPerfMtxRelease_Setup_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxRelease_Setup( ctx );
+}
+
+/**
+ * @brief Release the mutex.
+ */
+static void RtemsSemReqPerfMtxRelease_Body(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_semaphore_release( ctx->mutex_id );
+}
+
+static void RtemsSemReqPerfMtxRelease_Body_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxRelease_Body( ctx );
+}
+
+/**
+ * @brief Check the status code.
+ */
+static bool RtemsSemReqPerfMtxRelease_Teardown(
+  RtemsSemValPerformance_Context *ctx,
+  T_ticks                        *delta,
+  uint32_t                        tic,
+  uint32_t                        toc,
+  unsigned int                    retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfMtxRelease_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfMtxRelease_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Let the worker obtain the mutex.  Lower the worker priority so
+ *   that it releases the mutex only if the runner blocks.
+ */
+static void RtemsSemReqPerfMtxObtainWait_Setup(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  SendEvents( ctx->worker_id, EVENT_OBTAIN );
+  SetPriority( ctx->worker_id, PRIO_LOW );
+  SendEvents( ctx->worker_id, EVENT_RELEASE );
+}
+
+static void RtemsSemReqPerfMtxObtainWait_Setup_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxObtainWait_Setup( ctx );
+}
+
+/**
+ * @brief Obtain the mutex owned by the worker.  The runner blocks, the
+ *   worker releases the mutex, and the runner continues as the new
+ *   owner.
+ */
+static void RtemsSemReqPerfMtxObtainWait_Body(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_semaphore_obtain(
+    ctx->mutex_id,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static void RtemsSemReqPerfMtxObtainWait_Body_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxObtainWait_Body( ctx );
+}
+
+/**
+ * @brief Release the mutex and let the worker wait for the next request.
+ */
+static bool RtemsSemReqPerfMtxObtainWait_Teardown(
+  RtemsSemValPerformance_Context *ctx,
+  T_ticks                        *delta,
+  uint32_t                        tic,
+  uint32_t                        toc,
+  unsigned int                    retry
+)
+{
+  rtems_status_code sc;
+
+  T_quiet_rsc_success( ctx->status );
+
+  sc = rtems_semaphore_release( ctx->mutex_id );
+  T_quiet_rsc_success( sc );
+
+  SetPriority( ctx->worker_id, PRIO_HIGH );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfMtxObtainWait_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfMtxObtainWait_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Obtain the mutex and let the worker wait for the mutex at a
+ *   priority lower than the runner priority.
+ */
+static void RtemsSemReqPerfMtxReleaseOne_Setup(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain( ctx->mutex_id, RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  T_quiet_rsc_success( sc );
+
+  SendEvents( ctx->worker_id, EVENT_OBTAIN );
+  SetPriority( ctx->worker_id, PRIO_LOW );
+}
+
+static void RtemsSemReqPerfMtxReleaseOne_Setup_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxReleaseOne_Setup( ctx );
+}
+
+/**
+ * @brief Release the mutex.  The ownership is transferred to the worker
+ *   without a thread dispatch.
+ */
+static void RtemsSemReqPerfMtxReleaseOne_Body(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_semaphore_release( ctx->mutex_id );
+}
+
+static void RtemsSemReqPerfMtxReleaseOne_Body_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxReleaseOne_Body( ctx );
+}
+
+/**
+ * @brief Let the worker release the mutex.
+ */
+static bool RtemsSemReqPerfMtxReleaseOne_Teardown(
+  RtemsSemValPerformance_Context *ctx,
+  T_ticks                        *delta,
+  uint32_t                        tic,
+  uint32_t                        toc,
+  unsigned int                    retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  SendEvents( ctx->worker_id, EVENT_RELEASE );
+  SetPriority( ctx->worker_id, PRIO_HIGH );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfMtxReleaseOne_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfMtxReleaseOne_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Obtain the mutex and let the worker wait for the mutex at a
+ *   priority higher than the runner priority.
+ */
+static void RtemsSemReqPerfMtxReleasePreempt_Setup(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain( ctx->mutex_id, RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  T_quiet_rsc_success( sc );
+
+  SendEvents( ctx->worker_id, EVENT_OBTAIN );
+}
+
+static void RtemsSemReqPerfMtxReleasePreempt_Setup_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxReleasePreempt_Setup( ctx );
+}
+
+/**
+ * @brief Release the mutex.  The ownership is transferred to the worker
+ *   which preempts the runner.
+ */
+static void RtemsSemReqPerfMtxReleasePreempt_Body(
+  RtemsSemValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_semaphore_release( ctx->mutex_id );
+}
+
+static void RtemsSemReqPerfMtxReleasePreempt_Body_Wrap( void *arg )
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxReleasePreempt_Body( ctx );
+}
+
+/**
+ * @brief Let the worker release the mutex.
+ */
+static bool RtemsSemReqPerfMtxReleasePreempt_Teardown(
+  RtemsSemValPerformance_Context *ctx,
+  T_ticks                        *delta,
+  uint32_t                        tic,
+  uint32_t                        toc,
+  unsigned int                    retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  SendEvents( ctx->worker_id, EVENT_RELEASE );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfMtxReleasePreempt_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfMtxReleasePreempt_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @fn void T_case_body_RtemsSemValPerformance( void )
+ */
+T_TEST_CASE_FIXTURE(
+  RtemsSemValPerformance,
+  &RtemsSemValPerformance_Fixture
+)
+{
+  RtemsSemValPerformance_Context *ctx;
+
+  ctx = T_fixture_context();
+
+  ctx->request.name = "RtemsSemReqPerfSemObtain";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsSemReqPerfSemObtain_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfSemObtain_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfSemRelease";
+  ctx->request.setup = RtemsSemReqPerfSemRelease_Setup_Wrap;
+  ctx->request.body = RtemsSemReqPerfSemRelease_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfSemRelease_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfMtxObtain";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsSemReqPerfMtxObtain_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfMtxObtain_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfMtxRelease";
+  ctx->request.setup = RtemsSemReqPerfMtxRelease_Setup_Wrap;
+  ctx->request.body = RtemsSemReqPerfMtxRelease_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfMtxRelease_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfMtxObtainWait";
+  ctx->request.setup = RtemsSemReqPerfMtxObtainWait_Setup_Wrap;
+  ctx->request.body = RtemsSemReqPerfMtxObtainWait_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfMtxObtainWait_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfMtxReleaseOne";
+  ctx->request.setup = RtemsSemReqPerfMtxReleaseOne_Setup_Wrap;
+  ctx->request.body = RtemsSemReqPerfMtxReleaseOne_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfMtxReleaseOne_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfMtxReleasePreempt";
+  ctx->request.setup = RtemsSemReqPerfMtxReleasePreempt_Setup_Wrap;
+  ctx->request.body = RtemsSemReqPerfMtxReleasePreempt_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfMtxReleasePreempt_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+}
+
+/** @} */
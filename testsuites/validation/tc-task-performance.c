@@ -0,0 +1,386 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSTestCaseRtemsTaskValPerformance
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tx-support.h"
+
+#include <rtems/test.h>
+
+/**
+ * @defgroup RTEMSTestCaseRtemsTaskValPerformance Task Manager performance
+ *
+ * @ingroup RTEMSTestSuiteTestsuitesPerformance0
+ *
+ * @brief This test case provides a context to run Task Manager
+ *   performance tests.
+ *
+ * @{
+ */
+
+/**
+ * @brief Test context for the Task Manager performance test case.
+ */
+typedef struct {
+  /**
+   * @brief This member provides the worker task identifier.
+   */
+  rtems_id worker_id;
+
+  /**
+   * @brief This member provides a status code.
+   */
+  rtems_status_code status;
+
+  /**
+   * @brief This member references the measure runtime context.
+   */
+  T_measure_runtime_context *context;
+
+  /**
+   * @brief This member provides the measure runtime request.
+   */
+  T_measure_runtime_request request;
+} RtemsTaskValPerformance_Context;
+
+static RtemsTaskValPerformance_Context
+  RtemsTaskValPerformance_Instance;
+
+static void Worker( rtems_task_argument arg )
+{
+  (void) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+    T_quiet_rsc_success( sc );
+  }
+}
+
+static void RtemsTaskValPerformance_Setup_Context(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  T_measure_runtime_config config;
+
+  memset( &config, 0, sizeof( config ) );
+  config.sample_count = 1000;
+  ctx->request.arg = ctx;
+  ctx->context = T_measure_runtime_create( &config );
+  T_assert_not_null( ctx->context );
+}
+
+/**
+ * @brief Sets the runner priority.
+ */
+static void RtemsTaskValPerformance_Setup(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  SetSelfPriority( PRIO_NORMAL );
+}
+
+static void RtemsTaskValPerformance_Setup_Wrap( void *arg )
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTaskValPerformance_Setup_Context( ctx );
+  RtemsTaskValPerformance_Setup( ctx );
+}
+
+/**
+ * @brief Deletes the worker task and restores the runner priority.
+ */
+static void RtemsTaskValPerformance_Teardown(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  DeleteTask( ctx->worker_id );
+  RestoreRunnerPriority();
+}
+
+static void RtemsTaskValPerformance_Teardown_Wrap( void *arg )
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTaskValPerformance_Teardown( ctx );
+}
+
+static T_fixture RtemsTaskValPerformance_Fixture = {
+  .setup = RtemsTaskValPerformance_Setup_Wrap,
+  .stop = NULL,
+  .teardown = RtemsTaskValPerformance_Teardown_Wrap,
+  .scope = NULL,
+  .initial_context = &RtemsTaskValPerformance_Instance
+};
+
+/**
+ * @brief Yield the processor while no other task of the runner priority is
+ *   ready.
+ */
+static void RtemsTaskReqPerfYield_Body(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+}
+
+static void RtemsTaskReqPerfYield_Body_Wrap( void *arg )
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTaskReqPerfYield_Body( ctx );
+}
+
+/**
+ * @brief Check the status code.
+ */
+static bool RtemsTaskReqPerfYield_Teardown(
+  RtemsTaskValPerformance_Context *ctx,
+  T_ticks                         *delta,
+  uint32_t                         tic,
+  uint32_t                         toc,
+  unsigned int                     retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsTaskReqPerfYield_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsTaskReqPerfYield_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Create and start a worker with the runner priority which yields
+ *   the processor in a loop.
+ */
+static void RtemsTaskReqPerfYieldSwitch_Prepare(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  ctx->worker_id = CreateTask( "WORK", PRIO_NORMAL );
+  StartTask( ctx->worker_id, Worker, ctx );
+}
+
+/**
+ * @brief Yield the processor to the worker.  The worker yields the
+ *   processor back to the runner, so two task switches are measured.
+ */
+static void RtemsTaskReqPerfYieldSwitch_Body(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+}
+
+static void RtemsTaskReqPerfYieldSwitch_Body_Wrap( void *arg )
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTaskReqPerfYieldSwitch_Body( ctx );
+}
+
+/**
+ * @brief Check the status code.
+ */
+static bool RtemsTaskReqPerfYieldSwitch_Teardown(
+  RtemsTaskValPerformance_Context *ctx,
+  T_ticks                         *delta,
+  uint32_t                         tic,
+  uint32_t                         toc,
+  unsigned int                     retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsTaskReqPerfYieldSwitch_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsTaskReqPerfYieldSwitch_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Delete the worker.
+ */
+static void RtemsTaskReqPerfYieldSwitch_Cleanup(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  DeleteTask( ctx->worker_id );
+  ctx->worker_id = 0;
+}
+
+/**
+ * @brief Create a worker which is not started.
+ */
+static void RtemsTaskReqPerfSetPriority_Prepare(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  ctx->worker_id = CreateTask( "WORK", PRIO_LOW );
+}
+
+/**
+ * @brief Set the priority of the dormant worker.
+ */
+static void RtemsTaskReqPerfSetPriority_Body(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  rtems_task_priority previous;
+
+  ctx->status = rtems_task_set_priority(
+    ctx->worker_id,
+    PRIO_VERY_LOW,
+    &previous
+  );
+}
+
+static void RtemsTaskReqPerfSetPriority_Body_Wrap( void *arg )
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTaskReqPerfSetPriority_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and restore the worker priority.
+ */
+static bool RtemsTaskReqPerfSetPriority_Teardown(
+  RtemsTaskValPerformance_Context *ctx,
+  T_ticks                         *delta,
+  uint32_t                         tic,
+  uint32_t                         toc,
+  unsigned int                     retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  SetPriority( ctx->worker_id, PRIO_LOW );
+
+  return tic == toc;
+}
+
+static bool RtemsTaskReqPerfSetPriority_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsTaskReqPerfSetPriority_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Delete the worker.
+ */
+static void RtemsTaskReqPerfSetPriority_Cleanup(
+  RtemsTaskValPerformance_Context *ctx
+)
+{
+  DeleteTask( ctx->worker_id );
+  ctx->worker_id = 0;
+}
+
+/**
+ * @fn void T_case_body_RtemsTaskValPerformance( void )
+ */
+T_TEST_CASE_FIXTURE(
+  RtemsTaskValPerformance,
+  &RtemsTaskValPerformance_Fixture
+)
+{
+  RtemsTaskValPerformance_Context *ctx;
+
+  ctx = T_fixture_context();
+
+  ctx->request.name = "RtemsTaskReqPerfYield";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsTaskReqPerfYield_Body_Wrap;
+  ctx->request.teardown = RtemsTaskReqPerfYield_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  RtemsTaskReqPerfYieldSwitch_Prepare( ctx );
+  ctx->request.name = "RtemsTaskReqPerfYieldSwitch";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsTaskReqPerfYieldSwitch_Body_Wrap;
+  ctx->request.teardown = RtemsTaskReqPerfYieldSwitch_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+  RtemsTaskReqPerfYieldSwitch_Cleanup( ctx );
+
+  RtemsTaskReqPerfSetPriority_Prepare( ctx );
+  ctx->request.name = "RtemsTaskReqPerfSetPriority";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsTaskReqPerfSetPriority_Body_Wrap;
+  ctx->request.teardown = RtemsTaskReqPerfSetPriority_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+  RtemsTaskReqPerfSetPriority_Cleanup( ctx );
+}
+
+/** @} */
@@ -0,0 +1,402 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSTestCaseRtemsTimerValPerformance
+ */
+
+/*
+ * Copyright (C) 2021 The RTEMS Project Contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tx-support.h"
+
+#include <rtems/test.h>
+
+/**
+ * @defgroup RTEMSTestCaseRtemsTimerValPerformance Timer Manager performance
+ *
+ * @ingroup RTEMSTestSuiteTestsuitesPerformance0
+ *
+ * @brief This test case provides a context to run Timer Manager
+ *   performance tests.
+ *
+ * @{
+ */
+
+#define TIMER_INTERVAL 1000
+
+/**
+ * @brief Test context for the Timer Manager performance test case.
+ */
+typedef struct {
+  /**
+   * @brief This member provides the timer identifier.
+   */
+  rtems_id timer_id;
+
+  /**
+   * @brief This member provides a status code.
+   */
+  rtems_status_code status;
+
+  /**
+   * @brief This member references the measure runtime context.
+   */
+  T_measure_runtime_context *context;
+
+  /**
+   * @brief This member provides the measure runtime request.
+   */
+  T_measure_runtime_request request;
+} RtemsTimerValPerformance_Context;
+
+static RtemsTimerValPerformance_Context
+  RtemsTimerValPerformance_Instance;
+
+static void TimerRoutine( rtems_id id, void *arg )
+{
+  (void) id;
+  (void) arg;
+}
+
+static void FireAfter( const RtemsTimerValPerformance_Context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_fire_after(
+    ctx->timer_id,
+    TIMER_INTERVAL,
+    TimerRoutine,
+    NULL
+  );
+  T_quiet_rsc_success( sc );
+}
+
+static void Cancel( const RtemsTimerValPerformance_Context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_cancel( ctx->timer_id );
+  T_quiet_rsc_success( sc );
+}
+
+static void RtemsTimerValPerformance_Setup_Context(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  T_measure_runtime_config config;
+
+  memset( &config, 0, sizeof( config ) );
+  config.sample_count = 1000;
+  ctx->request.arg = ctx;
+  ctx->context = T_measure_runtime_create( &config );
+  T_assert_not_null( ctx->context );
+}
+
+/**
+ * @brief Creates the test timer.
+ */
+static void RtemsTimerValPerformance_Setup(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_create(
+    rtems_build_name( 'T', 'I', 'M', 'E' ),
+    &ctx->timer_id
+  );
+  T_assert_rsc_success( sc );
+}
+
+static void RtemsTimerValPerformance_Setup_Wrap( void *arg )
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTimerValPerformance_Setup_Context( ctx );
+  RtemsTimerValPerformance_Setup( ctx );
+}
+
+/**
+ * @brief Deletes the test timer.
+ */
+static void RtemsTimerValPerformance_Teardown(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  rtems_status_code sc;
+
+  if ( ctx->timer_id != 0 ) {
+    sc = rtems_timer_delete( ctx->timer_id );
+    T_rsc_success( sc );
+  }
+}
+
+static void RtemsTimerValPerformance_Teardown_Wrap( void *arg )
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTimerValPerformance_Teardown( ctx );
+}
+
+static T_fixture RtemsTimerValPerformance_Fixture = {
+  .setup = RtemsTimerValPerformance_Setup_Wrap,
+  .stop = NULL,
+  .teardown = RtemsTimerValPerformance_Teardown_Wrap,
+  .scope = NULL,
+  .initial_context = &RtemsTimerValPerformance_Instance
+};
+
+/**
+ * @brief Fire the inactive timer after an interval.
+ */
+static void RtemsTimerReqPerfFireAfter_Body(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_timer_fire_after(
+    ctx->timer_id,
+    TIMER_INTERVAL,
+    TimerRoutine,
+    NULL
+  );
+}
+
+static void RtemsTimerReqPerfFireAfter_Body_Wrap( void *arg )
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTimerReqPerfFireAfter_Body( ctx );
+}
+
+/**
+ * @brief Check the status code and cancel the timer.
+ */
+static bool RtemsTimerReqPerfFireAfter_Teardown(
+  RtemsTimerValPerformance_Context *ctx,
+  T_ticks                          *delta,
+  uint32_t                          tic,
+  uint32_t                          toc,
+  unsigned int                      retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  Cancel( ctx );
+
+  return tic == toc;
+}
+
+static bool RtemsTimerReqPerfFireAfter_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsTimerReqPerfFireAfter_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Fire the timer after an interval.
+ */
+static void RtemsTimerReqPerfReset_Prepare(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  FireAfter( ctx );
+}
+
+/**
+ * @brief Reset the active timer.
+ */
+static void RtemsTimerReqPerfReset_Body(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_timer_reset( ctx->timer_id );
+}
+
+static void RtemsTimerReqPerfReset_Body_Wrap( void *arg )
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTimerReqPerfReset_Body( ctx );
+}
+
+/**
+ * @brief Check the status code.
+ */
+static bool RtemsTimerReqPerfReset_Teardown(
+  RtemsTimerValPerformance_Context *ctx,
+  T_ticks                          *delta,
+  uint32_t                          tic,
+  uint32_t                          toc,
+  unsigned int                      retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsTimerReqPerfReset_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsTimerReqPerfReset_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Cancel the timer.
+ */
+static void RtemsTimerReqPerfReset_Cleanup(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  Cancel( ctx );
+}
+
+/**
+ * @brief Fire the timer after an interval.
+ */
+static void RtemsTimerReqPerfCancel_Setup(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  FireAfter( ctx );
+}
+
+static void RtemsTimerReqPerfCancel_Setup_Wrap( void *arg )
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTimerReqPerfCancel_Setup( ctx );
+}
+
+/**
+ * @brief Cancel the active timer.
+ */
+static void RtemsTimerReqPerfCancel_Body(
+  RtemsTimerValPerformance_Context *ctx
+)
+{
+  ctx->status = rtems_timer_cancel( ctx->timer_id );
+}
+
+static void RtemsTimerReqPerfCancel_Body_Wrap( void *arg )
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  RtemsTimerReqPerfCancel_Body( ctx );
+}
+
+/**
+ * @brief Check the status code.
+ */
+static bool RtemsTimerReqPerfCancel_Teardown(
+  RtemsTimerValPerformance_Context *ctx,
+  T_ticks                          *delta,
+  uint32_t                          tic,
+  uint32_t                          toc,
+  unsigned int                      retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsTimerReqPerfCancel_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = arg;
+  return RtemsTimerReqPerfCancel_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @fn void T_case_body_RtemsTimerValPerformance( void )
+ */
+T_TEST_CASE_FIXTURE(
+  RtemsTimerValPerformance,
+  &RtemsTimerValPerformance_Fixture
+)
+{
+  RtemsTimerValPerformance_Context *ctx;
+
+  ctx = T_fixture_context();
+
+  ctx->request.name = "RtemsTimerReqPerfFireAfter";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsTimerReqPerfFireAfter_Body_Wrap;
+  ctx->request.teardown = RtemsTimerReqPerfFireAfter_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  RtemsTimerReqPerfReset_Prepare( ctx );
+  ctx->request.name = "RtemsTimerReqPerfReset";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsTimerReqPerfReset_Body_Wrap;
+  ctx->request.teardown = RtemsTimerReqPerfReset_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+  RtemsTimerReqPerfReset_Cleanup( ctx );
+
+  ctx->request.name = "RtemsTimerReqPerfCancel";
+  ctx->request.setup = RtemsTimerReqPerfCancel_Setup_Wrap;
+  ctx->request.body = RtemsTimerReqPerfCancel_Body_Wrap;
+  ctx->request.teardown = RtemsTimerReqPerfCancel_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+}
+
+/** @} */